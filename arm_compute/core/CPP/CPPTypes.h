@@ -227,6 +227,7 @@ struct ThreadInfo
     int            thread_id{ 0 };
     int            num_threads{ 1 };
     const CPUInfo *cpu_info{ nullptr };
+    CPUModel       cpu_model{ CPUModel::GENERIC };
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPP_TYPES_H__ */
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel to run a depthwise convolution immediately followed by a 1x1 pointwise convolution.
+ *
+ * For every output row the kernel computes a tile of depthwise outputs (all the channels of a few pixels) into a
+ * per-thread buffer which fits in the L1 cache and consumes it straight away in the pointwise matrix multiplication,
+ * so the intermediate tensor is never written to memory.
+ *
+ * @note Only NHWC data layout and a depth multiplier of 1 are supported
+ */
+class NEDepthwiseSeparableConvolutionLayerKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDepthwiseSeparableConvolutionLayerKernel";
+    }
+    /** Default constructor */
+    NEDepthwiseSeparableConvolutionLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayerKernel(const NEDepthwiseSeparableConvolutionLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayerKernel &operator=(const NEDepthwiseSeparableConvolutionLayerKernel &) = delete;
+    /** Default Move Constructor. */
+    NEDepthwiseSeparableConvolutionLayerKernel(NEDepthwiseSeparableConvolutionLayerKernel &&) = default;
+    /** Default move assignment operator */
+    NEDepthwiseSeparableConvolutionLayerKernel &operator=(NEDepthwiseSeparableConvolutionLayerKernel &&) = default;
+    /** Initialize the kernel's inputs, output and workspace.
+     *
+     * @param[in]  input               Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                                 while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32.
+     * @param[in]  depthwise_weights   Depthwise convolution weights tensor. These are 3D tensors with dimensions [IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  depthwise_biases    Depthwise biases tensor. Biases are 1D tensor with dimensions [IFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  pointwise_weights   Pointwise convolution weights tensor. These are 4D tensors with dimensions [IFM, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pointwise_biases    Pointwise biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output              Destination tensor. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                                 Data types supported: Same as @p input.
+     * @param[in]  workspace           Workspace tensor. Its shape must be the one returned by @ref compute_workspace_shape. Data type supported: Same as @p input.
+     * @param[in]  depthwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for the depthwise convolution.
+     * @param[in]  depthwise_act_info  (Optional) Activation applied to the depthwise output. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in]  pointwise_act_info  (Optional) Activation applied to the pointwise output. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in]  dilation            (Optional) Dilation, in elements, across x and y of the depthwise convolution. Defaults to (1, 1).
+     */
+    void configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights, const ITensor *pointwise_biases,
+                   ITensor *output, ITensor *workspace, const PadStrideInfo &depthwise_conv_info,
+                   const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U));
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayerKernel
+     *
+     * @param[in] input               Source tensor info. Data types supported: F16/F32.
+     * @param[in] depthwise_weights   Depthwise convolution weights tensor info. Data type supported: Same as @p input.
+     * @param[in] depthwise_biases    Depthwise biases tensor info. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] pointwise_weights   Pointwise convolution weights tensor info. Data type supported: Same as @p input.
+     * @param[in] pointwise_biases    Pointwise biases tensor info. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output              Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] depthwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for the depthwise convolution.
+     * @param[in] depthwise_act_info  (Optional) Activation applied to the depthwise output.
+     * @param[in] pointwise_act_info  (Optional) Activation applied to the pointwise output.
+     * @param[in] dilation            (Optional) Dilation, in elements, across x and y of the depthwise convolution. Defaults to (1, 1).
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                           const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info,
+                           const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo(),
+                           const Size2D &dilation = Size2D(1U, 1U));
+    /** Compute the shape of the workspace needed by the kernel
+     *
+     * @param[in] input        Source tensor info.
+     * @param[in] output_width Width of the destination tensor.
+     * @param[in] num_threads  Number of threads the kernel will be run with.
+     *
+     * @return The shape of the workspace: one buffer of depthwise outputs per thread
+     */
+    static TensorShape compute_workspace_shape(const ITensorInfo *input, unsigned int output_width, unsigned int num_threads);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised depthwise separable functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about the executing thread.
+     */
+    using DepthwiseSeparableFunctionPtr = void (NEDepthwiseSeparableConvolutionLayerKernel::*)(const Window &window, const ThreadInfo &info);
+
+    /** Function to run the fused convolutions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about the executing thread.
+     */
+    template <typename T>
+    void depthwise_separable(const Window &window, const ThreadInfo &info);
+
+    DepthwiseSeparableFunctionPtr _func;
+    const ITensor                *_input;
+    const ITensor                *_depthwise_weights;
+    const ITensor                *_depthwise_biases;
+    const ITensor                *_pointwise_weights;
+    const ITensor                *_pointwise_biases;
+    ITensor                      *_output;
+    ITensor                      *_workspace;
+    PadStrideInfo                 _depthwise_conv_info;
+    ActivationLayerInfo           _depthwise_act_info;
+    ActivationLayerInfo           _pointwise_act_info;
+    Size2D                        _dilation;
+    unsigned int                  _tile_width;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__ */
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDYNAMICQUANTIZATIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEDYNAMICQUANTIZATIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the dynamic quantization layer kernel.
+ *
+ * Each row of the input matrix is quantized to S8 with its own symmetric scale, computed at run time:
+ *
+ *  -# scale = max(|input[x]|) / 127 (1 if the row is all zeros)
+ *  -# output[x] = round(input[x] / scale), rounding half away from zero
+ *
+ * The product of two matrices quantized this way is obtained by running an 8 bit GEMM and scaling
+ * each element of its S32 result by the scales of its row and column, see @ref NEGEMMLowpDynamicDequantizeKernel.
+ */
+class NEDynamicQuantizationLayerKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDynamicQuantizationLayerKernel";
+    }
+    /** Default constructor */
+    NEDynamicQuantizationLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDynamicQuantizationLayerKernel(const NEDynamicQuantizationLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDynamicQuantizationLayerKernel &operator=(const NEDynamicQuantizationLayerKernel &) = delete;
+    /** Default Move Constructor. */
+    NEDynamicQuantizationLayerKernel(NEDynamicQuantizationLayerKernel &&) = default;
+    /** Default move assignment operator */
+    NEDynamicQuantizationLayerKernel &operator=(NEDynamicQuantizationLayerKernel &&) = default;
+    /** Default destructor */
+    ~NEDynamicQuantizationLayerKernel() = default;
+    /** Set the input, output and scales.
+     *
+     * @param[in]  input  Source tensor with at most 2 dimensions. Data types supported: F32.
+     * @param[out] output Destination tensor with the same dimensions of input. Data types supported: S8/QASYMM8_SIGNED (with a zero offset).
+     * @param[out] scales 1D tensor with one scale per row of @p input. Data types supported: F32.
+     */
+    void configure(const ITensor *input, ITensor *output, ITensor *scales);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDynamicQuantizationLayerKernel
+     *
+     * @param[in] input  Source tensor info with at most 2 dimensions. Data types supported: F32.
+     * @param[in] output Destination tensor info with the same dimensions of input. Data types supported: S8/QASYMM8_SIGNED (with a zero offset).
+     * @param[in] scales 1D tensor info with one scale per row of @p input. Data types supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *scales);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    ITensor       *_scales;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEDYNAMICQUANTIZATIONLAYERKERNEL_H__ */
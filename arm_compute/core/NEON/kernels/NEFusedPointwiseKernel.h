@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDPOINTWISEKERNEL_H__
+#define __ARM_COMPUTE_NEFUSEDPOINTWISEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to run a chain of pointwise operations in a single pass.
+ *
+ * Every element of the input is loaded once, goes through all the operations of the chain
+ * and is stored once, so no intermediate tensor is written to memory.
+ *
+ * The supported operations are @ref PointwiseOperation::Type::ADD, @ref PointwiseOperation::Type::SUB,
+ * @ref PointwiseOperation::Type::REVERSE_SUB, @ref PointwiseOperation::Type::MUL,
+ * @ref PointwiseOperation::Type::SCALE_SHIFT and @ref PointwiseOperation::Type::ACTIVATION.
+ */
+class NEFusedPointwiseKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFusedPointwiseKernel";
+    }
+    /** Default constructor */
+    NEFusedPointwiseKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedPointwiseKernel(const NEFusedPointwiseKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedPointwiseKernel &operator=(const NEFusedPointwiseKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEFusedPointwiseKernel(NEFusedPointwiseKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEFusedPointwiseKernel &operator=(NEFusedPointwiseKernel &&) = default;
+    /** Default destructor */
+    ~NEFusedPointwiseKernel() = default;
+    /** Set the input, operands and output of the kernel.
+     *
+     * @param[in]  input      Source tensor. Data types supported: F32.
+     * @param[in]  operands   Operands of the operations. Data types supported: Same as @p input.
+     *                        Elementwise operands have the same shape as @p input, scale and shift operands are
+     *                        1D tensors with size equal to the channels of @p input.
+     * @param[out] output     Destination tensor. Data types supported: Same as @p input. Can be @p input for in-place computation.
+     * @param[in]  operations Chain of operations to apply, in order. Batch normalizations must be converted to scale and shift operations.
+     */
+    void configure(const ITensor *input, const std::vector<const ITensor *> &operands, ITensor *output, const std::vector<PointwiseOperation> &operations);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedPointwiseKernel
+     *
+     * @param[in] input      Source tensor info. Data types supported: F32.
+     * @param[in] operands   Operands of the operations. Data types supported: Same as @p input.
+     *                       Elementwise operands have the same shape as @p input, scale and shift operands are
+     *                       1D tensors with size equal to the channels of @p input.
+     * @param[in] output     Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] operations Chain of operations to apply, in order. Batch normalizations must be converted to scale and shift operations.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const ITensorInfo *output, const std::vector<PointwiseOperation> &operations);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor                  *_input;
+    std::vector<const ITensor *>    _operands;
+    ITensor                        *_output;
+    std::vector<PointwiseOperation> _operations;
+    size_t                          _channel_idx;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEFUSEDPOINTWISEKERNEL_H__ */
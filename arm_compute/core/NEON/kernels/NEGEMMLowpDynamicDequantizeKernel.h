@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMLOWPDYNAMICDEQUANTIZEKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMLOWPDYNAMICDEQUANTIZEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel used to dequantize the int32 accumulator values of a GEMM between two dynamically quantized matrices to F32
+ *
+ * The matrices are quantized by @ref NEDynamicQuantizationLayerKernel: the rows of matrix A and the columns of matrix B have
+ * their own symmetric scale. The following computations will be performed by the kernel:
+ *
+ *  -# Convert each entry of input to F32 and multiply it by the scale of its row and the scale of its column
+ *  -# Add bias to final result if bias tensor is not a nullptr
+ */
+class NEGEMMLowpDynamicDequantizeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMMLowpDynamicDequantizeKernel";
+    }
+    /** Constructor */
+    NEGEMMLowpDynamicDequantizeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers)*/
+    NEGEMMLowpDynamicDequantizeKernel(const NEGEMMLowpDynamicDequantizeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers)*/
+    NEGEMMLowpDynamicDequantizeKernel &operator=(const NEGEMMLowpDynamicDequantizeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMLowpDynamicDequantizeKernel(NEGEMMLowpDynamicDequantizeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMLowpDynamicDequantizeKernel &operator=(NEGEMMLowpDynamicDequantizeKernel &&) = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input      Input tensor with at most 2 dimensions. Data type supported: S32
+     * @param[in]  row_scales 1D tensor with the scales of the rows of matrix A. Data type supported: F32
+     * @param[in]  col_scales 1D tensor with the scales of the columns of matrix B. Data type supported: F32
+     * @param[in]  bias       Biases tensor. Only shared biases supported and it can be a nullptr if the biases addition is not required.
+     *                        Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
+     * @param[out] output     Output tensor. Data type supported: F32
+     */
+    void configure(const ITensor *input, const ITensor *row_scales, const ITensor *col_scales, const ITensor *bias, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMLowpDynamicDequantizeKernel
+     *
+     * @param[in] input      Input tensor info with at most 2 dimensions. Data type supported: S32
+     * @param[in] row_scales 1D tensor info with the scales of the rows of matrix A. Data type supported: F32
+     * @param[in] col_scales 1D tensor info with the scales of the columns of matrix B. Data type supported: F32
+     * @param[in] bias       Biases tensor info. Only shared biases supported and it can be a nullptr if the biases addition is not required.
+     *                       Biases are 1D tensor with dimensions [OFM]. Data type supported: F32
+     * @param[in] output     Output tensor info. Data type supported: F32
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *row_scales, const ITensorInfo *col_scales, const ITensorInfo *bias, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_row_scales;
+    const ITensor *_col_scales;
+    const ITensor *_bias;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEGEMMLOWPDYNAMICDEQUANTIZEKERNEL_H__ */
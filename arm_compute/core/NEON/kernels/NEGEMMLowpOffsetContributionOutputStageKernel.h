@@ -47,6 +47,11 @@ class ITensor;
  *
  * (FixedPointMul(mm_result'[i][k], result_fixedpoint_multiplier) >> result_shift) + result_offset_after_shift
  *
+ * If the output stage is quantized per channel, result_fixedpoint_multiplier and result_shift are replaced by
+ * the multiplier and the shift of the output channel k.
+ *
+ * The result is saturated to the range of the output data type, i.e. [0, 255] for QASYMM8 and [-128, 127] for QASYMM8_SIGNED.
+ *
  * where FixedPointMul(x, y) is the nearest integer to the following
  * mathematical expression, evaluated without overflow or intermediate rounding:
  *
@@ -83,7 +88,7 @@ public:
      * @param[in]  vector_sum_row Input row-vector of sums of all the entries in each row of matrix A.
      * @param[in]  bias           Biases tensor. Only shared biases supported and it can be a nullptr if the addition of biases is not required.
      *                            Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p mm_result.
-     * @param[out] output         Output tensor containing the final quantized result. Data type supported: QASYMM8
+     * @param[out] output         Output tensor containing the final quantized result. Data type supported: QASYMM8/QASYMM8_SIGNED
      * @param[in]  k              Number of matrix A columns or Matrix B rows
      * @param[in]  a_offset       Offset to be added to each element of the matrix A.
      * @param[in]  b_offset       Offset to be added to each element of the matrix B.
@@ -100,7 +105,7 @@ public:
      *                           Note: vector_sum_row can be a nullptr in case b_offset = 0. Data type supported: same as @p mm_result
      * @param[in] bias           Biases tensor info. Only shared biases supported and it can be a nullptr if the addition of biases is not required.
      *                           Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p mm_result.
-     * @param[in] output         Output tensor info containing the final quantized result. Data type supported: QASYMM8
+     * @param[in] output         Output tensor info containing the final quantized result. Data type supported: QASYMM8/QASYMM8_SIGNED
      * @param[in] a_offset       Offset to be added to each element of the matrix A.
      * @param[in] b_offset       Offset to be added to each element of the matrix B.
      * @param[in] output_stage   GEMMLowp output stage info, providing the type of quantization and the necessary parameters.
@@ -115,7 +120,7 @@ public:
     void run(const Window &window, const ThreadInfo &info) override;
 
     using NEGEMMLowpOffsetContributionOutputStageFunction = std::function<void(const Window, const ITensor *, const ITensor *, const ITensor *, const ITensor *,
-                                                                               ITensor *, int32_t, int32_t, int32_t, bool, GEMMLowpOutputStageInfo)>;
+                                                                               ITensor *, int32_t, int32_t, int32_t, bool, const GEMMLowpOutputStageInfo &)>;
 
 private:
     /** Function to use for the particular tensors passed to configure() */
@@ -28,13 +28,13 @@
 #include "arm_compute/core/NEON/kernels/convolution/common/convolution.hpp"
 #include "arm_compute/core/NEON/kernels/convolution/common/tensor.hpp"
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_layer.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_quantized.hpp"
 
 namespace arm_compute
 {
 class ITensor;
 
 /** Interface for the NEON kernel to perform Winograd input transform. */
-template <typename T>
 class INEWinogradLayerTransformInputKernel : public INEKernel
 {
 public:
@@ -49,7 +49,7 @@ public:
      */
     virtual unsigned int get_working_space_size(unsigned int num_threads) const = 0;
 
-    /** Determine how much memory (in units of TIn) to allocate for the
+    /** Determine how much memory (in units of the transformed data type) to allocate for the
      * transformed input.
      *
      * @param[in] num_batches  Number of batches in the input tensor.
@@ -58,7 +58,7 @@ public:
      * @param[in] num_cols     Number of columns in each feature map.
      * @param[in] same_padding Use "SAME" padding, otherwise use "VALID".
      *
-     * @return Storage size (in units of TIn) required.
+     * @return Storage size (in units of the transformed data type) required.
      */
     virtual unsigned int get_input_storage_size(int num_batches, int num_channels, int num_rows, int num_cols, bool same_padding) const = 0;
 
@@ -95,7 +95,7 @@ public:
 
 /** NEON kernel to perform Winograd input transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel<T>
+class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -159,7 +159,7 @@ public:
 
     /** Configure the output transform kernel.
      *
-     * @param[in]  input_nhwc    Input tensor.  Data types supported: F32. Layout supported NHWC.
+     * @param[in]  input_nhwc    Input tensor.  Data types supported: F16/F32. Layout supported NHWC.
      * @param[in]  num_batches   Number of batches in input tensor.
      * @param[in]  num_rows      Number of rows in input tensor.
      * @param[in]  num_cols      Number of columns in input tensor.
@@ -190,7 +190,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformInputKernel
      *
-     * @param[in] input         First tensor input info. Data types supported: F32.
+     * @param[in] input         First tensor input info. Data types supported: F16/F32.
      * @param[in] output        Output tensor info. Data types supported: same as @p input.
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
@@ -218,7 +218,6 @@ private:
 };
 
 /** Interface for the NEON kernel to perform Winograd output transform. */
-template <typename T>
 class INEWinogradLayerTransformOutputKernel : public INEKernel
 {
 public:
@@ -234,7 +233,7 @@ public:
      */
     virtual unsigned int get_working_space_size(unsigned int num_threads) const = 0;
 
-    /** Determine how much memory (in units of TOut) to allocate for the
+    /** Determine how much memory (in units of the transformed data type) to allocate for the
      * (Winograd domain) output.
      *
      * @param[in] num_batches         Number of batches in the output tensor.
@@ -243,7 +242,7 @@ public:
      * @param[in] num_output_channels Number of feature maps in the output tensor.
      * @param[in] same_padding        Use "SAME" padding, otherwise use "VALID".
      *
-     * @return Storage size (in units of TOut) required.
+     * @return Storage size (in units of the transformed data type) required.
      */
     virtual unsigned int get_output_storage_size(int num_batches, int num_rows, int num_cols, int num_output_channels, bool same_padding) const = 0;
 
@@ -297,7 +296,7 @@ public:
 
 /** NEON kernel to perform Winograd output transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel<T>
+class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel
 {
 public:
     const char *name() const override
@@ -390,7 +389,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputKernel
      *
-     * @param[in] input         Source tensor info with shape [C, N, 16, batches] or [C, N, 36, batches]. Data types supported: F32.
+     * @param[in] input         Source tensor info with shape [C, N, 16, batches] or [C, N, 36, batches]. Data types supported: F16/F32.
      * @param[in] bias          Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. It can be a nullptr. Data type supported: as @p input
      * @param[in] output        Destination tensor info with shape [output_convolved_dims.width, output_convolved_dims.height, C, batches]. Data type supported: same as @p input
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
@@ -418,7 +417,6 @@ private:
 };
 
 /** Interface for the NEON kernel to perform Winograd weights transform. */
-template <typename T>
 class INEWinogradLayerTransformWeightsKernel : public INEKernel
 {
 public:
@@ -437,13 +435,13 @@ public:
     virtual ~INEWinogradLayerTransformWeightsKernel()
     {
     }
-    /** Determine how much memory (in units of T) to allocate for the
+    /** Determine how much memory (in units of the transformed data type) to allocate for the
      * transformed weights.
      *
      * @param[in] num_output_channels Number of output feature maps.
      * @param[in] num_input_channels  Number of input feature maps.
      *
-     * @return Storage size (in units of T) required.
+     * @return Storage size (in units of the transformed data type) required.
      */
     virtual unsigned int get_weight_storage_size(int num_output_channels, int num_input_channels) const = 0;
     /** Gets the stride between matrices in the kernel worspace
@@ -467,7 +465,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
-     * @param[in] input   First tensor input info. Data types supported: F32.
+     * @param[in] input   First tensor input info. Data types supported: QASYMM8/F16/F32.
      * @param[in] weights Weights tensor info. Data types supported: same as @p input.
      *
      * @return a status
@@ -477,7 +475,7 @@ public:
 
 /** NEON kernel to perform Winograd weights transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel<T>
+class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -501,7 +499,7 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
      * @param[in] input         Source tensor info. The input is a 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM] (NCHW data layout).
-     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: F32.
+     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: F16/F32.
      * @param[in] output        Destination tensor info. The output is a 3D tensor with dimensions [OFM, IFM, 16] or [OFM, IFM, 36]. Data type supported: same as @p input
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
@@ -556,6 +554,210 @@ private:
     int                               _num_input_channels;
 };
 
+/** NEON kernel to perform the quantized Winograd F(2x2, 3x3) input transform.
+ *
+ * The QASYMM8 input is offset by its zero point and transformed into S16 matrices.
+ */
+class NEWinogradLayerTransformInputKernelQASYMM8 final : public INEWinogradLayerTransformInputKernel
+{
+public:
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformInputKernelQASYMM8(const NEWinogradLayerTransformInputKernelQASYMM8 &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformInputKernelQASYMM8 &operator=(const NEWinogradLayerTransformInputKernelQASYMM8 &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformInputKernelQASYMM8(NEWinogradLayerTransformInputKernelQASYMM8 &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformInputKernelQASYMM8 &operator=(NEWinogradLayerTransformInputKernelQASYMM8 &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformInputKernelQASYMM8() = default;
+    /** Default constructor */
+    NEWinogradLayerTransformInputKernelQASYMM8();
+
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformInputKernelQASYMM8";
+    }
+
+    // Inherited methods overridden:
+    unsigned int get_input_storage_size(int num_batches, int num_channels, int num_rows, int num_cols, bool same_padding) const override;
+    unsigned int get_working_space_size(unsigned int num_threads) const override;
+    int get_matrix_stride(const KernelShape &kernel_shape, const Tensor4DShape &input_shape, const PaddingType padding_type) const override;
+    void run(const Window &window, const ThreadInfo &info) override;
+
+    /** Configure the input transform kernel.
+     *
+     * @param[in]  input_nhwc    Input tensor. Data types supported: QASYMM8. Layout supported NHWC.
+     * @param[in]  num_batches   Number of batches in input tensor.
+     * @param[in]  num_rows      Number of rows in input tensor.
+     * @param[in]  num_cols      Number of columns in input tensor.
+     * @param[in]  num_channels  Number of channels in input tensor.
+     * @param[in]  padding       Padding type.
+     * @param[out] output        Base of output matrices. Data type supported: S16.
+     * @param[in]  matrix_stride Stride between output matrices.
+     * @param[in]  workspace     Tensor to be used as the working space during the computation.
+     */
+    void configure(const ITensor *input_nhwc, const int num_batches, const int num_rows, const int num_cols, const int num_channels,
+                   const PaddingType padding, ITensor *output, const int matrix_stride, ITensor *workspace) override;
+
+    /** Winograd base kernel */
+    using WinogradBase = winograd::WinogradGEMM<2, 2, 3, 3, winograd::WinogradRoots::Integers>;
+    /** Winograd convolution kernel */
+    using WinogradConv = WinogradBase::Convolution<uint8_t, uint8_t, int16_t, int32_t>;
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformInputKernelQASYMM8
+     *
+     * @param[in] input         First tensor input info. Data types supported: QASYMM8.
+     * @param[in] output        Output tensor info. Data types supported: S16.
+     * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info);
+
+private:
+    std::unique_ptr<winograd::QAsymm8InputTransform> _transform{ nullptr };
+    const ITensor                                   *_input_nhwc;
+    int                                              _num_channels;  /**< Number of channels in input tensor. */
+    ITensor                                         *_output;        /**< Base of output matrices. */
+    int                                              _matrix_stride; /**< Stride between output matrices. */
+    ITensor                                         *_workspace;
+};
+
+/** NEON kernel to perform the quantized Winograd F(2x2, 3x3) output transform.
+ *
+ * The S32 GEMM results are transformed back to the spatial domain, the S32 biases are added and the
+ * result is requantized to the output's QASYMM8 quantization info.
+ */
+class NEWinogradLayerTransformOutputKernelQASYMM8 final : public INEWinogradLayerTransformOutputKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformOutputKernelQASYMM8";
+    }
+    /** Constructor */
+    NEWinogradLayerTransformOutputKernelQASYMM8();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformOutputKernelQASYMM8(const NEWinogradLayerTransformOutputKernelQASYMM8 &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformOutputKernelQASYMM8 &operator=(const NEWinogradLayerTransformOutputKernelQASYMM8 &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformOutputKernelQASYMM8(NEWinogradLayerTransformOutputKernelQASYMM8 &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformOutputKernelQASYMM8 &operator=(NEWinogradLayerTransformOutputKernelQASYMM8 &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformOutputKernelQASYMM8() = default;
+
+    // Inherited methods overridden:
+    unsigned int get_output_storage_size(int num_batches, int num_rows, int num_cols, int num_output_channels, bool same_padding) const override;
+    int get_matrix_stride(const KernelShape &kernel_shape, const Tensor4DShape &input_shape, const PaddingType padding_type) const override;
+    Tensor4DShape get_output_shape(const KernelShape &kernel_shape, const Tensor4DShape &in_shape, const PaddingType padding) const override;
+    unsigned int get_working_space_size(unsigned int num_threads) const override;
+    void run(const Window &window, const ThreadInfo &info) override;
+
+    /** Configure the output transform kernel.
+     *
+     * @note The quantization info of @p transformed_output must hold the product of the input and weights scales.
+     *
+     * @param[in]  biases             Pointer to the biases tensor. Data type supported: S32.
+     * @param[in]  transformed_output Pointer to working space for the output tensor in the Winograd domain. Data type supported: S32.
+     * @param[in]  matrix_stride      Output matrix stride, can be computed with @ref get_matrix_stride
+     * @param[out] output_nhwc        Pointer to a tensor with NHWC data layout, in the spatial domain. Data type supported: QASYMM8.
+     * @param[in]  num_batches        Number of batches in the input tensor.
+     * @param[in]  num_rows           Number of rows in output tensor.
+     * @param[in]  num_cols           Number of columns in output tensor.
+     * @param[in]  num_channels       Number of feature maps in the output tensor.
+     * @param[in]  workspace          Tensor to be used as the working space during the computation.
+     */
+    void configure(const ITensor *biases, const ITensor *transformed_output, const int matrix_stride, ITensor *output_nhwc,
+                   const int num_batches, const int num_rows, const int num_cols, const int num_channels, ITensor *workspace) override;
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputKernelQASYMM8
+     *
+     * @param[in] input         Source tensor info with shape [C, N, 16, batches]. Data types supported: S32.
+     * @param[in] bias          Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. It can be a nullptr. Data type supported: S32
+     * @param[in] output        Destination tensor info with shape [output_convolved_dims.width, output_convolved_dims.height, C, batches]. Data type supported: QASYMM8
+     * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const WinogradInfo &winograd_info);
+
+private:
+    using WinogradConv = NEWinogradLayerTransformInputKernelQASYMM8::WinogradConv;
+
+    std::unique_ptr<winograd::QAsymm8OutputTransform> _transform{ nullptr };
+    const ITensor                                    *_biases;
+    const ITensor                                    *_transformed_output;
+    ITensor                                          *_workspace;
+    int                                               _matrix_stride;
+    int                                               _matrix_row_stride;
+    ITensor                                          *_output_nhwc;
+};
+
+/** NEON kernel to perform the quantized Winograd F(2x2, 3x3) weights transform.
+ *
+ * The QASYMM8 weights are offset by their zero point and transformed into S16 matrices.
+ */
+class NEWinogradLayerTransformWeightsKernelQASYMM8 final : public INEWinogradLayerTransformWeightsKernel
+{
+public:
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformWeightsKernelQASYMM8(const NEWinogradLayerTransformWeightsKernelQASYMM8 &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformWeightsKernelQASYMM8 &operator=(const NEWinogradLayerTransformWeightsKernelQASYMM8 &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformWeightsKernelQASYMM8(NEWinogradLayerTransformWeightsKernelQASYMM8 &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformWeightsKernelQASYMM8 &operator=(NEWinogradLayerTransformWeightsKernelQASYMM8 &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformWeightsKernelQASYMM8() = default;
+    /** Default constructor. */
+    NEWinogradLayerTransformWeightsKernelQASYMM8();
+
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformWeightsKernelQASYMM8";
+    }
+
+    // Inherited methods overridden:
+    unsigned int get_weight_storage_size(int num_output_channels, int num_input_channels) const override;
+    int get_matrix_stride(const KernelShape &kernel_shape) const override;
+    void run(const Window &window, const ThreadInfo &info) override;
+    bool is_parallelisable() const override;
+
+    /** Configure the weights transform kernel.
+     *
+     * @param[in]  weights_hwio        Pointer to the weights tensor. Data type supported: QASYMM8.
+     * @param[out] output              Pointer to working space for the output tensor in the Winograd domain. Data type supported: S16.
+     * @param[in]  matrix_stride       Stride across matrices in the output workspace.
+     * @param[in]  num_output_channels Number of filters.
+     * @param[in]  num_input_channels  Number of channels in each filter.
+     */
+    void configure(const ITensor *weights_hwio, ITensor *output, const int matrix_stride, const int num_output_channels, const int num_input_channels) override;
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernelQASYMM8
+     *
+     * @param[in] input         Source tensor info. The input is a 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM] (NCHW data layout).
+     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: QASYMM8.
+     * @param[in] output        Destination tensor info. The output is a 3D tensor with dimensions [OFM, IFM, 16]. Data type supported: S16
+     * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info);
+
+private:
+    using WinogradConv = NEWinogradLayerTransformInputKernelQASYMM8::WinogradConv;
+
+    std::unique_ptr<winograd::QAsymm8WeightTransform> _transform{ nullptr };
+    const ITensor                                    *_weights_hwio;
+    ITensor                                          *_output;
+    int                                               _matrix_stride;
+    int                                               _num_output_channels;
+};
+
 /** NEON kernel to perform Winograd. */
 template <typename TIn, typename TOut, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 class NEWinogradLayerConfiguration
@@ -572,5 +774,20 @@ public:
     using TransformOutputKernel  = NEWinogradLayerTransformOutputKernel<TOut, OutputTileRows, OutputTileCols, KernelRows, KernelCols>;
 };
 
+/** Quantized Winograd F(2x2, 3x3) configuration. */
+template <>
+class NEWinogradLayerConfiguration<uint8_t, uint8_t, 2, 2, 3, 3>
+{
+public:
+    /** Winograd base kernel */
+    using WinogradBase = NEWinogradLayerTransformInputKernelQASYMM8::WinogradBase;
+    /** Winograd convolution kernel */
+    using WinogradConv = NEWinogradLayerTransformInputKernelQASYMM8::WinogradConv;
+
+    using TransformInputKernel   = NEWinogradLayerTransformInputKernelQASYMM8;
+    using TransformWeightsKernel = NEWinogradLayerTransformWeightsKernelQASYMM8;
+    using TransformOutputKernel  = NEWinogradLayerTransformOutputKernelQASYMM8;
+};
+
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMMWINOGRADCONVOLUTIONLAYERKERNEL_H__*/
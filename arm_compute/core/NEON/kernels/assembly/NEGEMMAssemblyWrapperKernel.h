@@ -77,7 +77,8 @@ public:
         ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
         auto first = window.x().start();
         auto last  = window.x().end();
-        _kernel->execute(first, last, info.thread_id);
+        // Select the micro-kernel for the core the calling thread runs on
+        _kernel->execute_for_model(first, last, info.thread_id, info.cpu_model);
     }
     /** Initialise the kernel's input and output.
      *
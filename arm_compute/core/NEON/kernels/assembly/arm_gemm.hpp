@@ -63,6 +63,62 @@ struct GemmConfig
     GemmConfig() { }
 };
 
+/* Indirect A matrix: rather than being read with a fixed row stride, each
+ * row of A is gathered through a table of offsets (e.g. the input pixels
+ * covered by a convolution window, which avoids materializing an im2col
+ * matrix).
+ *
+ * Each row is made of Ksize / chunk_size chunks of chunk_size contiguous
+ * elements.  Chunk 'c' of row 'm' of batch 'b' starts at offset
+ * offsets[((b % table_batches) * Msize + m) * (Ksize / chunk_size) + c]
+ * from the A pointer of batch 'b / table_batches' (i.e. the A batch stride
+ * is the stride between groups of table_batches batches).  A negative
+ * offset denotes a chunk of zeroes (padding).
+ *
+ * Only the interleaved GEMMs support indirect A, the table must outlive
+ * the GEMM object. */
+struct IndirectParams
+{
+    const int    *offsets       = nullptr;
+    unsigned int  chunk_size    = 0;
+    unsigned int  table_batches = 1;
+
+    IndirectParams(const int *o, unsigned int c, unsigned int b) : offsets(o), chunk_size(c), table_batches(b) { }
+    IndirectParams() { }
+};
+
+/* Convolution A matrix: A is the im2col matrix of a planar (NCHW) input,
+ * which is never materialized.  Blocks of its rows are computed from the
+ * input by each thread while preparing its A panels.
+ *
+ * Row 'm' of batch 'b' is the im2col row of output pixel (m % output_width,
+ * m / output_width) of the image at the A pointer of batch 'b'.  Column 'k'
+ * is kernel position (k % kernel_width, (k / kernel_width) %
+ * kernel_height) of channel k / (kernel_width * kernel_height), or 1 for
+ * the last column if has_bias_column is set.  Out of bounds positions read
+ * zeroes.  Strides are in elements.
+ *
+ * Only the interleaved GEMMs support convolution A matrices, the parameters
+ * must outlive the GEMM object (they can be updated between executions). */
+struct ConvolutionParameters
+{
+    unsigned int input_width     = 0;
+    unsigned int input_height    = 0;
+    unsigned int input_channels  = 0;
+    unsigned int kernel_width    = 0;
+    unsigned int kernel_height   = 0;
+    unsigned int output_width    = 0;
+    unsigned int stride_w        = 1;
+    unsigned int stride_h        = 1;
+    unsigned int dilation_w      = 1;
+    unsigned int dilation_h      = 1;
+    unsigned int padding_left    = 0;
+    unsigned int padding_top     = 0;
+    int          row_stride      = 0;
+    int          channel_stride  = 0;
+    bool         has_bias_column = false;
+};
+
 template<typename T>
 struct GemmArgs
 {
@@ -80,6 +136,8 @@ public:
     int               _maxthreads;
     bool              _pretransposed_hint;
     const GemmConfig *_cfg;
+    const IndirectParams *_indirect = nullptr;
+    const ConvolutionParameters *_convolution = nullptr;
 
     GemmArgs(const CPUInfo *ci, const unsigned int M, const unsigned int N,
              const unsigned int K, const unsigned int nbatches,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,11 +26,13 @@
 /* This file is used to configure integration-specific aspects of arm_gemm into ACL */
 
 #include "arm_compute/core/CPP/CPPTypes.h"
+#include "support/Bfloat16.h"
 
 namespace arm_gemm
 {
 using CPUModel = arm_compute::CPUModel;
 using CPUInfo  = arm_compute::CPUInfo;
+using bfloat16 = arm_compute::bfloat16;
 } // namespace arm_compute
 
 
@@ -25,6 +25,8 @@
 
 #include <cstddef>
 
+#include "arm_gemm_local.hpp"
+
 namespace arm_gemm {
 
 // Abstract class for the GEMM/GEMV functions.
@@ -74,6 +76,14 @@ public:
      * buffers, and a start/end range to indicate which work to do.  */
     virtual void execute(unsigned int, unsigned int, int) = 0;
 
+    /* Do the work on a thread running on a core of the given model.  GEMMs
+     * whose kernel depends on the core (e.g. on big.LITTLE systems) select
+     * it from this model rather than from the core the calling thread
+     * happens to run on.  The default implementation ignores the model. */
+    virtual void execute_for_model(unsigned int start, unsigned int end, int threadid, CPUModel) {
+        execute(start, end, threadid);
+    }
+
     /*** Working space interface (optional) ***/
     /* Total number of bytes of temporary working space needed.  If zero, it's not necessary to call set_working_space(). */
     virtual size_t get_working_size() const { return 0; }
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/depthwise.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/common/qasymm8.hpp"
+
+namespace depthwise
+{
+
+namespace nck = neon_convolution_kernels;
+
+/** Depthwise convolution engine for arbitrary kernel sizes, strides and
+ * dilations.
+ *
+ * Unlike `DepthwiseConvolutionBase` the geometry of the convolution is a
+ * run-time property of the engine. Each tile computes a row of
+ * `output_tile_cols` output pixels; the inputs each output pixel reads are
+ * described by an array of pointers (one per kernel tap and output column)
+ * which is built by the engine, pointing padded taps at a buffer of padding
+ * values. The tile implementation (provided by `Derived`) therefore only
+ * needs to multiply and accumulate vectors of channels.
+ *
+ * Packed parameters are stored channel-minor: the biases for all channels
+ * followed by the weights of each kernel tap for all channels.
+ */
+template <typename TIn, typename TBias, typename TOut, typename Derived>
+class DepthwiseConvolutionGenericBase : public IDepthwiseConvolution
+{
+  public:
+    using InputType = TIn;
+    using BiasType = TBias;
+    using OutputType = TOut;
+    static constexpr int output_tile_cols = 4;
+
+    /** Create a new depthwise convolution engine.
+     *
+     * @param[in] n_batches Number of batches tensors.
+     * @param[in] n_input_rows Number of rows in input tensor.
+     * @param[in] n_input_cols Number of columns in input tensor.
+     * @param[in] n_channels Number of channels in input and output tensors.
+     * @param[in] kernel_rows Number of rows in the kernel.
+     * @param[in] kernel_cols Number of columns in the kernel.
+     * @param[in] stride_rows Stride between rows of the kernel.
+     * @param[in] stride_cols Stride between columns of the kernel.
+     * @param[in] dilation_rows Dilation between rows of the kernel.
+     * @param[in] dilation_cols Dilation between columns of the kernel.
+     */
+    DepthwiseConvolutionGenericBase(
+      int n_batches, int n_input_rows, int n_input_cols, int n_channels,
+      int kernel_rows, int kernel_cols,
+      int stride_rows, int stride_cols,
+      int dilation_rows, int dilation_cols,
+      nck::ActivationFunction activation,
+      unsigned int padding_top,
+      unsigned int padding_left,
+      unsigned int padding_bottom,
+      unsigned int padding_right
+    );
+
+    // Cannot copy or move a DepthwiseConvolution.
+    DepthwiseConvolutionGenericBase(DepthwiseConvolutionGenericBase&) = delete;
+    DepthwiseConvolutionGenericBase operator=(DepthwiseConvolutionGenericBase&) = delete;
+
+    /* Set input tensor and stride. */
+    void set_input(const void *inptr) override;
+    void set_input(const void *inptr, int column_stride) override;
+    void set_input(const void *inptr, int row_stride, int column_stride) override;
+    void set_input(const void *inptr, int batch_stride, int row_stride, int column_stride) override;
+
+    /* Set output tensor and stride. */
+    void set_output(void *outptr) override;
+    void set_output(void *outptr, int column_stride) override;
+    void set_output(void *outptr, int row_stride, int column_stride) override;
+    void set_output(void *outptr, int batch_stride, int row_stride, int column_stride) override;
+
+    /** Get the number of output rows/columns.
+     *
+     * @param[in] dim_size Number of elements in the dimension (rows/columns)
+     * @param[in] padding_before Padding before the first element.
+     * @param[in] padding_after Padding after the last element.
+     * @param[in] kernel_size Size of the kernel in the dimension.
+     * @param[in] stride Stride of the kernel in the dimension.
+     * @param[in] dilation Dilation of the kernel in the dimension.
+     */
+    static int get_output_size(
+      int dim_size, unsigned int padding_before, unsigned int padding_after,
+      int kernel_size, int stride, int dilation
+    );
+
+    /** Get the number of output rows (the geometry of the rows is used). */
+    int output_size(
+      int dim_size, unsigned int padding_before, unsigned int padding_after
+    ) const override;
+
+    /* Determine how much memory is required to store the packed weights and
+     * biases.
+     */
+    size_t get_packed_params_size(void) const override;
+
+    /* Set the buffer for the packed weights and biases, and perform the
+     * packing.
+     */
+    void set_packed_params_buffer(void *buffer) override;
+
+    void pack_params(const void *weights, const void *biases=nullptr) const override;
+
+    void pack_params(
+      void *buffer,
+      const void *weights,
+      const void *biases=nullptr
+    ) const override;
+
+    void pack_params(
+      void *buffer,
+      const void *weights,
+      unsigned int weight_row_stride,
+      unsigned int weight_col_stride,
+      const void *biases=nullptr
+    ) const override;
+
+    /** Query the amount of working space required.
+     * @param[in] The largest number of threads which will be used to execute
+     *            the kernel.
+     */
+    size_t get_working_space_size(unsigned int n_threads=1) const override;
+
+    /** Set the working space buffer.
+     */
+    void set_working_space(void *buffer) override;
+
+    /** Get the window of work to be performed by an instance of the operator.
+     */
+    unsigned int get_window(void) const override;
+
+    /** Perform a portion of the work associated with the operator.
+     *
+     * Will perform the window of work described by $[start, stop)$.
+     *
+     * @param[in] start Start of the window of work to perform.
+     * @param[in] stop End of the work to perform.
+     * @param[in] ID of the thread performing the work.
+     */
+    void run(
+      unsigned int start,
+      unsigned int stop,
+      unsigned int threadid=0
+    ) override;
+
+  protected:
+    /** Get the value to use to pad the tensor.
+     */
+    TIn _input_padding_value(void) const;
+
+    /** Size of the packed parameters stored for each channel.
+     */
+    size_t _get_packed_params_per_channel_size(void) const;
+
+    /** Default implementation of the parameter packing.
+     */
+    void _pack_params(
+      void *buffer,
+      const void *weights,
+      unsigned int weight_row_stride,
+      unsigned int weight_col_stride,
+      const void *biases=nullptr
+    ) const;
+
+    /** Compute a row of output pixels.
+     *
+     * @param[in] channel_start First channel to compute.
+     * @param[in] n_channels Number of channels to compute.
+     * @param[in] packed_params Start of the packed parameter buffer.
+     * @param[in] inptrs Pointers to the input (channel 0) read by each kernel
+     *                   tap for each output column, indexed by
+     *                   `(tap * output_tile_cols) + column`.
+     * @param[in] outptrs Pointers to the output (channel 0) of each column.
+     */
+    template <nck::ActivationFunction Activation>
+    void execute_tile(
+      int channel_start,
+      int n_channels,
+      const void* packed_params,
+      const InputType* const* inptrs,
+      OutputType* const* outptrs
+    );
+
+    int n_channels(void) const;
+    int kernel_rows(void) const;
+    int kernel_cols(void) const;
+
+  private:
+    const InputType* _input;
+    OutputType* _output;
+    void* _packed_parameters;
+    void* _working_space;  // Per-thread working space
+    const int _n_batches, _n_input_rows, _n_input_cols, _n_channels;
+    const int _kernel_rows, _kernel_cols, _stride_rows, _stride_cols;
+    const int _dilation_rows, _dilation_cols;
+    const int _n_output_rows, _n_output_cols;
+    const unsigned int _padding_top, _padding_left, _padding_bottom, _padding_right;
+    const nck::ActivationFunction _activation;
+
+    // Stride information for a convolution instance
+    int _input_col_stride, _input_row_stride, _input_batch_stride;
+    int _output_col_stride, _output_row_stride, _output_batch_stride;
+
+    /** Process a row of output tiles for a block of channels. */
+    template <nck::ActivationFunction Activation>
+    void process_row(
+      unsigned int threadid,
+      int channel_start,
+      int n_channels,
+      int batch,
+      int out_i
+    );
+
+    // Methods for getting access to working space
+    size_t _get_working_space_size_per_thread(void) const;
+    void *_get_input_working_space(unsigned int threadid) const;
+    void *_get_output_working_space(unsigned int threadid) const;
+    const TIn **_get_input_pointers(unsigned int threadid) const;
+    TOut **_get_output_pointers(unsigned int threadid) const;
+};
+
+
+template <typename TIn, typename TBias, typename TOut>
+class DepthwiseConvolutionGeneric : public DepthwiseConvolutionGenericBase<
+  TIn, TBias, TOut, DepthwiseConvolutionGeneric<TIn, TBias, TOut>
+>
+{
+  using Base = DepthwiseConvolutionGenericBase<
+    TIn, TBias, TOut, DepthwiseConvolutionGeneric<TIn, TBias, TOut>
+  >;
+  friend Base;
+  using InputType = typename Base::InputType;
+  using OutputType = typename Base::OutputType;
+
+  public:
+    using Base::DepthwiseConvolutionGenericBase;
+
+  protected:
+    template <nck::ActivationFunction Activation>
+    void execute_tile(
+      int channel_start,
+      int n_channels,
+      const void* packed_params,
+      const InputType* const* inptrs,
+      OutputType* const* outptrs
+    );
+};
+
+
+/** Generic QASYMM8 depthwise convolution.
+ *
+ * The packed parameters of each channel hold the bias and the requantization
+ * multiplier and shift, so that every channel may be requantized with its own
+ * parameters.
+ */
+class QAsymm8DepthwiseConvolutionGeneric : public DepthwiseConvolutionGenericBase<
+  uint8_t, int32_t, uint8_t, QAsymm8DepthwiseConvolutionGeneric
+>
+{
+  using Base = DepthwiseConvolutionGenericBase<
+    uint8_t, int32_t, uint8_t, QAsymm8DepthwiseConvolutionGeneric
+  >;
+  friend Base;
+
+  public:
+    QAsymm8DepthwiseConvolutionGeneric(
+      int n_batches, int n_input_rows, int n_input_cols, int n_channels,
+      int kernel_rows, int kernel_cols,
+      int stride_rows, int stride_cols,
+      int dilation_rows, int dilation_cols,
+      nck::ActivationFunction activation,
+      const qasymm8::QAsymm8Params& weight_quantisation,
+      const qasymm8::QAsymm8Params& input_quantisation,
+      const qasymm8::QAsymm8Params& output_quantisation,
+      const qasymm8::QAsymm8RescaleParams& rescale_parameters,
+      unsigned int padding_top,
+      unsigned int padding_left,
+      unsigned int padding_bottom,
+      unsigned int padding_right
+    );
+
+    /** Create an engine requantizing each channel with its own parameters.
+     *
+     * @param[in] rescale_parameters Rescale parameters for each channel.
+     */
+    QAsymm8DepthwiseConvolutionGeneric(
+      int n_batches, int n_input_rows, int n_input_cols, int n_channels,
+      int kernel_rows, int kernel_cols,
+      int stride_rows, int stride_cols,
+      int dilation_rows, int dilation_cols,
+      nck::ActivationFunction activation,
+      const qasymm8::QAsymm8Params& weight_quantisation,
+      const qasymm8::QAsymm8Params& input_quantisation,
+      const qasymm8::QAsymm8Params& output_quantisation,
+      const std::vector<qasymm8::QAsymm8RescaleParams>& rescale_parameters,
+      unsigned int padding_top,
+      unsigned int padding_left,
+      unsigned int padding_bottom,
+      unsigned int padding_right
+    );
+
+  protected:
+    uint8_t _input_padding_value(void) const;
+
+    size_t _get_packed_params_per_channel_size(void) const;
+
+    void _pack_params(
+      void *buffer,
+      const void *weights,
+      unsigned int weight_row_stride,
+      unsigned int weight_col_stride,
+      const void *biases=nullptr
+    ) const;
+
+    template <nck::ActivationFunction Activation>
+    void execute_tile(
+      int channel_start,
+      int n_channels,
+      const void* packed_params,
+      const uint8_t* const* inptrs,
+      uint8_t* const* outptrs
+    );
+
+  private:
+    // Quantization parameters
+    const qasymm8::QAsymm8Params _weights_quant, _inputs_quant, _output_quant;
+    const std::vector<qasymm8::QAsymm8RescaleParams> _rescale_parameters;
+};
+
+}  // namespace depthwise
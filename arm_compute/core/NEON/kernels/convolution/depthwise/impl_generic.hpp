@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ *
+ *          NOTE: Header to be included by implementation files only.
+ *
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/depthwise_generic.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/common/utils.hpp"
+
+#pragma once
+
+#define GENERIC_MEMBERFN(TOUT) template <\
+  typename TIn, typename TBias, typename TOut, typename Derived\
+> TOUT DepthwiseConvolutionGenericBase<TIn, TBias, TOut, Derived>
+
+using namespace neon_convolution_kernels;
+
+namespace depthwise
+{
+
+namespace generic
+{
+const unsigned int CHANNEL_BLOCK = 16;
+
+/** Round a size in bytes up to a multiple of the size of a pointer. */
+inline size_t pointer_align(const size_t size)
+{
+  return roundup(size, sizeof(void *));
+}
+}  // namespace generic
+
+GENERIC_MEMBERFN(int)::get_output_size(
+  const int dim_size, const unsigned int padding_before, const unsigned int padding_after,
+  const int kernel_size, const int stride, const int dilation
+)
+{
+  const int dilated_kernel_size = (kernel_size - 1) * dilation + 1;
+  return (dim_size + padding_before + padding_after - dilated_kernel_size) / stride + 1;
+}
+
+GENERIC_MEMBERFN(int)::output_size(
+  const int dim_size, const unsigned int padding_before, const unsigned int padding_after
+) const
+{
+  return get_output_size(dim_size, padding_before, padding_after, _kernel_rows, _stride_rows, _dilation_rows);
+}
+
+GENERIC_MEMBERFN()::DepthwiseConvolutionGenericBase(
+  const int n_batches,
+  const int n_input_rows,
+  const int n_input_cols,
+  const int n_channels,
+  const int kernel_rows,
+  const int kernel_cols,
+  const int stride_rows,
+  const int stride_cols,
+  const int dilation_rows,
+  const int dilation_cols,
+  ActivationFunction activation,
+  const unsigned int padding_top,
+  const unsigned int padding_left,
+  const unsigned int padding_bottom,
+  const unsigned int padding_right
+) : _input(nullptr), _output(nullptr),
+    _packed_parameters(nullptr),
+    _working_space(nullptr),
+    _n_batches(n_batches),
+    _n_input_rows(n_input_rows),
+    _n_input_cols(n_input_cols),
+    _n_channels(n_channels),
+    _kernel_rows(kernel_rows),
+    _kernel_cols(kernel_cols),
+    _stride_rows(stride_rows),
+    _stride_cols(stride_cols),
+    _dilation_rows(dilation_rows),
+    _dilation_cols(dilation_cols),
+    _n_output_rows(get_output_size(n_input_rows, padding_top, padding_bottom, kernel_rows, stride_rows, dilation_rows)),
+    _n_output_cols(get_output_size(n_input_cols, padding_left, padding_right, kernel_cols, stride_cols, dilation_cols)),
+    _padding_top(padding_top),
+    _padding_left(padding_left),
+    _padding_bottom(padding_bottom),
+    _padding_right(padding_right),
+    _activation(activation),
+    _input_col_stride(0), _input_row_stride(0), _input_batch_stride(0),
+    _output_col_stride(0), _output_row_stride(0), _output_batch_stride(0)
+{
+}
+
+GENERIC_MEMBERFN(void)::set_input(const void* const inptr)
+{
+  set_input(inptr, _n_channels);
+}
+
+GENERIC_MEMBERFN(void)::set_input(const void* const inptr, const int ld_col)
+{
+  set_input(inptr, _n_input_cols * ld_col, ld_col);
+}
+
+GENERIC_MEMBERFN(void)::set_input(const void* const inptr, const int ld_row, const int ld_col)
+{
+  set_input(inptr, _n_input_rows * ld_row, ld_row, ld_col);
+}
+
+GENERIC_MEMBERFN(void)::set_input(const void* const inptr, const int ld_batch, const int ld_row, const int ld_col)
+{
+  _input = static_cast<const TIn *>(inptr);
+  _input_batch_stride = ld_batch;
+  _input_row_stride = ld_row;
+  _input_col_stride = ld_col;
+}
+
+GENERIC_MEMBERFN(void)::set_output(void* const outptr)
+{
+  set_output(outptr, _n_channels);
+}
+
+GENERIC_MEMBERFN(void)::set_output(void* const outptr, const int ld_col)
+{
+  set_output(outptr, _n_output_cols * ld_col, ld_col);
+}
+
+GENERIC_MEMBERFN(void)::set_output(void* const outptr, const int ld_row, const int ld_col)
+{
+  set_output(outptr, _n_output_rows * ld_row, ld_row, ld_col);
+}
+
+GENERIC_MEMBERFN(void)::set_output(void* const outptr, const int ld_batch, const int ld_row, const int ld_col)
+{
+  _output = static_cast<TOut *>(outptr);
+  _output_batch_stride = ld_batch;
+  _output_row_stride = ld_row;
+  _output_col_stride = ld_col;
+}
+
+GENERIC_MEMBERFN(size_t)::_get_packed_params_per_channel_size(void) const
+{
+  return sizeof(TBias) + sizeof(TIn) * _kernel_rows * _kernel_cols;
+}
+
+GENERIC_MEMBERFN(size_t)::get_packed_params_size(void) const
+{
+  return _n_channels * static_cast<const Derived *>(this)->_get_packed_params_per_channel_size();
+}
+
+GENERIC_MEMBERFN(void)::set_packed_params_buffer(void *buffer)
+{
+  _packed_parameters = buffer;
+}
+
+GENERIC_MEMBERFN(void)::pack_params(const void *weights, const void *biases) const
+{
+  pack_params(_packed_parameters, weights, biases);
+}
+
+GENERIC_MEMBERFN(void)::pack_params(void *buffer, const void *weights, const void *biases) const
+{
+  const unsigned int weight_col_stride = _n_channels;
+  const unsigned int weight_row_stride = _kernel_cols * weight_col_stride;
+  pack_params(buffer, weights, weight_row_stride, weight_col_stride, biases);
+}
+
+GENERIC_MEMBERFN(void)::pack_params(
+  void * const buffer,
+  const void * const weights,
+  const unsigned int weight_row_stride,
+  const unsigned int weight_col_stride,
+  const void * const biases
+) const
+{
+  static_cast<const Derived *>(this)->_pack_params(
+    buffer, weights, weight_row_stride, weight_col_stride, biases
+  );
+}
+
+GENERIC_MEMBERFN(void)::_pack_params(
+  void * const buffer,
+  const void * const weights,
+  const unsigned int weight_row_stride,
+  const unsigned int weight_col_stride,
+  const void * const biases
+) const
+{
+  const TIn *wptr = static_cast<const TIn *>(weights);
+  const TBias *bptr = static_cast<const TBias *>(biases);
+  TBias *out_bptr = static_cast<TBias *>(buffer);
+  TIn *out_wptr = reinterpret_cast<TIn *>(out_bptr + _n_channels);
+
+  for (int n = 0; n < _n_channels; n++)
+  {
+    out_bptr[n] = (bptr != nullptr) ? bptr[n] : static_cast<TBias>(0);
+  }
+
+  for (int i = 0; i < _kernel_rows; i++)
+  {
+    for (int j = 0; j < _kernel_cols; j++)
+    {
+      const TIn *const tap_wptr = wptr + i*weight_row_stride + j*weight_col_stride;
+      TIn *const tap_outptr = out_wptr + (i*_kernel_cols + j)*_n_channels;
+      std::copy(tap_wptr, tap_wptr + _n_channels, tap_outptr);
+    }
+  }
+}
+
+GENERIC_MEMBERFN(size_t)::_get_working_space_size_per_thread(void) const
+{
+  // Padding buffer, output scratch buffer and the arrays of pointers
+  const size_t n_inptrs = _kernel_rows * _kernel_cols * output_tile_cols;
+  return generic::pointer_align(sizeof(TIn) * _n_channels) +
+         generic::pointer_align(sizeof(TOut) * _n_channels) +
+         sizeof(void *) * (n_inptrs + output_tile_cols);
+}
+
+GENERIC_MEMBERFN(size_t)::get_working_space_size(const unsigned int nthreads) const
+{
+  return nthreads * _get_working_space_size_per_thread();
+}
+
+GENERIC_MEMBERFN(void)::set_working_space(void *buffer)
+{
+  _working_space = buffer;
+}
+
+GENERIC_MEMBERFN(void *)::_get_input_working_space(const unsigned int threadid) const
+{
+  return static_cast<uint8_t*>(_working_space) + threadid * _get_working_space_size_per_thread();
+}
+
+GENERIC_MEMBERFN(void *)::_get_output_working_space(const unsigned int threadid) const
+{
+  return static_cast<uint8_t*>(_get_input_working_space(threadid)) +
+         generic::pointer_align(sizeof(TIn) * _n_channels);
+}
+
+GENERIC_MEMBERFN(const TIn **)::_get_input_pointers(const unsigned int threadid) const
+{
+  return reinterpret_cast<const TIn **>(
+    static_cast<uint8_t*>(_get_output_working_space(threadid)) +
+    generic::pointer_align(sizeof(TOut) * _n_channels)
+  );
+}
+
+GENERIC_MEMBERFN(TOut **)::_get_output_pointers(const unsigned int threadid) const
+{
+  return reinterpret_cast<TOut **>(
+    static_cast<uint8_t*>(_get_output_working_space(threadid)) +
+    generic::pointer_align(sizeof(TOut) * _n_channels) +
+    sizeof(void *) * _kernel_rows * _kernel_cols * output_tile_cols
+  );
+}
+
+GENERIC_MEMBERFN(unsigned int)::get_window() const
+{
+  // Parallelise over blocks of channels.
+  return iceildiv(_n_channels, generic::CHANNEL_BLOCK);
+}
+
+GENERIC_MEMBERFN(void)::run(
+  const unsigned int start,
+  const unsigned int stop,
+  const unsigned int threadid
+)
+{
+  // Clear the input padding buffer
+  TIn *buf = static_cast<TIn *>(_get_input_working_space(threadid));
+  const TIn pad_value = static_cast<Derived *>(this)->_input_padding_value();
+  for (int n = 0; n < _n_channels; n++)
+  {
+    buf[n] = pad_value;
+  }
+
+  // Parallelise over blocks of channels
+  const int start_channel = generic::CHANNEL_BLOCK * start;
+  const int stop_channel = std::min<int>(_n_channels, generic::CHANNEL_BLOCK * stop);
+  if (start_channel >= stop_channel)
+  {
+    return;
+  }
+
+  for (int batch = 0; batch < _n_batches; batch++)
+  {
+    for (int out_i = 0; out_i < _n_output_rows; out_i++)
+    {
+      switch(_activation)
+      {
+        case ActivationFunction::ReLU:
+          process_row<ActivationFunction::ReLU>(
+            threadid, start_channel, stop_channel - start_channel, batch, out_i
+          );
+          break;
+        case ActivationFunction::ReLU6:
+          process_row<ActivationFunction::ReLU6>(
+            threadid, start_channel, stop_channel - start_channel, batch, out_i
+          );
+          break;
+        default:
+          process_row<ActivationFunction::None>(
+            threadid, start_channel, stop_channel - start_channel, batch, out_i
+          );
+          break;
+      }
+    }
+  }
+}
+
+GENERIC_MEMBERFN(template <ActivationFunction Activation> void)::process_row(
+  const unsigned int threadid,
+  const int channel_start,
+  const int n_channels,
+  const int batch,
+  const int out_i
+)
+{
+  Derived * dthis = static_cast<Derived *>(this);
+  const TIn *const padding = static_cast<const TIn *>(_get_input_working_space(threadid));
+  TOut *const scratch = static_cast<TOut *>(_get_output_working_space(threadid));
+  const TIn **inptrs = _get_input_pointers(threadid);
+  TOut **outptrs = _get_output_pointers(threadid);
+
+  const TIn *const inptr_batch = _input + batch*_input_batch_stride;
+  TOut *const outptr_row = _output + batch*_output_batch_stride + out_i*_output_row_stride;
+  const int in_i_base = out_i*_stride_rows - static_cast<int>(_padding_top);
+
+  for (int out_j = 0; out_j < _n_output_cols; out_j += output_tile_cols)
+  {
+    for (int t = 0; t < output_tile_cols; t++)
+    {
+      // Columns beyond the end of the output are written to the scratch
+      // buffer and read only padding.
+      const int oj = out_j + t;
+      const bool valid_column = oj < _n_output_cols;
+      outptrs[t] = valid_column ? outptr_row + oj*_output_col_stride : scratch;
+
+      const int in_j_base = oj*_stride_cols - static_cast<int>(_padding_left);
+      for (int ki = 0; ki < _kernel_rows; ki++)
+      {
+        const int in_i = in_i_base + ki*_dilation_rows;
+        const bool valid_row = valid_column && 0 <= in_i && in_i < _n_input_rows;
+        for (int kj = 0; kj < _kernel_cols; kj++)
+        {
+          const int in_j = in_j_base + kj*_dilation_cols;
+          const bool valid = valid_row && 0 <= in_j && in_j < _n_input_cols;
+          inptrs[(ki*_kernel_cols + kj)*output_tile_cols + t] = valid ?
+            inptr_batch + in_i*_input_row_stride + in_j*_input_col_stride :
+            padding;
+        }
+      }
+    }
+
+    dthis->template execute_tile<Activation>(
+      channel_start, n_channels, _packed_parameters, inptrs, outptrs
+    );
+  }
+}
+
+GENERIC_MEMBERFN(TIn)::_input_padding_value(void) const
+{
+  return static_cast<TIn>(0);
+}
+
+GENERIC_MEMBERFN(int)::n_channels(void) const
+{
+  return _n_channels;
+}
+
+GENERIC_MEMBERFN(int)::kernel_rows(void) const
+{
+  return _kernel_rows;
+}
+
+GENERIC_MEMBERFN(int)::kernel_cols(void) const
+{
+  return _kernel_cols;
+}
+
+}  // namespace depthwise
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "winograd.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/common/qasymm8.hpp"
+
+namespace winograd
+{
+
+/** Quantized F(2x2, 3x3) Winograd transforms.
+ *
+ * Inputs and weights are offset by their zero points and transformed into
+ * int16_t matrices, the GEMM accumulates into int32_t and the output
+ * transform requantizes the result to QASYMM8. The weights are transformed
+ * with 2G (rather than G) so that every transformed weight is an integer, the
+ * output of the GEMM is hence four times too large and is divided by four
+ * before the bias is added.
+ *
+ * All intermediate values are exact. The transformed inputs are bounded by
+ * 4 * 255 and the transformed weights by 9 * 255, so the accumulations of the
+ * GEMM cannot overflow provided the number of input channels does not exceed
+ * `qasymm8_max_input_channels`.
+ */
+constexpr int qasymm8_max_input_channels = std::numeric_limits<int32_t>::max() / ((4 * 255) * (9 * 255));
+
+class QAsymm8InputTransform : public IInputTransform
+{
+  public:
+    static constexpr int inner_tile_rows = 4;
+    static constexpr int inner_tile_cols = 4;
+    static constexpr int kernel_rows = 3;
+    static constexpr int kernel_cols = 3;
+
+    QAsymm8InputTransform(
+      int n_batches,       /**< Number of batches in input tensor. */
+      int n_rows,          /**< Number of rows in input tensor. */
+      int n_cols,          /**< Number of columns in input tensor. */
+      int n_channels,      /**< Number of channels in input tensor. */
+      int padding_top,     /**< Padding to apply to the top of the image. */
+      int padding_left,    /**< Padding to apply to the left of the image. */
+      int padding_bottom,  /**< Padding to apply to the bottom of the image. */
+      int padding_right,   /**< Padding to apply to the right of the image. */
+      const qasymm8::QAsymm8Params &input_quantisation
+    );
+
+    QAsymm8InputTransform(QAsymm8InputTransform&) = delete;
+    QAsymm8InputTransform operator=(QAsymm8InputTransform&) = delete;
+
+    /** Set pointers to the input tensor read by the transform. */
+    void set_input_tensor(const void *input) override;
+    void set_input_tensor(const void *input, int col_stride) override;
+    void set_input_tensor(const void *input, int row_stride, int col_stride) override;
+    void set_input_tensor(const void *input, int batch_stride, int row_stride, int col_stride) override;
+
+    /** Set pointers to the matrices written by the transform. */
+    void set_output_matrices(void *matrices, int iter_matrix_stride, int matrix_row_stride) override;
+
+    /** Get the working space required to perform the transformation. */
+    size_t get_working_space_size(unsigned int nthreads=1) const override;
+    void set_working_space(void *buffer) override;
+
+    /** Get the window of work a given operator can perform. */
+    unsigned int get_window() const override;
+    static constexpr unsigned int WINDOW_BLOCK = 16;  // Base size of window
+
+    /** Perform work upon a window of the input. */
+    void run(unsigned int start, unsigned int stop, unsigned int threadid=0) override;
+
+  private:
+    /** Transform a tile, padded cells point at a row of zero points. */
+    static void transform_tile(
+      int n_channels,
+      const uint8_t* const inptrs[inner_tile_rows][inner_tile_cols],
+      uint8_t zero_point,
+      int16_t* outptr,
+      int matrix_stride
+    );
+
+    const int _n_batches, _n_rows, _n_cols, _n_channels;
+    const int _padding_top, _padding_left, _padding_bottom, _padding_right;
+    const int _tiles_M, _tiles_N;
+    const qasymm8::QAsymm8Params _input_quant;
+
+    const uint8_t* _inptr;
+    int16_t* _outptr;
+    int _matrix_stride, _matrix_row_stride, _matrix_batch_stride;
+    int _in_col_stride, _in_row_stride, _in_batch_stride;
+    uint8_t *_working_space;
+};
+
+class QAsymm8WeightTransform : public IWeightTransform
+{
+  public:
+    static constexpr int inner_tile_rows = 4;
+    static constexpr int inner_tile_cols = 4;
+    static constexpr int kernel_rows = 3;
+    static constexpr int kernel_cols = 3;
+
+    QAsymm8WeightTransform(
+      int n_output_channels,  /**< Number of output channels in the kernel. */
+      int n_input_channels,   /**< Number of input channels in the kernel. */
+      const qasymm8::QAsymm8Params &weight_quantisation
+    );
+
+    QAsymm8WeightTransform(QAsymm8WeightTransform&) = delete;
+    QAsymm8WeightTransform operator=(QAsymm8WeightTransform&) = delete;
+
+    /** Set pointer to the (HWIO-ordered) weight tensor read by the transform. */
+    void set_weight_tensor(const void *weights) override;
+
+    /** Set pointer to the matrices written by the transform. */
+    void set_output_matrices(void *matrices, int inter_matrix_stride, int matrix_row_stride) override;
+
+    /** Get the working space required to perform the transformation. */
+    size_t get_working_space_size(unsigned int nthreads=1) const override;
+    void set_working_space(void *buffer) override;
+
+    /** Get the window of work a given operator can perform. */
+    unsigned int get_window() const override;
+
+    /** Perform work upon a window of the input. */
+    void run(unsigned int start, unsigned int stop, unsigned int threadid=0) override;
+
+  private:
+    const int _n_output_channels, _n_input_channels;
+    const qasymm8::QAsymm8Params _weight_quant;
+    int16_t *_matrices;
+    int _matrix_stride, _matrix_row_stride;
+    const uint8_t *_weights;
+};
+
+class QAsymm8OutputTransform : public IOutputTransform
+{
+  public:
+    static constexpr int inner_tile_rows = 4;
+    static constexpr int inner_tile_cols = 4;
+    static constexpr int output_tile_rows = 2;
+    static constexpr int output_tile_cols = 2;
+
+    QAsymm8OutputTransform(
+      int n_batches,  /**< Number of batches in output tensor. */
+      int n_rows,     /**< Number of rows in output tensor. */
+      int n_cols,     /**< Number of columns in output tensor. */
+      int n_channels, /**< Number of channels in output tensor. */
+      const qasymm8::QAsymm8Params &output_quantisation,
+      const qasymm8::QAsymm8RescaleParams &rescale_parameters  /**< Rescale from input_scale * weight_scale to the output scale. */
+    );
+
+    QAsymm8OutputTransform(QAsymm8OutputTransform&) = delete;
+    QAsymm8OutputTransform operator=(QAsymm8OutputTransform&) = delete;
+
+    /** Set pointers to the (int32_t) matrices read by the transform. */
+    void set_input_matrices(const void *matrices, int iter_matrix_stride, int matrix_row_stride) override;
+
+    /** Set pointer to the int32_t bias tensor (can be nullptr for no bias). */
+    void set_bias(const void *bias=nullptr) override;
+
+    /** Set pointers to the output tensor written by the transform. */
+    void set_output_tensor(void *output) override;
+    void set_output_tensor(void *output, int col_stride) override;
+    void set_output_tensor(void *output, int row_stride, int col_stride) override;
+    void set_output_tensor(void *output, int batch_stride, int row_stride, int col_stride) override;
+
+    /** Get the working space required to perform the transformation. */
+    size_t get_working_space_size(unsigned int nthreads=1) const override;
+    void set_working_space(void *buffer) override;
+
+    /** Get the window of work a given operator can perform. */
+    unsigned int get_window() const override;
+    static constexpr unsigned int WINDOW_BLOCK = 16;  // Base size of window
+
+    /** Perform work upon a window of the input. */
+    void run(unsigned int start, unsigned int stop, unsigned int threadid=0) override;
+
+  private:
+    /** Transform a tile, cropped cells point at a scratch row. */
+    void transform_tile(
+      int n_channels,
+      const int32_t* matrix_base,
+      const int32_t* biases,
+      uint8_t* const outptrs[output_tile_rows][output_tile_cols]
+    ) const;
+
+    const int _n_batches, _n_rows, _n_cols, _n_channels;
+    const int _tiles_M, _tiles_N;
+    const qasymm8::QAsymm8Params _output_quant;
+    const qasymm8::QAsymm8RescaleParams _rescale;
+
+    const int32_t* _matrix_base;
+    const int32_t* _biases;
+    int _matrix_stride, _matrix_row_stride, _matrix_batch_stride;
+    uint8_t* _outptr;
+    int _out_col_stride, _out_row_stride, _out_batch_stride;
+    uint8_t *_working_space;
+};
+
+}  // namespace winograd
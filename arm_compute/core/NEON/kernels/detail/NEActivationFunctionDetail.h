@@ -26,6 +26,8 @@
 
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace detail
@@ -53,6 +55,14 @@ struct dummy
     {
         ARM_COMPUTE_UNUSED(vval);
     }
+    /** Run activation function on a scalar.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        ARM_COMPUTE_UNUSED(val);
+    }
 };
 /** Linear activation object */
 template <typename T, int S>
@@ -173,6 +183,15 @@ struct relu
         vval = wrapper::vmax(vzero, vval);
     }
 
+    /** Run activation function on a scalar.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        val = std::max(static_cast<T>(0.f), val);
+    }
+
     /** Vector of zeroes. */
     const ExactType vzero;
 };
@@ -191,7 +210,8 @@ struct brelu
      */
     explicit brelu(ActivationLayerInfo act_info)
         : vzero(wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{})),
-          valpha(wrapper::vdup_n(static_cast<T>(act_info.a()), ExactTagType{}))
+          valpha(wrapper::vdup_n(static_cast<T>(act_info.a()), ExactTagType{})),
+          alpha(static_cast<T>(act_info.a()))
     {
     }
 
@@ -204,10 +224,21 @@ struct brelu
         vval = wrapper::vmin(valpha, wrapper::vmax(vzero, vval));
     }
 
+    /** Run activation function on a scalar.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        val = std::min(alpha, std::max(static_cast<T>(0.f), val));
+    }
+
     /** Vector of zeroes. */
     const ExactType vzero;
     /** Vector of alphas. */
     const ExactType valpha;
+    /** Scalar alpha. */
+    const T alpha;
 };
 /** Lower-Upper Bounded RELU activation object */
 template <typename T, int S>
@@ -224,7 +255,9 @@ struct lubrelu
      */
     explicit lubrelu(ActivationLayerInfo act_info)
         : valpha(wrapper::vdup_n(static_cast<T>(act_info.a()), ExactTagType{})),
-          vbeta(wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{}))
+          vbeta(wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{})),
+          alpha(static_cast<T>(act_info.a())),
+          beta(static_cast<T>(act_info.b()))
     {
     }
 
@@ -237,10 +270,23 @@ struct lubrelu
         vval = wrapper::vmin(valpha, wrapper::vmax(vbeta, vval));
     }
 
+    /** Run activation function on a scalar.
+     *
+     * @param[in] val Scalar value.
+     */
+    void operator()(T &val)
+    {
+        val = std::min(alpha, std::max(beta, val));
+    }
+
     /** Vector of alphas. */
     const ExactType valpha;
     /** Vector of betas. */
     const ExactType vbeta;
+    /** Scalar alpha. */
+    const T alpha;
+    /** Scalar beta. */
+    const T beta;
 };
 } // namespace detail
 } // namespace arm_compute
@@ -59,6 +59,9 @@ public:
             case DataType::QASYMM8:
                 value.u8 = sqcvt_qasymm8_f32(v, quant_info.scale, quant_info.offset);
                 break;
+            case DataType::QASYMM8_SIGNED:
+                value.s8 = sqcvt_qasymm8_signed_f32(v, quant_info.scale, quant_info.offset);
+                break;
             case DataType::U16:
                 value.u16 = static_cast<uint16_t>(v);
                 break;
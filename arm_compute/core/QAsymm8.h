@@ -27,7 +27,8 @@
 
 namespace arm_compute
 {
-using qasymm8_t = uint8_t; /**< 8 bit quantized asymmetric scalar value */
+using qasymm8_t        = uint8_t; /**< 8 bit quantized asymmetric scalar value */
+using qasymm8_signed_t = int8_t;  /**< 8 bit quantized signed asymmetric scalar value */
 }
 #include "arm_compute/core/QAsymm8.inl"
 #endif /* __ARM_COMPUTE_QASYMM8_H__ */
@@ -39,5 +39,18 @@ inline float scvt_f32_qasymm8(qasymm8_t value, float scale, int offset)
     float dequantized = (static_cast<int>(value) - offset) * scale;
     return dequantized;
 }
+
+inline qasymm8_signed_t sqcvt_qasymm8_signed_f32(float value, float scale, int offset, RoundingPolicy rounding_policy = RoundingPolicy::TO_NEAREST_UP)
+{
+    int quantized = arm_compute::round(value / scale, rounding_policy) + offset;
+    quantized     = std::max(-128, std::min(quantized, 127));
+    return quantized;
+}
+
+inline float scvt_f32_qasymm8_signed(qasymm8_signed_t value, float scale, int offset)
+{
+    float dequantized = (static_cast<int>(value) - offset) * scale;
+    return dequantized;
+}
 #endif /* DOXYGEN_SKIP_THIS */
 }
@@ -30,6 +30,7 @@
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Strides.h"
 #include "arm_compute/core/TensorShape.h"
+#include "support/Bfloat16.h"
 #include "support/Half.h"
 
 #include <cmath>
@@ -37,6 +38,7 @@
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -73,20 +75,23 @@ enum class Format
 /** Available data types */
 enum class DataType
 {
-    UNKNOWN, /**< Unknown data type */
-    U8,      /**< unsigned 8-bit number */
-    S8,      /**< signed 8-bit number */
-    QASYMM8, /**< quantized, asymmetric fixed-point 8-bit number */
-    U16,     /**< unsigned 16-bit number */
-    S16,     /**< signed 16-bit number */
-    U32,     /**< unsigned 32-bit number */
-    S32,     /**< signed 32-bit number */
-    U64,     /**< unsigned 64-bit number */
-    S64,     /**< signed 64-bit number */
-    F16,     /**< 16-bit floating-point number */
-    F32,     /**< 32-bit floating-point number */
-    F64,     /**< 64-bit floating-point number */
-    SIZET    /**< size_t */
+    UNKNOWN,            /**< Unknown data type */
+    U8,                 /**< unsigned 8-bit number */
+    S8,                 /**< signed 8-bit number */
+    QASYMM8,            /**< quantized, asymmetric fixed-point 8-bit number unsigned */
+    QASYMM8_SIGNED,     /**< quantized, asymmetric fixed-point 8-bit number signed */
+    QSYMM8_PER_CHANNEL, /**< quantized, symmetric per channel fixed-point 8-bit number */
+    U16,                /**< unsigned 16-bit number */
+    S16,                /**< signed 16-bit number */
+    U32,                /**< unsigned 32-bit number */
+    S32,                /**< signed 32-bit number */
+    U64,                /**< unsigned 64-bit number */
+    S64,                /**< signed 64-bit number */
+    BFLOAT16,           /**< 16-bit brain floating-point number */
+    F16,                /**< 16-bit floating-point number */
+    F32,                /**< 32-bit floating-point number */
+    F64,                /**< 64-bit floating-point number */
+    SIZET               /**< size_t */
 };
 
 /** Available Sampling Policies */
@@ -166,7 +171,8 @@ struct QuantizationInfo
     /** Default constructor */
     QuantizationInfo() noexcept
         : scale(0.0f),
-          offset(0)
+          offset(0),
+          channel_scales()
     {
     }
 
@@ -180,6 +186,15 @@ struct QuantizationInfo
     {
     }
 
+    /** Construct per channel quantization info.
+     *
+     * @param[in] scales Scale of each channel, the offset of symmetric quantization is always 0.
+     */
+    explicit QuantizationInfo(std::vector<float> scales)
+        : scale(0.0f), offset(0), channel_scales(std::move(scales))
+    {
+    }
+
     /** Check whether equal to a given quantization info.
      *
      * @param[in] other Other quantization info.
@@ -188,7 +203,7 @@ struct QuantizationInfo
      */
     bool operator==(const QuantizationInfo &other) const
     {
-        return scale == other.scale && offset == other.offset;
+        return scale == other.scale && offset == other.offset && channel_scales == other.channel_scales;
     }
 
     /** Check whether not equal to a given quantization info.
@@ -202,8 +217,9 @@ struct QuantizationInfo
         return !(*this == other);
     }
 
-    float scale;  /**< scale */
-    int   offset; /**< offset */
+    float              scale;          /**< scale */
+    int                offset;         /**< offset */
+    std::vector<float> channel_scales; /**< Per channel scales, empty unless the quantization is per channel */
 
     /** Quantizes a value using the scale/offset in this QuantizationInfo
      *
@@ -230,13 +246,47 @@ struct QuantizationInfo
         return scvt_f32_qasymm8(value, scale, offset);
     }
 
+    /** Quantizes a value to a signed 8-bit value using the scale/offset in this QuantizationInfo
+     *
+     * @param[in] value           Value to quantize.
+     * @param[in] rounding_policy Policy to use when rounding.
+     *
+     * @return the quantized value.
+     */
+    qasymm8_signed_t quantize_signed(float value, RoundingPolicy rounding_policy) const
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(scale == 0, "QuantizationInfo::quantize_signed: scale == 0");
+        return sqcvt_qasymm8_signed_f32(value, scale, offset, rounding_policy);
+    }
+
+    /** Dequantizes a signed 8-bit value using the scale/offset in this QuantizationInfo
+     *
+     * @param[in] value Value to dequantize.
+     *
+     * @return the original value before quantization.
+     */
+    float dequantize_signed(qasymm8_signed_t value) const
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(scale == 0, "QuantizationInfo::dequantize_signed: scale == 0");
+        return scvt_f32_qasymm8_signed(value, scale, offset);
+    }
+
     /** Indicates whether this QuantizationInfo has valid settings or not
      *
      * @return True if the this has invalid settings.
      */
     bool empty() const
     {
-        return scale == 0;
+        return scale == 0 && channel_scales.empty();
+    }
+
+    /** Indicates whether this QuantizationInfo holds one scale per channel
+     *
+     * @return True if the quantization is per channel.
+     */
+    bool is_per_channel() const
+    {
+        return !channel_scales.empty();
     }
 };
 
@@ -860,6 +910,7 @@ struct FullyConnectedLayerInfo
     bool       transpose_weights{ true };                  /**<  Transpose weights if true. */
     bool       are_weights_reshaped{ false };              /**<  Reshape the weights tensor if false. */
     bool       retain_internal_weights{ false };           /**<  Retain internal reshaped weights. */
+    bool       dynamic_quantization{ false };              /**<  Quantize the F32 input and weights to symmetric S8 at run time and perform the matrix multiplication in integer arithmetic. */
 
     /** Sets the weights trained data layout
      *
@@ -883,6 +934,17 @@ struct FullyConnectedLayerInfo
         transpose_weights = should_transpose_weights;
         return *this;
     }
+    /** Sets the dynamic quantization flag
+     *
+     * @param[in] use_dynamic_quantization Boolean flag indicating if the input and weights should be dynamically quantized
+     *
+     * @return Updated object
+     */
+    FullyConnectedLayerInfo &set_dynamic_quantization(bool use_dynamic_quantization)
+    {
+        dynamic_quantization = use_dynamic_quantization;
+        return *this;
+    }
 };
 
 /** PriorBox layer info */
@@ -1523,6 +1585,52 @@ private:
     bool               _enabled = { false };
 };
 
+/** Pointwise operation of a fused chain of pointwise operations
+ *
+ * Each operation is applied to the result of the previous one. Operations that need tensors
+ * reference them through the index of their (first) operand in the operand list of the chain.
+ */
+struct PointwiseOperation
+{
+    /** Available pointwise operations */
+    enum class Type
+    {
+        ADD,                 /**< Add the operand ( \f$ f(x) = x + y \f$ ) */
+        SUB,                 /**< Subtract the operand ( \f$ f(x) = x - y \f$ ) */
+        REVERSE_SUB,         /**< Subtract from the operand ( \f$ f(x) = y - x \f$ ) */
+        MUL,                 /**< Multiply by the operand ( \f$ f(x) = x \cdot y \f$ ) */
+        SCALE_SHIFT,         /**< Per channel scale (operand) and shift (operand + 1) ( \f$ f(x) = scale \cdot x + shift \f$ ) */
+        BATCH_NORMALIZATION, /**< Batch normalization with mean (operand), variance (operand + 1), beta (operand + 2) and gamma (operand + 3) */
+        ACTIVATION           /**< Activation function */
+    };
+
+    /** Default Constructor */
+    PointwiseOperation() = default;
+    /** Constructor for operations with operands
+     *
+     * @param[in] type    Type of the operation. Must not be @ref Type::ACTIVATION
+     * @param[in] operand Index of the (first) operand of the operation
+     * @param[in] epsilon (Optional) Small value to avoid division by zero. Only used by @ref Type::BATCH_NORMALIZATION
+     */
+    PointwiseOperation(Type type, unsigned int operand, float epsilon = 0.001f)
+        : type(type), operand(operand), epsilon(epsilon), act_info()
+    {
+    }
+    /** Constructor for activation operations
+     *
+     * @param[in] act_info Activation function to apply
+     */
+    PointwiseOperation(ActivationLayerInfo act_info)
+        : type(Type::ACTIVATION), operand(0), epsilon(0.f), act_info(act_info)
+    {
+    }
+
+    Type                type{ Type::ACTIVATION }; /**< Type of the operation */
+    unsigned int        operand{ 0 };             /**< Index of the (first) operand of the operation */
+    float               epsilon{ 0.f };           /**< Batch normalization epsilon */
+    ActivationLayerInfo act_info{};               /**< Activation function of activation operations */
+};
+
 /** Normalization Layer Information class */
 class NormalizationLayerInfo
 {
@@ -1789,6 +1897,9 @@ struct GEMMLowpOutputStageInfo
     int                     gemmlowp_shift{ 0 };                   /**< GEMMLowp output stage shift used for quantizing to uint8 */
     int                     gemmlowp_min_bound{ 0 };               /**< GEMMLowp min value used to saturate down the output result before converting back to QASYMM8 */
     int                     gemmlowp_max_bound{ 0 };               /**< GEMMLowp max value used to saturate down the output result before converting back to QASYMM8 */
+    std::vector<int32_t>    gemmlowp_multipliers{};                /**< GEMMLowp output stage multipliers used for quantizing to QASYMM8, one per output channel */
+    std::vector<int32_t>    gemmlowp_shifts{};                     /**< GEMMLowp output stage shifts used for quantizing to QASYMM8, one per output channel */
+    bool                    is_quantized_per_channel{ false };     /**< GEMMLowp quantized per-channel flag */
 };
 
 /** GEMM LHS (Left Hand Side) matrix information */
@@ -112,9 +112,12 @@ inline size_t data_size_from_type(DataType data_type)
         case DataType::U8:
         case DataType::S8:
         case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8_PER_CHANNEL:
             return 1;
         case DataType::U16:
         case DataType::S16:
+        case DataType::BFLOAT16:
         case DataType::F16:
             return 2;
         case DataType::F32:
@@ -184,9 +187,12 @@ inline size_t element_size_from_data_type(DataType dt)
         case DataType::S8:
         case DataType::U8:
         case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8_PER_CHANNEL:
             return 1;
         case DataType::U16:
         case DataType::S16:
+        case DataType::BFLOAT16:
         case DataType::F16:
             return 2;
         case DataType::U32:
@@ -1000,6 +1006,8 @@ inline bool is_data_type_quantized(DataType dt)
     switch(dt)
     {
         case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8_PER_CHANNEL:
             return true;
         default:
             return false;
@@ -1017,6 +1025,24 @@ inline bool is_data_type_quantized_asymmetric(DataType dt)
     switch(dt)
     {
         case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Check if a given data type is of per channel quantized type
+ *
+ * @param[in] dt Input data type.
+ *
+ * @return True if data type is of per channel quantized type, else false.
+ */
+inline bool is_data_type_quantized_per_channel(DataType dt)
+{
+    switch(dt)
+    {
+        case DataType::QSYMM8_PER_CHANNEL:
             return true;
         default:
             return false;
@@ -1078,7 +1104,14 @@ bool check_value_range(T val, DataType dt, QuantizationInfo quant_info = Quantiz
             double max = static_cast<double>(quant_info.dequantize(std::numeric_limits<uint8_t>::max()));
             return ((double)val >= min && (double)val <= max);
         }
+        case DataType::QASYMM8_SIGNED:
+        {
+            double min = static_cast<double>(quant_info.dequantize_signed(std::numeric_limits<int8_t>::lowest()));
+            double max = static_cast<double>(quant_info.dequantize_signed(std::numeric_limits<int8_t>::max()));
+            return ((double)val >= min && (double)val <= max);
+        }
         case DataType::S8:
+        case DataType::QSYMM8_PER_CHANNEL:
             return ((static_cast<int8_t>(val) == val) && val >= std::numeric_limits<int8_t>::lowest() && val <= std::numeric_limits<int8_t>::max());
         case DataType::U16:
             return ((static_cast<uint16_t>(val) == val) && val >= std::numeric_limits<uint16_t>::lowest() && val <= std::numeric_limits<uint16_t>::max());
@@ -1092,6 +1125,8 @@ bool check_value_range(T val, DataType dt, QuantizationInfo quant_info = Quantiz
             return (val >= std::numeric_limits<uint64_t>::lowest() && val <= std::numeric_limits<uint64_t>::max());
         case DataType::S64:
             return (val >= std::numeric_limits<int64_t>::lowest() && val <= std::numeric_limits<int64_t>::max());
+        case DataType::BFLOAT16:
+            return (val >= bfloat16::lowest() && val <= bfloat16::max());
         case DataType::F16:
             return (val >= std::numeric_limits<half>::lowest() && val <= std::numeric_limits<half>::max());
         case DataType::F32:
@@ -26,6 +26,9 @@
 
 #include "arm_compute/core/Error.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 namespace quantization
@@ -48,6 +51,20 @@ arm_compute::Status calculate_quantized_multiplier_less_than_one(float multiplie
  * @return a status
  */
 arm_compute::Status calculate_quantized_multiplier_greater_than_one(float multiplier, int *quantized_multiplier, int *left_shift);
+/** Calculate quantized representation of the per channel multipliers of a convolution, each with value less than one.
+ *
+ * The multiplier of channel i is input_scale * weights_scales[i] / output_scale.
+ *
+ * @param[in]  input_scale       Scale of the input.
+ * @param[in]  weights_scales    Scale of each output channel of the weights.
+ * @param[in]  output_scale      Scale of the output.
+ * @param[out] quant_multipliers Integer multipliers, one for each channel.
+ * @param[out] right_shifts      Right bit shifts, one for each channel.
+ *
+ * @return a status
+ */
+arm_compute::Status calculate_quantized_multipliers_less_than_one(float input_scale, const std::vector<float> &weights_scales, float output_scale,
+                                                                  std::vector<int32_t> *quant_multipliers, std::vector<int32_t> *right_shifts);
 } // namespace quantization
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_IO_FILE_HANDLER_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/graph/IGraphMutator.h"
 #include "arm_compute/graph/IGraphPrinter.h"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#include <memory>
 
 namespace arm_compute
 {
@@ -36,6 +37,7 @@ namespace graph
 // Forward declaration
 class Graph;
 class GraphContext;
+class GraphProfiler;
 class PassManager;
 
 /** Graph manager class
@@ -72,11 +74,45 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Executes a graph once on external input and output buffers
+     *
+     * The buffers are imported as the backing memory of the input and output tensors so that
+     * the graph reads its inputs from and writes its outputs to them without copying the data.
+     * The accessors are only called for the tensors without a buffer.
+     *
+     * @note Nodes computed in-place may overwrite the input buffers.
+     * @note The buffers are only referenced during the execution: the tensors get back their own memory afterwards.
+     *
+     * @param[in] graph   Graph to execute
+     * @param[in] inputs  Buffers to bind to the inputs of the graph, in the order of the input nodes
+     * @param[in] outputs Buffers to bind to the outputs of the graph, in the order of the output nodes
+     */
+    void execute_graph(Graph &graph, const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs);
+    /** Checks if external buffers can be bound to the inputs and outputs of a finalized graph
+     *
+     * A buffer must be aligned to the element size of its tensor, be at least as large as the tensor
+     * and follow the strides of the tensor. A dense buffer can hence only be bound to a tensor without padding.
+     *
+     * @param[in] graph   Graph to bind the buffers to
+     * @param[in] inputs  Buffers to bind to the inputs of the graph, in the order of the input nodes
+     * @param[in] outputs Buffers to bind to the outputs of the graph, in the order of the output nodes
+     *
+     * @return A status
+     */
+    Status validate_external_buffers(Graph &graph, const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Profiles the executions of a finalized graph
+     *
+     * The profiler is configured for the workload of the graph and records every execution of its tasks, see @ref GraphProfiler.
+     *
+     * @param[in] graph    Graph to profile
+     * @param[in] profiler Profiler to record the executions into. Pass nullptr to stop profiling the graph.
+     */
+    void set_profiler(Graph &graph, std::shared_ptr<GraphProfiler> profiler);
 
 private:
     std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_GRAPH_PROFILER_H__
+#define __ARM_COMPUTE_GRAPH_GRAPH_PROFILER_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class INode;
+struct ExecutionTask;
+struct ExecutionWorkload;
+
+/** Profiling information of a kernel scheduled by an execution task */
+struct KernelProfile
+{
+    std::string  name          = {};    /**< Name of the kernel */
+    unsigned int num_runs      = { 0 }; /**< Number of times the kernel was scheduled */
+    double       total_time_us = { 0 }; /**< Accumulated wall time of the kernel in microseconds */
+};
+
+/** Profiling information of an execution task */
+struct TaskProfile
+{
+    NodeID                     node_id       = { EmptyNodeID };         /**< ID of the node bound to the task */
+    std::string                name          = {};                      /**< Name of the node bound to the task */
+    NodeType                   type          = { NodeType::Dummy };     /**< Type of the node bound to the task */
+    Target                     target        = { Target::UNSPECIFIED }; /**< Target the task is executed on */
+    uint64_t                   flops         = { 0 };                   /**< Estimated number of operations of one run, a multiply-accumulate counts as two */
+    uint64_t                   bytes         = { 0 };                   /**< Size in bytes of the input and output tensors of the node, read or written once per run */
+    unsigned int               num_runs      = { 0 };                   /**< Number of times the task was executed */
+    double                     total_time_us = { 0 };                   /**< Accumulated wall time of the task in microseconds */
+    std::vector<KernelProfile> kernels       = {};                      /**< Kernels scheduled by the task, in order of first execution */
+};
+
+/** Profiler of the executions of a graph
+ *
+ * Records the wall time of every execution task of a workload, the kernels each task schedules and the operations and
+ * bytes of each task estimated from its node, see @ref GraphManager::set_profiler.
+ *
+ * @note The kernels are intercepted through a scheduler overriding the active one in the thread executing a task (See @ref Scheduler::set_thread_scheduler)
+ *       therefore they are not recorded in builds without multi-threading support.
+ * @note The tasks of asynchronous targets (OpenCL, GLES) only enqueue their kernels: their time doesn't include the execution of the kernels.
+ */
+class GraphProfiler final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] record_trace (Optional) Record an event per task and kernel execution to export a trace. The memory used grows with the number of runs.
+     */
+    GraphProfiler(bool record_trace = true);
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    GraphProfiler(const GraphProfiler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    GraphProfiler &operator=(const GraphProfiler &) = delete;
+    /** Destructor */
+    ~GraphProfiler();
+    /** Creates the profiles of the tasks of a workload and estimates the operations and bytes of their nodes
+     *
+     * @note Clears any recorded information.
+     *
+     * @param[in] workload Workload to profile
+     */
+    void configure(const ExecutionWorkload &workload);
+    /** Executes a task of the configured workload through @ref TaskExecutor and records its execution
+     *
+     * @note Can be called concurrently for different tasks.
+     *
+     * @param[in] task Task to execute
+     */
+    void run_task(ExecutionTask &task);
+    /** Clears the recorded times, kernels and trace events
+     *
+     * @note Must not be called while the workload is executed.
+     */
+    void reset();
+    /** Returns the profiles of the tasks
+     *
+     * @return The profiles of the tasks, in execution order
+     */
+    const std::vector<TaskProfile> &tasks() const;
+    /** Prints a table with the average time, achieved GFLOP/s and GB/s of each task
+     *
+     * @param[out] os Output stream
+     */
+    void print_table(std::ostream &os) const;
+    /** Exports the recorded events in the Chrome trace event format (chrome://tracing)
+     *
+     * @param[out] os Output stream
+     */
+    void export_chrome_trace(std::ostream &os) const;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    /** Trace event of a task or kernel execution */
+    struct TraceEvent
+    {
+        size_t          task;     /**< Index of the task */
+        int             kernel;   /**< Index of the kernel in the task, -1 for the task itself */
+        double          start_us; /**< Start time since the last reset in microseconds */
+        double          dur_us;   /**< Duration in microseconds */
+        std::thread::id tid;      /**< Thread the event happened on */
+    };
+
+    /** Records the execution of a kernel by a task
+     *
+     * @param[in] task     Index of the task
+     * @param[in] name     Name of the kernel
+     * @param[in] start    Start of the kernel
+     * @param[in] duration Duration of the kernel
+     */
+    void record_kernel(size_t task, const std::string &name, clock::time_point start, clock::duration duration);
+    /** Records a trace event
+     *
+     * @param[in] event Event to record
+     */
+    void record_event(const TraceEvent &event);
+
+    /** Scheduler recording the kernels scheduled by a task */
+    class TaskScheduler;
+
+    /** Returns the scheduler of the calling thread, creates it on the first call from the thread
+     *
+     * @return The scheduler recording the kernels of the tasks executed by the calling thread
+     */
+    TaskScheduler &thread_scheduler();
+
+    const ExecutionTask                                                   *_first_task;
+    std::vector<TaskProfile>                                               _tasks;
+    std::vector<TraceEvent>                                                _events;
+    mutable std::mutex                                                     _events_mtx;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<TaskScheduler>>> _schedulers;
+    std::mutex                                                             _schedulers_mtx;
+    clock::time_point                                                      _origin;
+    bool                                                                   _record_trace;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_GRAPH_PROFILER_H__ */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__
+#define __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+/** Version of the serialized graph format, files with a different version are rejected */
+constexpr unsigned int serialized_graph_version = 3;
+/** Alignment in bytes of the constant tensor data in a serialized graph */
+constexpr size_t serialized_graph_alignment = 64;
+
+/** Serializes a graph to a file
+ *
+ * The nodes with their attributes, the connections between them, the descriptors of their
+ * outputs and the data of the constant tensors are stored so that the graph can be restored
+ * without running the passes that restructure the graph IR (e.g. the fusion passes).
+ * The data of every constant tensor is aligned to @ref serialized_graph_alignment in the file.
+ *
+ * The weights of the NEON fully connected layers are stored transposed, as the functions would transpose them
+ * when preparing, unless they are quantized dynamically or shared with other nodes. The weights of the NEON GEMM
+ * convolution layers which aren't grouped nor quantized per channel are stored reshaped, without the biases, and
+ * the restored nodes get a @ref WeightsInfo marking them as reshaped. The other transformations of the constant
+ * tensors are done by the functions when preparing and still run after a restore:
+ * - The reshape of the Winograd convolution weights and of the depthwise convolution weights.
+ * - The pretransposition of the GEMM right-hand side matrices by the assembly kernels.
+ * - The conversion of the fully connected weights trained in a different data layout.
+ *
+ * @note Only the graph IR is stored: the assembly kernels and the memory lifetime plan of the tensors aren't
+ *       recorded and are selected again when the functions of the restored graph are configured.
+ *
+ * @note The data of the constant tensors is read from their handles, the graph must therefore be
+ *       serialized after the constant accessors have been called and before the functions are prepared.
+ * @note The accessors of the input and output nodes can't be serialized.
+ * @note The models of all the CPUs are recorded, the graph can only be restored on a system with the same
+ *       CPU models as the execution methods and fused nodes were selected for them.
+ *
+ * @param[in] g        Graph to serialize
+ * @param[in] filename File to write the graph to
+ *
+ * @return A status, an error if the graph contains a node type which can't be serialized
+ */
+Status serialize_graph(Graph &g, const std::string &filename);
+/** Restores a graph serialized with @ref serialize_graph
+ *
+ * The constant nodes get an accessor which imports their data from the file as the backing memory of
+ * their tensors, see @ref ITensorHandle::import_memory, or copies it if the tensor is padded or the
+ * backend can't import memory. The input and output nodes don't have any accessor and are expected
+ * to be set by the caller or bound to external buffers, see @ref GraphManager::execute_graph.
+ *
+ * @note The file is privately memory-mapped if supported by the platform, writes to the constant tensors
+ *       don't modify it, and stays mapped until the accessors of the constant nodes are destroyed.
+ *
+ * @param[out] g        Empty graph to restore the nodes into
+ * @param[in]  filename File to read the graph from
+ *
+ * @return A status, an error if the file is not a serialized graph, has a different version or
+ *         was serialized on a different CPU model
+ */
+Status deserialize_graph(Graph &g, const std::string &filename);
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__ */
@@ -96,6 +96,16 @@ public:
      * @param[in] n Node to visit.
      */
     virtual void visit(FusedConvolutionBatchNormalizationNode &n) = 0;
+    /** Visit FusedDepthwiseSeparableConvolutionNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(FusedDepthwiseSeparableConvolutionNode &n) = 0;
+    /** Visit FusedPointwiseNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(FusedPointwiseNode &n) = 0;
     /** Visit InputNode.
      *
      * @param[in] n Node to visit.
@@ -209,6 +219,14 @@ public:
     {
         default_visit();
     }
+    virtual void visit(FusedDepthwiseSeparableConvolutionNode &n) override
+    {
+        default_visit();
+    }
+    virtual void visit(FusedPointwiseNode &n) override
+    {
+        default_visit();
+    }
     virtual void visit(InputNode &n) override
     {
         default_visit();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_GRAPH_ITENSORHANDLE_H__
 #define __ARM_COMPUTE_GRAPH_ITENSORHANDLE_H__
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
@@ -84,6 +85,20 @@ public:
      * @return Target type
      */
     virtual Target target() const = 0;
+    /** Imports an external buffer as the backing memory of the tensor
+     *
+     * @note The buffer must outlive the last execution that accesses the tensor or be released with @ref restore_memory
+     *
+     * @param[in] memory Buffer to import, it must be at least as large as the total size of the tensor
+     *
+     * @return A status
+     */
+    virtual Status import_memory(void *memory) = 0;
+    /** Releases an imported buffer and restores the backing memory of the tensor
+     *
+     * @note No-op if no buffer is imported
+     */
+    virtual void restore_memory() = 0;
 };
 } // namespace graph
 } // namespace arm_compute
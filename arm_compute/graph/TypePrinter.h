@@ -101,6 +101,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::FusedConvolutionBatchNormalizationLayer:
             os << "FusedConvolutionBatchNormalizationLayer";
             break;
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            os << "FusedDepthwiseSeparableConvolutionLayer";
+            break;
+        case NodeType::FusedPointwiseLayer:
+            os << "FusedPointwiseLayer";
+            break;
         case NodeType::GenerateProposalsLayer:
             os << "GenerateProposalsLayer";
             break;
@@ -76,12 +76,27 @@ class TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    CLTunerMode tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool         use_function_memory_manager{ true };                      /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool         use_transition_memory_manager{ true };                    /**< Use a memory manager to manager transition buffer memory */
+    bool         use_tuner{ false };                                       /**< Use a tuner in tunable backends */
+    CLTunerMode  tuner_mode{ CLTunerMode::EXHAUSTIVE };                    /**< Tuner mode to be used by the CL tuner */
+    int          num_threads{ -1 };                                        /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string  tuner_file{ "acl_tuner.csv" };                            /**< File to load/store tuning values from */
+    std::string  gemm_tuner_file{ "acl_gemm_tuner.csv" };                  /**< File to load/store the GEMM kernels selected by the NEON tuner from */
+    std::string  convolution_method_file{ "acl_convolution_methods.csv" }; /**< File to load the convolution methods measured offline from (NEON only) */
+    unsigned int max_concurrent_tasks{ 1 };                                /**< Maximum number of independent tasks executed concurrently, each one on its own partition of the threads (NEON only). If 1 the tasks are executed one after the other in topological order. Greater values disable the transition memory manager */
+    bool         use_interval_memory_planner{ false };                     /**< Plan the memory of the managed tensors from their lifetime intervals (Offset affinity backends only) */
+    unsigned int num_streams{ 1 };                                         /**< Number of inferences executed concurrently, each one on its own partition of the threads and transition memory pool (NEON only, requires the transition memory manager and can't be combined with max_concurrent_tasks) */
+    bool         use_padding_free_kernels{ false };                        /**< Select the functions whose kernels handle borders and left-over elements in-kernel so that the tensors need no padding and no border filling (NEON only). A warning names each node that still pads its tensors */
+    std::string  serialized_graph_file{};                                  /**< File to serialize the graph to once the mutating passes were applied, see @ref serialize_graph. Not serialized if empty */
+};
+
+/** External buffer bound to an input or output tensor of a graph for one execution */
+struct ExternalBuffer
+{
+    void   *ptr{ nullptr }; /**< Pointer to the buffer. If nullptr the accessor of the tensor is used instead */
+    size_t  size{ 0 };      /**< Size of the buffer in bytes */
+    Strides strides{};      /**< Strides of the buffer in bytes. If empty the buffer is assumed to be dense */
 };
 
 /**< Device target types */
@@ -141,6 +156,8 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
+    FusedDepthwiseSeparableConvolutionLayer,
+    FusedPointwiseLayer,
     GenerateProposalsLayer,
     NormalizationLayer,
     NormalizePlanarYUVLayer,
@@ -169,8 +186,9 @@ enum class NodeType
 /** Backend Memory Manager affinity **/
 enum class MemoryManagerAffinity
 {
-    Buffer, /**< Affinity at buffer level */
-    Offset  /**< Affinity at offset level */
+    Buffer,  /**< Affinity at buffer level */
+    Offset,  /**< Affinity at offset level */
+    Interval /**< Affinity at offset level, offsets planned from the lifetime intervals of the tensors */
 };
 
 /** NodeID-index struct
@@ -89,6 +89,16 @@ void force_target_to_graph(Graph &g, Target target);
  * @return A PassManager with default mutating passes
  */
 PassManager create_default_pass_manager(Target target);
+/** Creates a @ref PassManager for the graphs restored with @ref deserialize_graph
+ *
+ * The passes which restructure the graph IR were applied before the graph was serialized and
+ * the execution methods they validated are stored, only the passes which alias tensors are run again.
+ *
+ * @param[in] target Target to create the pass manager for
+ *
+ * @return A PassManager with the mutating passes a restored graph needs
+ */
+PassManager create_restore_pass_manager(Target target);
 /** Setups requested backend context if it exists, is supported and hasn't been initialized already.
  *
  * @param[in,out] ctx    Graph Context.
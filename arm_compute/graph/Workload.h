@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,12 +41,23 @@ class ITensorHandle;
 class INode;
 class Tensor;
 class Graph;
+class GraphProfiler;
 
 struct ExecutionTask;
 
+/** Default task execution function: runs the function of the task
+ *
+ * @param[in] task Task to execute
+ */
 void execute_task(ExecutionTask &task);
 
-/** Task executor */
+/** Task executor
+ *
+ * Every task of a workload is executed through @ref TaskExecutor::execute_function, which can be replaced to intercept the executions.
+ *
+ * @note The function is global to all the graphs and, if the tasks are executed concurrently, called from several threads at once.
+ *       Use @ref GraphManager::set_profiler to measure the tasks of a single graph.
+ */
 class TaskExecutor final
 {
 private:
@@ -59,7 +70,7 @@ public:
      * @return Task executor instance
      */
     static TaskExecutor &get();
-    /** Function that is responsible for executing tasks */
+    /** Function that is responsible for executing tasks, @ref execute_task by default */
     std::function<decltype(execute_task)> execute_function;
 };
 
@@ -84,8 +95,9 @@ struct ExecutionTask
     /** Default destructor */
     ~ExecutionTask() = default;
     // TODO (geopin01) : Support vector of functions?
-    std::unique_ptr<arm_compute::IFunction> task = {}; /**< Task to execute */
-    INode                                  *node = {}; /**< Node bound to this workload */
+    std::unique_ptr<arm_compute::IFunction> task     = {};          /**< Task to execute */
+    INode                                  *node     = {};          /**< Node bound to this workload */
+    GraphProfiler                          *profiler = { nullptr }; /**< Profiler recording the executions of the task, nullptr if the task isn't profiled */
 
     /** Function operator */
     void operator()();
@@ -94,14 +106,31 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Dependencies of an execution task on the other tasks of a workload */
+struct ExecutionTaskDependencies
+{
+    std::vector<size_t> successors       = {};    /**< Indices of the tasks consuming the outputs of the task */
+    unsigned int        num_predecessors = { 0 }; /**< Number of tasks producing the inputs of the task */
+};
+
+namespace detail
+{
+class ConcurrentTaskRunner;
+class MultiStreamRunner;
+} // namespace detail
+
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>                         inputs       = {};          /**< Input handles */
+    std::vector<Tensor *>                         outputs      = {};          /**< Output handles */
+    std::vector<ExecutionTask>                    tasks        = {};          /**< Execution workload */
+    Graph                                        *graph        = { nullptr }; /**< Graph bound to the workload */
+    GraphContext                                 *ctx          = { nullptr }; /**< Graph execution context */
+    std::vector<ExecutionTaskDependencies>        dependencies = {};          /**< Dependencies between the tasks, only populated when tasks can be executed concurrently */
+    std::shared_ptr<detail::ConcurrentTaskRunner> runner       = { nullptr }; /**< Runner executing independent tasks concurrently, nullptr to execute the tasks serially */
+    std::shared_ptr<detail::MultiStreamRunner>    streams      = { nullptr }; /**< Runner executing several inferences concurrently, nullptr to execute one inference at a time */
+    std::shared_ptr<GraphProfiler>                profiler     = { nullptr }; /**< Profiler recording the executions of the tasks, nullptr if the workload isn't profiled */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -221,6 +221,94 @@ std::unique_ptr<IFunction> create_fused_convolution_batch_normalization_layer(Fu
     return std::move(func);
 }
 
+/** Create a backend fused depthwise and pointwise convolution layer function
+ *
+ * @tparam DepthwiseSeparableConvolutionLayerFunction Backend depthwise separable convolution function
+ * @tparam TargetInfo                                 Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend depthwise separable convolution layer function
+ */
+template <typename DepthwiseSeparableConvolutionLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input             = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *depthwise_weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *depthwise_biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *pointwise_weights = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *pointwise_biases  = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *output            = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       depthwise_conv_info = node.depthwise_convolution_info();
+    const PadStrideInfo       pointwise_conv_info = node.pointwise_convolution_info();
+    const ActivationLayerInfo depthwise_act       = node.depthwise_fused_activation();
+    const ActivationLayerInfo pointwise_act       = node.fused_activation();
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<DepthwiseSeparableConvolutionLayerFunction>(get_memory_manager(ctx, TargetInfo::TargetType));
+    func->configure(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, depthwise_conv_info, pointwise_conv_info, depthwise_act, pointwise_act);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Depthwise weights shape: " << depthwise_weights->info()->tensor_shape()
+                               << " Pointwise weights shape: " << pointwise_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (depthwise_act.enabled() ? " " + to_string(depthwise_act.activation()) : "")
+                               << (pointwise_act.enabled() ? " " + to_string(pointwise_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
+/** Create a backend fused pointwise layer function
+ *
+ * @tparam FusedPointwiseLayerFunction Backend fused pointwise function
+ * @tparam TargetInfo                  Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused pointwise layer function
+ */
+template <typename FusedPointwiseLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_pointwise_layer(FusedPointwiseNode &node)
+{
+    validate_node<TargetInfo>(node, node.num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    std::vector<const typename TargetInfo::TensorType *> operands;
+    for(size_t i = 1; i < node.num_inputs(); ++i)
+    {
+        operands.emplace_back(get_backing_tensor<TargetInfo>(node.input(i)));
+    }
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<FusedPointwiseLayerFunction>();
+    func->configure(input, operands, output, node.operations());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Shape: " << input->info()->tensor_shape()
+                               << " Operations: " << node.operations().size()
+                               << std::endl);
+    return std::move(func);
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -408,7 +496,7 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
         std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
                                         std::string("GEMMConvolutionLayer"), mm,
                                         input, weights, biases, output, conv_info,
-                                        WeightsInfo(), Size2D(1U, 1U), fused_act, num_groups);
+                                        node.weights_info(), Size2D(1U, 1U), fused_act, num_groups);
     }
     else
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,6 +62,8 @@ public:
     ITensorHandle              *parent_handle() override;
     bool                        is_subtensor() const override;
     Target                      target() const override;
+    Status                      import_memory(void *memory) override;
+    void                        restore_memory() override;
 
 private:
     arm_compute::GCTensor _tensor; /**< Backend Tensor */
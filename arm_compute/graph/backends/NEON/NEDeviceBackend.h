@@ -27,6 +27,10 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTable.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include <string>
 
 namespace arm_compute
 {
@@ -39,6 +43,8 @@ class NEDeviceBackend final : public IDeviceBackend
 {
 public:
     NEDeviceBackend();
+    /** Destructor */
+    ~NEDeviceBackend();
 
     // Inherited overridden methods
     void initialize_backend() override;
@@ -53,7 +59,10 @@ public:
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator                _allocator;         /**< NEON backend allocator */
+    NEGEMMTuner              _gemm_tuner;        /**< GEMM kernel tuner */
+    std::string              _gemm_tuner_file;   /**< Filename to load/store the GEMM tuner's values from */
+    NEConvolutionMethodTable _conv_method_table; /**< Convolution methods measured offline */
 };
 } // namespace backends
 } // namespace graph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,8 +26,11 @@
 
 #include "arm_compute/graph/ITensorHandle.h"
 
+#include "arm_compute/runtime/IMemoryRegion.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 namespace graph
@@ -62,9 +65,14 @@ public:
     ITensorHandle              *parent_handle() override;
     bool                        is_subtensor() const override;
     Target                      target() const override;
+    Status                      import_memory(void *memory) override;
+    void                        restore_memory() override;
 
 private:
-    arm_compute::Tensor _tensor; /**< Backend Tensor */
+    arm_compute::Tensor            _tensor;      /**< Backend Tensor */
+    std::unique_ptr<IMemoryRegion> _memory;      /**< Backing memory of unmanaged tensors, kept while an external buffer is imported */
+    bool                           _is_managed;  /**< True if the tensor is handled by a memory group */
+    bool                           _is_imported; /**< True if an external buffer is imported */
 };
 } // namespace backends
 } // namespace graph
@@ -143,7 +143,7 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
             break;
         case ConvolutionMethod::GEMM:
             status = GEMMConvolutionLayer::validate(input, weights, biases, output, conv_info,
-                                                    WeightsInfo(), Size2D(1, 1), ActivationLayerInfo(), num_groups);
+                                                    node.weights_info(), Size2D(1, 1), ActivationLayerInfo(), num_groups);
             break;
         case ConvolutionMethod::Winograd:
             ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups != 1, "WinogradConvolutionLayer does not support grouping!");
@@ -204,6 +204,64 @@ Status validate_depthwise_convolution_layer(DepthwiseConvolutionLayerNode &node)
     return status;
 }
 
+/** Validates a fused depthwise and pointwise convolution layer node
+ *
+ * @tparam DepthwiseSeparableConvolutionLayer Depthwise separable convolution layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename DepthwiseSeparableConvolutionLayer>
+Status validate_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedDepthwiseSeparableConvolutionLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input             = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *depthwise_weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *depthwise_biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *pointwise_weights = get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *pointwise_biases  = get_backing_tensor_info(node.input(4));
+    arm_compute::ITensorInfo *output            = get_backing_tensor_info(node.output(0));
+
+    // Validate function
+    return DepthwiseSeparableConvolutionLayer::validate(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output,
+                                                        node.depthwise_convolution_info(), node.pointwise_convolution_info(),
+                                                        node.depthwise_fused_activation(), node.fused_activation());
+}
+
+/** Validates a fused pointwise layer node
+ *
+ * @tparam FusedPointwiseLayer Fused pointwise layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename FusedPointwiseLayer>
+Status validate_fused_pointwise_layer(FusedPointwiseNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedPointwiseLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    std::vector<const arm_compute::ITensorInfo *> operands;
+    for(size_t i = 1; i < node.num_inputs(); ++i)
+    {
+        operands.emplace_back(get_backing_tensor_info(node.input(i)));
+    }
+
+    // Validate function
+    return FusedPointwiseLayer::validate(input, operands, output, node.operations());
+}
+
 /** Validates a detection output layer node
  *
  * @tparam DetectionOutputLayer DetectionOutput layer type
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_CONCURRENT_TASK_RUNNER_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_CONCURRENT_TASK_RUNNER_H__
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Share of the threads of the active scheduler */
+struct SchedulerPartition
+{
+    std::unique_ptr<IScheduler> scheduler = { nullptr }; /**< Scheduler running the kernels of the partition, nullptr to use the active scheduler */
+    std::vector<unsigned int>   cpu_ids   = {};          /**< Cores the threads of the partition are pinned to, empty if the active scheduler isn't pinned */
+};
+
+/** Splits the threads and pinned cores of the active scheduler in equal partitions
+ *
+ * @note A partition only gets its own scheduler if the C++ scheduler is available.
+ *
+ * @param[in] num_partitions Number of partitions to create.
+ * @param[in] num_threads    Total number of threads shared between the partitions.
+ *
+ * @return The partitions
+ */
+std::vector<SchedulerPartition> create_scheduler_partitions(unsigned int num_partitions, unsigned int num_threads);
+/** Makes the calling thread schedule its kernels on the given partition
+ *
+ * @param[in] partition Partition to use, nullptr to restore the active scheduler.
+ */
+void bind_scheduler_partition(SchedulerPartition *partition);
+
+/** Computes the dependencies between the tasks of a workload
+ *
+ * A task depends on the tasks producing its input tensors. Nodes which don't create a task (e.g. concatenations or splits
+ * performed through sub-tensors) are transparent: their consumers depend on the tasks producing the inputs of such nodes.
+ *
+ * @param[in]      g          Graph the workload was created from
+ * @param[in, out] workload   Workload to compute the dependencies of
+ * @param[in]      node_order Topological order of the nodes of the graph
+ */
+void configure_task_dependencies(Graph &g, ExecutionWorkload &workload, const std::vector<NodeID> &node_order);
+
+/** Executes the independent tasks of a workload concurrently
+ *
+ * The threads of the active scheduler are split in lanes: each lane has its own thread and pool of threads and picks
+ * the next task whose dependencies have all been executed. The functions run by a lane are scheduled on the lane's pool of threads.
+ */
+class ConcurrentTaskRunner final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_lanes   Maximum number of tasks executed concurrently.
+     * @param[in] num_threads Total number of threads shared between the lanes.
+     */
+    ConcurrentTaskRunner(unsigned int num_lanes, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ConcurrentTaskRunner(const ConcurrentTaskRunner &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ConcurrentTaskRunner &operator=(const ConcurrentTaskRunner &) = delete;
+    /** Destructor: join all the lanes */
+    ~ConcurrentTaskRunner();
+    /** Executes all the tasks of a workload and returns once they are all complete
+     *
+     * @param[in] workload Workload to execute. Its dependencies must have been configured using @ref configure_task_dependencies
+     */
+    void run(ExecutionWorkload &workload);
+    /** Returns the number of lanes
+     *
+     * @return Number of tasks that can be executed concurrently
+     */
+    unsigned int num_lanes() const;
+
+private:
+    /** Function ran by the thread of a lane
+     *
+     * @param[in] lane Index of the lane
+     */
+    void lane_thread(unsigned int lane);
+    /** Execute ready tasks until all the tasks of the current workload have been executed */
+    void process_tasks();
+
+    std::vector<SchedulerPartition>                                        _partitions;
+    std::vector<std::thread>                                               _threads;
+    std::mutex                                                             _m;
+    std::condition_variable                                                _cv;
+    std::condition_variable                                                _done_cv;
+    ExecutionWorkload                                                     *_workload;
+    std::vector<unsigned int>                                              _remaining_predecessors;
+    std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> _ready_tasks;
+    size_t                                                                 _num_completed_tasks;
+    unsigned int                                                           _generation;
+    unsigned int                                                           _num_active_lanes;
+    bool                                                                   _exit;
+    std::exception_ptr                                                     _exception;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_CONCURRENT_TASK_RUNNER_H__ */
@@ -41,11 +41,13 @@ namespace detail
 {
 /** Configures transition manager and execution workload
  *
- * @param[in] g        Graph to configure
- * @param[in] ctx      Graph context
- * @param[in] workload Workload to configure
+ * @param[in] g         Graph to configure
+ * @param[in] ctx       Graph context
+ * @param[in] workload  Workload to configure
+ * @param[in] manage_io (Optional) Also manage the input and output tensors of the graph.
+ *                      Their lifetime then spans the whole execution of the workload so they can be accessed before and after it.
  */
-void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload);
+void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload, bool manage_io = false);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
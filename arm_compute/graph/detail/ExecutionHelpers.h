@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,13 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Reports the tensors of a graph that still require padding after all the nodes have been configured
+ *
+ * @param[in] g Graph to check
+ *
+ * @return The number of padded tensors
+ */
+unsigned int report_padded_tensors(Graph &g);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
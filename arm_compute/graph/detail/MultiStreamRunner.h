@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_MULTI_STREAM_RUNNER_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_MULTI_STREAM_RUNNER_H__
+
+#include "arm_compute/graph/detail/ConcurrentTaskRunner.h"
+#include "arm_compute/runtime/IPoolManager.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executes several inferences of a workload concurrently
+ *
+ * Each stream runs in its own thread, on its own share of the threads of the active scheduler, and locks its own pool from the
+ * pool manager of the transition buffers. The functions and their prepared weights are shared by all the streams:
+ * before a function is executed its input and output tensors are bound to the pool of the stream, hence a function and its
+ * tensors are only used by one stream at a time while the other streams work on other parts of the graph.
+ *
+ * @note The transition buffers, including the input and output tensors of the graph, must be managed by the cross-layer memory manager
+ *       (See @ref configure_transition_manager) and its pool manager must have at least one pool per stream.
+ * @note The accessors of the input and output tensors are called by the streams one at a time. Each inference is numbered when its input
+ *       accessors are called and the output accessors of the inferences are called in the same order, so that the N-th call to the output
+ *       accessors returns the results computed from the N-th call to the input accessors.
+ */
+class MultiStreamRunner final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workload    Workload to execute. Its transition buffers must have been configured with managed input and outputs.
+     * @param[in] num_streams Number of inferences executed concurrently.
+     * @param[in] num_threads Total number of threads shared between the streams.
+     */
+    MultiStreamRunner(ExecutionWorkload &workload, unsigned int num_streams, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains mutexes) */
+    MultiStreamRunner(const MultiStreamRunner &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains mutexes) */
+    MultiStreamRunner &operator=(const MultiStreamRunner &) = delete;
+    /** Default destructor */
+    ~MultiStreamRunner() = default;
+    /** Executes inferences until one of the input or output accessors returns false
+     *
+     * @param[in] workload Workload to execute
+     */
+    void run(ExecutionWorkload &workload);
+    /** Returns the number of streams
+     *
+     * @return Number of inferences executed concurrently
+     */
+    unsigned int num_streams() const;
+
+private:
+    /** Memory bindings of a group of tensors used together */
+    struct Binding
+    {
+        MemoryMappings      mappings = {}; /**< Mappings of the managed tensors to the blobs of a pool */
+        std::vector<size_t> locks    = {}; /**< Sorted indices of the mutexes to hold while the tensors are used */
+    };
+    /** RAII object holding the mutexes of a binding and binding its tensors to a pool */
+    class BindingScope;
+
+    /** Function ran by the thread of a stream
+     *
+     * @param[in] workload Workload to execute
+     * @param[in] stream   Index of the stream
+     */
+    void stream_thread(ExecutionWorkload &workload, unsigned int stream);
+    /** Executes inferences on the given pool until the runner is stopped
+     *
+     * @param[in] workload Workload to execute
+     * @param[in] pool     Pool holding the transition buffers of the stream
+     */
+    void process_inferences(ExecutionWorkload &workload, IMemoryPool &pool);
+    /** Stops the inferences from the given one onwards
+     *
+     * @param[in] sequence Number of the first inference whose outputs are not returned
+     */
+    void stop_at(unsigned int sequence);
+
+    IPoolManager                   *_pool_manager;
+    std::vector<SchedulerPartition> _partitions;
+    std::vector<Binding>            _input_bindings;
+    std::vector<Binding>            _task_bindings;
+    std::vector<Binding>            _output_bindings;
+    std::vector<std::mutex>         _mutexes;
+    std::mutex                      _input_mutex;
+    std::mutex                      _sequence_mutex;
+    std::condition_variable         _sequence_cv;
+    unsigned int                    _next_input_sequence;
+    unsigned int                    _next_output_sequence;
+    unsigned int                    _stop_sequence;
+    std::exception_ptr              _exception;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_MULTI_STREAM_RUNNER_H__ */
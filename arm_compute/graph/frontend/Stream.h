@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,8 +65,39 @@ public:
      * @param[in] config (Optional) Graph configuration to use
      */
     void finalize(Target target, const GraphConfig &config);
+    /** Restores a graph serialized with @ref serialize_graph into the stream and finalizes it
+     *
+     * The stream must be empty. The constant tensors are read from the file, the inputs and outputs
+     * have no accessor and are bound to external buffers, see @ref run(const std::vector<ExternalBuffer> &, const std::vector<ExternalBuffer> &)
+     *
+     * @note The execution methods of the nodes aren't validated again, the target must be the one the graph was serialized for.
+     *
+     * @param[in] target   Execution target
+     * @param[in] config   Graph configuration to use, the graph is not serialized again
+     * @param[in] filename File to restore the graph from
+     */
+    void restore(Target target, const GraphConfig &config, const std::string &filename);
     /** Executes the stream **/
     void run();
+    /** Executes the stream once on external input and output buffers, see @ref GraphManager::execute_graph
+     *
+     * @param[in] inputs  Buffers to bind to the inputs of the stream, in the order the input layers were added
+     * @param[in] outputs Buffers to bind to the outputs of the stream, in the order the output layers were added
+     */
+    void run(const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs);
+    /** Checks if external buffers can be bound to the inputs and outputs of the finalized stream, see @ref GraphManager::validate_external_buffers
+     *
+     * @param[in] inputs  Buffers to bind to the inputs of the stream, in the order the input layers were added
+     * @param[in] outputs Buffers to bind to the outputs of the stream, in the order the output layers were added
+     *
+     * @return A status
+     */
+    Status validate_external_buffers(const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs);
+    /** Profiles the executions of the finalized stream
+     *
+     * @param[in] profiler Profiler to record the executions into. Pass nullptr to stop profiling.
+     */
+    void set_profiler(std::shared_ptr<GraphProfiler> profiler);
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,12 +41,14 @@ public:
      * @param[in] method         (Optional) Convolution method to use
      * @param[in] fast_math_hint (Optional) Fast math hint
      * @param[in] out_quant_info (Optional) Output quantization info
+     * @param[in] weights_info   (Optional) Weights information, the weights are passed reshaped to the backend function if stated so (NEON GEMM convolution only)
      */
     ConvolutionLayerNode(PadStrideInfo     info,
                          unsigned int      num_groups     = 1,
                          ConvolutionMethod method         = ConvolutionMethod::Default,
                          FastMathHint      fast_math_hint = FastMathHint::Disabled,
-                         QuantizationInfo  out_quant_info = QuantizationInfo());
+                         QuantizationInfo  out_quant_info = QuantizationInfo(),
+                         WeightsInfo       weights_info   = WeightsInfo());
     /** Sets the convolution layer method to use
      *
      * @param[in] method Method to use for convolution
@@ -90,6 +92,11 @@ public:
      * @param[in] fused_activation Fused activation to set
      */
     void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Returns the weights information
+     *
+     * @return Weights information
+     */
+    WeightsInfo weights_info() const;
     /** Computes convolution output descriptor
      *
      * @param[in] input_descriptor   Input descriptor
@@ -118,6 +125,7 @@ private:
     FastMathHint        _fast_math_hint;
     QuantizationInfo    _out_quant_info;
     ActivationLayerInfo _fused_activation;
+    WeightsInfo         _weights_info;
 };
 } // namespace graph
 } // namespace arm_compute
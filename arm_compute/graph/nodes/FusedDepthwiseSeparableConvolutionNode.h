@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_SEPARABLE_CONVOLUTION_NODE_H__
+#define __ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_SEPARABLE_CONVOLUTION_NODE_H__
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Depthwise Convolution and 1x1 Convolution node
+ *
+ * Inputs are: input, depthwise weights, depthwise biases, pointwise weights and pointwise biases.
+ */
+class FusedDepthwiseSeparableConvolutionNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] depthwise_info     Depthwise convolution layer attributes.
+     * @param[in] pointwise_info     Pointwise convolution layer attributes.
+     * @param[in] depthwise_act_info (Optional) Activation fused to the depthwise convolution. Disabled if not specified
+     * @param[in] pointwise_act_info (Optional) Activation fused to the pointwise convolution. Disabled if not specified
+     * @param[in] out_quant_info     (Optional) Output quantization info
+     */
+    FusedDepthwiseSeparableConvolutionNode(PadStrideInfo       depthwise_info,
+                                           PadStrideInfo       pointwise_info,
+                                           ActivationLayerInfo depthwise_act_info = ActivationLayerInfo(),
+                                           ActivationLayerInfo pointwise_act_info = ActivationLayerInfo(),
+                                           QuantizationInfo    out_quant_info     = QuantizationInfo());
+    /** Depthwise convolution metadata accessor
+     *
+     * @return Depthwise convolution information
+     */
+    PadStrideInfo depthwise_convolution_info() const;
+    /** Pointwise convolution metadata accessor
+     *
+     * @return Pointwise convolution information
+     */
+    PadStrideInfo pointwise_convolution_info() const;
+    /** Returns the activation fused to the depthwise convolution
+     *
+     * @return Depthwise fused activation
+     */
+    ActivationLayerInfo depthwise_fused_activation() const;
+    /** Returns the activation fused to the pointwise convolution
+     *
+     * @return Pointwise fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets the activation fused to the pointwise convolution
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Computes the fused convolutions output descriptor
+     *
+     * @param[in] input_descriptor             Input descriptor
+     * @param[in] depthwise_weights_descriptor Depthwise weights descriptor
+     * @param[in] pointwise_weights_descriptor Pointwise weights descriptor
+     * @param[in] depthwise_info               Depthwise convolution operation attributes
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &depthwise_weights_descriptor,
+                                                      const TensorDescriptor &pointwise_weights_descriptor,
+                                                      const PadStrideInfo    &depthwise_info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedDepthwiseSeparableConvolutionLayer;
+
+private:
+    PadStrideInfo       _depthwise_info;
+    PadStrideInfo       _pointwise_info;
+    ActivationLayerInfo _depthwise_act_info;
+    ActivationLayerInfo _pointwise_act_info;
+    QuantizationInfo    _out_quant_info;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_SEPARABLE_CONVOLUTION_NODE_H__ */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_FUSED_POINTWISE_NODE_H__
+#define __ARM_COMPUTE_GRAPH_FUSED_POINTWISE_NODE_H__
+
+#include "arm_compute/graph/INode.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused chain of pointwise operations node
+ *
+ * Inputs are: the input of the chain followed by the operands of the operations, see @ref PointwiseOperation.
+ */
+class FusedPointwiseNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] operations   Chain of operations to apply, in order
+     * @param[in] num_operands Number of operands of the operations
+     */
+    FusedPointwiseNode(std::vector<PointwiseOperation> operations, unsigned int num_operands);
+    /** Operations accessor
+     *
+     * @return Chain of operations performed by the node
+     */
+    const std::vector<PointwiseOperation> &operations() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedPointwiseLayer;
+
+private:
+    std::vector<PointwiseOperation> _operations;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_FUSED_POINTWISE_NODE_H__ */
@@ -45,6 +45,8 @@ class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
+class FusedDepthwiseSeparableConvolutionNode;
+class FusedPointwiseNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class NormalizationLayerNode;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2018 ARM Limited.
+ * Copyright (c) 2016-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_CPPSCHEDULER_H__
 #define __ARM_COMPUTE_CPPSCHEDULER_H__
 
+#include "arm_compute/runtime/CPUUtils.h"
 #include "arm_compute/runtime/IScheduler.h"
 
 #include <list>
@@ -34,6 +35,14 @@ namespace arm_compute
 class CPPScheduler : public IScheduler
 {
 public:
+    /** Constructor: create a pool of threads.
+     *
+     * @note Most users should use the scheduler singleton returned by @ref get(). Separate instances are useful to run
+     *       several functions concurrently, each one on its own pool of threads (See @ref Scheduler::set_thread_scheduler).
+     */
+    CPPScheduler();
+    /** Destructor: join all the threads of the pool. */
+    ~CPPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
@@ -44,6 +53,21 @@ public:
      * @return Number of threads available in CPPScheduler.
      */
     unsigned int num_threads() const override;
+    /** Sets the policy used by the worker threads to wait for new work and by the caller to wait for the workers to finish.
+     *
+     * @param[in] policy     Wait policy to use.
+     * @param[in] spin_count Number of busy-wait iterations before blocking. Ignored if policy is @ref WaitPolicy::BLOCK.
+     */
+    void set_wait_policy(WaitPolicy policy, unsigned int spin_count) override;
+    /** Pins the threads of the scheduler to the given cores.
+     *
+     * The thread calling this function is pinned to cpu_ids[0] and worker thread i to cpu_ids[(i + 1) % cpu_ids.size()].
+     * The original affinity of that thread is restored when the scheduler is reconfigured or destroyed from the same thread.
+     *
+     * @param[in] cpu_ids Ids of the cores to pin the threads to. If empty, the threads get their original affinity back,
+     *                    which keeps them within the CPUs the process is allowed to run on.
+     */
+    void set_affinity(const std::vector<unsigned int> &cpu_ids) override;
 
     /** Access the scheduler singleton
      *
@@ -70,11 +94,12 @@ protected:
 
 private:
     class Thread;
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
+    /** Pass the affinity currently set to the worker threads and pin the calling thread. */
+    void apply_affinity();
 
     unsigned int      _num_threads;
     std::list<Thread> _threads;
+    ThreadAffinity    _caller_affinity{};
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+#define __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of threads where each worker owns a queue of workloads.
+ *
+ * The workloads are distributed in contiguous blocks over the per-thread queues before the workers are woken up.
+ * A worker first drains its own queue and then steals workloads from the queues of the other workers until all of them are empty.
+ * Contrary to @ref CPPScheduler there is no counter shared by all the workers.
+ */
+class CPPWorkStealingScheduler : public IScheduler
+{
+public:
+    /** Destructor */
+    ~CPPWorkStealingScheduler();
+    /** Sets the number of threads the scheduler will use to run the kernels.
+     *
+     * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
+     */
+    void set_num_threads(unsigned int num_threads) override;
+    /** Returns the number of threads that the CPPWorkStealingScheduler has in its pool.
+     *
+     * @return Number of threads available in CPPWorkStealingScheduler.
+     */
+    unsigned int num_threads() const override;
+
+    /** Access the scheduler singleton
+     *
+     * @return The scheduler
+     */
+    static CPPWorkStealingScheduler &get();
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * The kernel will run on a single thread if any of these conditions is true:
+     * - ICPPKernel::is_parallelisable() returns false
+     * - The scheduler has been initialized with only one thread.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    class Thread;
+    class WorkQueue;
+    /** Constructor: create a pool of threads. */
+    CPPWorkStealingScheduler();
+
+    unsigned int                            _num_threads;
+    std::vector<std::unique_ptr<WorkQueue>> _queues;
+    std::list<Thread>                       _threads;
+};
+}
+#endif /* __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__ */
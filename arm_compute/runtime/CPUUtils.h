@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 #define __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 
+#include <vector>
+
 namespace arm_compute
 {
 class CPUInfo;
@@ -40,5 +42,46 @@ void get_cpu_configuration(CPUInfo &cpuinfo);
  * @return The minumum number of common cores.
  */
 unsigned int get_threads_hint();
+/** Returns the ids of all the CPUs of the system, sorted from the fastest to the slowest core.
+ *
+ * Cores are ranked using their maximum frequency when the kernel exposes it, otherwise
+ * the little cores (A53, A55) are placed after all the other ones. Ties are broken using the CPU id.
+ *
+ * @param[in] cpuinfo @ref CPUInfo holding the system's cpu configuration.
+ *
+ * @return The sorted list of CPU ids.
+ */
+std::vector<unsigned int> get_cpu_ids_big_cores_first(const CPUInfo &cpuinfo);
+/** Restrict the calling thread to run on a single CPU.
+ *
+ * @note To let the thread run on other CPUs again, save its affinity with @ref get_thread_affinity before
+ *       pinning it and pass it to @ref restore_thread_affinity afterwards.
+ *
+ * @param[in] cpu_id Id of the CPU to run on.
+ *
+ * @return True if the affinity of the thread was successfully updated.
+ */
+bool set_thread_affinity(unsigned int cpu_id);
+/** Affinity of a thread */
+struct ThreadAffinity
+{
+    int                       tid{ -1 };  /**< Id of the thread, negative if the affinity is unknown */
+    std::vector<unsigned int> cpu_ids{}; /**< Ids of the CPUs the thread is allowed to run on */
+};
+/** Get the affinity of the calling thread.
+ *
+ * @return The affinity of the thread, with a negative thread id if it can't be queried.
+ */
+ThreadAffinity get_thread_affinity();
+/** Restore the affinity of the calling thread previously returned by @ref get_thread_affinity.
+ *
+ * @note Thread ids can be reused once a thread exits, therefore the affinity is only restored
+ *       if it was queried on the calling thread.
+ *
+ * @param[in] affinity Affinity to restore. Nothing is done if its thread id is not the one of the calling thread.
+ *
+ * @return True if the affinity of the thread was successfully restored.
+ */
+bool restore_thread_affinity(const ThreadAffinity &affinity);
 }
 #endif /* __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__ */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_HUGEPAGEALLOCATOR_H__
+#define __ARM_COMPUTE_HUGEPAGEALLOCATOR_H__
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+/** CPU allocator backing large allocations with huge pages
+ *
+ * Allocations of at least the given threshold are mapped directly from the OS, aligned to a huge page boundary and advised to
+ * be backed by transparent huge pages, which reduces the TLB pressure when accessing large weights or memory pools.
+ * They can optionally be bound to a NUMA node. Smaller allocations come from the heap. All the allocations honour the requested alignment.
+ *
+ * @note On bare metal all the allocations come from the heap.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Size in bytes of a huge page */
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    /** Constructor
+     *
+     * @param[in] threshold (Optional) Minimum size in bytes of the allocations backed by huge pages. Defaults to the size of a huge page
+     * @param[in] numa_node (Optional) NUMA node to bind the huge page allocations to. Defaults to -1 which keeps the default memory policy
+     */
+    HugePageAllocator(size_t threshold = huge_page_size, int numa_node = -1);
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+    /** Destructor: releases the allocations which were not freed */
+    ~HugePageAllocator();
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    /** Backing memory of an allocation */
+    struct Allocation
+    {
+        void  *base;   /**< Pointer returned by the OS or the heap */
+        size_t length; /**< Length of the mapping, 0 for heap allocations */
+    };
+
+    size_t                       _threshold;
+    int                          _numa_node;
+    std::mutex                   _mtx;
+    std::map<void *, Allocation> _allocations;
+};
+} // arm_compute
+#endif /*__ARM_COMPUTE_HUGEPAGEALLOCATOR_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 
 #include <functional>
+#include <vector>
 
 namespace arm_compute
 {
@@ -42,6 +43,18 @@ public:
         STATIC,  /**< Split the workload evenly among the threads */
         DYNAMIC, /**< Split the workload dynamically using a bucket system */
     };
+    /** Policies available to the worker threads to wait for new work */
+    enum class WaitPolicy
+    {
+        BLOCK,           /**< Block on a condition variable straight away */
+        SPIN_THEN_BLOCK, /**< Busy-wait for a limited number of iterations before blocking on a condition variable */
+    };
+    /** Policies available to place the threads on the CPU cores */
+    enum class AffinityPolicy
+    {
+        NONE,            /**< Let the operating system place and migrate the threads */
+        BIG_CORES_FIRST, /**< Pin the threads to the cores sorted from the fastest to the slowest one */
+    };
     /** Scheduler hints
      *
      * Collection of preferences set by the function regarding how to split a given workload
@@ -138,11 +151,54 @@ public:
      */
     virtual void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag);
 
+    /** Sets the policy used by the worker threads to wait for new work and by the caller to wait for the workers to finish.
+     *
+     * Spinning avoids the cost of putting a thread to sleep and waking it up again when kernels are scheduled back to back,
+     * at the expense of keeping the cores busy while there is no work to do.
+     *
+     * @note Only @ref CPPScheduler implements the spinning policy, the other schedulers ignore this setting.
+     *
+     * @param[in] policy     Wait policy to use.
+     * @param[in] spin_count Number of busy-wait iterations before blocking. Ignored if policy is @ref WaitPolicy::BLOCK.
+     */
+    virtual void set_wait_policy(WaitPolicy policy, unsigned int spin_count);
+    /** Returns the policy used by the threads to wait for new work.
+     *
+     * @return The wait policy.
+     */
+    WaitPolicy wait_policy() const;
+    /** Returns the number of busy-wait iterations done before blocking.
+     *
+     * @return Number of iterations, 0 if the policy is @ref WaitPolicy::BLOCK.
+     */
+    unsigned int spin_count() const;
+    /** Pins the threads of the scheduler to the cores selected by the given policy.
+     *
+     * @param[in] policy Affinity policy to use.
+     */
+    void set_affinity_policy(AffinityPolicy policy);
+    /** Pins the threads of the scheduler to the given cores.
+     *
+     * The thread calling this function (and later set_num_threads()) is pinned to cpu_ids[0], the fastest core
+     * when the ids come from @ref AffinityPolicy::BIG_CORES_FIRST, and worker thread i to cpu_ids[(i + 1) % cpu_ids.size()].
+     * schedule() is expected to be called from that same thread.
+     *
+     * @note Only @ref CPPScheduler pins its threads, the other schedulers ignore this setting.
+     *
+     * @param[in] cpu_ids Ids of the cores to pin the threads to. If empty, the threads are allowed to run on any core.
+     */
+    virtual void set_affinity(const std::vector<unsigned int> &cpu_ids);
+    /** Returns the ids of the cores the threads are pinned to.
+     *
+     * @return The list of CPU ids, empty if the threads are not pinned.
+     */
+    const std::vector<unsigned int> &affinity() const;
+
     /** Get CPU info.
      *
      * @return CPU info.
      */
-    CPUInfo &cpu_info();
+    virtual CPUInfo &cpu_info();
     /** Get a hint for the best possible number of execution threads
      *
      * @warning In case we can't work out the best number of threads,
@@ -164,6 +220,9 @@ protected:
 
 private:
     unsigned int _num_threads_hint = {};
+    WaitPolicy                _wait_policy{ WaitPolicy::BLOCK };
+    unsigned int              _spin_count{ 0 };
+    std::vector<unsigned int> _affinity{};
 };
 }
 #endif /* __ARM_COMPUTE_ISCHEDULER_H__ */
@@ -61,6 +61,17 @@ public:
     void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
     bool are_all_finalized() const override;
 
+    /** Returns the memory backing an object once the lifetimes of its group are finalized
+     *
+     * The memory is the key of the object in the mappings of the group (See @ref IMemoryGroup::mappings).
+     *
+     * @param[in] group Group managing the object
+     * @param[in] obj   Managed object
+     *
+     * @return The memory of the object, nullptr if the object isn't part of a finalized group
+     */
+    IMemory *finalized_memory(IMemoryGroup *group, void *obj) const;
+
 protected:
     /** Update blobs and mappings */
     virtual void update_blobs_and_mappings() = 0;
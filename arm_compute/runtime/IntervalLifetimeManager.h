@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_INTERVALLIFETIMEMANAGER_H__
+#define __ARM_COMPUTE_INTERVALLIFETIMEMANAGER_H__
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+
+#include "arm_compute/runtime/Types.h"
+
+#include <map>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryPool;
+
+/** Concrete class that tracks the lifetime intervals of registered tensors and
+ *  plans their offsets in a single blob
+ *
+ * The lifetime of an object spans from the call to start_lifetime() to the call to end_lifetime(). Once all the objects of a group are finalized,
+ * they are placed in decreasing order of size at the best fitting offset, i.e. in the smallest gap left by the already placed objects
+ * whose lifetime overlaps with their own. Contrary to @ref OffsetLifetimeManager, objects with disjoint lifetimes of different sizes can
+ * share memory without reserving the size of the largest of them.
+ */
+class IntervalLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    /** Constructor */
+    IntervalLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    IntervalLifetimeManager(const IntervalLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    IntervalLifetimeManager &operator=(const IntervalLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    IntervalLifetimeManager(IntervalLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    IntervalLifetimeManager &operator=(IntervalLifetimeManager &&) = default;
+    /** Returns the size of the blob planned for the finalized groups
+     *
+     * @return Size in bytes of the blob
+     */
+    size_t planned_size() const;
+    /** Returns the size a blob would need if the objects of the finalized groups didn't share any memory
+     *
+     * @return Sum of the sizes in bytes of the objects of the largest group
+     */
+    size_t naive_size() const;
+
+    // Inherited methods overridden:
+    void start_lifetime(void *obj) override;
+    void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    /** Lifetime interval of an object */
+    struct Interval
+    {
+        size_t start; /**< Time the lifetime of the object started at */
+        size_t end;   /**< Time the lifetime of the object ended at */
+    };
+
+    BlobInfo _blob;                          /**< Memory blob size */
+    size_t   _naive_size;                    /**< Size required without memory sharing */
+    size_t   _time;                          /**< Logical time of the active group */
+    std::map<void *, Interval> _intervals;  /**< Lifetime intervals of the objects of the active group */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_INTERVALLIFETIMEMANAGER_H__ */
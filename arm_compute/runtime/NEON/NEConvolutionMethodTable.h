@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECONVOLUTIONMETHODTABLE_H__
+#define __ARM_COMPUTE_NECONVOLUTIONMETHODTABLE_H__
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Table of the convolution methods to use for known convolution configurations
+ *
+ * A configuration is identified by the data type and layout, the input dimensions, the kernel size, the number of
+ * output feature maps, the padding, the stride, the dilation and the number of threads. Entries registered with
+ * @ref any_num_threads apply to every number of threads.
+ *
+ * The table is typically filled offline by timing every valid @ref ConvolutionMethod of each configuration
+ * (see examples/neon_convolution_method_tuner.cpp) and loaded at runtime with load_from_file().
+ *
+ * @note The table is used by @ref NEConvolutionLayer once registered with NEConvolutionLayer::set_method_table()
+ */
+class NEConvolutionMethodTable
+{
+public:
+    /** Number of threads matching any number of threads */
+    static constexpr unsigned int any_num_threads = 0;
+
+    /** Constructor
+     *
+     * @param[in] add_known_configs (Optional) Add the entries of the configurations of well known networks measured on a reference platform
+     */
+    NEConvolutionMethodTable(bool add_known_configs = true);
+
+    /** Build the identifier of a convolution configuration
+     *
+     * @param[in] input       Source tensor info.
+     * @param[in] weights     Weights tensor info.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation    Dilation, in elements, across x and y.
+     * @param[in] num_threads Number of threads the convolution runs on, @ref any_num_threads for any.
+     *
+     * @return The identifier of the configuration
+     */
+    static std::string config_id(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, unsigned int num_threads);
+
+    /** Add the method to use for a configuration
+     *
+     * @param[in] config_id Identifier of the configuration as returned by @ref config_id
+     * @param[in] method    Convolution method to use for the configuration
+     */
+    void add_method(const std::string &config_id, ConvolutionMethod method);
+    /** Look up the method to use for a configuration
+     *
+     * The entry of the given number of threads is used if present, otherwise the entry of @ref any_num_threads.
+     *
+     * @param[in]  input       Source tensor info.
+     * @param[in]  weights     Weights tensor info.
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation    Dilation, in elements, across x and y.
+     * @param[in]  num_threads Number of threads the convolution runs on.
+     * @param[out] method      Convolution method to use. Left unchanged if the configuration is not in the table.
+     *
+     * @return True if the configuration is present in the table
+     */
+    bool find_method(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, unsigned int num_threads, ConvolutionMethod &method) const;
+    /** Remove all the entries of the table */
+    void clear();
+    /** Give read access to the table
+     *
+     * @return The table as unordered_map container
+     */
+    const std::unordered_map<std::string, ConvolutionMethod> &table() const;
+
+    /** Load entries from file and add them to the table
+     *
+     * @param[in] filename Load the entries from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the table to file
+     *
+     * @param[in] filename Save the table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, ConvolutionMethod> _table;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NECONVOLUTIONMETHODTABLE_H__ */
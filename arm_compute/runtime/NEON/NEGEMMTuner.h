@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMTUNER_H__
+#define __ARM_COMPUTE_NEGEMMTUNER_H__
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner selecting the assembly GEMM kernel to use for each GEMM configuration
+ *
+ * The table maps a GEMM configuration (data type, CPU model, M, N, K, batches, multis, number of threads, ...)
+ * to the name of the arm_gemm kernel to run for it. When tuning of new configurations is enabled,
+ * @ref NEGEMMAssemblyDispatch times every compatible kernel of a configuration missing from the table and records the fastest one.
+ *
+ * @note The tuner is used by @ref NEGEMMAssemblyDispatch once registered with NEGEMMAssemblyDispatch::set_tuner()
+ */
+class NEGEMMTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_kernels Find the fastest kernel for GEMM configurations which are not present in the table ?
+     */
+    NEGEMMTuner(bool tune_new_kernels = true);
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    NEGEMMTuner(const NEGEMMTuner &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    NEGEMMTuner &operator=(const NEGEMMTuner &) = delete;
+    /** Destructor */
+    ~NEGEMMTuner() = default;
+
+    /** Setter for tune_new_kernels option
+     *
+     * @param[in] tune_new_kernels Find the fastest kernel for GEMM configurations which are not present in the table ?
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+    /** Tune GEMM configurations that are not in the kernel table
+     *
+     * @return True if tuning of new configurations is enabled.
+     */
+    bool tune_new_kernels() const;
+    /** Set the number of timed runs of each candidate kernel
+     *
+     * @param[in] num_iterations Number of runs timed for each kernel, the fastest run is kept. Must be greater than 0.
+     */
+    void set_num_iterations(unsigned int num_iterations);
+    /** Get the number of timed runs of each candidate kernel
+     *
+     * @return The number of timed runs of each candidate kernel
+     */
+    unsigned int num_iterations() const;
+
+    /** Manually add a kernel for a GEMM configuration
+     *
+     * @param[in] gemm_id     Unique identifier of the GEMM configuration
+     * @param[in] kernel_name Name of the arm_gemm kernel to use for the given configuration
+     */
+    void add_kernel_to_table(const std::string &gemm_id, const std::string &kernel_name);
+    /** Look up the kernel to use for a GEMM configuration
+     *
+     * @param[in]  gemm_id     Unique identifier of the GEMM configuration
+     * @param[out] kernel_name Name of the arm_gemm kernel to use. Left unchanged if the configuration is not in the table.
+     *
+     * @return True if the configuration is present in the table
+     */
+    bool find_kernel(const std::string &gemm_id, std::string &kernel_name) const;
+    /** Import kernel table
+     *
+     * @param[in] kernel_table The unordered_map container to import
+     */
+    void import_kernel_table(const std::unordered_map<std::string, std::string> &kernel_table);
+    /** Give read access to the kernel table
+     *
+     * @return The kernel table as unordered_map container
+     */
+    const std::unordered_map<std::string, std::string> &kernel_table() const;
+
+    /** Load the kernel table from file
+     *
+     * @param[in] filename Load the kernel table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the kernel table to file
+     *
+     * @param[in] filename Save the kernel table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, std::string> _kernel_table;
+    mutable std::mutex _mtx;
+    bool               _tune_new_kernels;
+    unsigned int       _num_iterations;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMTUNER_H__ */
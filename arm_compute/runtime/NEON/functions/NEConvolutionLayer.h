@@ -37,12 +37,16 @@
 namespace arm_compute
 {
 class ITensor;
+class NEConvolutionMethodTable;
 
 /** Basic function to simulate a convolution layer. This function calls one of the following NEON functions:
  * -# @ref NEGEMMConvolutionLayer     (executed only in case GEMM is required for the operation)
  * -# @ref NEWinogradConvolutionLayer (executed only in case Winograd is required for the operation)
  * -# @ref NEDirectConvolutionLayer   (executed only in case Direct Convolution is required for the operation)
  * -# @ref NEFFTConvolutionLayer      (executed only in case FFT is required for the operation)
+ *
+ * The method is the one of the configuration in the registered @ref NEConvolutionMethodTable if present and valid,
+ * otherwise the valid method with the lowest estimated cost.
  */
 class NEConvolutionLayer : public IFunction
 {
@@ -115,6 +119,13 @@ public:
      */
     static ConvolutionMethod get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
                                                     const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Set the table of the convolution methods used by the functions configured afterwards
+     *
+     * @note The table must outlive the configuration of the functions.
+     *
+     * @param[in] table Table to use. Pass nullptr to use the default table, which only contains the configurations of well known networks.
+     */
+    static void set_method_table(const NEConvolutionMethodTable *table);
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
@@ -51,7 +51,7 @@ public:
     NEDepthConcatenateLayer();
     /** Initialise the kernel's inputs vector and output.
      *
-     * @param[in,out] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/F16/F32.
+     * @param[in,out] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      *                              Input dimensions might differ for each input for the first three dimensions (width, height, depth)
      *                              and must match for the rest.
      *                              Note that the difference between the minimum and maximum width and height among the input tensors
@@ -65,7 +65,7 @@ public:
     void configure(const std::vector<ITensor *> &inputs_vector, ITensor *output);
     /** Static function to check if given info will lead to a valid configuration of @ref NEDepthConcatenateLayer
      *
-     * @param[in] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/F16/F32.
+     * @param[in] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      *                          Input dimensions might differ for each input for the first three dimensions (width, height, depth)
      *                          and must match for the rest.
      *                          Note that the difference between the minimum and maximum width and height among the input tensors
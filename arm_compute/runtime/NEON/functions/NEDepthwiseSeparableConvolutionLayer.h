@@ -24,20 +24,28 @@
 #ifndef __ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__
 #define __ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__
 
+#include "arm_compute/core/NEON/kernels/NEDepthwiseSeparableConvolutionLayerKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
+#include <memory>
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to execute depthwise convolution. This function calls the following NEON kernels and function:
+/** Basic function to execute depthwise separable convolution. This function calls the following NEON kernels and function:
  *
+ * If the depthwise output is not requested, the data layout is NHWC and the pointwise convolution is a 1x1 convolution with unit strides and no padding:
+ * -# @ref NEDepthwiseSeparableConvolutionLayerKernel
+ *
+ * otherwise:
  * -# @ref NEDepthwiseConvolutionLayer
  * -# @ref NEDirectConvolutionLayer
  *
@@ -46,7 +54,7 @@ class NEDepthwiseSeparableConvolutionLayer : public IFunction
 {
 public:
     /** Default constructor */
-    NEDepthwiseSeparableConvolutionLayer();
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Set the input and output tensors.
      *
      * @param[in]  input               Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
@@ -66,14 +74,81 @@ public:
     void configure(ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, ITensor *depthwise_out,
                    const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
                    const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info);
+    /** Set the input and output tensors.
+     *
+     * The depthwise output is kept internal, which allows the two convolutions to be fused when supported.
+     *
+     * @param[in]  input               Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                                 while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32.
+     * @param[in]  depthwise_weights   Depthwise convolution weights tensor. These are 3D tensors with dimensions [kernel_x, kernel_y, IFM]. Data type supported: Same as @p input.
+     * @param[in]  depthwise_biases    (Optional) Biases tensor.Biases are 1D tensor with dimensions [IFM]. Must be nullptr if not needed.
+     *                                 Data type supported: Same as @p weights.
+     * @param[in]  pointwise_weights   Pointwise convolution weights tensor. These are 4D tensors with dimensions [1, 1, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pointwise_biases    (Optional) Biases tensor. Biases are 1D tensor with dimensions [OFM]. Must be nullptr if not needed.
+     *                                 Data type supported: Same as @p weights.
+     * @param[out] output              Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                                 Data types supported: Same as @p input.
+     * @param[in]  depthwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for depthwise convolution.
+     * @param[in]  pointwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for pointwise convolution.
+     * @param[in]  depthwise_act_info  (Optional) Activation layer information applied to the depthwise output.
+     * @param[in]  pointwise_act_info  (Optional) Activation layer information applied to the pointwise output.
+     */
+    void configure(ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases,
+                   const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
+                   const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                   const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayer
+     *
+     * @param[in] input               Source tensor info. Data types supported: F16/F32.
+     * @param[in] depthwise_weights   Depthwise convolution weights tensor info. Data type supported: Same as @p input.
+     * @param[in] depthwise_biases    (Optional) Depthwise biases tensor info. Data type supported: Same as @p input.
+     * @param[in] pointwise_weights   Pointwise convolution weights tensor info. Data type supported: Same as @p input.
+     * @param[in] pointwise_biases    (Optional) Pointwise biases tensor info. Data type supported: Same as @p input.
+     * @param[in] output              Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] depthwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for depthwise convolution.
+     * @param[in] pointwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for pointwise convolution.
+     * @param[in] depthwise_act_info  (Optional) Activation layer information applied to the depthwise output.
+     * @param[in] pointwise_act_info  (Optional) Activation layer information applied to the pointwise output.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases,
+                           const ITensorInfo *pointwise_weights, const ITensorInfo *pointwise_biases, const ITensorInfo *output,
+                           const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                           const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
 
     // Inherited methods overriden:
     void run() override;
     void prepare() override;
 
 private:
-    NEDepthwiseConvolutionLayer _depthwise_conv;
-    NEDirectConvolutionLayer    _pointwise_conv;
+    /** Checks if the two convolutions can be computed by @ref NEDepthwiseSeparableConvolutionLayerKernel
+     *
+     * @param[in] input               Source tensor info.
+     * @param[in] depthwise_weights   Depthwise convolution weights tensor info.
+     * @param[in] depthwise_biases    Depthwise biases tensor info. Can be nullptr.
+     * @param[in] pointwise_weights   Pointwise convolution weights tensor info.
+     * @param[in] pointwise_biases    Pointwise biases tensor info. Can be nullptr.
+     * @param[in] output              Destination tensor info.
+     * @param[in] depthwise_conv_info Padding and stride information of the depthwise convolution.
+     * @param[in] pointwise_conv_info Padding and stride information of the pointwise convolution.
+     * @param[in] depthwise_act_info  Activation layer information applied to the depthwise output.
+     * @param[in] pointwise_act_info  Activation layer information applied to the pointwise output.
+     *
+     * @return True if the fused kernel can be used
+     */
+    static bool is_fused_supported(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases,
+                                   const ITensorInfo *pointwise_weights, const ITensorInfo *pointwise_biases, const ITensorInfo *output,
+                                   const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                   const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info);
+
+    MemoryGroup                                _memory_group;
+    NEDepthwiseConvolutionLayer                _depthwise_conv;
+    NEDirectConvolutionLayer                   _pointwise_conv;
+    NEDepthwiseSeparableConvolutionLayerKernel _fused_kernel;
+    Tensor                                     _depthwise_out;
+    Tensor                                     _workspace;
+    bool                                       _is_fused;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,9 @@
 
 #include "arm_compute/runtime/IFunction.h"
 
+#include "arm_compute/core/NEON/kernels/NEDynamicQuantizationLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFlattenLayerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpDynamicDequantizeKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixAccumulateBiasesKernel.h"
 #include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -49,13 +51,13 @@ class NEFullyConnectedLayerReshapeWeights : public INESimpleFunctionNoBorder
 public:
     /** Set the input and output tensors.
      *
-     * @param[in]  input  Weights tensor. The weights must be 2 dimensional. Data types supported: QASYMM8/F16/F32.
+     * @param[in]  input  Weights tensor. The weights must be 2 dimensional. Data types supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[out] output Destination tensor. Data type supported: Same as @p input.
      */
     void configure(const ITensor *input, ITensor *output);
     /** Static function to check if given info will lead to a valid configuration of @ref NEFullyConnectedLayerReshapeWeights
      *
-     * @param[in] input  Weights tensor info. The weights must be 2 dimensional. Data types supported: QASYMM8/F16/F32.
+     * @param[in] input  Weights tensor info. The weights must be 2 dimensional. Data types supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[in] output Destination tensor info. Data type supported: Same as @p input.
      *
      * @return a status
@@ -69,6 +71,13 @@ public:
  *  -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric)
  *  -# @ref NEGEMMMatrixAccumulateBiasesKernel or @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
+ * If dynamic quantization is requested through @ref FullyConnectedLayerInfo, the F32 weights are quantized once per output channel and the input is quantized
+ * per row at each run, the function then calls the following NEON kernels:
+ *  -# @ref NEDynamicQuantizationLayerKernel (called once for the weights and at each run for the input)
+ *  -# @ref NEFullyConnectedLayerReshapeWeights (called once)
+ *  -# @ref NEGEMMLowpMatrixMultiplyCore
+ *  -# @ref NEGEMMLowpDynamicDequantizeKernel
+ *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
  */
 class NEFullyConnectedLayer : public IFunction
@@ -86,33 +95,33 @@ public:
     NEFullyConnectedLayer &operator=(NEFullyConnectedLayer &&) = default;
     /** Set the input and output tensors.
      *
-     * @param[in]  input   Source tensor. Data type supported: QASYMM8/F16/F32.
+     * @param[in]  input   Source tensor. Data type supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[in]  weights Weights tensor. The weights must be 2 dimensional.
      *                     If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                     If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
      *                     Data type supported: Same as @p input.
-     * @param[in]  biases  Bias tensor. Can be nullptr. Data type supported:Same as @p input.
+     * @param[in]  biases  Bias tensor. Can be nullptr. Data type supported:Same as @p input, F32 if @p input is BFLOAT16.
      * @param[out] output  Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                     - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                     - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
-     *                     Data type supported: Same as @p input.
-     * @param[in]  fc_info (Optional) Fully connected layer additional info
+     *                     Data type supported: Same as @p input, F32 if @p input is BFLOAT16.
+     * @param[in]  fc_info (Optional) Fully connected layer additional info. Dynamic quantization is only supported for F32 and requires the weights to be transposed but not reshaped.
      */
     void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output,
                    FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref NEFullyConnectedLayer
      *
-     * @param[in]  input   Source tensor info. Data type supported: QASYMM8/F16/F32.
+     * @param[in]  input   Source tensor info. Data type supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[in]  weights Weights tensor info. The weights must be 2 dimensional.
      *                     If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                     If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
      *                     Data type supported: Same as @p input.
-     * @param[in]  biases  Bias tensor info. Can be nullptr. Data type supported:Same as @p input.
+     * @param[in]  biases  Bias tensor info. Can be nullptr. Data type supported:Same as @p input, F32 if @p input is BFLOAT16.
      * @param[out] output  Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                     - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                     - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
-     *                     Data type supported: Same as @p input.
-     * @param[in]  fc_info (Optional) Fully connected layer additional info
+     *                     Data type supported: Same as @p input, F32 if @p input is BFLOAT16.
+     * @param[in]  fc_info (Optional) Fully connected layer additional info. Dynamic quantization is only supported for F32 and requires the weights to be transposed but not reshaped.
      *
      * @return a status
      */
@@ -130,6 +139,9 @@ private:
 
     MemoryGroup                                         _memory_group;
     NEFlattenLayerKernel                                _flatten_kernel;
+    NEDynamicQuantizationLayerKernel                    _quantize_weights_kernel;
+    NEDynamicQuantizationLayerKernel                    _quantize_input_kernel;
+    NEGEMMLowpDynamicDequantizeKernel                   _dequantize_kernel;
     NEConvertFullyConnectedWeights                      _convert_weights;
     NEFullyConnectedLayerReshapeWeights                 _reshape_weights_function;
     NEGEMM                                              _mm_gemm;
@@ -140,12 +152,17 @@ private:
     Tensor                                              _gemmlowp_output;
     Tensor                                              _converted_weights_output;
     Tensor                                              _reshape_weights_output;
+    Tensor                                              _quantized_weights;
+    Tensor                                              _weights_scales;
+    Tensor                                              _quantized_input;
+    Tensor                                              _input_scales;
     const ITensor                                      *_original_weights;
     bool                                                _are_weights_converted;
     bool                                                _are_weights_reshaped;
     bool                                                _is_fc_after_conv;
     bool                                                _accumulate_biases;
     bool                                                _is_quantized;
+    bool                                                _is_dynamic;
     bool                                                _is_prepared;
 };
 } // namespace arm_compute
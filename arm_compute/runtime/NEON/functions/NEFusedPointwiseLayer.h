@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDPOINTWISELAYER_H__
+#define __ARM_COMPUTE_NEFUSEDPOINTWISELAYER_H__
+
+#include "arm_compute/core/NEON/kernels/NEFusedPointwiseKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run a chain of pointwise operations in a single pass. This function calls the following NEON kernels:
+ *
+ * -# @ref NEFusedPointwiseKernel
+ *
+ * Batch normalization operations are converted to a per channel scale and shift when the function is prepared.
+ */
+class NEFusedPointwiseLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NEFusedPointwiseLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedPointwiseLayer(const NEFusedPointwiseLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedPointwiseLayer &operator=(const NEFusedPointwiseLayer &) = delete;
+    /** Allow instances of this class to be moved */
+    NEFusedPointwiseLayer(NEFusedPointwiseLayer &&) = default;
+    /** Allow instances of this class to be moved */
+    NEFusedPointwiseLayer &operator=(NEFusedPointwiseLayer &&) = default;
+    /** Set the input, operands and output of the function.
+     *
+     * @param[in]  input      Source tensor. Data types supported: F32.
+     * @param[in]  operands   Operands of the operations. Data types supported: Same as @p input.
+     *                        Elementwise operands have the same shape as @p input, batch normalization, scale and shift operands
+     *                        are 1D tensors with size equal to the channels of @p input. Batch normalization beta and gamma can be nullptr.
+     * @param[out] output     Destination tensor. Data types supported: Same as @p input. Can be @p input for in-place computation.
+     * @param[in]  operations Chain of operations to apply, in order.
+     */
+    void configure(const ITensor *input, const std::vector<const ITensor *> &operands, ITensor *output, const std::vector<PointwiseOperation> &operations);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedPointwiseLayer
+     *
+     * @param[in] input      Source tensor info. Data types supported: F32.
+     * @param[in] operands   Operands of the operations. Data types supported: Same as @p input.
+     *                       Elementwise operands have the same shape as @p input, batch normalization, scale and shift operands
+     *                       are 1D tensors with size equal to the channels of @p input. Batch normalization beta and gamma can be nullptr.
+     * @param[in] output     Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] operations Chain of operations to apply, in order.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const ITensorInfo *output, const std::vector<PointwiseOperation> &operations);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    /** Batch normalization converted to a scale and shift */
+    struct BatchNormalization
+    {
+        const ITensor          *mean;
+        const ITensor          *var;
+        const ITensor          *beta;
+        const ITensor          *gamma;
+        float                   epsilon;
+        std::unique_ptr<Tensor> scale;
+        std::unique_ptr<Tensor> shift;
+    };
+
+    NEFusedPointwiseKernel          _kernel;
+    std::vector<BatchNormalization> _batch_normalizations;
+    bool                            _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEFUSEDPOINTWISELAYER_H__ */
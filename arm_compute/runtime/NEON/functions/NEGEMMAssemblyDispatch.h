@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 #define __ARM_COMPUTE_NEGEMMASSEMBLYDISPATCH_H__
 
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -34,6 +36,8 @@
 
 namespace arm_compute
 {
+class NEGEMMTuner;
+
 /** Assembly kernel glue */
 class NEGEMMAssemblyDispatch : public IFunction
 {
@@ -85,7 +89,7 @@ public:
      *
      * @param[in]  a                 Input tensor (Matrix A)
      * @param[in]  b                 Input tensor (Matrix B)
-     * @param[out] d                 Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[out] d                 Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0 (F32 if @p input0 is BFLOAT16).
      * @param[in]  alpha             Scalar multiplier to apply to AB matrix product.
      * @param[in]  beta              Scalar multiplier to apply to input D matrix before adding product.
      * @param[in]  pretranspose_hint Can the B tensor can be pretransposed (ie shared across invocations)?
@@ -96,7 +100,7 @@ public:
      *
      * @param[in] a                 Input tensor (Matrix A)
      * @param[in] b                 Input tensor (Matrix B)
-     * @param[in] d                 Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[in] d                 Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0 (F32 if @p input0 is BFLOAT16).
      * @param[in] alpha             Scalar multiplier to apply to AB matrix product.
      * @param[in] beta              Scalar multiplier to apply to input D matrix before adding product.
      * @param[in] pretranspose_hint Can the B tensor can be pretransposed (ie shared across invocations)?
@@ -104,6 +108,98 @@ public:
      * @return a status.
      */
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint);
+    /** Configure the function to compute a convolution as an indirect GEMM.
+     *
+     * The rows of matrix A are gathered from the input through a table of offsets built at configure time,
+     * therefore no im2col matrix is needed. Out of bounds kernel positions read zeroes.
+     *
+     * @note Matrix B is pretransposed on the first run.
+     *
+     * @param[in]  a           Input tensor. Data types supported: F16/F32. Data layout supported: NHWC.
+     * @param[in]  b           Reshaped weights (Matrix B) of shape [OFM, kernel_width * kernel_height * IFM] as produced by @ref NEWeightsReshapeKernel without biases.
+     *                         Data type supported: same as @p a.
+     * @param[out] d           Output tensor. Data type and layout supported: same as @p a.
+     * @param[in]  kernel_dims Width and height of the convolution kernel.
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation    Kernel dilation.
+     */
+    void configure_indirect(const ITensor *a, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation);
+    /** Indicates whether or not this function can compute the given convolution as an indirect GEMM.
+     *
+     * @param[in] a           Input tensor info. Data types supported: F16/F32. Data layout supported: NHWC.
+     * @param[in] b           Reshaped weights info (Matrix B) of shape [OFM, kernel_width * kernel_height * IFM]. Data type supported: same as @p a.
+     * @param[in] d           Output tensor info. Data type and layout supported: same as @p a.
+     * @param[in] kernel_dims Width and height of the convolution kernel.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation    Kernel dilation.
+     *
+     * @return a status.
+     */
+    static Status validate_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation);
+    /** Configure the function to multiply the im2col matrix of an input by matrix B without running im2col.
+     *
+     * The rows of the im2col matrix are computed by each thread, one cache sized block at a time, while arm_gemm packs its
+     * A panels: no im2col tensor is needed.
+     *
+     * @note Matrix B is pretransposed on the first run.
+     *
+     * @param[in]  a           Input tensor. Data types supported: F16/F32. Data layout supported: NCHW.
+     * @param[in]  b           Reshaped weights (Matrix B) of shape [OFM, kernel_width * kernel_height * IFM (+ 1 if @p append_bias)] as produced by @ref NEWeightsReshapeKernel.
+     *                         Data type supported: same as @p a.
+     * @param[out] d           GEMM output of shape [OFM, output_width * output_height, 1, batches]. Data type supported: same as @p a.
+     * @param[in]  kernel_dims Width and height of the convolution kernel.
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation    Kernel dilation.
+     * @param[in]  append_bias True if the im2col matrix has a column of ones for the biases stored in the last row of @p b.
+     */
+    void configure_fused_im2col(const ITensor *a, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias);
+    /** Indicates whether or not this function can multiply the im2col matrix of the given input by matrix B without running im2col.
+     *
+     * @param[in] a           Input tensor info. Data types supported: F16/F32. Data layout supported: NCHW.
+     * @param[in] b           Reshaped weights info (Matrix B) of shape [OFM, kernel_width * kernel_height * IFM (+ 1 if @p append_bias)]. Data type supported: same as @p a.
+     * @param[in] d           GEMM output info of shape [OFM, output_width * output_height, 1, batches]. Data type supported: same as @p a.
+     * @param[in] kernel_dims Width and height of the convolution kernel.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation    Kernel dilation.
+     * @param[in] append_bias True if the im2col matrix has a column of ones for the biases stored in the last row of @p b.
+     *
+     * @return a status.
+     */
+    static Status validate_fused_im2col(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                       bool append_bias);
+    /** Configure the function to compute a batch of matrix multiplications with a single arm_gemm kernel.
+     *
+     * Matrix A of shape [K, M, heads, batches] is multiplied by a matrix B which is either broadcast to all the heads
+     * (shape [N, K]) or has one matrix per head (shape [N, K, heads] or [N, K, heads, batches]). The heads with their own matrix B
+     * are mapped onto the multis of arm_gemm, all the other matrices onto its batches.
+     *
+     * @param[in]  a                 Input tensor (Matrices A). Data types supported: F16/F32.
+     * @param[in]  b                 Input tensor (Matrices B). Data type supported: same as @p a.
+     * @param[out] d                 Output tensor of shape [N, M, heads, batches]. Data type supported: same as @p a.
+     * @param[in]  alpha             Scalar multiplier to apply to AB matrix product.
+     * @param[in]  beta              Scalar multiplier to apply to input D matrix before adding product.
+     * @param[in]  pretranspose_hint Can the B tensor can be pretransposed (ie shared across invocations)?
+     */
+    void configure_batched(const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, bool pretranspose_hint);
+    /** Indicates whether or not this function can compute the given batch of matrix multiplications.
+     *
+     * @param[in] a                 Input tensor info (Matrices A). Data types supported: F16/F32.
+     * @param[in] b                 Input tensor info (Matrices B). Data type supported: same as @p a.
+     * @param[in] d                 Output tensor info. Data type supported: same as @p a.
+     * @param[in] alpha             Scalar multiplier to apply to AB matrix product.
+     * @param[in] beta              Scalar multiplier to apply to input D matrix before adding product.
+     * @param[in] pretranspose_hint Can the B tensor can be pretransposed (ie shared across invocations)?
+     *
+     * @return a status.
+     */
+    static Status validate_batched(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint);
+    /** Set the tuner used to select the assembly kernels of the functions configured afterwards
+     *
+     * @note The tuner must outlive the configuration of the functions.
+     *
+     * @param[in] tuner Tuner to use. Pass nullptr to select the kernels through the arm_gemm heuristics only.
+     */
+    static void set_tuner(NEGEMMTuner *tuner);
     /** Was the function successfully configured ?
      *
      * @return True if the function is configured and ready to run
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMBATCHED_H__
+#define __ARM_COMPUTE_NEGEMMBATCHED_H__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to execute a batch of GEMMs of the same size on NEON, e.g. the heads of an attention layer.
+ *
+ * All the matrix multiplications are computed by a single assembly kernel (@ref NEGEMMAssemblyDispatch): matrix A of each head and batch
+ * is multiplied either by a single matrix B broadcast to all of them or by the matrix B of its head. The work of all the heads is split
+ * between the threads at once, therefore small GEMMs don't pay for a function, a workspace and a scheduling per head.
+ */
+class NEGEMMBatched : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMBatched(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBatched(const NEGEMMBatched &) = delete;
+    /** Default move constructor */
+    NEGEMMBatched(NEGEMMBatched &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBatched &operator=(const NEGEMMBatched &) = delete;
+    /** Default move assignment operator */
+    NEGEMMBatched &operator=(NEGEMMBatched &&) = default;
+    /** Initialise the kernel's inputs, output
+     *
+     * @note GEMM: d[h, n] = alpha * a[h, n] * b[h] for each head h and batch n.
+     *
+     * @param[in]  a         Input tensor of shape [K, M, heads, batches] (Matrices A). Data type supported: F16/F32
+     * @param[in]  b         Input tensor of shape [N, K] (broadcast to all the heads), [N, K, heads] or [N, K, heads, batches] (Matrices B). Data type supported: same as @p a
+     * @param[out] d         Output tensor of shape [N, M, heads, batches]. Data type supported: same as @p a
+     * @param[in]  alpha     (Optional) Weight of the matrix products. Defaults to 1.
+     * @param[in]  gemm_info (Optional) Only the flag reshape_b_only_on_first_run is used: set it to true only if the content of @p b doesn't change between runs.
+     *                       Matrix A and B reshapes are not supported.
+     */
+    void configure(const ITensor *a, const ITensor *b, ITensor *d, float alpha = 1.f, const GEMMInfo &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMBatched.
+     *
+     * @param[in] a         Input tensor info of shape [K, M, heads, batches] (Matrices A). Data type supported: F16/F32
+     * @param[in] b         Input tensor info of shape [N, K], [N, K, heads] or [N, K, heads, batches] (Matrices B). Data type supported: same as @p a
+     * @param[in] d         Output tensor info of shape [N, M, heads, batches]. Data type supported: same as @p a
+     * @param[in] alpha     (Optional) Weight of the matrix products. Defaults to 1.
+     * @param[in] gemm_info (Optional) Only the flag reshape_b_only_on_first_run is used. Matrix A and B reshapes are not supported.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha = 1.f, const GEMMInfo &gemm_info = GEMMInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    NEGEMMAssemblyDispatch _asm_glue;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMBATCHED_H__ */
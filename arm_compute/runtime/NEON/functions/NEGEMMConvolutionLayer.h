@@ -28,6 +28,7 @@
 
 #include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
 #include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NEWeightsReshapeKernel.h"
@@ -35,6 +36,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
@@ -56,15 +58,17 @@ public:
     NEConvolutionLayerReshapeWeights();
     /** Set the input and output tensors.
      *
-     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
+     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[in]  biases  Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     *                     Must be nullptr if @p weights is BFLOAT16.
      * @param[out] output  Destination tensor. Data types supported: Same as @p weights.
      */
     void configure(const ITensor *weights, const ITensor *biases, ITensor *output);
     /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionLayerReshapeWeights
      *
-     * @param[in] weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
+     * @param[in] weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/BFLOAT16/F16/F32.
      * @param[in] biases  Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     *                    Must be nullptr if @p weights is BFLOAT16.
      * @param[in] output  Destination tensor. Data types supported: Same as @p weights.
      *
      * @return an error status
@@ -80,11 +84,12 @@ private:
 
 /** Basic function to compute the convolution layer. This function calls the following NEON kernels/functions:
  *
- * -# @ref NEIm2ColKernel
- * -# @ref NEGEMM (if the data type is FP32 or FP16)
+ * -# @ref NEIm2ColKernel (if the data type is QASYMM8)
+ * -# @ref NEGEMM (if the data type is FP32 or FP16 and the input can't be read directly by the GEMM)
+ * -# @ref NEGEMMAssemblyDispatch (if the data type is FP32 or FP16: indirect GEMM with the NHWC data layout, GEMM computing the im2col matrix by blocks with the NCHW data layout)
  * -# @ref NEGEMMLowpMatrixMultiplyCore (if the data type is QASYMM8)
  * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if the data type is QASYMM8)
- * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution with the NHWC data layout)
+ * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution or an indirect GEMM with the NHWC data layout)
  * -# @ref NECol2ImKernel (if NCHW data layout)
  *
  */
@@ -105,15 +110,18 @@ public:
      *
      * @param[in]  input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                          while every optional dimension from 4 and above represent a batch of inputs.
-     *                          Data types supported: QASYMM8/F32.
-     * @param[in]  weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                          Data types supported: QASYMM8/BFLOAT16/F16/F32.
+     * @param[in]  weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input,
+     *                          or QSYMM8_PER_CHANNEL with one scale per OFM if @p input is QASYMM8.
      * @param[in]  biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
-     *                          Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     *                          Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type
+     *                          and input of BFLOAT16 type where biases should be of F32 type.
      * @param[out] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                          Data types supported: Same as @p input.
+     *                          Data types supported: Same as @p input, except for input of BFLOAT16 type where output should be of F32 type.
      * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in]  weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
-     *                          tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in]  weights_info Specifies if the weights tensor has been reshaped by @ref NEConvolutionLayerReshapeWeights without biases, in which case @p weights is
+     *                          a 2D tensor with dimensions [OFM, kernel_x * kernel_y * IFM] and the kernel size and number of kernels are given by @p weights_info.
+     *                          Per channel quantized weights can't be passed reshaped.
      * @param[in]  dilation     (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
      * @param[in]  act_info     (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  num_groups   (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
@@ -124,15 +132,18 @@ public:
      *
      * @param[in] input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                         while every optional dimension from 4 and above represent a batch of inputs.
-     *                         Data types supported: QASYMM8/F16/F32.
-     * @param[in] weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
+     *                         Data types supported: QASYMM8/BFLOAT16/F16/F32.
+     * @param[in] weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input,
+     *                         or QSYMM8_PER_CHANNEL with one scale per OFM if @p input is QASYMM8.
      * @param[in] biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
-     *                         Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     *                         Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type
+     *                         and input of BFLOAT16 type where biases should be of F32 type.
      * @param[in] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                         Data types supported: Same as @p input.
+     *                         Data types supported: Same as @p input, except for input of BFLOAT16 type where output should be of F32 type.
      * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in] weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
-     *                         tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in] weights_info Specifies if the weights tensor has been reshaped by @ref NEConvolutionLayerReshapeWeights without biases, in which case @p weights is
+     *                         a 2D tensor with dimensions [OFM, kernel_x * kernel_y * IFM] and the kernel size and number of kernels are given by @p weights_info.
+     *                         Per channel quantized weights can't be passed reshaped.
      * @param[in] dilation     (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
      * @param[in] act_info     (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in] num_groups   (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
@@ -187,19 +198,22 @@ private:
     static Status validate_gemm3d(const ITensorInfo *input_info, const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col);
 
 private:
-    MemoryGroup                      _memory_group;
-    NEConvolutionLayerReshapeWeights _reshape_weights;
-    NEIm2ColKernel                   _im2col_kernel;
-    NEGEMM                           _mm_gemm;
-    NEGEMMLowpMatrixMultiplyCore     _mm_gemmlowp;
-    NECol2ImKernel                   _col2im_kernel;
-    NEActivationLayer                _activationlayer_function;
-    NEArithmeticAdditionKernel       _add_bias_kernel;
-    NEReshapeLayer                   _reshape_layer;
+    MemoryGroup                        _memory_group;
+    NEConvertQuantizedSignednessKernel _convert_weights_kernel;
+    NEConvolutionLayerReshapeWeights   _reshape_weights;
+    NEIm2ColKernel                     _im2col_kernel;
+    NEGEMM                             _mm_gemm;
+    NEGEMMAssemblyDispatch             _mm_im2col_free;
+    NEGEMMLowpMatrixMultiplyCore       _mm_gemmlowp;
+    NECol2ImKernel                     _col2im_kernel;
+    NEActivationLayer                  _activationlayer_function;
+    NEArithmeticAdditionKernel         _add_bias_kernel;
+    NEReshapeLayer                     _reshape_layer;
 
     const ITensor *_original_weights;
 
     Tensor _im2col_output;
+    Tensor _weights_converted;
     Tensor _weights_reshaped;
     Tensor _gemm_output;
     Tensor _tmp_output;
@@ -209,8 +223,13 @@ private:
     bool _append_bias;
     bool _skip_im2col;
     bool _skip_col2im;
+    bool _use_indirect;
+    bool _fuse_im2col;
+    bool _add_bias;
     bool _is_quantized;
+    bool _is_quantized_per_channel;
     bool _is_activationlayer_enabled;
+    bool _are_weights_reshaped;
     bool _is_prepared;
 };
 } // namespace arm_compute
@@ -76,6 +76,7 @@ public:
      *                                         input_gate_bias              1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input
      *                                         projection_weights           2D weights tensor with dimensions [output_size, num_units]. Data type supported: Same as @p input.
      *                                         projection_bias              1D weights tensor with dimensions [output_size]. Data type supported: Same as @p input.
+     *                                         use_dynamic_quantization     Quantize the inputs and weights of the matrix multiplications to 8 bit at run time. Only supported for F32.
      * @param[in]  activation_info             Contains activation information described in @ref ActivationLayerInfo.
      * @param[in]  cell_threshold              The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
      * @param[in]  projection_threshold        The clipping threshold for the output from the projection layer, such that values are bound within [-proj_clip, proj_clip]. If set to 0.0 then clipping is disabled.
@@ -116,6 +117,7 @@ public:
      *                                        input_gate_bias              1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input
      *                                        projection_weights           2D weights tensor with dimensions [output_size, num_units]. Data type supported: Same as @p input.
      *                                        projection_bias              1D weights tensor with dimensions [output_size]. Data type supported: Same as @p input.
+     *                                        use_dynamic_quantization     Quantize the inputs and weights of the matrix multiplications to 8 bit at run time. Only supported for F32.
      * @param[in] activation_info             Contains activation information described in @ref ActivationLayerInfo.
      * @param[in] cell_threshold              The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
      * @param[in] projection_threshold        The clipping threshold for the output from the projection layer, such that values are bound within [-proj_clip, proj_clip]. If set to 0.0 then clipping is disabled.
@@ -153,6 +155,7 @@ private:
     NEActivationLayerKernel         _activation_forget_gate;
     NEFullyConnectedLayer           _fully_connected_cell_state;
     NEGEMM                          _gemm_cell_state1;
+    NEFullyConnectedLayer           _fully_connected_cell_state_recurrent;
     NEGEMM                          _gemm_cell_state2;
     NETransposeKernel               _transpose_cell_state;
     NEArithmeticAdditionKernel      _accum_cell_state1;
@@ -208,6 +211,7 @@ private:
     bool                            _perform_cell_clipping;
     bool                            _has_projection_weights;
     bool                            _perform_projection_clipping;
+    bool                            _run_dynamic_quantization;
     bool                            _is_prepared;
 };
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
 #include "arm_compute/core/NEON/kernels/NECopyKernel.h"
+#include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
@@ -60,8 +61,11 @@ public:
      * @param[out]    output            Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
      * @param[in,out] hidden_state      Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
      * @param[in]     info              Activation layer parameter.
+     * @param[in]     fc_info           (Optional) Fully connected layer info forwarded to the input and recurrent matrix multiplications.
+     *                                  Setting dynamic_quantization quantizes their inputs and weights to 8 bit at run time. Only supported for F32.
      */
-    void configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output, ActivationLayerInfo &info);
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output, ActivationLayerInfo &info,
+                   FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
     /** Initialize the function
      *
      * @param[in] input             Input is a 2-D tensor of shape [input_size, batch_size]. Data types supported: F16/F32
@@ -71,11 +75,13 @@ public:
      * @param[in] output            Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
      * @param[in] hidden_state      Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
      * @param[in] info              Activation layer parameter.
+     * @param[in] fc_info           (Optional) Fully connected layer info forwarded to the input and recurrent matrix multiplications.
+     *                              Setting dynamic_quantization quantizes their inputs and weights to 8 bit at run time. Only supported for F32.
      *
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *recurrent_weights, const ITensorInfo *bias, const ITensorInfo *hidden_state, const ITensorInfo *output,
-                           const ActivationLayerInfo &info);
+                           const ActivationLayerInfo &info, FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
 
     // Inherited methods overridden:
     void run() override;
@@ -87,10 +93,14 @@ private:
     NEArithmeticAdditionKernel _add_kernel;
     NEActivationLayerKernel    _activation_kernel;
     NEFullyConnectedLayer      _fully_connected_kernel;
+    NETransposeKernel          _transpose_recurrent_weights;
+    NEFullyConnectedLayer      _fully_connected_state;
     NECopyKernel               _copy_kernel;
     Tensor                     _fully_connected_out;
     Tensor                     _gemm_output;
     Tensor                     _add_output;
+    Tensor                     _recurrent_weights_transposed;
+    bool                       _run_dynamic_quantization;
     bool                       _is_prepared;
 };
 } // namespace arm_compute
@@ -54,7 +54,7 @@ public:
     NEWidthConcatenateLayer();
     /** Initialise the kernel's inputs vector and output.
      *
-     * @param[in]  inputs_vector The vectors containing all the tensors to concatenate. Data types supported: U8/S8/QASYMM8/U16/S16/F16/U32/S32/F32.
+     * @param[in]  inputs_vector The vectors containing all the tensors to concatenate. Data types supported: U8/S8/QASYMM8/QASYMM8_SIGNED/U16/S16/F16/U32/S32/F32.
      *                           Dimensions of all the inputs should match apart for the width which can differ.
      * @param[out] output        Output tensor. Data types supported: Same as @p input.
      *                           Output tensor dimensions are the same with the inputs from the second dimension and above.
@@ -64,7 +64,7 @@ public:
     void configure(std::vector<const ITensor *> inputs_vector, ITensor *output);
     /** Static function to check if given info will lead to a valid configuration of @ref NEWidthConcatenateLayer
      *
-     * @param[in] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: U8/S8/QASYMM8/U16/S16/F16/U32/S32/F32.
+     * @param[in] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: U8/S8/QASYMM8/QASYMM8_SIGNED/U16/S16/F16/U32/S32/F32.
      *                          Dimensions of all the inputs should match apart for the width which can differ.
      * @param[in] output        Output tensor. Data types supported: Same as @p input.
      *                          Output tensor dimensions are the same with the inputs from the second dimension and above.
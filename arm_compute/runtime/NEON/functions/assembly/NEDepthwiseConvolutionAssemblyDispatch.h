@@ -30,12 +30,18 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include "arm_compute/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEDepthwiseConvolutionAssemblyKernelWrapper.h"
 #include "arm_compute/core/NEON/kernels/convolution/depthwise/depthwise.hpp"
 
 namespace arm_compute
 {
-/** Depthwise convolution assembly kernel glue */
+/** Depthwise convolution assembly kernel glue
+ *
+ * 3x3 convolutions with unit or 2x2 strides, no dilation and SAME or VALID padding run on the tiled
+ * assembly kernels; every other configuration runs on the generic engine, which supports any kernel size,
+ * stride and dilation.
+ */
 class NEDepthwiseConvolutionAssemblyDispatch : public IFunction
 {
 public:
@@ -57,33 +63,39 @@ public:
      * @note Supports only NHWC format
      *
      * @param[in]  input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [3, 3, IFM]. Data type supported: Same as @p input.
+     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [kernel_x, kernel_y, IFM]. Data type supported: Same as @p input,
+     *                              or QSYMM8_PER_CHANNEL with one scale per IFM if @p input is QASYMM8.
      * @param[in]  bias             (Optional) Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
-     *                              Data type supported: Same as @p input.
+     *                              Data type supported: Same as @p input, S32 when input is QASYMM8.
      * @param[out] output           Destination tensor. Data type supported: same as @p input.
      * @param[in]  conv_info        Padding and stride information to use for the convolution.
      * @param[in]  depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in]  dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
      */
     void configure(const ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output,
-                   const PadStrideInfo &conv_info, unsigned int depth_multiplier = 1, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+                   const PadStrideInfo &conv_info, unsigned int depth_multiplier = 1, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U));
     /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionAssemblyDispatch
      *
      * @note Supports only NHWC format
      *
      * @param[in]  input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [3, 3, IFM]. Data type supported: Same as @p input.
+     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [kernel_x, kernel_y, IFM]. Data type supported: Same as @p input,
+     *                              or QSYMM8_PER_CHANNEL with one scale per IFM if @p input is QASYMM8.
      * @param[in]  bias             (Optional) Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
-     *                              Data type supported: Same as @p input.
+     *                              Data type supported: Same as @p input, S32 when input is QASYMM8.
      * @param[out] output           Destination tensor. Data type supported: same as @p input.
      * @param[in]  conv_info        Padding and stride information to use for the convolution.
      * @param[in]  depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in]  dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
      *
      * @return An error status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output,
-                           const PadStrideInfo &conv_info, unsigned int depth_multiplier = 1, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+                           const PadStrideInfo &conv_info, unsigned int depth_multiplier = 1, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                           const Size2D &dilation = Size2D(1U, 1U));
     /** Check if the optimized kernel can be used for the given kernel sizes and strides
      *
      * @warning Even if this return true the inputs and outputs might need to get permuted as the only layout supported is NHWC
@@ -97,6 +109,19 @@ public:
      * @return True if the assembly kernel could be used else false. Note that transformations of input/output could be needed.
      */
     static bool is_optimized_supported(const ITensorInfo *input, const ITensorInfo *weights, PadStrideInfo conv_info, unsigned int depth_multiplier = 1, const Size2D &dilation = Size2D(1, 1));
+    /** Check if the generic engine can be used for the given configuration
+     *
+     * @warning Even if this return true the inputs and outputs might need to get permuted as the only layout supported is NHWC
+     *
+     * @param[in] input            Input tensor info.
+     * @param[in] weights          Weights tensor info.
+     * @param[in] conv_info        Convolution layer metadata.
+     * @param[in] depth_multiplier (Optional) Depth multiplier to be used.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     *
+     * @return True if the generic engine could be used else false. Note that transformations of input/output could be needed.
+     */
+    static bool is_generic_supported(const ITensorInfo *input, const ITensorInfo *weights, PadStrideInfo conv_info, unsigned int depth_multiplier = 1, const Size2D &dilation = Size2D(1, 1));
 
     // Inherited methods overridden:
     void run() override;
@@ -110,9 +135,12 @@ private:
     ITensor                                          *_output;
     Tensor                                            _packed_weights;
     Tensor                                            _workspace;
+    Tensor                                            _weights_converted;
     bool                                              _is_prepared;
+    bool                                              _is_quantized_per_channel;
     std::unique_ptr<depthwise::IDepthwiseConvolution> _dwc_assembly_kernel;
     NEDepthwiseConvolutionAssemblyKernelWrapper       _dwc_acl_kernel;
+    NEConvertQuantizedSignednessKernel                _convert_weights_kernel;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEDEPTHWISECONVOLUTIONASSEMBLYDISPATCH_H__ */
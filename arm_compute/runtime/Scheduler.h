@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,10 +36,11 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,    /**< Single thread. */
-        CPP,   /**< C++11 threads. */
-        OMP,   /**< OpenMP. */
-        CUSTOM /**< Provided by the user. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        CPP_WORK_STEALING, /**< C++11 threads with per-thread work-stealing queues. */
+        OMP,               /**< OpenMP. */
+        CUSTOM             /**< Provided by the user. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
      *
@@ -70,6 +71,20 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Overrides the active scheduler for the calling thread only.
+     *
+     * Allows several functions to run concurrently from different threads, each one on its own pool of threads.
+     *
+     * @note Not available in builds without multi-threading support.
+     *
+     * @param[in] scheduler Scheduler to use in the calling thread, nullptr to use the active scheduler again.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
+    /** Returns the scheduler overriding the active scheduler for the calling thread.
+     *
+     * @return The scheduler set by @ref set_thread_scheduler in the calling thread, nullptr if the thread uses the active scheduler.
+     */
+    static IScheduler *get_thread_scheduler();
 
 private:
     static Type                        _scheduler_type;
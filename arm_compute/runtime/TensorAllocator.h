@@ -36,6 +36,7 @@ namespace arm_compute
 class Coordinates;
 class TensorInfo;
 class Tensor;
+class IAllocator;
 template <typename>
 class MemoryGroupBase;
 using MemoryGroup = MemoryGroupBase<Tensor>;
@@ -110,6 +111,14 @@ public:
      * @param[in] associated_memory_group Memory group to associate the tensor with
      */
     void set_associated_memory_group(MemoryGroup *associated_memory_group);
+    /** Sets the allocator used to allocate the backing memory of the tensor
+     *
+     * @note Has no effect on memory managed tensors whose memory comes from the pools of their memory manager.
+     * @warning The allocator must outlive the backing memory of the tensor.
+     *
+     * @param[in] allocator Allocator to use. nullptr to allocate from the heap (Default)
+     */
+    void set_allocator(IAllocator *allocator);
 
 protected:
     /** No-op for CPU memory
@@ -125,6 +134,7 @@ private:
     MemoryGroup *_associated_memory_group; /**< Registered memory manager */
     Memory       _memory;                  /**< CPU memory */
     Tensor      *_owner;                   /**< Owner of the allocator */
+    IAllocator  *_allocator;               /**< Allocator of the backing memory, nullptr to use the heap */
 };
 }
 #endif /* __ARM_COMPUTE_TENSORALLOCATOR_H__ */
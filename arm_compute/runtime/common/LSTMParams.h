@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,7 +41,8 @@ public:
     /** Constructor */
     LSTMParams()
         : _input_to_input_weights(nullptr), _recurrent_to_input_weights(nullptr), _cell_to_input_weights(nullptr), _input_gate_bias(nullptr), _cell_to_forget_weights(nullptr),
-          _cell_to_output_weights(nullptr), _projection_weights(nullptr), _projection_bias(nullptr), _has_peephole_opt(false), _has_projection(false), _has_cifg_opt(true)
+          _cell_to_output_weights(nullptr), _projection_weights(nullptr), _projection_bias(nullptr), _has_peephole_opt(false), _has_projection(false), _has_cifg_opt(true),
+          _use_dynamic_quantization(false)
     {
     }
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -96,6 +97,17 @@ public:
         _has_peephole_opt       = true;
         return *this;
     }
+    /** Set whether the fully connected layers of the cell should quantize their F32 inputs and weights at run time.
+     *
+     * @param[in] use_dynamic_quantization True to perform the matrix multiplications on dynamically quantized symmetric 8 bit values.
+     *
+     * @return Reference to this LSTMParams object
+     */
+    LSTMParams &set_dynamic_quantization(bool use_dynamic_quantization)
+    {
+        _use_dynamic_quantization = use_dynamic_quantization;
+        return *this;
+    }
 
     const T *input_to_input_weights() const
     {
@@ -152,6 +164,11 @@ public:
         return _has_cifg_opt;
     }
 
+    bool use_dynamic_quantization() const
+    {
+        return _use_dynamic_quantization;
+    }
+
 private:
     const T *_input_to_input_weights;
     const T *_recurrent_to_input_weights;
@@ -164,6 +181,7 @@ private:
     bool     _has_peephole_opt;
     bool     _has_projection;
     bool     _has_cifg_opt;
+    bool     _use_dynamic_quantization;
 };
 }
 #endif /*__ARM_COMPUTE_LSTMPARAMS_H__ */
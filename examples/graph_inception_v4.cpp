@@ -149,10 +149,13 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads              = common_params.threads;
+        config.use_tuner                = common_params.enable_tuner;
+        config.tuner_mode               = common_params.tuner_mode;
+        config.tuner_file               = common_params.tuner_file;
+        config.max_concurrent_tasks     = std::max(1, common_params.parallel_branches);
+        config.num_streams              = std::max(1, common_params.streams);
+        config.use_padding_free_kernels = common_params.padding_free;
 
         graph.finalize(common_params.target, config);
 
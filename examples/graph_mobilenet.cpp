@@ -66,6 +66,23 @@ public:
         // Print parameter values
         std::cout << common_params << std::endl;
 
+        // Graph configuration
+        GraphConfig config;
+        config.num_threads              = common_params.threads;
+        config.use_tuner                = common_params.enable_tuner;
+        config.tuner_mode               = common_params.tuner_mode;
+        config.tuner_file               = common_params.tuner_file;
+        config.use_padding_free_kernels = common_params.padding_free;
+        config.serialized_graph_file    = common_params.serialize_graph;
+
+        // Restore a serialized graph instead of building it
+        if(!common_params.restore_graph.empty())
+        {
+            graph.restore(common_params.target, config, common_params.restore_graph);
+            set_restored_accessors();
+            return !common_params.external_buffers || bind_external_buffers();
+        }
+
         // Get model parameters
         int model_id = model_id_opt->value();
 
@@ -97,20 +114,30 @@ public:
               << OutputLayer(get_output_accessor(common_params, 5));
 
         // Finalize graph
-        GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
-
         graph.finalize(common_params.target, config);
 
+        // Bind buffers owned by the example to the input and output
+        if(common_params.external_buffers && !bind_external_buffers())
+        {
+            return false;
+        }
+
         return true;
     }
     void do_run() override
     {
         // Run graph
-        graph.run();
+        if(common_params.external_buffers)
+        {
+            graph.run(external_inputs, external_outputs);
+
+            // Process the output buffer through the output accessor
+            output_accessor->access_tensor(output_buffer);
+        }
+        else
+        {
+            graph.run();
+        }
     }
 
 private:
@@ -120,6 +147,71 @@ private:
     CommonGraphParams  common_params;
     Stream             graph;
 
+    arm_compute::Tensor                             input_buffer{};
+    arm_compute::Tensor                             output_buffer{};
+    std::vector<arm_compute::graph::ExternalBuffer> external_inputs{};
+    std::vector<arm_compute::graph::ExternalBuffer> external_outputs{};
+    arm_compute::graph::ITensorAccessor            *output_accessor{ nullptr };
+
+    /** Sets the accessors of the input and output of a restored graph, which are not serialized */
+    void set_restored_accessors()
+    {
+        arm_compute::graph::Graph &g = graph.graph();
+        if(arm_compute::is_data_type_float(common_params.data_type))
+        {
+            std::unique_ptr<IPreprocessor> preprocessor = arm_compute::support::cpp14::make_unique<TFPreproccessor>();
+            g.node(g.nodes(arm_compute::graph::NodeType::Input).front())->output(0)->set_accessor(get_input_accessor(common_params, std::move(preprocessor), false));
+        }
+        else
+        {
+            const std::string data_path = common_params.data_path.empty() ? common_params.data_path : common_params.data_path + "/cnn_data/mobilenet_qasymm8_model/";
+            g.node(g.nodes(arm_compute::graph::NodeType::Input).front())->output(0)->set_accessor(get_weights_accessor(data_path, common_params.image));
+        }
+        g.node(g.nodes(arm_compute::graph::NodeType::Output).front())->input(0)->set_accessor(get_output_accessor(common_params, 5));
+    }
+
+    /** Allocates aligned buffers laid out as the input and output tensors of the finalized graph and binds them
+     *
+     * The input buffer is filled once through the input accessor, the output buffer is processed by the output accessor after each run.
+     *
+     * @return True if the buffers can be bound to the graph else false
+     */
+    bool bind_external_buffers()
+    {
+        constexpr size_t alignment = 64;
+
+        arm_compute::graph::Graph  &g      = graph.graph();
+        arm_compute::graph::Tensor *input  = g.node(g.nodes(arm_compute::graph::NodeType::Input).front())->output(0);
+        arm_compute::graph::Tensor *output = g.node(g.nodes(arm_compute::graph::NodeType::Output).front())->input(0);
+
+        input_buffer.allocator()->init(TensorInfo(*input->handle()->tensor().info()), alignment);
+        output_buffer.allocator()->init(TensorInfo(*output->handle()->tensor().info()), alignment);
+        input_buffer.allocator()->allocate();
+        output_buffer.allocator()->allocate();
+
+        external_inputs.resize(1);
+        external_inputs[0].ptr     = input_buffer.buffer();
+        external_inputs[0].size    = input_buffer.info()->total_size();
+        external_inputs[0].strides = input_buffer.info()->strides_in_bytes();
+        external_outputs.resize(1);
+        external_outputs[0].ptr     = output_buffer.buffer();
+        external_outputs[0].size    = output_buffer.info()->total_size();
+        external_outputs[0].strides = output_buffer.info()->strides_in_bytes();
+
+        const Status status = graph.validate_external_buffers(external_inputs, external_outputs);
+        if(!bool(status))
+        {
+            std::cerr << "Can't bind external buffers: " << status.error_description() << std::endl;
+            return false;
+        }
+
+        // Load the input once, outside of the runs
+        input->accessor()->access_tensor(input_buffer);
+        output_accessor = output->accessor();
+
+        return true;
+    }
+
     void create_graph_float(TensorDescriptor &input_descriptor, int model_id)
     {
         float       depth_scale = (model_id == 0) ? 1.f : 0.75;
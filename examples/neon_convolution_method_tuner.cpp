@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTable.h"
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "utils/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+using namespace arm_compute;
+using namespace utils;
+
+namespace
+{
+/** Convolution configuration read from the configurations file */
+struct ConvolutionConfig
+{
+    TensorShape   input_shape{};
+    TensorShape   weights_shape{};
+    PadStrideInfo conv_info{};
+};
+
+std::string method_name(ConvolutionMethod method)
+{
+    switch(method)
+    {
+        case ConvolutionMethod::GEMM:
+            return "GEMM";
+        case ConvolutionMethod::WINOGRAD:
+            return "WINOGRAD";
+        case ConvolutionMethod::DIRECT:
+            return "DIRECT";
+        case ConvolutionMethod::FFT:
+            return "FFT";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/** Create and configure the function implementing a convolution method
+ *
+ * @return The configured function, nullptr if the method doesn't support the configuration
+ */
+std::unique_ptr<IFunction> create_function(ConvolutionMethod method, Tensor &src, Tensor &weights, Tensor &biases, Tensor &dst, const PadStrideInfo &conv_info)
+{
+    switch(method)
+    {
+        case ConvolutionMethod::GEMM:
+        {
+            if(!bool(NEGEMMConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info)))
+            {
+                return nullptr;
+            }
+            auto f = support::cpp14::make_unique<NEGEMMConvolutionLayer>();
+            f->configure(&src, &weights, &biases, &dst, conv_info);
+            return std::move(f);
+        }
+        case ConvolutionMethod::WINOGRAD:
+        {
+            if(!bool(NEWinogradConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info, ActivationLayerInfo(), true)))
+            {
+                return nullptr;
+            }
+            auto f = support::cpp14::make_unique<NEWinogradConvolutionLayer>();
+            f->configure(&src, &weights, &biases, &dst, conv_info, ActivationLayerInfo(), true);
+            return std::move(f);
+        }
+        case ConvolutionMethod::DIRECT:
+        {
+            if(!bool(NEDirectConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info)))
+            {
+                return nullptr;
+            }
+            auto f = support::cpp14::make_unique<NEDirectConvolutionLayer>();
+            f->configure(&src, &weights, &biases, &dst, conv_info);
+            return std::move(f);
+        }
+        case ConvolutionMethod::FFT:
+        {
+            if(!bool(NEFFTConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info)))
+            {
+                return nullptr;
+            }
+            auto f = support::cpp14::make_unique<NEFFTConvolutionLayer>();
+            f->configure(&src, &weights, &biases, &dst, conv_info);
+            return std::move(f);
+        }
+        default:
+            return nullptr;
+    }
+}
+} // namespace
+
+/** Offline benchmark filling a table of convolution methods
+ *
+ * Times every valid convolution method of each configuration and stores the fastest one in a table
+ * which can be loaded at runtime and registered with NEConvolutionLayer::set_method_table().
+ *
+ * @note Winograd is timed with fast math enabled: the entries selecting Winograd are only used by the functions configured with fast math enabled
+ */
+class NEConvolutionMethodTunerExample : public Example
+{
+public:
+    bool do_setup(int argc, char **argv) override
+    {
+        if(argc < 2)
+        {
+            // Print help
+            std::cout << "Usage: ./build/neon_convolution_method_tuner configs.csv [table.csv = acl_convolution_methods.csv] [data_layout = NCHW] [iterations = 10]\n\n";
+            std::cout << "Each line of configs.csv describes a convolution: width,height,ifm,kernel_width,kernel_height,ofm,stride_x,stride_y,pad_x,pad_y[,batches]\n";
+            std::cout << "The entries of the file are added to the content of table.csv if it exists\n\n";
+            return false;
+        }
+
+        table_filename = (argc > 2) ? argv[2] : "acl_convolution_methods.csv";
+        data_layout    = (argc > 3 && std::string(argv[3]) == "NHWC") ? DataLayout::NHWC : DataLayout::NCHW;
+        num_iterations = (argc > 4) ? std::max(1, atoi(argv[4])) : 10;
+
+        std::ifstream table_file(table_filename);
+        if(table_file.good())
+        {
+            table.load_from_file(table_filename);
+        }
+
+        std::ifstream fs(argv[1]);
+        if(!fs.good())
+        {
+            std::cerr << "Failed to open " << argv[1] << std::endl;
+            return false;
+        }
+        std::string line;
+        while(std::getline(fs, line))
+        {
+            std::replace(line.begin(), line.end(), ',', ' ');
+            std::istringstream ss(line);
+            unsigned int       width = 0, height = 0, ifm = 0, kernel_w = 0, kernel_h = 0, ofm = 0, stride_x = 1, stride_y = 1, pad_x = 0, pad_y = 0, batches = 1;
+            if(!(ss >> width >> height >> ifm >> kernel_w >> kernel_h >> ofm >> stride_x >> stride_y >> pad_x >> pad_y))
+            {
+                continue;
+            }
+            ss >> batches;
+
+            ConvolutionConfig config;
+            config.input_shape   = (data_layout == DataLayout::NCHW) ? TensorShape(width, height, ifm, batches) : TensorShape(ifm, width, height, batches);
+            config.weights_shape = (data_layout == DataLayout::NCHW) ? TensorShape(kernel_w, kernel_h, ifm, ofm) : TensorShape(ifm, kernel_w, kernel_h, ofm);
+            config.conv_info     = PadStrideInfo(stride_x, stride_y, pad_x, pad_y);
+            configs.push_back(config);
+        }
+
+        return true;
+    }
+    void do_run() override
+    {
+        const unsigned int num_threads = NEScheduler::get().num_threads();
+
+        for(const auto &config : configs)
+        {
+            TensorInfo src_info(config.input_shape, 1, DataType::F32);
+            TensorInfo weights_info(config.weights_shape, 1, DataType::F32);
+            src_info.set_data_layout(data_layout);
+            weights_info.set_data_layout(data_layout);
+            TensorInfo dst_info(misc::shape_calculator::compute_deep_convolution_shape(src_info, weights_info, config.conv_info), 1, DataType::F32);
+            dst_info.set_data_layout(data_layout);
+            const TensorInfo biases_info(TensorShape(config.weights_shape[3]), 1, DataType::F32);
+
+            const std::string config_id = NEConvolutionMethodTable::config_id(&src_info, &weights_info, config.conv_info, Size2D(1U, 1U), num_threads);
+
+            ConvolutionMethod fastest_method = ConvolutionMethod::GEMM;
+            double            fastest_time   = std::numeric_limits<double>::max();
+            for(auto method : { ConvolutionMethod::GEMM, ConvolutionMethod::WINOGRAD, ConvolutionMethod::DIRECT, ConvolutionMethod::FFT })
+            {
+                // Fresh tensors for each method: preparing a function may mark the weights as unused and free them
+                Tensor src{}, weights{}, biases{}, dst{};
+                src.allocator()->init(src_info);
+                weights.allocator()->init(weights_info);
+                biases.allocator()->init(biases_info);
+                dst.allocator()->init(dst_info);
+
+                std::unique_ptr<IFunction> conv = create_function(method, src, weights, biases, dst, config.conv_info);
+                if(conv == nullptr)
+                {
+                    continue;
+                }
+
+                src.allocator()->allocate();
+                weights.allocator()->allocate();
+                biases.allocator()->allocate();
+                dst.allocator()->allocate();
+                fill_random_tensor(src, -1.f, 1.f);
+                fill_random_tensor(weights, -1.f, 1.f);
+                fill_random_tensor(biases, -1.f, 1.f);
+
+                // Warm-up run, which also prepares the weights
+                conv->run();
+
+                double method_time = std::numeric_limits<double>::max();
+                for(unsigned int i = 0; i < num_iterations; ++i)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    conv->run();
+                    const auto stop = std::chrono::steady_clock::now();
+                    method_time     = std::min(method_time, std::chrono::duration<double>(stop - start).count());
+                }
+                if(method_time < fastest_time)
+                {
+                    fastest_time   = method_time;
+                    fastest_method = method;
+                }
+            }
+
+            std::cout << config_id << " : " << method_name(fastest_method) << " (" << fastest_time * 1000.0 << " ms)" << std::endl;
+            table.add_method(config_id, fastest_method);
+        }
+    }
+    void do_teardown() override
+    {
+        table.save_to_file(table_filename);
+    }
+
+private:
+    std::vector<ConvolutionConfig> configs{};
+    NEConvolutionMethodTable       table{ false };
+    std::string                    table_filename{};
+    DataLayout                     data_layout{ DataLayout::NCHW };
+    unsigned int                   num_iterations{ 10 };
+};
+
+/** Main program for the convolution method tuner
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( configurations file, [optional] table file, [optional] data layout, [optional] number of iterations )
+ */
+int main(int argc, char **argv)
+{
+    return utils::run_example<NEConvolutionMethodTunerExample>(argc, argv);
+}
@@ -39,6 +39,7 @@
 #include <arm_neon.h>
 #include <array>
 #include <cmath>
+#include <limits>
 #include <map>
 
 using namespace arm_compute;
@@ -47,7 +48,7 @@ namespace
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
@@ -99,10 +100,10 @@ void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, Activat
 
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr));
 
-    ARM_COMPUTE_ERROR_ON_MSG((input->info()->data_type() == DataType::QASYMM8) && (activation_info.activation() != ActivationLayerInfo::ActivationFunction::RELU)
+    ARM_COMPUTE_ERROR_ON_MSG(is_data_type_quantized_asymmetric(input->info()->data_type()) && (activation_info.activation() != ActivationLayerInfo::ActivationFunction::RELU)
                              && (activation_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU) && (activation_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU)
                              && (activation_info.activation() != ActivationLayerInfo::ActivationFunction::LOGISTIC),
-                             "For QASYMM8 only logistic, relu and lower/upper bounded relu are supported");
+                             "For QASYMM8 and QASYMM8_SIGNED only logistic, relu and lower/upper bounded relu are supported");
 
     // Activation functions : FP32
     static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_f32 =
@@ -147,11 +148,23 @@ void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, Activat
         { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_t> },
     };
 
+    // Activation functions : QASYMM8_SIGNED
+    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qasymm8_signed =
+    {
+        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qasymm8_signed_t> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, qasymm8_signed_t> },
+        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, qasymm8_signed_t> },
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_signed_t> },
+    };
+
     switch(input->info()->data_type())
     {
         case DataType::QASYMM8:
             _func = act_map_qasymm8[activation_info.activation()];
             break;
+        case DataType::QASYMM8_SIGNED:
+            _func = act_map_qasymm8_signed[activation_info.activation()];
+            break;
         case DataType::F32:
             _func = act_map_f32[activation_info.activation()];
             break;
@@ -298,8 +311,12 @@ NEActivationLayerKernel::activation(const Window &window)
 }
 
 template <ActivationLayerInfo::ActivationFunction F, typename T>
-typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivationLayerKernel::activation(const Window &window)
+typename std::enable_if<std::is_same<T, qasymm8_t>::value || std::is_same<T, qasymm8_signed_t>::value, void>::type NEActivationLayerKernel::activation(const Window &window)
 {
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    using Helper       = QAsymm8Helper<T>;
+
     const int                window_step_x  = 16 / sizeof(T);
     const auto               window_start_x = static_cast<int>(window.x().start());
     const auto               window_end_x   = static_cast<int>(window.x().end());
@@ -313,13 +330,15 @@ typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivat
 
     const QuantizationInfo qi_in    = _input->info()->quantization_info();
     const QuantizationInfo qi_out   = _output->info()->quantization_info();
-    const qasymm8x16_t     va       = vdupq_n_u8(sqcvt_qasymm8_f32(_act_info.a(), qi_in.scale, qi_in.offset));
-    const qasymm8x16_t     vb       = vdupq_n_u8(sqcvt_qasymm8_f32(_act_info.b(), qi_in.scale, qi_in.offset));
-    const qasymm8_t        a        = sqcvt_qasymm8_f32(_act_info.a(), qi_in.scale, qi_in.offset);
-    const qasymm8_t        b        = sqcvt_qasymm8_f32(_act_info.b(), qi_in.scale, qi_in.offset);
-    const qasymm8_t        const_0  = sqcvt_qasymm8_f32(0.f, qi_in.scale, qi_in.offset);
-    const qasymm8x16_t     vconst_0 = vdupq_n_u8(const_0);
+    const T                a        = Helper::quantize(_act_info.a(), qi_in);
+    const T                b        = Helper::quantize(_act_info.b(), qi_in);
+    const T                const_0  = Helper::quantize(0.f, qi_in);
+    const auto             va       = wrapper::vdup_n(a, ExactTagType{});
+    const auto             vb       = wrapper::vdup_n(b, ExactTagType{});
+    const auto             vconst_0 = wrapper::vdup_n(const_0, ExactTagType{});
     const auto             vconst_1 = vdupq_n_f32(1.f);
+    const int32_t          min_val  = std::numeric_limits<T>::lowest();
+    const int32_t          max_val  = std::numeric_limits<T>::max();
 
     // Initialise scale/offset for re-quantization
     float       s  = qi_in.scale / qi_out.scale;
@@ -342,23 +361,23 @@ typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivat
             if(act == ActivationFunction::RELU)
             {
                 // Perform activation
-                tmp = vmaxq_u8(vconst_0, vin);
+                tmp = wrapper::vmax(vconst_0, vin);
                 // Re-quantize to new output space
-                tmp = vmlaq_qasymm8(tmp, vs, vo);
+                tmp = Helper::vmla(tmp, vs, vo);
             }
             else if(act == ActivationFunction::BOUNDED_RELU)
             {
                 // Perform activation
-                tmp = vminq_u8(va, vmaxq_u8(vconst_0, vin));
+                tmp = wrapper::vmin(va, wrapper::vmax(vconst_0, vin));
                 // Re-quantize to new output space
-                tmp = vmlaq_qasymm8(tmp, vs, vo);
+                tmp = Helper::vmla(tmp, vs, vo);
             }
             else if(act == ActivationFunction::LU_BOUNDED_RELU)
             {
                 // Perform activation
-                tmp = vminq_u8(va, vmaxq_u8(vb, vin));
+                tmp = wrapper::vmin(va, wrapper::vmax(vb, vin));
                 // Re-quantize to new output space
-                tmp = vmlaq_qasymm8(tmp, vs, vo);
+                tmp = Helper::vmla(tmp, vs, vo);
             }
             else if(act == ActivationFunction::LOGISTIC)
             {
@@ -375,7 +394,7 @@ typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivat
                     }
                 };
                 // Re-quantize to new output space
-                tmp = vquantize(tmp_dep, qi_out);
+                tmp = Helper::vquantize(tmp_dep, qi_out);
             }
             else
             {
@@ -392,23 +411,23 @@ typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivat
             if(act == ActivationFunction::RELU)
             {
                 tmp = std::max(const_0, in);
-                tmp = std::max<int32_t>(0, std::min<int32_t>(tmp * s + o, 255));
+                tmp = std::max<int32_t>(min_val, std::min<int32_t>(tmp * s + o, max_val));
             }
             else if(act == ActivationFunction::BOUNDED_RELU)
             {
                 tmp = std::min(a, std::max(const_0, in));
-                tmp = std::max<int32_t>(0, std::min<int32_t>(tmp * s + o, 255));
+                tmp = std::max<int32_t>(min_val, std::min<int32_t>(tmp * s + o, max_val));
             }
             else if(act == ActivationFunction::LU_BOUNDED_RELU)
             {
                 tmp = std::min(a, std::max(b, in));
-                tmp = std::max<int32_t>(0, std::min<int32_t>(tmp * s + o, 255));
+                tmp = std::max<int32_t>(min_val, std::min<int32_t>(tmp * s + o, max_val));
             }
             else if(act == ActivationFunction::LOGISTIC)
             {
-                float tmp_f = scvt_f32_qasymm8(in, qi_in.scale, qi_in.offset);
+                float tmp_f = Helper::dequantize(in, qi_in);
                 tmp_f       = 1.f / (1.f + std::exp(-tmp_f));
-                tmp         = sqcvt_qasymm8_f32(tmp_f, qi_out.scale, qi_out.offset);
+                tmp         = Helper::quantize(tmp_f, qi_out);
             }
             else
             {
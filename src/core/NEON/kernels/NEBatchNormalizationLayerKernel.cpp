@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <cmath>
 #include <map>
 
 using namespace arm_compute;
@@ -82,21 +83,21 @@ validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const IT
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
 {
+    // Configure kernel window
+    Window win = calculate_max_window(*input, Steps());
+
     if(output != nullptr)
     {
         // Output tensor auto initialization if not yet initialized
         auto_init_if_empty(*output, *input->clone());
-    }
 
-    unsigned int num_elems_processed_per_iteration = 16 / input->element_size();
+        // NEBatchNormalizationLayerKernel doesn't need padding so update_window_and_padding() can be skipped
+        Coordinates coord;
+        coord.set_num_dimensions(output->num_dimensions());
+        output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+    }
 
-    Window                 win = calculate_max_window(*input, Steps(num_elems_processed_per_iteration));
-    AccessWindowHorizontal input_access(input, 0, num_elems_processed_per_iteration);
-    AccessWindowHorizontal output_access(output, 0, num_elems_processed_per_iteration);
-    bool                   window_changed = update_window_and_padding(win, input_access, output_access);
-    output_access.set_valid_region(win, input->valid_region());
-    Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
-    return std::make_pair(err, win);
+    return std::make_pair(Status{}, win);
 }
 } //namespace
 
@@ -105,8 +106,15 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nchw(const Window
 {
     ARM_COMPUTE_UNUSED(window);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int  window_step_x  = 8;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_to_use = window;
+    win_to_use.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_to_use);
+    Iterator output(_output, win_to_use);
 
     F activation_functor(_act_info);
 
@@ -125,8 +133,11 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nchw(const Window
     float16x8_t       beta_vec    = vdupq_n_f16(0.0);
     float16x8_t       denominator = vdupq_n_f16(0.0);
     const float16x8_t epsilon_vec = vdupq_n_f16(_epsilon);
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(win_to_use, [&](const Coordinates & id)
     {
+        const auto input_ptr  = reinterpret_cast<const float16_t *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float16_t *>(output.ptr());
+
         if(slice != id.z())
         {
             // Conctruct vectors
@@ -146,18 +157,39 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nchw(const Window
             slice       = id.z();
         }
 
-        // Calculate x bar and store results
-        const float16x8_t numerator = vsubq_f16(vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr())), mean_vec);
-        const float16x8_t x_bar     = vmulq_f16(numerator, denominator);
-        float16x8_t       res       = vaddq_f16(beta_vec, vmulq_f16(x_bar, gamma_vec));
-
-        // Perform fused activation
-        if(fused_activation)
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
         {
-            activation_functor(res);
+            // Calculate x bar
+            const float16x8_t numerator = vsubq_f16(vld1q_f16(input_ptr + x), mean_vec);
+            const float16x8_t x_bar     = vmulq_f16(numerator, denominator);
+            float16x8_t       res       = vaddq_f16(beta_vec, vmulq_f16(x_bar, gamma_vec));
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            vst1q_f16(output_ptr + x, res);
         }
 
-        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), res);
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const float16_t x_bar = (*(input_ptr + x) - vgetq_lane_f16(mean_vec, 0)) * vgetq_lane_f16(denominator, 0);
+            float16_t       res   = vgetq_lane_f16(beta_vec, 0) + x_bar * vgetq_lane_f16(gamma_vec, 0);
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            *(output_ptr + x) = res;
+        }
     },
     input, output);
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
@@ -168,8 +200,15 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nhwc(const Window
 {
     ARM_COMPUTE_UNUSED(window);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int  window_step_x  = 8;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_collapsed);
+    Iterator output(_output, win_collapsed);
 
     F activation_functor(_act_info);
 
@@ -179,28 +218,58 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nhwc(const Window
     const auto input_beta  = (_beta != nullptr) ? reinterpret_cast<const float16_t *>(_beta->ptr_to_element(Coordinates(0, 0))) : nullptr;
 
     const float16x8_t epsilon_vec = vdupq_n_f16(_epsilon);
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
     {
-        // Conctruct vectors
-        const float16x8_t mean_vec  = vld1q_f16(input_mean + id.x());
-        const float16x8_t var_vec   = vld1q_f16(input_var + id.x());
-        const float16x8_t gamma_vec = (input_gamma != nullptr) ? vld1q_f16(input_gamma + id.x()) : vdupq_n_f16(1.0);
-        const float16x8_t beta_vec  = (input_beta != nullptr) ? vld1q_f16(input_beta + id.x()) : vdupq_n_f16(0.0);
-        // Calculate denominator
-        const float16x8_t denominator = vinvsqrtq_f16(vaddq_f16(var_vec, epsilon_vec));
-
-        // Calculate x bar and store results
-        const float16x8_t numerator = vsubq_f16(vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr())), mean_vec);
-        const float16x8_t x_bar     = vmulq_f16(numerator, denominator);
-        float16x8_t       res       = vaddq_f16(beta_vec, vmulq_f16(x_bar, gamma_vec));
-
-        // Perform fused activation
-        if(fused_activation)
+        const auto input_ptr  = reinterpret_cast<const float16_t *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float16_t *>(output.ptr());
+
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
         {
-            activation_functor(res);
+            // Conctruct vectors
+            const float16x8_t mean_vec  = vld1q_f16(input_mean + x);
+            const float16x8_t var_vec   = vld1q_f16(input_var + x);
+            const float16x8_t gamma_vec = (input_gamma != nullptr) ? vld1q_f16(input_gamma + x) : vdupq_n_f16(1.0);
+            const float16x8_t beta_vec  = (input_beta != nullptr) ? vld1q_f16(input_beta + x) : vdupq_n_f16(0.0);
+            // Calculate denominator
+            const float16x8_t denominator = vinvsqrtq_f16(vaddq_f16(var_vec, epsilon_vec));
+
+            // Calculate x bar
+            const float16x8_t numerator = vsubq_f16(vld1q_f16(input_ptr + x), mean_vec);
+            const float16x8_t x_bar     = vmulq_f16(numerator, denominator);
+            float16x8_t       res       = vaddq_f16(beta_vec, vmulq_f16(x_bar, gamma_vec));
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            vst1q_f16(output_ptr + x, res);
         }
 
-        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), res);
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            // Conctruct scalars
+            const float16_t gamma       = (input_gamma != nullptr) ? *(input_gamma + x) : static_cast<float16_t>(1.f);
+            const float16_t beta        = (input_beta != nullptr) ? *(input_beta + x) : static_cast<float16_t>(0.f);
+            const float16_t denominator = static_cast<float16_t>(1.f / std::sqrt(static_cast<float>(*(input_var + x)) + _epsilon));
+
+            // Calculate x bar
+            const float16_t x_bar = (*(input_ptr + x) - *(input_mean + x)) * denominator;
+            float16_t       res   = beta + x_bar * gamma;
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            *(output_ptr + x) = res;
+        }
     },
     input, output);
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
@@ -209,8 +278,15 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp16_nhwc(const Window
 template <bool fused_activation, typename F>
 void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nchw(const Window &window)
 {
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int  window_step_x  = 4;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_to_use = window;
+    win_to_use.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_to_use);
+    Iterator output(_output, win_to_use);
 
     F activation_functor(_act_info);
 
@@ -229,8 +305,11 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nchw(const Window
     float32x4_t       beta_vec    = vdupq_n_f32(0.0);
     float32x4_t       denominator = vdupq_n_f32(0.0);
     const float32x4_t epsilon_vec = vdupq_n_f32(_epsilon);
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(win_to_use, [&](const Coordinates & id)
     {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
         if(slice != id.z())
         {
             // Conctruct vectors
@@ -250,19 +329,39 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nchw(const Window
             slice       = id.z();
         }
 
-        // Calculate x bar
-        const float32x4_t numerator = vsubq_f32(vld1q_f32(reinterpret_cast<const float *>(input.ptr())), mean_vec);
-        const float32x4_t x_bar     = vmulq_f32(numerator, denominator);
-        float32x4_t       res       = vmlaq_f32(beta_vec, x_bar, gamma_vec);
-
-        // Perform fused activation
-        if(fused_activation)
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
         {
-            activation_functor(res);
+            // Calculate x bar
+            const float32x4_t numerator = vsubq_f32(vld1q_f32(input_ptr + x), mean_vec);
+            const float32x4_t x_bar     = vmulq_f32(numerator, denominator);
+            float32x4_t       res       = vmlaq_f32(beta_vec, x_bar, gamma_vec);
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            vst1q_f32(output_ptr + x, res);
         }
 
-        // Store results
-        vst1q_f32(reinterpret_cast<float *>(output.ptr()), res);
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const float x_bar = (*(input_ptr + x) - vgetq_lane_f32(mean_vec, 0)) * vgetq_lane_f32(denominator, 0);
+            float       res   = vgetq_lane_f32(beta_vec, 0) + x_bar * vgetq_lane_f32(gamma_vec, 0);
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            *(output_ptr + x) = res;
+        }
     },
     input, output);
 }
@@ -270,8 +369,15 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nchw(const Window
 template <bool fused_activation, typename F>
 void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nhwc(const Window &window)
 {
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int  window_step_x  = 4;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_collapsed);
+    Iterator output(_output, win_collapsed);
 
     F activation_functor(_act_info);
 
@@ -281,29 +387,58 @@ void NEBatchNormalizationLayerKernel::batch_normalization_fp32_nhwc(const Window
     const auto input_beta  = (_beta != nullptr) ? reinterpret_cast<const float *>(_beta->ptr_to_element(Coordinates(0, 0))) : nullptr;
 
     const float32x4_t epsilon_vec = vdupq_n_f32(_epsilon);
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
     {
-        // Conctruct vectors
-        const float32x4_t mean_vec  = vld1q_f32(input_mean + id.x());
-        const float32x4_t var_vec   = vld1q_f32(input_var + id.x());
-        const float32x4_t gamma_vec = (input_gamma != nullptr) ? vld1q_f32(input_gamma + id.x()) : vdupq_n_f32(1.0);
-        const float32x4_t beta_vec  = (input_beta != nullptr) ? vld1q_f32(input_beta + id.x()) : vdupq_n_f32(0.0);
-        // Calculate denominator
-        const float32x4_t denominator = vinvsqrtq_f32(vaddq_f32(var_vec, epsilon_vec));
-
-        // Calculate x bar
-        const float32x4_t numerator = vsubq_f32(vld1q_f32(reinterpret_cast<const float *>(input.ptr())), mean_vec);
-        const float32x4_t x_bar     = vmulq_f32(numerator, denominator);
-        float32x4_t       res       = vmlaq_f32(beta_vec, x_bar, gamma_vec);
-
-        // Perform fused activation
-        if(fused_activation)
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
         {
-            activation_functor(res);
+            // Conctruct vectors
+            const float32x4_t mean_vec  = vld1q_f32(input_mean + x);
+            const float32x4_t var_vec   = vld1q_f32(input_var + x);
+            const float32x4_t gamma_vec = (input_gamma != nullptr) ? vld1q_f32(input_gamma + x) : vdupq_n_f32(1.0);
+            const float32x4_t beta_vec  = (input_beta != nullptr) ? vld1q_f32(input_beta + x) : vdupq_n_f32(0.0);
+            // Calculate denominator
+            const float32x4_t denominator = vinvsqrtq_f32(vaddq_f32(var_vec, epsilon_vec));
+
+            // Calculate x bar
+            const float32x4_t numerator = vsubq_f32(vld1q_f32(input_ptr + x), mean_vec);
+            const float32x4_t x_bar     = vmulq_f32(numerator, denominator);
+            float32x4_t       res       = vmlaq_f32(beta_vec, x_bar, gamma_vec);
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            vst1q_f32(output_ptr + x, res);
         }
 
-        // Store results
-        vst1q_f32(reinterpret_cast<float *>(output.ptr()), res);
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            // Conctruct scalars
+            const float gamma       = (input_gamma != nullptr) ? *(input_gamma + x) : static_cast<float>(1.f);
+            const float beta        = (input_beta != nullptr) ? *(input_beta + x) : static_cast<float>(0.f);
+            const float denominator = static_cast<float>(1.f / std::sqrt(static_cast<float>(*(input_var + x)) + _epsilon));
+
+            // Calculate x bar
+            const float x_bar = (*(input_ptr + x) - *(input_mean + x)) * denominator;
+            float       res   = beta + x_bar * gamma;
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            *(output_ptr + x) = res;
+        }
     },
     input, output);
 }
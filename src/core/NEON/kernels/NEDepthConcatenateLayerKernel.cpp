@@ -25,7 +25,6 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
-#include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/NEFixedPoint.h"
@@ -50,30 +49,84 @@ void depth_concat(const ITensor *in, ITensor *out, int depth_offset, const Windo
     // Offset output
     uint8_t *output_ptr = out->buffer() + out->info()->offset_first_element_in_bytes() + depth_offset * out->info()->strides_in_bytes()[2];
 
-    Iterator input(in, window);
-    Iterator output(out, window);
+    // The rows are processed in-kernel: one vector per iteration and a left-over loop
+    Window win{ window };
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    const DataType          dt           = in->info()->data_type();
-    const QuantizationInfo &input_qinfo  = in->info()->quantization_info();
-    const QuantizationInfo &output_qinfo = out->info()->quantization_info();
+    Iterator input(in, win);
+    Iterator output(out, win);
+
+    const int               window_start_x = window.x().start();
+    const int               window_end_x   = window.x().end();
+    const DataType          dt             = in->info()->data_type();
+    const QuantizationInfo &input_qinfo    = in->info()->quantization_info();
+    const QuantizationInfo &output_qinfo   = out->info()->quantization_info();
     if(dt == DataType::QASYMM8 && input_qinfo != output_qinfo)
     {
-        execute_window_loop(window, [&](const Coordinates &)
+        const int window_step_x = 16;
+
+        execute_window_loop(win, [&](const Coordinates &)
         {
             const auto in_ptr  = reinterpret_cast<const uint8_t *>(input_ptr + input.offset());
             const auto out_ptr = reinterpret_cast<uint8_t *>(output_ptr + output.offset());
-            vst1q_u8(out_ptr, vquantize(vdequantize(vld1q_u8(in_ptr), input_qinfo), output_qinfo));
+
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                vst1q_u8(out_ptr + x, vquantize(vdequantize(vld1q_u8(in_ptr + x), input_qinfo), output_qinfo));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = QAsymm8Helper<qasymm8_t>::quantize(QAsymm8Helper<qasymm8_t>::dequantize(*(in_ptr + x), input_qinfo), output_qinfo);
+            }
+        },
+        input, output);
+    }
+    else if(dt == DataType::QASYMM8_SIGNED && input_qinfo != output_qinfo)
+    {
+        const int window_step_x = 16;
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const int8_t *>(input_ptr + input.offset());
+            const auto out_ptr = reinterpret_cast<int8_t *>(output_ptr + output.offset());
+
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                vst1q_s8(out_ptr + x, vquantize_signed(vdequantize(vld1q_s8(in_ptr + x), input_qinfo), output_qinfo));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = QAsymm8Helper<qasymm8_signed_t>::quantize(QAsymm8Helper<qasymm8_signed_t>::dequantize(*(in_ptr + x), input_qinfo), output_qinfo);
+            }
         },
         input, output);
     }
     else
     {
-        execute_window_loop(window, [&](const Coordinates &)
+        const int window_step_x = 16 / sizeof(T);
+
+        execute_window_loop(win, [&](const Coordinates &)
         {
             const auto in_ptr  = reinterpret_cast<const T *>(input_ptr + input.offset());
             const auto out_ptr = reinterpret_cast<T *>(output_ptr + output.offset());
 
-            wrapper::vstore(out_ptr, wrapper::vloadq(in_ptr));
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                wrapper::vstore(out_ptr + x, wrapper::vloadq(in_ptr + x));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = *(in_ptr + x);
+            }
         },
         input, output);
     }
@@ -83,26 +136,21 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, unsi
 {
     ARM_COMPUTE_UNUSED(depth_offset);
 
-    const unsigned int num_elems_processed_per_iteration = 16 / input->element_size();
-
     // The window needs to be based on input as we copy all the depths of input
-    Window win = calculate_max_window(*output, Steps(num_elems_processed_per_iteration));
+    // The left-over elements of each row are copied in-kernel so no padding is required
+    Window win = calculate_max_window(*output, Steps());
     win.set(Window::DimZ, Window::Dimension(0, input->tensor_shape().z(), 1));
 
-    AccessWindowHorizontal input_access(input, 0, num_elems_processed_per_iteration);
-    AccessWindowHorizontal output_access(output, 0, num_elems_processed_per_iteration);
-    bool                   window_changed = update_window_and_padding(win, input_access, output_access);
-    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
 
-    Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
-    return std::make_pair(err, win);
+    return std::make_pair(Status{}, win);
 }
 
 Status validate_arguments(const ITensorInfo *input, unsigned int depth_offset, const ITensorInfo *output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(Window::DimX) != output->dimension(Window::DimX));
@@ -132,6 +180,7 @@ void NEDepthConcatenateLayerKernel::configure(const ITensor *input, unsigned int
     switch(input->info()->data_type())
     {
         case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
             _func = &depth_concat<uint8_t>;
             break;
         case DataType::F16:
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseSeparableConvolutionLayerKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <limits>
+
+namespace arm_compute
+{
+namespace
+{
+// Size in bytes of the depthwise tile kept in the L1 cache, leaving room for the pointwise weights and the outputs
+constexpr unsigned int l1_tile_size_in_bytes = 16 * 1024;
+// Number of pixels and output channels computed at once by the pointwise matrix multiplication
+constexpr int pointwise_block_pixels  = 4;
+constexpr int pointwise_block_outputs = 4;
+
+bool is_activation_supported(const ActivationLayerInfo &act_info)
+{
+    if(!act_info.enabled())
+    {
+        return true;
+    }
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Returns the [lower, upper] range the supported activations clamp to */
+std::pair<float, float> activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float lower = std::numeric_limits<float>::lowest();
+    float upper = std::numeric_limits<float>::max();
+    if(act_info.enabled())
+    {
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                lower = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                lower = 0.f;
+                upper = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                lower = act_info.b();
+                upper = act_info.a();
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation not supported");
+        }
+    }
+    return std::make_pair(lower, upper);
+}
+
+unsigned int compute_tile_width(unsigned int num_channels, size_t element_size, unsigned int output_width)
+{
+    const unsigned int num_pixels = l1_tile_size_in_bytes / (num_channels * element_size);
+    return std::max(1U, std::min(num_pixels, output_width));
+}
+
+TensorShape compute_output_shape(const ITensorInfo &input, const ITensorInfo &depthwise_weights, const ITensorInfo &pointwise_weights,
+                                 const PadStrideInfo &depthwise_conv_info, const Size2D &dilation)
+{
+    TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(input, depthwise_weights, depthwise_conv_info, 1, dilation);
+    output_shape.set(0, pointwise_weights.dimension(3));
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                          const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info,
+                          const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, depthwise_weights, pointwise_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, depthwise_weights, pointwise_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_activation_supported(depthwise_act_info) || !is_activation_supported(pointwise_act_info), "Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU can be fused");
+
+    // Depthwise weights are [IFM, kernel_x, kernel_y]
+    const unsigned int num_channels = input->dimension(0);
+    const unsigned int kernel_w     = depthwise_weights->dimension(1);
+    const unsigned int kernel_h     = depthwise_weights->dimension(2);
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->dimension(0) != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_w + (kernel_w - 1) * (dilation.x() - 1) > input->dimension(1) + depthwise_conv_info.pad_left() + depthwise_conv_info.pad_right());
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_h + (kernel_h - 1) * (dilation.y() - 1) > input->dimension(2) + depthwise_conv_info.pad_top() + depthwise_conv_info.pad_bottom());
+
+    // Pointwise weights are [IFM, 1, 1, OFM]
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->dimension(0) != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->dimension(1) != 1 || pointwise_weights->dimension(2) != 1);
+
+    if(depthwise_biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, depthwise_biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(depthwise_biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(depthwise_biases->dimension(0) != num_channels);
+    }
+
+    if(pointwise_biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, pointwise_biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(pointwise_biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(pointwise_biases->dimension(0) != pointwise_weights->dimension(3));
+    }
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = compute_output_shape(*input, *depthwise_weights, *pointwise_weights, depthwise_conv_info, dilation);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *depthwise_weights, ITensorInfo *pointwise_weights, ITensorInfo *output,
+                                                        const PadStrideInfo &depthwise_conv_info, const Size2D &dilation)
+{
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape = compute_output_shape(*input, *depthwise_weights, *pointwise_weights, depthwise_conv_info, dilation);
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+
+    // Every iteration computes a whole output row, no padding is required
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+
+/** Sum the lanes of a vector */
+template <typename T, typename V>
+inline T reduce_add(const V &v)
+{
+    auto sum = wrapper::vadd(wrapper::vgethigh(v), wrapper::vgetlow(v));
+    for(int lanes = 8 / sizeof(T); lanes > 1; lanes >>= 1)
+    {
+        sum = wrapper::vpadd(sum, sum);
+    }
+    return wrapper::vgetlane(sum, 0);
+}
+
+/** Multiply a block of depthwise outputs by a block of pointwise weights
+ *
+ * @param[in]  src            Depthwise outputs of the first pixel of the block. Pixels are @p src_stride elements apart.
+ * @param[in]  src_stride     Distance in elements between two pixels of @p src.
+ * @param[in]  weights        Pointwise weights of the first output channel of the block.
+ * @param[in]  weights_stride Distance in bytes between the weights of two output channels.
+ * @param[in]  bias           Biases of the first output channel of the block. Can be nullptr.
+ * @param[in]  num_channels   Number of depthwise channels.
+ * @param[in]  act_lower      Lower bound of the fused activation.
+ * @param[in]  act_upper      Upper bound of the fused activation.
+ * @param[out] dst            Output of the first pixel and output channel of the block.
+ * @param[in]  dst_stride     Distance in bytes between two output pixels.
+ */
+template <typename T, int P, int O>
+inline void pointwise_block(const T *src, int src_stride, const uint8_t *weights, int weights_stride, const T *bias, int num_channels,
+                            T act_lower, T act_upper, uint8_t *dst, int dst_stride)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    using VectorType   = wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const T *w_ptrs[O];
+    for(int o = 0; o < O; ++o)
+    {
+        w_ptrs[o] = reinterpret_cast<const T *>(weights + o * weights_stride);
+    }
+
+    VectorType acc[P][O];
+    for(int p = 0; p < P; ++p)
+    {
+        for(int o = 0; o < O; ++o)
+        {
+            acc[p][o] = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+        }
+    }
+
+    int c = 0;
+    for(; c <= num_channels - step; c += step)
+    {
+        VectorType vw[O];
+        for(int o = 0; o < O; ++o)
+        {
+            vw[o] = wrapper::vloadq(w_ptrs[o] + c);
+        }
+        for(int p = 0; p < P; ++p)
+        {
+            const VectorType vs = wrapper::vloadq(src + p * src_stride + c);
+            for(int o = 0; o < O; ++o)
+            {
+                acc[p][o] = wrapper::vmla(acc[p][o], vs, vw[o]);
+            }
+        }
+    }
+
+    for(int p = 0; p < P; ++p)
+    {
+        T *out_ptr = reinterpret_cast<T *>(dst + p * dst_stride);
+        for(int o = 0; o < O; ++o)
+        {
+            T sum = reduce_add<T>(acc[p][o]);
+            for(int k = c; k < num_channels; ++k)
+            {
+                sum += src[p * src_stride + k] * w_ptrs[o][k];
+            }
+            if(bias != nullptr)
+            {
+                sum += bias[o];
+            }
+            out_ptr[o] = std::min(std::max(sum, act_lower), act_upper);
+        }
+    }
+}
+} // namespace
+
+NEDepthwiseSeparableConvolutionLayerKernel::NEDepthwiseSeparableConvolutionLayerKernel()
+    : _func(nullptr), _input(nullptr), _depthwise_weights(nullptr), _depthwise_biases(nullptr), _pointwise_weights(nullptr), _pointwise_biases(nullptr), _output(nullptr), _workspace(nullptr),
+      _depthwise_conv_info(), _depthwise_act_info(), _pointwise_act_info(), _dilation(1U, 1U), _tile_width(1)
+{
+}
+
+void NEDepthwiseSeparableConvolutionLayerKernel::configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights,
+                                                           const ITensor *pointwise_biases, ITensor *output, ITensor *workspace, const PadStrideInfo &depthwise_conv_info,
+                                                           const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output, workspace);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), depthwise_weights->info(), (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr, pointwise_weights->info(),
+                                                  (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr, output->info(), depthwise_conv_info,
+                                                  depthwise_act_info, pointwise_act_info, dilation));
+
+    _input               = input;
+    _depthwise_weights   = depthwise_weights;
+    _depthwise_biases    = depthwise_biases;
+    _pointwise_weights   = pointwise_weights;
+    _pointwise_biases    = pointwise_biases;
+    _output              = output;
+    _workspace           = workspace;
+    _depthwise_conv_info = depthwise_conv_info;
+    _depthwise_act_info  = depthwise_act_info;
+    _pointwise_act_info  = pointwise_act_info;
+    _dilation            = dilation;
+
+    auto win_config = validate_and_configure_window(input->info(), depthwise_weights->info(), pointwise_weights->info(), output->info(), depthwise_conv_info, dilation);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+
+    _tile_width = compute_tile_width(input->info()->dimension(0), input->info()->element_size(), output->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(workspace->info()->dimension(0) < _tile_width * input->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, workspace);
+
+    switch(input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NEDepthwiseSeparableConvolutionLayerKernel::depthwise_separable<float16_t>;
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            _func = &NEDepthwiseSeparableConvolutionLayerKernel::depthwise_separable<float>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    INEKernel::configure(win_config.second);
+}
+
+Status NEDepthwiseSeparableConvolutionLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                                                            const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info,
+                                                            const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, depthwise_conv_info,
+                                                   depthwise_act_info, pointwise_act_info, dilation));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), depthwise_weights->clone().get(), pointwise_weights->clone().get(), output->clone().get(),
+                                                              depthwise_conv_info, dilation)
+                                .first);
+    return Status{};
+}
+
+TensorShape NEDepthwiseSeparableConvolutionLayerKernel::compute_workspace_shape(const ITensorInfo *input, unsigned int output_width, unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    const unsigned int num_channels = input->dimension(0);
+    const unsigned int tile_width   = compute_tile_width(num_channels, input->element_size(), output_width);
+    return TensorShape(tile_width * num_channels, std::max(1U, num_threads));
+}
+
+template <typename T>
+void NEDepthwiseSeparableConvolutionLayerKernel::depthwise_separable(const Window &window, const ThreadInfo &info)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const ITensorInfo *input_info = _input->info();
+    const ITensorInfo *dw_info    = _depthwise_weights->info();
+    const ITensorInfo *pw_info    = _pointwise_weights->info();
+    const ITensorInfo *out_info   = _output->info();
+
+    const int num_channels = input_info->dimension(0);
+    const int input_w      = input_info->dimension(1);
+    const int input_h      = input_info->dimension(2);
+    const int num_outputs  = out_info->dimension(0);
+    const int output_w     = out_info->dimension(1);
+    const int kernel_w     = dw_info->dimension(1);
+    const int kernel_h     = dw_info->dimension(2);
+    const int stride_x     = _depthwise_conv_info.stride().first;
+    const int stride_y     = _depthwise_conv_info.stride().second;
+    const int pad_left     = _depthwise_conv_info.pad_left();
+    const int pad_top      = _depthwise_conv_info.pad_top();
+    const int dilation_x   = _dilation.x();
+    const int dilation_y   = _dilation.y();
+    const int tile_width   = _tile_width;
+
+    const int input_stride_x  = input_info->strides_in_bytes()[1];
+    const int input_stride_y  = input_info->strides_in_bytes()[2];
+    const int input_stride_z  = input_info->strides_in_bytes()[3];
+    const int dw_stride_x     = dw_info->strides_in_bytes()[1];
+    const int dw_stride_y     = dw_info->strides_in_bytes()[2];
+    const int pw_stride_o     = pw_info->strides_in_bytes()[3];
+    const int output_stride_x = out_info->strides_in_bytes()[1];
+    const int output_stride_y = out_info->strides_in_bytes()[2];
+    const int output_stride_z = out_info->strides_in_bytes()[3];
+
+    const uint8_t *input_base  = _input->buffer() + input_info->offset_first_element_in_bytes();
+    const uint8_t *dw_base     = _depthwise_weights->buffer() + dw_info->offset_first_element_in_bytes();
+    const uint8_t *pw_base     = _pointwise_weights->buffer() + pw_info->offset_first_element_in_bytes();
+    uint8_t       *output_base = _output->buffer() + out_info->offset_first_element_in_bytes();
+    const T       *dw_biases   = (_depthwise_biases != nullptr) ? reinterpret_cast<const T *>(_depthwise_biases->ptr_to_element(Coordinates(0))) : nullptr;
+    const T       *pw_biases   = (_pointwise_biases != nullptr) ? reinterpret_cast<const T *>(_pointwise_biases->ptr_to_element(Coordinates(0))) : nullptr;
+
+    // Per-thread buffer holding the depthwise outputs of a tile: [tile_width, num_channels]
+    ARM_COMPUTE_ERROR_ON(static_cast<unsigned int>(info.thread_id) >= _workspace->info()->dimension(1));
+    T *tile = reinterpret_cast<T *>(_workspace->ptr_to_element(Coordinates(0, info.thread_id)));
+
+    const auto dw_bounds = activation_bounds(_depthwise_act_info);
+    const auto pw_bounds = activation_bounds(_pointwise_act_info);
+    const T    dw_lower  = static_cast<T>(std::max(dw_bounds.first, static_cast<float>(std::numeric_limits<T>::lowest())));
+    const T    dw_upper  = static_cast<T>(std::min(dw_bounds.second, static_cast<float>(std::numeric_limits<T>::max())));
+    const T    pw_lower  = static_cast<T>(std::max(pw_bounds.first, static_cast<float>(std::numeric_limits<T>::lowest())));
+    const T    pw_upper  = static_cast<T>(std::min(pw_bounds.second, static_cast<float>(std::numeric_limits<T>::max())));
+    const auto vdw_lower = wrapper::vdup_n(dw_lower, ExactTagType{});
+    const auto vdw_upper = wrapper::vdup_n(dw_upper, ExactTagType{});
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int      out_y       = id[2];
+        const int      batch       = id[3];
+        const uint8_t *input_batch = input_base + batch * input_stride_z;
+        uint8_t       *output_row  = output_base + out_y * output_stride_y + batch * output_stride_z;
+        const int      in_y_start  = out_y * stride_y - pad_top;
+
+        for(int x0 = 0; x0 < output_w; x0 += tile_width)
+        {
+            const int num_pixels = std::min(tile_width, output_w - x0);
+
+            // Depthwise convolution of the tile into the L1 buffer
+            for(int p = 0; p < num_pixels; ++p)
+            {
+                T        *tile_row   = tile + p * num_channels;
+                const int in_x_start = (x0 + p) * stride_x - pad_left;
+
+                int c = 0;
+                for(; c <= num_channels - step; c += step)
+                {
+                    auto acc = (dw_biases != nullptr) ? wrapper::vloadq(dw_biases + c) : wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+                    for(int ky = 0; ky < kernel_h; ++ky)
+                    {
+                        const int in_y = in_y_start + ky * dilation_y;
+                        if(in_y < 0 || in_y >= input_h)
+                        {
+                            continue;
+                        }
+                        for(int kx = 0; kx < kernel_w; ++kx)
+                        {
+                            const int in_x = in_x_start + kx * dilation_x;
+                            if(in_x < 0 || in_x >= input_w)
+                            {
+                                continue;
+                            }
+                            const T *in_ptr = reinterpret_cast<const T *>(input_batch + in_x * input_stride_x + in_y * input_stride_y) + c;
+                            const T *w_ptr  = reinterpret_cast<const T *>(dw_base + kx * dw_stride_x + ky * dw_stride_y) + c;
+                            acc             = wrapper::vmla(acc, wrapper::vloadq(in_ptr), wrapper::vloadq(w_ptr));
+                        }
+                    }
+                    wrapper::vstore(tile_row + c, wrapper::vmin(wrapper::vmax(acc, vdw_lower), vdw_upper));
+                }
+
+                // Left-over channels
+                for(; c < num_channels; ++c)
+                {
+                    T acc = (dw_biases != nullptr) ? dw_biases[c] : static_cast<T>(0.f);
+                    for(int ky = 0; ky < kernel_h; ++ky)
+                    {
+                        const int in_y = in_y_start + ky * dilation_y;
+                        if(in_y < 0 || in_y >= input_h)
+                        {
+                            continue;
+                        }
+                        for(int kx = 0; kx < kernel_w; ++kx)
+                        {
+                            const int in_x = in_x_start + kx * dilation_x;
+                            if(in_x < 0 || in_x >= input_w)
+                            {
+                                continue;
+                            }
+                            acc += *(reinterpret_cast<const T *>(input_batch + in_x * input_stride_x + in_y * input_stride_y) + c) * *(reinterpret_cast<const T *>(dw_base + kx * dw_stride_x + ky * dw_stride_y) + c);
+                        }
+                    }
+                    tile_row[c] = std::min(std::max(acc, dw_lower), dw_upper);
+                }
+            }
+
+            // Pointwise convolution of the tile straight into the output
+            uint8_t *output_tile = output_row + x0 * output_stride_x;
+            int      p           = 0;
+            for(; p <= num_pixels - pointwise_block_pixels; p += pointwise_block_pixels)
+            {
+                int o = 0;
+                for(; o <= num_outputs - pointwise_block_outputs; o += pointwise_block_outputs)
+                {
+                    pointwise_block<T, pointwise_block_pixels, pointwise_block_outputs>(tile + p * num_channels, num_channels, pw_base + o * pw_stride_o, pw_stride_o,
+                                                                                        (pw_biases != nullptr) ? pw_biases + o : nullptr, num_channels, pw_lower, pw_upper,
+                                                                                        output_tile + p * output_stride_x + o * sizeof(T), output_stride_x);
+                }
+                for(; o < num_outputs; ++o)
+                {
+                    pointwise_block<T, pointwise_block_pixels, 1>(tile + p * num_channels, num_channels, pw_base + o * pw_stride_o, pw_stride_o,
+                                                                  (pw_biases != nullptr) ? pw_biases + o : nullptr, num_channels, pw_lower, pw_upper,
+                                                                  output_tile + p * output_stride_x + o * sizeof(T), output_stride_x);
+                }
+            }
+            for(; p < num_pixels; ++p)
+            {
+                int o = 0;
+                for(; o <= num_outputs - pointwise_block_outputs; o += pointwise_block_outputs)
+                {
+                    pointwise_block<T, 1, pointwise_block_outputs>(tile + p * num_channels, num_channels, pw_base + o * pw_stride_o, pw_stride_o,
+                                                                   (pw_biases != nullptr) ? pw_biases + o : nullptr, num_channels, pw_lower, pw_upper,
+                                                                   output_tile + p * output_stride_x + o * sizeof(T), output_stride_x);
+                }
+                for(; o < num_outputs; ++o)
+                {
+                    pointwise_block<T, 1, 1>(tile + p * num_channels, num_channels, pw_base + o * pw_stride_o, pw_stride_o,
+                                             (pw_biases != nullptr) ? pw_biases + o : nullptr, num_channels, pw_lower, pw_upper,
+                                             output_tile + p * output_stride_x + o * sizeof(T), output_stride_x);
+                }
+            }
+        }
+    });
+}
+
+void NEDepthwiseSeparableConvolutionLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window, info);
+}
+} // namespace arm_compute
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDynamicQuantizationLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S8, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->quantization_info().offset != 0, "Only symmetric quantization is supported");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+
+    if(scales->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(scales->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(scales->dimension(0) != input->dimension(1));
+    }
+
+    return Status{};
+}
+
+/** Quantize 16 values with a symmetric scale, rounding half away from zero and saturating to S8 */
+inline int8x16_t vquantize_symmetric(const float32x4x4_t &values, const float32x4_t &vinv_scale)
+{
+    const float32x4_t vzero       = vdupq_n_f32(0.f);
+    const float32x4_t vhalf       = vdupq_n_f32(0.5f);
+    const float32x4_t vminus_half = vdupq_n_f32(-0.5f);
+
+    int32x4_t rf[4];
+    for(int i = 0; i < 4; ++i)
+    {
+        const float32x4_t x = vmulq_f32(values.val[i], vinv_scale);
+        rf[i]               = vcvtq_s32_f32(vaddq_f32(x, vbslq_f32(vcltq_f32(x, vzero), vminus_half, vhalf)));
+    }
+
+    const int16x8_t lo = vcombine_s16(vqmovn_s32(rf[0]), vqmovn_s32(rf[1]));
+    const int16x8_t hi = vcombine_s16(vqmovn_s32(rf[2]), vqmovn_s32(rf[3]));
+    return vcombine_s8(vqmovn_s16(lo), vqmovn_s16(hi));
+}
+
+/** Scalar version of @ref vquantize_symmetric */
+inline int8_t quantize_symmetric(float value, float inv_scale)
+{
+    const float x = value * inv_scale;
+    return static_cast<int8_t>(utility::clamp<int>(static_cast<int>(x + ((x < 0.f) ? -0.5f : 0.5f)), -128, 127));
+}
+} // namespace
+
+NEDynamicQuantizationLayerKernel::NEDynamicQuantizationLayerKernel()
+    : _input(nullptr), _output(nullptr), _scales(nullptr)
+{
+}
+
+void NEDynamicQuantizationLayerKernel::configure(const ITensor *input, ITensor *output, ITensor *scales)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, scales);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_data_type(DataType::S8));
+    auto_init_if_empty(*scales->info(), TensorShape(input->info()->dimension(1)), 1, DataType::F32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), scales->info()));
+
+    _input  = input;
+    _output = output;
+    _scales = scales;
+
+    // Configure kernel window: the rows are processed entirely by a single thread as their scale depends on all their elements
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+    scales->info()->set_valid_region(ValidRegion(Coordinates(), scales->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEDynamicQuantizationLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, scales));
+
+    return Status{};
+}
+
+void NEDynamicQuantizationLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    constexpr int window_step_x  = 16;
+    const int     window_start_x = static_cast<int>(window.x().start());
+    const int     window_end_x   = static_cast<int>(window.x().end());
+
+    // Reset first dimension to handle the rows manually
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+    Iterator output(_output, win);
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<int8_t *>(output.ptr());
+
+        // Find the largest absolute value of the row
+        float32x4_t vmax = vdupq_n_f32(0.f);
+        int         x    = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const float32x4_t vmax01 = vmaxq_f32(vabsq_f32(vld1q_f32(input_ptr + x)), vabsq_f32(vld1q_f32(input_ptr + x + 4)));
+            const float32x4_t vmax23 = vmaxq_f32(vabsq_f32(vld1q_f32(input_ptr + x + 8)), vabsq_f32(vld1q_f32(input_ptr + x + 12)));
+            vmax                     = vmaxq_f32(vmax, vmaxq_f32(vmax01, vmax23));
+        }
+        float32x2_t vmax2 = vpmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+        vmax2             = vpmax_f32(vmax2, vmax2);
+        float max         = vget_lane_f32(vmax2, 0);
+        for(; x < window_end_x; ++x)
+        {
+            max = std::max(max, std::abs(input_ptr[x]));
+        }
+
+        const float scale     = (max > 0.f) ? max / 127.f : 1.f;
+        const float inv_scale = 1.f / scale;
+        *reinterpret_cast<float *>(_scales->ptr_to_element(Coordinates(id.y()))) = scale;
+
+        // Quantize the row
+        const float32x4_t vinv_scale = vdupq_n_f32(inv_scale);
+        x                            = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const float32x4x4_t values =
+            {
+                {
+                    vld1q_f32(input_ptr + x),
+                    vld1q_f32(input_ptr + x + 4),
+                    vld1q_f32(input_ptr + x + 8),
+                    vld1q_f32(input_ptr + x + 12)
+                }
+            };
+            vst1q_s8(output_ptr + x, vquantize_symmetric(values, vinv_scale));
+        }
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            output_ptr[x] = quantize_symmetric(input_ptr[x], inv_scale);
+        }
+    },
+    input, output);
+}
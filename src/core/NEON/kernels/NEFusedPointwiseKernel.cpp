@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFusedPointwiseKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+bool is_operation_with_elementwise_operand(PointwiseOperation::Type type)
+{
+    return type == PointwiseOperation::Type::ADD || type == PointwiseOperation::Type::SUB || type == PointwiseOperation::Type::REVERSE_SUB || type == PointwiseOperation::Type::MUL;
+}
+
+Status validate_arguments(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const ITensorInfo *output, const std::vector<PointwiseOperation> &operations)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(operations.empty(), "The chain of operations is empty");
+
+    const size_t channel_idx = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
+
+    for(const auto &op : operations)
+    {
+        if(is_operation_with_elementwise_operand(op.type))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(op.operand >= operands.size(), "Operand index out of range");
+            const ITensorInfo *operand = operands[op.operand];
+            ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(operand);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, operand);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, operand);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, operand);
+        }
+        else if(op.type == PointwiseOperation::Type::SCALE_SHIFT)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(op.operand + 1 >= operands.size(), "Operand index out of range");
+            for(unsigned int i = op.operand; i <= op.operand + 1; ++i)
+            {
+                const ITensorInfo *operand = operands[i];
+                ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(operand);
+                ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, operand);
+                ARM_COMPUTE_RETURN_ERROR_ON(operand->num_dimensions() > 1);
+                ARM_COMPUTE_RETURN_ERROR_ON(operand->dimension(0) != input->dimension(channel_idx));
+            }
+        }
+        else if(op.type != PointwiseOperation::Type::ACTIVATION)
+        {
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported pointwise operation");
+        }
+    }
+
+    // Checks performed when output is configured
+    if((output != nullptr) && (output->total_size() != 0))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+
+inline float32x4_t activate(const float32x4_t &in, const ActivationLayerInfo &act_info)
+{
+    const float32x4_t const_0 = vdupq_n_f32(0.f);
+    const float32x4_t const_1 = vdupq_n_f32(1.f);
+    const float32x4_t va      = vdupq_n_f32(act_info.a());
+    const float32x4_t vb      = vdupq_n_f32(act_info.b());
+
+    switch(act_info.activation())
+    {
+        case ActivationFunction::ABS:
+            return wrapper::vabs(in);
+        case ActivationFunction::LINEAR:
+            return wrapper::vmla(vb, va, in);
+        case ActivationFunction::LOGISTIC:
+            return wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(in))));
+        case ActivationFunction::RELU:
+            return wrapper::vmax(const_0, in);
+        case ActivationFunction::BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(const_0, in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(vb, in));
+        case ActivationFunction::LEAKY_RELU:
+            return wrapper::vbsl(wrapper::vcgt(in, const_0), in, wrapper::vmul(va, in));
+        case ActivationFunction::SOFT_RELU:
+            return wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(in)));
+        case ActivationFunction::SQRT:
+            return wrapper::vinv(wrapper::vinvsqrt(in));
+        case ActivationFunction::SQUARE:
+            return wrapper::vmul(in, in);
+        case ActivationFunction::TANH:
+            return wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, in)));
+        case ActivationFunction::IDENTITY:
+            return in;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+inline float activate(float in, const ActivationLayerInfo &act_info)
+{
+    const float a = act_info.a();
+    const float b = act_info.b();
+
+    switch(act_info.activation())
+    {
+        case ActivationFunction::ABS:
+            return std::abs(in);
+        case ActivationFunction::LINEAR:
+            return a * in + b;
+        case ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-in));
+        case ActivationFunction::RELU:
+            return std::max(0.f, in);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min(a, std::max(0.f, in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min(a, std::max(b, in));
+        case ActivationFunction::LEAKY_RELU:
+            return (in > 0.f) ? in : a * in;
+        case ActivationFunction::SOFT_RELU:
+            return std::log(1.f + std::exp(in));
+        case ActivationFunction::SQRT:
+            return std::sqrt(in);
+        case ActivationFunction::SQUARE:
+            return in * in;
+        case ActivationFunction::TANH:
+            return a * std::tanh(b * in);
+        case ActivationFunction::IDENTITY:
+            return in;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Operands of an operation for the row being processed */
+struct OperandRow
+{
+    const float *first{ nullptr };  /**< Elementwise operand or scale */
+    const float *second{ nullptr }; /**< Shift */
+    bool         broadcast{ false }; /**< True if the operands are the same for the whole row */
+};
+} // namespace
+
+NEFusedPointwiseKernel::NEFusedPointwiseKernel()
+    : _input(nullptr), _operands(), _output(nullptr), _operations(), _channel_idx(0)
+{
+}
+
+void NEFusedPointwiseKernel::configure(const ITensor *input, const std::vector<const ITensor *> &operands, ITensor *output, const std::vector<PointwiseOperation> &operations)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    std::vector<const ITensorInfo *> operands_info;
+    for(const ITensor *operand : operands)
+    {
+        operands_info.emplace_back((operand != nullptr) ? operand->info() : nullptr);
+    }
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), *input->info()->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), operands_info, output->info(), operations));
+
+    _input       = input;
+    _operands    = operands;
+    _output      = output;
+    _operations  = operations;
+    _channel_idx = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    // NEFusedPointwiseKernel doesn't need padding so update_window_and_padding() can be skipped
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEFusedPointwiseKernel::validate(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const ITensorInfo *output, const std::vector<PointwiseOperation> &operations)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, operands, output, operations));
+    return Status{};
+}
+
+void NEFusedPointwiseKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    using Type = PointwiseOperation::Type;
+
+    const int  window_step_x  = 4;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+    Iterator output(_output, win);
+
+    const size_t            num_operations = _operations.size();
+    std::vector<OperandRow> rows(num_operations);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // Locate the operands of the row
+        for(size_t i = 0; i < num_operations; ++i)
+        {
+            const PointwiseOperation &op = _operations[i];
+            if(op.type == Type::SCALE_SHIFT)
+            {
+                rows[i].broadcast = _channel_idx != 0;
+                rows[i].first     = reinterpret_cast<const float *>(_operands[op.operand]->ptr_to_element(Coordinates(rows[i].broadcast ? id[_channel_idx] : 0)));
+                rows[i].second    = reinterpret_cast<const float *>(_operands[op.operand + 1]->ptr_to_element(Coordinates(rows[i].broadcast ? id[_channel_idx] : 0)));
+            }
+            else if(op.type != Type::ACTIVATION)
+            {
+                rows[i].first = reinterpret_cast<const float *>(_operands[op.operand]->ptr_to_element(id));
+            }
+        }
+
+        // Compute 4 elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            float32x4_t res = vld1q_f32(input_ptr + x);
+            for(size_t i = 0; i < num_operations; ++i)
+            {
+                const PointwiseOperation &op  = _operations[i];
+                const OperandRow         &row = rows[i];
+                switch(op.type)
+                {
+                    case Type::ADD:
+                        res = vaddq_f32(res, vld1q_f32(row.first + x));
+                        break;
+                    case Type::SUB:
+                        res = vsubq_f32(res, vld1q_f32(row.first + x));
+                        break;
+                    case Type::REVERSE_SUB:
+                        res = vsubq_f32(vld1q_f32(row.first + x), res);
+                        break;
+                    case Type::MUL:
+                        res = vmulq_f32(res, vld1q_f32(row.first + x));
+                        break;
+                    case Type::SCALE_SHIFT:
+                    {
+                        const float32x4_t scale = row.broadcast ? vdupq_n_f32(*row.first) : vld1q_f32(row.first + x);
+                        const float32x4_t shift = row.broadcast ? vdupq_n_f32(*row.second) : vld1q_f32(row.second + x);
+                        res                     = vmlaq_f32(shift, res, scale);
+                        break;
+                    }
+                    case Type::ACTIVATION:
+                        res = activate(res, op.act_info);
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pointwise operation");
+                }
+            }
+            vst1q_f32(output_ptr + x, res);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            float res = *(input_ptr + x);
+            for(size_t i = 0; i < num_operations; ++i)
+            {
+                const PointwiseOperation &op  = _operations[i];
+                const OperandRow         &row = rows[i];
+                switch(op.type)
+                {
+                    case Type::ADD:
+                        res = res + row.first[x];
+                        break;
+                    case Type::SUB:
+                        res = res - row.first[x];
+                        break;
+                    case Type::REVERSE_SUB:
+                        res = row.first[x] - res;
+                        break;
+                    case Type::MUL:
+                        res = res * row.first[x];
+                        break;
+                    case Type::SCALE_SHIFT:
+                    {
+                        const float scale = row.broadcast ? *row.first : row.first[x];
+                        const float shift = row.broadcast ? *row.second : row.second[x];
+                        res               = res * scale + shift;
+                        break;
+                    }
+                    case Type::ACTIVATION:
+                        res = activate(res, op.act_info);
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pointwise operation");
+                }
+            }
+            *(output_ptr + x) = res;
+        }
+    },
+    input, output);
+}
+} // namespace arm_compute
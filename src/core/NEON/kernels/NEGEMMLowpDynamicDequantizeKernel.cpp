@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpDynamicDequantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *row_scales, const ITensorInfo *col_scales, const ITensorInfo *bias, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, row_scales, col_scales, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(row_scales, col_scales);
+    ARM_COMPUTE_RETURN_ERROR_ON(row_scales->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(col_scales->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(row_scales->dimension(0) != input->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(col_scales->dimension(0) != input->dimension(0));
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(row_scales, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != input->dimension(0));
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEGEMMLowpDynamicDequantizeKernel::NEGEMMLowpDynamicDequantizeKernel()
+    : _input(nullptr), _row_scales(nullptr), _col_scales(nullptr), _bias(nullptr), _output(nullptr)
+{
+}
+
+void NEGEMMLowpDynamicDequantizeKernel::configure(const ITensor *input, const ITensor *row_scales, const ITensor *col_scales, const ITensor *bias, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, row_scales, col_scales, output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_data_type(DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), row_scales->info(), col_scales->info(), (bias != nullptr) ? bias->info() : nullptr, output->info()));
+
+    _input      = input;
+    _row_scales = row_scales;
+    _col_scales = col_scales;
+    _bias       = bias;
+    _output     = output;
+
+    // Configure kernel window, the columns are handled manually in run()
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEGEMMLowpDynamicDequantizeKernel::validate(const ITensorInfo *input, const ITensorInfo *row_scales, const ITensorInfo *col_scales, const ITensorInfo *bias, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, row_scales, col_scales, bias, output));
+
+    return Status{};
+}
+
+void NEGEMMLowpDynamicDequantizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    constexpr int window_step_x  = 8;
+    const int     window_start_x = static_cast<int>(window.x().start());
+    const int     window_end_x   = static_cast<int>(window.x().end());
+
+    const auto col_scales_ptr = reinterpret_cast<const float *>(_col_scales->buffer() + _col_scales->info()->offset_first_element_in_bytes());
+    const auto bias_ptr       = (_bias != nullptr) ? reinterpret_cast<const float *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+    Iterator output(_output, win);
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const auto  input_ptr  = reinterpret_cast<const int32_t *>(input.ptr());
+        const auto  output_ptr = reinterpret_cast<float *>(output.ptr());
+        const float row_scale  = *reinterpret_cast<const float *>(_row_scales->ptr_to_element(Coordinates(id.y())));
+
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            float32x4_t out0 = vmulq_f32(vcvtq_f32_s32(vld1q_s32(input_ptr + x)), vmulq_n_f32(vld1q_f32(col_scales_ptr + x), row_scale));
+            float32x4_t out1 = vmulq_f32(vcvtq_f32_s32(vld1q_s32(input_ptr + x + 4)), vmulq_n_f32(vld1q_f32(col_scales_ptr + x + 4), row_scale));
+            if(bias_ptr != nullptr)
+            {
+                out0 = vaddq_f32(out0, vld1q_f32(bias_ptr + x));
+                out1 = vaddq_f32(out1, vld1q_f32(bias_ptr + x + 4));
+            }
+            vst1q_f32(output_ptr + x, out0);
+            vst1q_f32(output_ptr + x + 4, out1);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            float out = static_cast<float>(input_ptr[x]) * (col_scales_ptr[x] * row_scale);
+            if(bias_ptr != nullptr)
+            {
+                out += bias_ptr[x];
+            }
+            output_ptr[x] = out;
+        }
+    },
+    input, output);
+}
@@ -141,6 +141,36 @@ inline uint8x16_t finalize_quantization_floating_point(int32x4x4_t &in_s32, int3
     return out_u8;
 }
 
+template <bool   is_bounded_relu>
+inline int8x16_t finalize_quantization_floating_point(int32x4x4_t &in_s32, int32x4_t result_shift_s32, int8x16_t min_s8, int8x16_t max_s8)
+{
+    // Shift final result (negative value shift right)
+    in_s32.val[0] = vshlq_s32(in_s32.val[0], result_shift_s32);
+    in_s32.val[1] = vshlq_s32(in_s32.val[1], result_shift_s32);
+    in_s32.val[2] = vshlq_s32(in_s32.val[2], result_shift_s32);
+    in_s32.val[3] = vshlq_s32(in_s32.val[3], result_shift_s32);
+
+    // Convert S32 to S16
+    const int16x8x2_t in_s16 =
+    {
+        {
+            vcombine_s16(vqmovn_s32(in_s32.val[0]), vqmovn_s32(in_s32.val[1])),
+            vcombine_s16(vqmovn_s32(in_s32.val[2]), vqmovn_s32(in_s32.val[3]))
+        }
+    };
+
+    // Convert S16 to S8
+    int8x16_t out_s8 = vcombine_s8(vqmovn_s16(in_s16.val[0]), vqmovn_s16(in_s16.val[1]));
+
+    if(is_bounded_relu)
+    {
+        out_s8 = vmaxq_s8(out_s8, min_s8);
+        out_s8 = vminq_s8(out_s8, max_s8);
+    }
+
+    return out_s8;
+}
+
 inline Window get_win_vector_sum(const Window &window)
 {
     Window win_vector_sum(window);
@@ -211,12 +241,19 @@ inline int32x4x4_t mul_s32(int32x4x4_t &a, int32_t mul_scalar)
     };
 }
 
-template <bool has_a_offset, bool has_b_offset, bool has_bias, bool is_bounded_relu, bool is_fixed_point>
+template <typename T, bool has_a_offset, bool has_b_offset, bool has_bias, bool is_bounded_relu, bool is_fixed_point, bool is_per_channel>
 inline void run_offset_contribution_output_stage_window(const int32_t *vector_sum_col_ptr, const int32_t *vector_sum_row_ptr, const int32_t *bias_ptr, Iterator mm_result_it, Iterator out_it,
-                                                        const int32x4_t result_offset_s32, const int32x4_t result_shift_s32, uint8x16_t min_u8, uint8x16_t max_u8,
+                                                        const int32x4_t result_offset_s32, const int32x4_t result_shift_s32,
+                                                        typename wrapper::traits::neon_vector<T, 16>::type min_vec, typename wrapper::traits::neon_vector<T, 16>::type max_vec,
                                                         int32_t a_offset, int32_t b_offset, int32_t k_offset,
-                                                        GEMMLowpOutputStageInfo output_stage, int window_step_x, int window_start_x, int window_end_x)
+                                                        const GEMMLowpOutputStageInfo &output_stage, int window_step_x, int window_start_x, int window_end_x)
 {
+    auto out_ptr = reinterpret_cast<T *>(out_it.ptr());
+
+    // Multipliers and shifts of each output channel, only used by the per channel output stage
+    const int32_t *result_multipliers_ptr = output_stage.gemmlowp_multipliers.data();
+    const int32_t *result_shifts_ptr      = output_stage.gemmlowp_shifts.data();
+
     int32x4x4_t offset_term_s32 = { 0, 0, 0, 0 };
     if(!is_fixed_point)
     {
@@ -254,13 +291,17 @@ inline void run_offset_contribution_output_stage_window(const int32_t *vector_su
             in_s32 = mul_s32(in_s32, output_stage.gemmlowp_multiplier);
         }
 
-        if(is_fixed_point)
+        if(is_fixed_point && is_per_channel)
+        {
+            wrapper::vstore(out_ptr + x, finalize_quantization<is_bounded_relu>(in_s32, load(result_multipliers_ptr, x), load(result_shifts_ptr, x), result_offset_s32, min_vec, max_vec));
+        }
+        else if(is_fixed_point)
         {
-            vst1q_u8(out_it.ptr() + x, finalize_quantization<is_bounded_relu>(in_s32, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift, result_offset_s32, min_u8, max_u8));
+            wrapper::vstore(out_ptr + x, finalize_quantization<is_bounded_relu>(in_s32, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift, result_offset_s32, min_vec, max_vec));
         }
         else
         {
-            vst1q_u8(out_it.ptr() + x, finalize_quantization_floating_point<is_bounded_relu>(in_s32, result_shift_s32, min_u8, max_u8));
+            wrapper::vstore(out_ptr + x, finalize_quantization_floating_point<is_bounded_relu>(in_s32, result_shift_s32, min_vec, max_vec));
         }
     }
     // Compute left-over elements
@@ -279,9 +320,12 @@ inline void run_offset_contribution_output_stage_window(const int32_t *vector_su
 
         if(is_fixed_point)
         {
+            const int32_t result_multiplier = is_per_channel ? result_multipliers_ptr[x] : output_stage.gemmlowp_multiplier;
+            const int32_t result_shift      = is_per_channel ? result_shifts_ptr[x] : output_stage.gemmlowp_shift;
+
             // Finalize and store the result
-            *(out_it.ptr() + x) = finalize_quantization<is_bounded_relu>(in_value, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift,
-                                                                         output_stage.gemmlowp_offset, static_cast<uint8_t>(output_stage.gemmlowp_min_bound), static_cast<uint8_t>(output_stage.gemmlowp_max_bound));
+            *(out_ptr + x) = finalize_quantization<is_bounded_relu>(in_value, result_multiplier, result_shift,
+                                                                    output_stage.gemmlowp_offset, static_cast<T>(output_stage.gemmlowp_min_bound), static_cast<T>(output_stage.gemmlowp_max_bound));
         }
         else
         {
@@ -291,26 +335,28 @@ inline void run_offset_contribution_output_stage_window(const int32_t *vector_su
             // Bound and store the result
             if(is_bounded_relu)
             {
-                in_value = static_cast<uint8_t>(std::max<int32_t>(output_stage.gemmlowp_min_bound, std::min<int32_t>(output_stage.gemmlowp_max_bound, in_value)));
+                in_value = static_cast<T>(std::max<int32_t>(output_stage.gemmlowp_min_bound, std::min<int32_t>(output_stage.gemmlowp_max_bound, in_value)));
             }
-            *(out_it.ptr() + x) = static_cast<uint8_t>(std::max<int32_t>(0, std::min<int32_t>(255, in_value)));
+            *(out_ptr + x) = static_cast<T>(std::max<int32_t>(std::numeric_limits<T>::lowest(), std::min<int32_t>(std::numeric_limits<T>::max(), in_value)));
         }
     }
 }
 
-template <bool is_gemm3d, bool is_bounded_relu, bool is_fixed_point>
+template <typename T, bool is_gemm3d, bool is_bounded_relu, bool is_fixed_point, bool is_per_channel>
 void run_offset_contribution_output_stage(const Window &window,
                                           const ITensor *mm_result, const ITensor *vector_sum_col, const ITensor *vector_sum_row, const ITensor *bias, ITensor *output,
                                           int32_t a_offset, int32_t b_offset, int32_t k_offset, bool slide_vector_sum_col,
-                                          GEMMLowpOutputStageInfo output_stage)
+                                          const GEMMLowpOutputStageInfo &output_stage)
 {
     const int height_input = is_gemm3d ? mm_result->info()->dimension(1) : 0;
     const int depth_input  = is_gemm3d ? mm_result->info()->dimension(2) : 1;
 
-    const int32x4_t  result_offset_s32 = vdupq_n_s32(output_stage.gemmlowp_offset);
-    const int32x4_t  result_shift_s32  = vdupq_n_s32(is_fixed_point ? output_stage.gemmlowp_shift : -output_stage.gemmlowp_shift);
-    const uint8x16_t min_u8            = vdupq_n_u8(static_cast<uint8_t>(output_stage.gemmlowp_min_bound));
-    const uint8x16_t max_u8            = vdupq_n_u8(static_cast<uint8_t>(output_stage.gemmlowp_max_bound));
+    using ExactTagType = typename wrapper::traits::neon_vector<T, 16>::tag_type;
+
+    const int32x4_t result_offset_s32 = vdupq_n_s32(output_stage.gemmlowp_offset);
+    const int32x4_t result_shift_s32  = vdupq_n_s32(is_fixed_point ? output_stage.gemmlowp_shift : -output_stage.gemmlowp_shift);
+    const auto      min_vec           = wrapper::vdup_n(static_cast<T>(output_stage.gemmlowp_min_bound), ExactTagType{});
+    const auto      max_vec           = wrapper::vdup_n(static_cast<T>(output_stage.gemmlowp_max_bound), ExactTagType{});
 
     const int  window_step_x  = 16;
     const auto window_start_x = static_cast<int>(window.x().start());
@@ -346,10 +392,10 @@ void run_offset_contribution_output_stage(const Window &window,
                 const auto vector_sum_col_ptr = reinterpret_cast<const int32_t *>(vector_sum_col_it.ptr() + batch_id * vector_sum_col_batch_offset);
                 const auto vector_sum_row_ptr = reinterpret_cast<const int32_t *>(vector_sum_row_it.ptr() + batch_id * sum_row_stride_y)
                                                 + id.y() + (id.z() % depth_input) * height_input;
-                run_offset_contribution_output_stage_window<true, true, true, is_bounded_relu, is_fixed_point>(vector_sum_col_ptr, vector_sum_row_ptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it,
-                                                                                                               out_it,
-                                                                                                               result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                               output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, true, true, true, is_bounded_relu, is_fixed_point, is_per_channel>(vector_sum_col_ptr, vector_sum_row_ptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it,
+                                                                                                                                  out_it,
+                                                                                                                                  result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                  output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_col_it, vector_sum_row_it, bias_it, mm_result_it, out_it);
         }
@@ -361,9 +407,9 @@ void run_offset_contribution_output_stage(const Window &window,
                 const auto vector_sum_col_ptr = reinterpret_cast<const int32_t *>(vector_sum_col_it.ptr() + batch_id * vector_sum_col_batch_offset);
                 const auto vector_sum_row_ptr = reinterpret_cast<const int32_t *>(vector_sum_row_it.ptr() + batch_id * sum_row_stride_y)
                                                 + id.y() + (id.z() % depth_input) * height_input;
-                run_offset_contribution_output_stage_window<true, true, false, is_bounded_relu, is_fixed_point>(vector_sum_col_ptr, vector_sum_row_ptr, nullptr, mm_result_it, out_it,
-                                                                                                                result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, true, true, false, is_bounded_relu, is_fixed_point, is_per_channel>(vector_sum_col_ptr, vector_sum_row_ptr, nullptr, mm_result_it, out_it,
+                                                                                                                                   result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                   output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_col_it, vector_sum_row_it, mm_result_it, out_it);
         }
@@ -384,9 +430,9 @@ void run_offset_contribution_output_stage(const Window &window,
                 const int  batch_id           = id.z() / depth_input;
                 const auto vector_sum_row_ptr = reinterpret_cast<const int32_t *>(vector_sum_row_it.ptr() + batch_id * sum_row_stride_y)
                                                 + id.y() + (id.z() % depth_input) * height_input;
-                run_offset_contribution_output_stage_window<false, true, true, is_bounded_relu, is_fixed_point>(nullptr, vector_sum_row_ptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
-                                                                                                                result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, false, true, true, is_bounded_relu, is_fixed_point, is_per_channel>(nullptr, vector_sum_row_ptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
+                                                                                                                                   result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                   output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_row_it, bias_it, mm_result_it, out_it);
         }
@@ -397,9 +443,9 @@ void run_offset_contribution_output_stage(const Window &window,
                 const int  batch_id           = id.z() / depth_input;
                 const auto vector_sum_row_ptr = reinterpret_cast<const int32_t *>(vector_sum_row_it.ptr() + batch_id * sum_row_stride_y)
                                                 + id.y() + (id.z() % depth_input) * height_input;
-                run_offset_contribution_output_stage_window<false, true, false, is_bounded_relu, is_fixed_point>(nullptr, vector_sum_row_ptr, nullptr, mm_result_it, out_it,
-                                                                                                                 result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                 output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, false, true, false, is_bounded_relu, is_fixed_point, is_per_channel>(nullptr, vector_sum_row_ptr, nullptr, mm_result_it, out_it,
+                                                                                                                                    result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                    output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_row_it, mm_result_it, out_it);
         }
@@ -420,9 +466,9 @@ void run_offset_contribution_output_stage(const Window &window,
             {
                 const int  batch_id           = id.z() / depth_input;
                 const auto vector_sum_col_ptr = reinterpret_cast<const int32_t *>(vector_sum_col_it.ptr() + batch_id * vector_sum_col_batch_offset);
-                run_offset_contribution_output_stage_window<true, false, true, is_bounded_relu, is_fixed_point>(vector_sum_col_ptr, nullptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
-                                                                                                                result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, true, false, true, is_bounded_relu, is_fixed_point, is_per_channel>(vector_sum_col_ptr, nullptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
+                                                                                                                                   result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                   output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_col_it, bias_it, mm_result_it, out_it);
         }
@@ -432,9 +478,9 @@ void run_offset_contribution_output_stage(const Window &window,
             {
                 const int  batch_id           = id.z() / depth_input;
                 const auto vector_sum_col_ptr = reinterpret_cast<const int32_t *>(vector_sum_col_it.ptr() + batch_id * vector_sum_col_batch_offset);
-                run_offset_contribution_output_stage_window<true, false, false, is_bounded_relu, is_fixed_point>(vector_sum_col_ptr, nullptr, nullptr, mm_result_it, out_it,
-                                                                                                                 result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                 output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, true, false, false, is_bounded_relu, is_fixed_point, is_per_channel>(vector_sum_col_ptr, nullptr, nullptr, mm_result_it, out_it,
+                                                                                                                                    result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                    output_stage, window_step_x, window_start_x, window_end_x);
             },
             vector_sum_col_it, mm_result_it, out_it);
         }
@@ -446,9 +492,9 @@ void run_offset_contribution_output_stage(const Window &window,
             Iterator bias_it = get_bias_it(collapsed_window, bias);
             execute_window_loop(collapsed_window, [&](const Coordinates &)
             {
-                run_offset_contribution_output_stage_window<false, false, true, is_bounded_relu, is_fixed_point>(nullptr, nullptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
-                                                                                                                 result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                 output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, false, false, true, is_bounded_relu, is_fixed_point, is_per_channel>(nullptr, nullptr, reinterpret_cast<const int32_t *>(bias_it.ptr()), mm_result_it, out_it,
+                                                                                                                                    result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                    output_stage, window_step_x, window_start_x, window_end_x);
             },
             bias_it, mm_result_it, out_it);
         }
@@ -456,9 +502,9 @@ void run_offset_contribution_output_stage(const Window &window,
         {
             execute_window_loop(collapsed_window, [&](const Coordinates &)
             {
-                run_offset_contribution_output_stage_window<false, false, false, is_bounded_relu, is_fixed_point>(nullptr, nullptr, nullptr, mm_result_it, out_it,
-                                                                                                                  result_offset_s32, result_shift_s32, min_u8, max_u8, a_offset, b_offset, k_offset,
-                                                                                                                  output_stage, window_step_x, window_start_x, window_end_x);
+                run_offset_contribution_output_stage_window<T, false, false, false, is_bounded_relu, is_fixed_point, is_per_channel>(nullptr, nullptr, nullptr, mm_result_it, out_it,
+                                                                                                                                     result_offset_s32, result_shift_s32, min_vec, max_vec, a_offset, b_offset, k_offset,
+                                                                                                                                     output_stage, window_step_x, window_start_x, window_end_x);
             },
             mm_result_it, out_it);
         }
@@ -470,10 +516,16 @@ Status validate_arguments(const ITensorInfo *mm_result, const ITensorInfo *vecto
                           int32_t a_offset, int32_t b_offset, GEMMLowpOutputStageInfo output_stage)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mm_result, 1, DataType::S32);
-    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_max_bound > 255);
-    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_min_bound < 0 || output_stage.gemmlowp_min_bound > output_stage.gemmlowp_max_bound);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_min_bound > output_stage.gemmlowp_max_bound);
     ARM_COMPUTE_RETURN_ERROR_ON(output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN && output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT);
 
+    if(output_stage.is_quantized_per_channel)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, "Per channel quantization is only supported by the fixed point output stage");
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_multipliers.size() != mm_result->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_shifts.size() != mm_result->dimension(0));
+    }
+
     if(bias != nullptr)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
@@ -525,10 +577,15 @@ Status validate_arguments(const ITensorInfo *mm_result, const ITensorInfo *vecto
 
     if(output->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(mm_result, output);
     }
 
+    // The bounds must be representable by the output data type
+    const bool is_signed = output->total_size() != 0 && output->data_type() == DataType::QASYMM8_SIGNED;
+    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_min_bound < (is_signed ? -128 : 0));
+    ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_max_bound > (is_signed ? 127 : 255));
+
     return Status{};
 }
 
@@ -551,18 +608,34 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *mm_result,
 }
 
 NEGEMMLowpOffsetContributionOutputStageKernel::NEGEMMLowpOffsetContributionOutputStageFunction
-get_configured_function(const ITensor *mm_result, const ITensor *vector_sum_row, GEMMLowpOutputStageInfo output_stage)
+get_configured_function(const ITensor *mm_result, const ITensor *vector_sum_row, const ITensor *output, GEMMLowpOutputStageInfo output_stage)
 {
     static std::map<uint8_t, NEGEMMLowpOffsetContributionOutputStageKernel::NEGEMMLowpOffsetContributionOutputStageFunction> map_function =
     {
-        { 0, &run_offset_contribution_output_stage<false, false, false> },
-        { 1, &run_offset_contribution_output_stage<true, false, false> },
-        { 2, &run_offset_contribution_output_stage<false, true, false> },
-        { 3, &run_offset_contribution_output_stage<true, true, false> },
-        { 4, &run_offset_contribution_output_stage<false, false, true> },
-        { 5, &run_offset_contribution_output_stage<true, false, true> },
-        { 6, &run_offset_contribution_output_stage<false, true, true> },
-        { 7, &run_offset_contribution_output_stage<true, true, true> }
+        { 0, &run_offset_contribution_output_stage<uint8_t, false, false, false, false> },
+        { 1, &run_offset_contribution_output_stage<uint8_t, true, false, false, false> },
+        { 2, &run_offset_contribution_output_stage<uint8_t, false, true, false, false> },
+        { 3, &run_offset_contribution_output_stage<uint8_t, true, true, false, false> },
+        { 4, &run_offset_contribution_output_stage<uint8_t, false, false, true, false> },
+        { 5, &run_offset_contribution_output_stage<uint8_t, true, false, true, false> },
+        { 6, &run_offset_contribution_output_stage<uint8_t, false, true, true, false> },
+        { 7, &run_offset_contribution_output_stage<uint8_t, true, true, true, false> },
+        { 12, &run_offset_contribution_output_stage<uint8_t, false, false, true, true> },
+        { 13, &run_offset_contribution_output_stage<uint8_t, true, false, true, true> },
+        { 14, &run_offset_contribution_output_stage<uint8_t, false, true, true, true> },
+        { 15, &run_offset_contribution_output_stage<uint8_t, true, true, true, true> },
+        { 16, &run_offset_contribution_output_stage<int8_t, false, false, false, false> },
+        { 17, &run_offset_contribution_output_stage<int8_t, true, false, false, false> },
+        { 18, &run_offset_contribution_output_stage<int8_t, false, true, false, false> },
+        { 19, &run_offset_contribution_output_stage<int8_t, true, true, false, false> },
+        { 20, &run_offset_contribution_output_stage<int8_t, false, false, true, false> },
+        { 21, &run_offset_contribution_output_stage<int8_t, true, false, true, false> },
+        { 22, &run_offset_contribution_output_stage<int8_t, false, true, true, false> },
+        { 23, &run_offset_contribution_output_stage<int8_t, true, true, true, false> },
+        { 28, &run_offset_contribution_output_stage<int8_t, false, false, true, true> },
+        { 29, &run_offset_contribution_output_stage<int8_t, true, false, true, true> },
+        { 30, &run_offset_contribution_output_stage<int8_t, false, true, true, true> },
+        { 31, &run_offset_contribution_output_stage<int8_t, true, true, true, true> }
     };
 
     // Check if input is a 3D reinterpretation
@@ -570,15 +643,22 @@ get_configured_function(const ITensor *mm_result, const ITensor *vector_sum_row,
                                    && mm_result->info()->num_dimensions() > 1
                                    && mm_result->info()->tensor_shape().y() != vector_sum_row->info()->tensor_shape().x();
 
+    const bool is_signed = output->info()->data_type() == DataType::QASYMM8_SIGNED;
+
     // Check if we need to clamp the result using min and max
+    const int  type_min        = is_signed ? -128 : 0;
+    const int  type_max        = is_signed ? 127 : 255;
     const bool is_bounded_relu = ((output_stage.gemmlowp_min_bound != output_stage.gemmlowp_max_bound)
-                                  && !(output_stage.gemmlowp_min_bound == 0 && output_stage.gemmlowp_max_bound == 255));
+                                  && !(output_stage.gemmlowp_min_bound == type_min && output_stage.gemmlowp_max_bound == type_max));
 
     const bool is_fixed_point = output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN;
 
+    // Per channel multipliers and shifts are only supported by the fixed point output stage
+    const bool is_per_channel = output_stage.is_quantized_per_channel;
+
     // key acts as a bitset, setting the first bit on reinterpret_as_3d,
-    // the second on is_bounded_relu, and the third on is_fixed_point.
-    uint8_t key = (reinterpret_as_3d ? 1UL : 0UL) | ((is_bounded_relu ? 1UL : 0UL) << 1) | ((is_fixed_point ? 1UL : 0UL) << 2);
+    // the second on is_bounded_relu, the third on is_fixed_point, the fourth on is_per_channel and the fifth on is_signed.
+    uint8_t key = (reinterpret_as_3d ? 1UL : 0UL) | ((is_bounded_relu ? 1UL : 0UL) << 1) | ((is_fixed_point ? 1UL : 0UL) << 2) | ((is_per_channel ? 1UL : 0UL) << 3) | ((is_signed ? 1UL : 0UL) << 4);
     return map_function.find(key)->second;
 }
 } // namespace
@@ -627,7 +707,7 @@ void NEGEMMLowpOffsetContributionOutputStageKernel::configure(const ITensor *mm_
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 
-    _function = get_configured_function(mm_result, vector_sum_row, output_stage);
+    _function = get_configured_function(mm_result, vector_sum_row, output, output_stage);
 }
 
 Status NEGEMMLowpOffsetContributionOutputStageKernel::validate(const ITensorInfo *mm_result, const ITensorInfo *vector_sum_col,
@@ -25,7 +25,6 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
-#include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
@@ -42,16 +41,13 @@ namespace
 {
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
 {
-    const unsigned int num_elems_processed_per_iteration = 16 / output->element_size();
+    ARM_COMPUTE_UNUSED(output);
 
     // The window needs to be based on input as we copy all the widths of input
-    Window                 win = calculate_max_window(*input, Steps(num_elems_processed_per_iteration));
-    AccessWindowHorizontal input_access(input, 0, num_elems_processed_per_iteration);
-    AccessWindowHorizontal output_access(output, 0, num_elems_processed_per_iteration);
-    bool                   window_changed = update_window_and_padding(win, input_access, output_access);
+    // The left-over elements of each row are copied in-kernel so no padding is required
+    Window win = calculate_max_window(*input, Steps());
 
-    Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
-    return std::make_pair(err, win);
+    return std::make_pair(Status{}, win);
 }
 
 Status validate_arguments(const ITensorInfo *input, unsigned int height_offset, const ITensorInfo *output)
@@ -59,7 +55,7 @@ Status validate_arguments(const ITensorInfo *input, unsigned int height_offset,
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     // Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1,
-                                                         DataType::U8, DataType::S8, DataType::QASYMM8,
+                                                         DataType::U8, DataType::S8, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
                                                          DataType::U16, DataType::S16, DataType::F16,
                                                          DataType::U32, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
@@ -111,28 +107,88 @@ void NEHeightConcatenateLayerKernel::run(const Window &window, const ThreadInfo
     // Offset output pointer to the correct position
     uint8_t *output_ptr = _output->buffer() + _output->info()->offset_first_element_in_bytes() + _height_offset * _output->info()->strides_in_bytes()[Window::DimY];
 
+    // The rows are processed in-kernel: 16 bytes per iteration and a left-over loop
+    Window win{ window };
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
     // Create iterators
-    Iterator                input(_input, window);
-    Iterator                output(_output, window);
+    Iterator                input(_input, win);
+    Iterator                output(_output, win);
     const DataType          dt           = _input->info()->data_type();
     const QuantizationInfo &input_qinfo  = _input->info()->quantization_info();
     const QuantizationInfo &output_qinfo = _output->info()->quantization_info();
+    const int               window_step  = 16;
     if(dt == DataType::QASYMM8 && input_qinfo != output_qinfo)
     {
-        execute_window_loop(window, [&](const Coordinates &)
+        const int window_start_x = window.x().start();
+        const int window_end_x   = window.x().end();
+
+        execute_window_loop(win, [&](const Coordinates &)
         {
-            vst1q_u8(output_ptr + output.offset(), vquantize(vdequantize(vld1q_u8(input.ptr()), input_qinfo), output_qinfo));
+            const auto in_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
+            const auto out_ptr = reinterpret_cast<uint8_t *>(output_ptr + output.offset());
+
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step); x += window_step)
+            {
+                vst1q_u8(out_ptr + x, vquantize(vdequantize(vld1q_u8(in_ptr + x), input_qinfo), output_qinfo));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = QAsymm8Helper<qasymm8_t>::quantize(QAsymm8Helper<qasymm8_t>::dequantize(*(in_ptr + x), input_qinfo), output_qinfo);
+            }
+        },
+        input, output);
+    }
+    else if(dt == DataType::QASYMM8_SIGNED && input_qinfo != output_qinfo)
+    {
+        const int window_start_x = window.x().start();
+        const int window_end_x   = window.x().end();
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const int8_t *>(input.ptr());
+            const auto out_ptr = reinterpret_cast<int8_t *>(output_ptr + output.offset());
+
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step); x += window_step)
+            {
+                vst1q_s8(out_ptr + x, vquantize_signed(vdequantize(vld1q_s8(in_ptr + x), input_qinfo), output_qinfo));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = QAsymm8Helper<qasymm8_signed_t>::quantize(QAsymm8Helper<qasymm8_signed_t>::dequantize(*(in_ptr + x), input_qinfo), output_qinfo);
+            }
         },
         input, output);
     }
     else
     {
-        execute_window_loop(window, [&](const Coordinates &)
+        // Copy the rows byte-wise
+        const int element_size   = static_cast<int>(_input->info()->element_size());
+        const int window_start_x = window.x().start() * element_size;
+        const int window_end_x   = window.x().end() * element_size;
+
+        execute_window_loop(win, [&](const Coordinates &)
         {
             const auto in_ptr  = input.ptr();
             const auto out_ptr = output_ptr + output.offset();
 
-            wrapper::vstore(out_ptr, wrapper::vloadq(in_ptr));
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step); x += window_step)
+            {
+                wrapper::vstore(out_ptr + x, wrapper::vloadq(in_ptr + x));
+            }
+
+            // Left-overs loop
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = *(in_ptr + x);
+            }
         },
         input, output);
     }
@@ -31,6 +31,7 @@
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/NEFixedPoint.h"
 #include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -131,7 +132,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     std::tie(pool_stride_x, pool_stride_y) = pad_stride_info.stride();
 
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(pool_type == PoolingType::L2 && is_data_type_quantized(input->data_type()));
 
     if(output->total_size() != 0)
@@ -217,6 +218,12 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
                         break;
                 }
                 break;
+            case DataType::QASYMM8_SIGNED:
+                if(is_nhwc)
+                {
+                    num_elems_processed_per_iteration = 16;
+                }
+                break;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
             case DataType::F16:
                 if(is_nhwc)
@@ -307,17 +314,29 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
         output_shape.set(2, pooled_h);
         TensorInfo output_info(input->clone()->set_tensor_shape(output_shape));
 
-        win = calculate_max_window(output_info, Steps(num_elems_processed_per_iteration));
-        AccessWindowHorizontal input_access(input, 0, num_elems_processed_per_iteration);
-
-        AccessWindowHorizontal output_access(output, 0, num_elems_processed_per_iteration);
-        window_changed = update_window_and_padding(win, input_access, output_access);
-        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+        // The NHWC kernels handle the left-over channels in-kernel so no padding is required
+        win = calculate_max_window(output_info, Steps());
+        output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
     }
 
     Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
     return std::make_pair(err, win);
 }
+
+/** Scale the 32-bit sums of an average pooling and round them to the nearest integer */
+inline uint32x4_t vscale_and_round(const uint32x4_t &v, const float32x4_t &scale)
+{
+    // Add 0.5f to round to nearest instead of rounding towards zero
+    return vcvtq_u32_f32(vmlaq_f32(vdupq_n_f32(0.5f), vcvtq_f32_u32(v), scale));
+}
+
+/** Scale the 32-bit sums of an average pooling and round them to the nearest integer, halfway cases away from zero */
+inline int32x4_t vscale_and_round(const int32x4_t &v, const float32x4_t &scale)
+{
+    const float32x4_t vres = vmulq_f32(vcvtq_f32_s32(v), scale);
+    const float32x4_t half = vbslq_f32(vcltq_f32(vres, vdupq_n_f32(0.f)), vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+    return vcvtq_s32_f32(vaddq_f32(vres, half));
+}
 } // namespace
 
 NEPoolingLayerKernel::NEPoolingLayerKernel()
@@ -383,7 +402,7 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
             }
             else
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc<qasymm8_t>;
             }
         }
         else if(pool_size.x() == 3 && pool_stride_x < 3 && _is_square)
@@ -394,21 +413,33 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
             }
             else
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc<qasymm8_t>;
             }
         }
         else
         {
             if(is_nchw)
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nchw;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nchw<qasymm8_t>;
             }
             else
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc<qasymm8_t>;
             }
         }
     }
+    else if(data_type == DataType::QASYMM8_SIGNED)
+    {
+        // Only the generic MxN path is available for QASYMM8_SIGNED
+        if(is_nchw)
+        {
+            _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nchw<qasymm8_signed_t>;
+        }
+        else
+        {
+            _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc<qasymm8_signed_t>;
+        }
+    }
     else if(data_type == DataType::F16)
     {
         if(_is_square)
@@ -1067,8 +1098,15 @@ void NEPoolingLayerKernel::poolingMxN_f16_nhwc(const Window &window_input, const
     ARM_COMPUTE_UNUSED(pooling_type);
     ARM_COMPUTE_UNUSED(exclude_padding);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+    const int window_step_x  = 8;
+
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
     Iterator input(_input, window_input);
-    Iterator output(_output, window);
+    Iterator output(_output, window_out);
 
     const int pool_size_x     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().y() : _pool_info.pool_size().width;
     const int pool_size_y     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().z() : _pool_info.pool_size().height;
@@ -1084,7 +1122,7 @@ void NEPoolingLayerKernel::poolingMxN_f16_nhwc(const Window &window_input, const
 
     float16x8_t vres;
 
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(window_out, [&](const Coordinates & id)
     {
         const int idx_width    = id.y() * pool_stride_x;
         const int idx_height   = id.z() * pool_stride_y;
@@ -1096,60 +1134,106 @@ void NEPoolingLayerKernel::poolingMxN_f16_nhwc(const Window &window_input, const
         const int pool_start_x = std::max(0, window_input.y().start() + pool_limit_x);
         const int pool_end_x   = std::min(pool_size_x, window_input.y().end() + pool_limit_x);
 
-        if(pooling_type != PoolingType::MAX)
+        // Calculate scale
+        const float scale = (pooling_type != PoolingType::MAX) ? calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left,
+                                                                                     pool_pad_top, pool_stride_x, pool_stride_y) :
+                            1.f;
+
+        int x_off = window_start_x;
+        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x)
         {
-            // Calculate scale
-            const float scale = calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x,
-                                                    pool_stride_y);
-            const float16x8_t scale_v = vdupq_n_f16(scale);
+            if(pooling_type != PoolingType::MAX)
+            {
+                const float16x8_t scale_v = vdupq_n_f16(scale);
+
+                // Perform pooling
+                vres = vdupq_n_f16(0.0f);
+
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float16x8_t data = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+
+                        // Get power of 2 in case of l2 pooling and accumulate
+                        if(pooling_type == PoolingType::L2)
+                        {
+                            vres = vaddq_f16(vres, vmulq_f16(data, data));
+                        }
+                        else
+                        {
+                            vres = vaddq_f16(vres, data);
+                        }
+                    }
+                }
+                // Divide by scale
+                vres = vmulq_f16(vres, scale_v);
+            }
+            else
+            {
+                vres = vdupq_n_f16(std::numeric_limits<float>::lowest());
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float16x8_t data = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+                        vres                   = vmaxq_f16(vres, data);
+                    }
+                }
+            }
+
+            // Calculate square-root in case of l2 pooling
+            if(pooling_type == PoolingType::L2)
+            {
+                float16x8_t sqrt_reciprocal = vrsqrteq_f16(vres);
+                vres                        = vmulq_f16(vres, vmulq_f16(vrsqrtsq_f16(vmulq_f16(vres, sqrt_reciprocal), sqrt_reciprocal), sqrt_reciprocal));
+            }
+
+            // Store result
+            vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()) + x_off, vres);
+        }
+
+        // Left-overs loop
+        for(; x_off < window_end_x; ++x_off)
+        {
+            float16_t res = (pooling_type != PoolingType::MAX) ? 0.f : std::numeric_limits<float>::lowest();
 
-            // Perform pooling
-            vres = vdupq_n_f16(0.0f);
             for(int y = pool_start_y; y < pool_end_y; ++y)
             {
                 for(int x = pool_start_x; x < pool_end_x; ++x)
                 {
-                    const float16x8_t data = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
+                    const float16_t data = *(reinterpret_cast<const float16_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                         (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
 
-                    // Get power of 2 in case of l2 pooling and accumulate
-                    if(pooling_type == PoolingType::L2)
+                    if(pooling_type == PoolingType::MAX)
                     {
-                        vres = vaddq_f16(vres, vmulq_f16(data, data));
+                        res = std::max(res, data);
                     }
                     else
                     {
-                        vres = vaddq_f16(vres, data);
+                        // Get power of 2 in case of l2 pooling and accumulate
+                        res += (pooling_type == PoolingType::L2) ? data * data : data;
                     }
                 }
             }
-            // Divide by scale
-            vres = vmulq_f16(vres, scale_v);
-        }
-        else
-        {
-            vres = vdupq_n_f16(std::numeric_limits<float>::lowest());
 
-            for(int y = pool_start_y; y < pool_end_y; ++y)
+            if(pooling_type != PoolingType::MAX)
             {
-                for(int x = pool_start_x; x < pool_end_x; ++x)
+                // Divide by scale
+                res *= static_cast<float16_t>(scale);
+
+                // Calculate square-root in case of l2 pooling
+                if(pooling_type == PoolingType::L2)
                 {
-                    const float16x8_t data = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
-                    vres                   = vmaxq_f16(vres, data);
+                    res = std::sqrt(static_cast<float>(res));
                 }
             }
-        }
 
-        // Calculate square-root in case of l2 pooling
-        if(pooling_type == PoolingType::L2)
-        {
-            float16x8_t sqrt_reciprocal = vrsqrteq_f16(vres);
-            vres                        = vmulq_f16(vres, vmulq_f16(vrsqrtsq_f16(vmulq_f16(vres, sqrt_reciprocal), sqrt_reciprocal), sqrt_reciprocal));
+            // Store result
+            *(reinterpret_cast<float16_t *>(output.ptr()) + x_off) = res;
         }
-
-        // Store result
-        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), vres);
     },
     input, output);
 
@@ -1495,8 +1579,15 @@ void NEPoolingLayerKernel::pooling7_f32_nchw(const Window &window_input, const W
 
 void NEPoolingLayerKernel::poolingMxN_f32_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
 {
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+    const int window_step_x  = 4;
+
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
     Iterator input(_input, window_input);
-    Iterator output(_output, window);
+    Iterator output(_output, window_out);
 
     const int pool_size_x     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().y() : _pool_info.pool_size().width;
     const int pool_size_y     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().z() : _pool_info.pool_size().height;
@@ -1512,7 +1603,7 @@ void NEPoolingLayerKernel::poolingMxN_f32_nhwc(const Window &window_input, const
 
     float32x4_t vres;
 
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(window_out, [&](const Coordinates & id)
     {
         const int idx_width    = id.y() * pool_stride_x;
         const int idx_height   = id.z() * pool_stride_y;
@@ -1524,68 +1615,121 @@ void NEPoolingLayerKernel::poolingMxN_f32_nhwc(const Window &window_input, const
         const int pool_start_x = std::max(0, window_input.y().start() + pool_limit_x);
         const int pool_end_x   = std::min(pool_size_x, window_input.y().end() + pool_limit_x);
 
-        if(pooling_type != PoolingType::MAX)
+        // Calculate scale
+        const float scale = (pooling_type != PoolingType::MAX) ? calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left,
+                                                                                     pool_pad_top, pool_stride_x, pool_stride_y) :
+                            1.f;
+
+        int x_off = window_start_x;
+        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x)
         {
-            // Calculate scale
-            const float scale = calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x,
-                                                    pool_stride_y);
-            const float32x4_t scale_v = vdupq_n_f32(scale);
+            if(pooling_type != PoolingType::MAX)
+            {
+                const float32x4_t scale_v = vdupq_n_f32(scale);
 
-            // Perform pooling
-            vres = vdupq_n_f32(0.0f);
+                // Perform pooling
+                vres = vdupq_n_f32(0.0f);
+
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+
+                        // Get power of 2 in case of l2 pooling and accumulate
+                        if(pooling_type == PoolingType::L2)
+                        {
+                            vres = vmlaq_f32(vres, data, data);
+                        }
+                        else
+                        {
+                            vres = vaddq_f32(vres, data);
+                        }
+                    }
+                }
+                // Divide by scale
+                vres = vmulq_f32(vres, scale_v);
+            }
+            else
+            {
+                vres = vdupq_n_f32(std::numeric_limits<float>::lowest());
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+                        vres                   = vmaxq_f32(vres, data);
+                    }
+                }
+            }
+
+            // Calculate square-root in case of l2 pooling
+            if(pooling_type == PoolingType::L2)
+            {
+                vres = vmulq_f32(vres, vinvsqrtq_f32(vres));
+            }
+
+            // Store result
+            vst1q_f32(reinterpret_cast<float *>(output.ptr()) + x_off, vres);
+        }
+
+        // Left-overs loop
+        for(; x_off < window_end_x; ++x_off)
+        {
+            float res = (pooling_type != PoolingType::MAX) ? 0.f : std::numeric_limits<float>::lowest();
 
             for(int y = pool_start_y; y < pool_end_y; ++y)
             {
                 for(int x = pool_start_x; x < pool_end_x; ++x)
                 {
-                    const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                       (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
+                    const float data = *(reinterpret_cast<const float *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                         (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
 
-                    // Get power of 2 in case of l2 pooling and accumulate
-                    if(pooling_type == PoolingType::L2)
+                    if(pooling_type == PoolingType::MAX)
                     {
-                        vres = vmlaq_f32(vres, data, data);
+                        res = std::max(res, data);
                     }
                     else
                     {
-                        vres = vaddq_f32(vres, data);
+                        // Get power of 2 in case of l2 pooling and accumulate
+                        res += (pooling_type == PoolingType::L2) ? data * data : data;
                     }
                 }
             }
-            // Divide by scale
-            vres = vmulq_f32(vres, scale_v);
-        }
-        else
-        {
-            vres = vdupq_n_f32(std::numeric_limits<float>::lowest());
-            for(int y = pool_start_y; y < pool_end_y; ++y)
+
+            if(pooling_type != PoolingType::MAX)
             {
-                for(int x = pool_start_x; x < pool_end_x; ++x)
+                // Divide by scale
+                res *= scale;
+
+                // Calculate square-root in case of l2 pooling
+                if(pooling_type == PoolingType::L2)
                 {
-                    const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                       (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
-                    vres                   = vmaxq_f32(vres, data);
+                    res = std::sqrt(res);
                 }
             }
-        }
 
-        // Calculate square-root in case of l2 pooling
-        if(pooling_type == PoolingType::L2)
-        {
-            vres = vmulq_f32(vres, vinvsqrtq_f32(vres));
+            // Store result
+            *(reinterpret_cast<float *>(output.ptr()) + x_off) = res;
         }
-
-        // Store result
-        vst1q_f32(reinterpret_cast<float *>(output.ptr()), vres);
     },
     input, output);
 }
 
+template <typename T>
 void NEPoolingLayerKernel::poolingMxN_qasymm8_nchw(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
 {
     Iterator input(_input, window_input);
     Iterator output(_output, window);
 
+    /** NEON vector types */
+    using q8x8_t  = typename wrapper::traits::neon_vector<T, 8>::type;
+    using q16_t   = typename wrapper::traits::promote_t<T>;
+    using q32_t   = typename wrapper::traits::promote_t<q16_t>;
+    using q32x4_t = typename wrapper::traits::neon_vector<q32_t, 4>::type;
+
     const int pool_size_x     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().x() : _pool_info.pool_size().width;
     const int pool_size_y     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().y() : _pool_info.pool_size().height;
     const int pool_pad_right  = _pool_info.pad_stride_info().pad_right();
@@ -1600,12 +1744,12 @@ void NEPoolingLayerKernel::poolingMxN_qasymm8_nchw(const Window &window_input, c
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        uint8_t res = 0;
+        T res = std::numeric_limits<T>::lowest();
 
         if(pooling_type != PoolingType::MAX)
         {
-            uint32x4_t vres = vdupq_n_u32(0);
-            uint32_t   sres = 0;
+            q32x4_t vres = wrapper::vdup_n(static_cast<q32_t>(0), wrapper::traits::vector_128_tag{});
+            q32_t   sres = 0;
 
             // Calculate scale
             const float scale = calculate_avg_scale(exclude_padding, DataLayout::NCHW, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x, pool_stride_y);
@@ -1616,75 +1760,87 @@ void NEPoolingLayerKernel::poolingMxN_qasymm8_nchw(const Window &window_input, c
                 int x = 0;
                 for(; x <= (pool_size_x - 8); x += 8)
                 {
-                    const uint8x8_t data = vld1_u8(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() +
-                                                                                     (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
+                    const q8x8_t data = wrapper::vload(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() +
+                                                                                   (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
 
-                    const uint16x8_t data_u16 = vmovl_u8(data);
-                    vres                      = vaddq_u32(vres, vaddl_u16(vget_high_u16(data_u16), vget_low_u16(data_u16)));
+                    const auto data_q16 = wrapper::vmovl(data);
+                    vres                = wrapper::vadd(vres, wrapper::vaddl(wrapper::vgethigh(data_q16), wrapper::vgetlow(data_q16)));
                 }
 
                 // Leftover for loop
                 for(; x < pool_size_x; ++x)
                 {
-                    uint8_t data = *(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() + (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
+                    T data = *(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() + (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
                     sres += data;
                 }
             }
 
             // Reduction
-            const auto tmp = vpadd_u32(vget_high_u32(vres), vget_low_u32(vres));
-            sres += vget_lane_u32(tmp, 0) + vget_lane_u32(tmp, 1);
+            const auto tmp = wrapper::vpadd(wrapper::vgethigh(vres), wrapper::vgetlow(vres));
+            sres += wrapper::vgetlane(tmp, 0) + wrapper::vgetlane(tmp, 1);
 
             // Divide by scale
-            res = static_cast<uint8_t>(support::cpp11::round(sres * scale));
+            res = static_cast<T>(support::cpp11::round(sres * scale));
         }
         else
         {
-            uint8x8_t vres = vdup_n_u8(0);
-            res            = 0;
+            q8x8_t vres = wrapper::vdup_n(std::numeric_limits<T>::lowest(), wrapper::traits::vector_64_tag{});
 
             for(int y = 0; y < pool_size_y; ++y)
             {
                 int x = 0;
                 for(; x <= (pool_size_x - 8); x += 8)
                 {
-                    const uint8x8_t data = vld1_u8(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() +
-                                                                                     (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
-                    vres                 = vmax_u8(vres, data);
+                    const q8x8_t data = wrapper::vload(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() +
+                                                                                   (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
+                    vres              = wrapper::vmax(vres, data);
                 }
 
                 // Leftover for loop
                 for(; x < pool_size_x; ++x)
                 {
-                    const uint8_t data = *(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() + (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
-                    res                = std::max(res, data);
+                    const T data = *(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().x() + (y - pool_pad_top) * _input->info()->strides_in_bytes().y()));
+                    res          = std::max(res, data);
                 }
             }
 
             // Reduce max
-            vres = vpmax_u8(vres, vres);
-            vres = vpmax_u8(vres, vres);
-            vres = vpmax_u8(vres, vres);
+            vres = wrapper::vpmax(vres, vres);
+            vres = wrapper::vpmax(vres, vres);
+            vres = wrapper::vpmax(vres, vres);
 
             // Get max value
-            res = std::max(res, vget_lane_u8(vres, 0));
+            res = std::max(res, wrapper::vgetlane(vres, 0));
         }
 
         // Store result
         const QuantizationInfo &input_qinfo  = _input->info()->quantization_info();
         const QuantizationInfo &output_qinfo = _output->info()->quantization_info();
-        res                                  = (input_qinfo != output_qinfo) ? sqcvt_qasymm8_f32(scvt_f32_qasymm8(res, input_qinfo.scale, input_qinfo.offset), output_qinfo.scale,
-                                                                                                 output_qinfo.offset) :
-                                               res;
-        *(reinterpret_cast<uint8_t *>(output.ptr())) = res;
+        res                                  = (input_qinfo != output_qinfo) ? QAsymm8Helper<T>::quantize(QAsymm8Helper<T>::dequantize(res, input_qinfo), output_qinfo) : res;
+        *(reinterpret_cast<T *>(output.ptr())) = res;
     },
     input, output);
 }
 
+template <typename T>
 void NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
 {
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+    const int window_step_x  = 16;
+
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
     Iterator input(_input, window_input);
-    Iterator output(_output, window);
+    Iterator output(_output, window_out);
+
+    /** NEON vector types */
+    using q8x8_t  = typename wrapper::traits::neon_vector<T, 8>::type;
+    using q8x16_t = typename wrapper::traits::neon_vector<T, 16>::type;
+    using q16_t   = typename wrapper::traits::promote_t<T>;
+    using q32_t   = typename wrapper::traits::promote_t<q16_t>;
+    using q32x4_t = typename wrapper::traits::neon_vector<q32_t, 4>::type;
 
     const int pool_size_x     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().y() : _pool_info.pool_size().width;
     const int pool_size_y     = _pool_info.is_global_pooling() ? _input->info()->tensor_shape().z() : _pool_info.pool_size().height;
@@ -1698,11 +1854,10 @@ void NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc(const Window &window_input, c
     const int upper_bound_w = _input->info()->dimension(1) + (exclude_padding ? 0 : pool_pad_right);
     const int upper_bound_h = _input->info()->dimension(2) + (exclude_padding ? 0 : pool_pad_bottom);
 
-    const float32x4_t       half_scale_v = vdupq_n_f32(0.5f);
     const QuantizationInfo &input_qinfo  = _input->info()->quantization_info();
     const QuantizationInfo &output_qinfo = _output->info()->quantization_info();
 
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(window_out, [&](const Coordinates & id)
     {
         const int idx_width    = id.y() * pool_stride_x;
         const int idx_height   = id.z() * pool_stride_y;
@@ -1714,69 +1869,114 @@ void NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc(const Window &window_input, c
         const int pool_start_x = std::max(0, window_input.y().start() + pool_limit_x);
         const int pool_end_x   = std::min(pool_size_x, window_input.y().end() + pool_limit_x);
 
-        if(pooling_type != PoolingType::MAX)
+        // Calculate scale
+        const float scale = (pooling_type != PoolingType::MAX) ? calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left,
+                                                                                     pool_pad_top, pool_stride_x, pool_stride_y) :
+                            1.f;
+
+        int x_off = window_start_x;
+        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x)
         {
-            uint32x4_t vres1 = vdupq_n_u32(0);
-            uint32x4_t vres2 = vdupq_n_u32(0);
-            uint32x4_t vres3 = vdupq_n_u32(0);
-            uint32x4_t vres4 = vdupq_n_u32(0);
+            if(pooling_type != PoolingType::MAX)
+            {
+                q32x4_t vres1 = wrapper::vdup_n(static_cast<q32_t>(0), wrapper::traits::vector_128_tag{});
+                q32x4_t vres2 = wrapper::vdup_n(static_cast<q32_t>(0), wrapper::traits::vector_128_tag{});
+                q32x4_t vres3 = wrapper::vdup_n(static_cast<q32_t>(0), wrapper::traits::vector_128_tag{});
+                q32x4_t vres4 = wrapper::vdup_n(static_cast<q32_t>(0), wrapper::traits::vector_128_tag{});
 
-            // Calculate scale
-            const float scale = calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size_x, pool_size_y, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x,
-                                                    pool_stride_y);
-            const float32x4_t scale_v = vdupq_n_f32(scale);
+                const float32x4_t scale_v = vdupq_n_f32(scale);
 
-            // Perform pooling
-            for(int y = pool_start_y; y < pool_end_y; ++y)
-            {
-                for(int x = pool_start_x; x < pool_end_x; ++x)
+                // Perform pooling
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const q8x16_t data = wrapper::vloadq(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                         (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+
+                        const auto data_q16  = wrapper::vmovl(wrapper::vgetlow(data));
+                        const auto data2_q16 = wrapper::vmovl(wrapper::vgethigh(data));
+                        vres1                = wrapper::vadd(vres1, wrapper::vmovl(wrapper::vgetlow(data_q16)));
+                        vres2                = wrapper::vadd(vres2, wrapper::vmovl(wrapper::vgethigh(data_q16)));
+                        vres3                = wrapper::vadd(vres3, wrapper::vmovl(wrapper::vgetlow(data2_q16)));
+                        vres4                = wrapper::vadd(vres4, wrapper::vmovl(wrapper::vgethigh(data2_q16)));
+                    }
+                }
+                // Divide by scale and round to nearest instead of rounding towards zero
+                vres1 = vscale_and_round(vres1, scale_v);
+                vres2 = vscale_and_round(vres2, scale_v);
+                vres3 = vscale_and_round(vres3, scale_v);
+                vres4 = vscale_and_round(vres4, scale_v);
+
+                q8x8_t res1 = wrapper::vmovn(wrapper::vcombine(wrapper::vmovn(vres1), wrapper::vmovn(vres2)));
+                q8x8_t res2 = wrapper::vmovn(wrapper::vcombine(wrapper::vmovn(vres3), wrapper::vmovn(vres4)));
+                if(input_qinfo != output_qinfo)
                 {
-                    const uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                       (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
-
-                    const uint16x8_t data_u16  = vmovl_u8(vget_low_u8(data));
-                    const uint16x8_t data2_u16 = vmovl_u8(vget_high_u8(data));
-                    vres1                      = vaddq_u32(vres1, vmovl_u16(vget_low_u16(data_u16)));
-                    vres2                      = vaddq_u32(vres2, vmovl_u16(vget_high_u16(data_u16)));
-                    vres3                      = vaddq_u32(vres3, vmovl_u16(vget_low_u16(data2_u16)));
-                    vres4                      = vaddq_u32(vres4, vmovl_u16(vget_high_u16(data2_u16)));
+                    const auto requantized_output = QAsymm8Helper<T>::vquantize(vdequantize(wrapper::vcombine(res1, res2), input_qinfo), output_qinfo);
+                    res1                          = wrapper::vgetlow(requantized_output);
+                    res2                          = wrapper::vgethigh(requantized_output);
                 }
+
+                // Store result
+                wrapper::vstore(reinterpret_cast<T *>(output.ptr()) + x_off, res1);
+                wrapper::vstore(reinterpret_cast<T *>(output.ptr()) + x_off + 8, res2);
             }
-            // Divide by scale and add 0.5f to round to nearest instead of rounding towards zero
-            vres1 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vres1), scale_v));
-            vres2 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vres2), scale_v));
-            vres3 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vres3), scale_v));
-            vres4 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vres4), scale_v));
-
-            uint8x8_t res1 = vmovn_u16(vcombine_u16(vmovn_u32(vres1), vmovn_u32(vres2)));
-            uint8x8_t res2 = vmovn_u16(vcombine_u16(vmovn_u32(vres3), vmovn_u32(vres4)));
-            if(input_qinfo != output_qinfo)
+            else
             {
-                const auto requantized_output = vquantize(vdequantize(vcombine_u8(res1, res2), input_qinfo), output_qinfo);
-                res1                          = vget_low_u8(requantized_output);
-                res2                          = vget_high_u8(requantized_output);
-            }
+                q8x16_t vres = wrapper::vdup_n(std::numeric_limits<T>::lowest(), wrapper::traits::vector_128_tag{});
 
-            // Store result
-            vst1_u8(output.ptr(), res1);
-            vst1_u8(output.ptr() + 8, res2);
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const q8x16_t data = wrapper::vloadq(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                                         (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+                        vres               = wrapper::vmax(vres, data);
+                    }
+                }
+
+                // Store result
+                wrapper::vstore(reinterpret_cast<T *>(output.ptr()) + x_off, (input_qinfo != output_qinfo) ? QAsymm8Helper<T>::vquantize(vdequantize(vres, input_qinfo), output_qinfo) : vres);
+            }
         }
-        else
+
+        // Left-overs loop
+        for(; x_off < window_end_x; ++x_off)
         {
-            uint8x16_t vres = vdupq_n_u8(0);
+            T res = std::numeric_limits<T>::lowest();
 
-            for(int y = pool_start_y; y < pool_end_y; ++y)
+            if(pooling_type != PoolingType::MAX)
             {
-                for(int x = pool_start_x; x < pool_end_x; ++x)
+                q32_t sum = 0;
+
+                // Perform pooling
+                for(int y = pool_start_y; y < pool_end_y; ++y)
                 {
-                    const uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
-                                                                                       (y - pool_pad_top) * _input->info()->strides_in_bytes().z()));
-                    vres                  = vmaxq_u8(vres, data);
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        sum += *(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                             (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off);
+                    }
+                }
+
+                // Divide by scale and round to nearest, halfway cases away from zero
+                const float avg = static_cast<float>(sum) * scale;
+                res             = static_cast<T>(avg + ((avg < 0.f) ? -0.5f : 0.5f));
+            }
+            else
+            {
+                for(int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    for(int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        res = std::max(res, *(reinterpret_cast<const T *>(input.ptr() + (x - pool_pad_left) * _input->info()->strides_in_bytes().y() +
+                                                                           (y - pool_pad_top) * _input->info()->strides_in_bytes().z()) + x_off));
+                    }
                 }
             }
 
             // Store result
-            vst1q_u8(output.ptr(), (input_qinfo != output_qinfo) ? vquantize(vdequantize(vres, input_qinfo), output_qinfo) : vres);
+            *(reinterpret_cast<T *>(output.ptr()) + x_off) = (input_qinfo != output_qinfo) ? QAsymm8Helper<T>::quantize(QAsymm8Helper<T>::dequantize(res, input_qinfo), output_qinfo) : res;
         }
     },
     input, output);
@@ -1850,6 +2050,7 @@ void NEPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
                 break;
             }
 
+            case DataType::QASYMM8_SIGNED:
             case DataType::F16:
             case DataType::F32:
             {
@@ -1866,7 +2067,7 @@ void NEPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
     }
     else
     {
-        window_input.set(Window::DimX, Window::Dimension(window.x().start(), window.x().end(), _num_elems_processed_per_iteration));
+        window_input.set(Window::DimX, Window::Dimension(0, 1, 1));
         window_input.set(Window::DimY, Window::Dimension(0, _input->info()->dimension(1), pool_stride_x));
         window_input.set(Window::DimZ, Window::Dimension(0, _input->info()->dimension(2), pool_stride_y));
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -264,6 +264,28 @@ uint8x16_t vcvt<uint8x16_t>(float32x4x4_t vec)
     return res;
 }
 
+template <>
+int8x16_t vcvt<int8x16_t>(float32x4x4_t vec)
+{
+    // The values are in [0, 256], shift the unsigned result by the -128 output offset
+    const uint8x16_t res = vcvt<uint8x16_t>(vec);
+    return vreinterpretq_s8_u8(veorq_u8(res, vdupq_n_u8(0x80)));
+}
+
+/** Computes the unsigned difference of two quantized vectors where @p a >= @p b
+ *
+ * @note For signed inputs the difference can exceed the int8 range but always fits in uint8
+ */
+inline uint8x16_t vsub_max(uint8x16_t a, uint8x16_t b)
+{
+    return vsubq_u8(a, b);
+}
+
+inline uint8x16_t vsub_max(int8x16_t a, int8x16_t b)
+{
+    return vreinterpretq_u8_s8(vsubq_s8(a, b));
+}
+
 float32x4x4_t vexp(float32x4x4_t vec)
 {
     float32x4x4_t res = { {
@@ -338,7 +360,7 @@ namespace
 Status validate_arguments_logits_1d_max(const ITensorInfo &input, const ITensorInfo &output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&input);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
 
     // Validate in case of configured output
     if(output.total_size() != 0)
@@ -449,6 +471,9 @@ void NELogits1DMaxKernel::configure(const ITensor *input, ITensor *output)
         case DataType::QASYMM8:
             _func = &logits_1d_max<qasymm8_t>;
             break;
+        case DataType::QASYMM8_SIGNED:
+            _func = &logits_1d_max<qasymm8_signed_t>;
+            break;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
             _func = &logits_1d_max<float16_t>;
@@ -501,9 +526,10 @@ Status validate_arguments_logits_softmax(const ITensorInfo &input, const ITensor
     ARM_COMPUTE_UNUSED(beta);
     // Check input
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&input);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
 
     const bool is_quantized_asymmetric = is_data_type_quantized_asymmetric(input.data_type());
+    const int  output_offset           = input.data_type() == DataType::QASYMM8_SIGNED ? -128 : 0;
 
     // Check max
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&input, &max);
@@ -513,7 +539,7 @@ Status validate_arguments_logits_softmax(const ITensorInfo &input, const ITensor
     // Check output if configured
     if(output.total_size() != 0)
     {
-        const QuantizationInfo output_quantization = is_quantized_asymmetric ? QuantizationInfo(1.f / 256.f, 0) : output.quantization_info();
+        const QuantizationInfo output_quantization = is_quantized_asymmetric ? QuantizationInfo(1.f / 256.f, output_offset) : output.quantization_info();
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&input, &output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&input, &output);
         ARM_COMPUTE_RETURN_ERROR_ON(output.quantization_info() != output_quantization);
@@ -536,9 +562,10 @@ std::pair<Status, Window> validate_and_configure_window_logits_softmax(ITensorIn
                                                                        ITensorInfo &output, ITensorInfo &tmp)
 {
     const bool is_quantized_asymmetric = is_data_type_quantized_asymmetric(input.data_type());
+    const int  output_offset           = input.data_type() == DataType::QASYMM8_SIGNED ? -128 : 0;
 
     // Output auto initialization if not yet initialized
-    const QuantizationInfo output_quantization = is_quantized_asymmetric ? QuantizationInfo(1.f / 256.f, 0) : output.quantization_info();
+    const QuantizationInfo output_quantization = is_quantized_asymmetric ? QuantizationInfo(1.f / 256.f, output_offset) : output.quantization_info();
     auto_init_if_empty(output, TensorInfo(input).set_quantization_info(output_quantization).reset_padding());
 
     // Tmp auto initialization if not yet initialized
@@ -590,8 +617,11 @@ elem_type_t<V> reduce_add(F add_fn, V vec)
     return reduce_add_impl < elem_type_t<V>, N, 0, N - 1 >::reduce(add_fn, vec);
 }
 
+template <typename T>
 void logits_1d_softmax_qasymm8(const ITensor &in, const ITensor &max, void *const tmp, ITensor &out, const float beta, const Window &window)
 {
+    const int out_offset = std::is_same<T, qasymm8_signed_t>::value ? -128 : 0;
+
     const int start_x     = in.info()->valid_region().anchor.x();
     const int input_width = in.info()->valid_region().shape.x();
 
@@ -604,8 +634,8 @@ void logits_1d_softmax_qasymm8(const ITensor &in, const ITensor &max, void *cons
     execute_window_loop(window, [&](const Coordinates &)
     {
         /* Get pointers */
-        const auto in_ptr  = reinterpret_cast<const qasymm8_t *>(in_it.ptr()) + start_x;
-        const auto out_ptr = reinterpret_cast<qasymm8_t *>(out_it.ptr()) + start_x;
+        const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr()) + start_x;
+        const auto out_ptr = reinterpret_cast<T *>(out_it.ptr()) + start_x;
         const auto tmp_ptr = reinterpret_cast<float *>(tmp);
 
         float sum_inversed;
@@ -613,8 +643,8 @@ void logits_1d_softmax_qasymm8(const ITensor &in, const ITensor &max, void *cons
         /* Compute exponentials and sum */
         {
             /* Get max value */
-            const auto max_val = *reinterpret_cast<const qasymm8_t *>(max_it.ptr());
-            const auto vec_max = vdup_n<vec_16_byte_t<qasymm8_t>>(max_val);
+            const auto max_val = *reinterpret_cast<const T *>(max_it.ptr());
+            const auto vec_max = vdup_n<vec_16_byte_t<T>>(max_val);
 
             /* Init sum to zero */
             auto vec_sum = vdup_n<float32x4x4_t>(0.f);
@@ -624,8 +654,7 @@ void logits_1d_softmax_qasymm8(const ITensor &in, const ITensor &max, void *cons
             constexpr int vec_size = vec_size_of(vec_max);
             for(; i <= (input_width - vec_size); i += vec_size)
             {
-                auto vec_elements = vld<vec_16_byte_t<qasymm8_t>>(in_ptr + i);
-                vec_elements      = vsubq_u8(vec_max, vec_elements);
+                const auto vec_elements = vsub_max(vec_max, vld<vec_16_byte_t<T>>(in_ptr + i));
 
                 auto vec_elements_flt = vcvt<float32x4x4_t>(vec_elements);
                 vec_elements_flt      = vexp(vmul_n(vec_elements_flt, scale_beta));
@@ -660,14 +689,14 @@ void logits_1d_softmax_qasymm8(const ITensor &in, const ITensor &max, void *cons
                 for(; i <= (input_width - vec_size); i += vec_size)
                 {
                     float32x4x4_t vec_in           = vld4q_f32(tmp_ptr + i);
-                    auto          normalized_value = vcvt<vec_16_byte_t<qasymm8_t>>(vmul_n(vec_in, sum_inversed));
+                    auto          normalized_value = vcvt<vec_16_byte_t<T>>(vmul_n(vec_in, sum_inversed));
                     vst(out_ptr + i, normalized_value);
                 }
             }
             /* Run remaining elements */
             for(; i < input_width; ++i)
             {
-                out_ptr[i] = utils::cast::saturate_cast<qasymm8_t>(tmp_ptr[i] * sum_inversed);
+                out_ptr[i] = static_cast<T>(utils::cast::saturate_cast<qasymm8_t>(tmp_ptr[i] * sum_inversed) + out_offset);
             }
         }
     },
@@ -771,7 +800,10 @@ void NELogits1DSoftmaxKernel::configure(const ITensor *input, const ITensor *max
     switch(input->info()->data_type())
     {
         case DataType::QASYMM8:
-            _func = &logits_1d_softmax_qasymm8;
+            _func = &logits_1d_softmax_qasymm8<qasymm8_t>;
+            break;
+        case DataType::QASYMM8_SIGNED:
+            _func = &logits_1d_softmax_qasymm8<qasymm8_signed_t>;
             break;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
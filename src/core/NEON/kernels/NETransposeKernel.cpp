@@ -76,8 +76,8 @@ unsigned int num_elems_processed(size_t element_size)
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QASYMM8, DataType::U16, DataType::S16, DataType::U32, DataType::S32,
-                                                         DataType::F16,
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::U16, DataType::S16, DataType::U32, DataType::S32,
+                                                         DataType::BFLOAT16, DataType::F16,
                                                          DataType::F32);
 
     if(output->total_size() != 0)
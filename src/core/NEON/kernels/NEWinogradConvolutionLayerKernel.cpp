@@ -24,6 +24,7 @@
 #include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerKernel.h"
 
 #include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
@@ -32,6 +33,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "support/ToolchainSupport.h"
 
 namespace arm_compute
@@ -46,11 +48,29 @@ inline bool is_kernel_size_supported(Size2D size)
     return std::end(supported_input_sizes) != std::find(std::begin(supported_input_sizes), std::end(supported_input_sizes), size);
 }
 
+/** Data type of the matrices the input and the weights are transformed into.
+ *
+ * Quantized tensors are offset by their zero point and transformed into S16 matrices.
+ */
+inline DataType transformed_data_type(DataType data_type)
+{
+    return is_data_type_quantized_asymmetric(data_type) ? DataType::S16 : data_type;
+}
+
+/** Checks specific to the quantized Winograd kernels, which only implement F(2x2, 3x3) */
+Status validate_winograd_qasymm8(const ITensorInfo *input, const WinogradInfo &winograd_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(winograd_info.kernel_size != Size2D(3U, 3U) || winograd_info.output_tile_size != Size2D(2U, 2U), "Only F(2x2, 3x3) is supported for QASYMM8");
+    return Status{};
+}
+
 Status validate_arguments_winograd_weight_trans(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
 
     const size_t idx_width    = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_height   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -68,7 +88,7 @@ Status validate_arguments_winograd_weight_trans(const ITensorInfo *input, const
         const TensorInfo tensor_info_output = input->clone()->set_tensor_shape(arm_compute::misc::shape_calculator::compute_winograd_filter_transform_shape(*input, winograd_info));
 
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(output, &tensor_info_output);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->data_type() != transformed_data_type(input->data_type()));
     }
 
     return Status{};
@@ -78,7 +98,8 @@ std::pair<Status, Window> validate_and_configure_window_winograd_weight_trans(IT
 {
     const Size2D kernel_dims = winograd_info.kernel_size;
     // Output tensor auto inizialitation if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(arm_compute::misc::shape_calculator::compute_winograd_filter_transform_shape(*input, winograd_info)));
+    const TensorShape output_shape = arm_compute::misc::shape_calculator::compute_winograd_filter_transform_shape(*input, winograd_info);
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(output_shape).set_data_type(transformed_data_type(input->data_type())));
 
     unsigned int num_elems_processed_per_iteration_x = kernel_dims.width;
     unsigned int num_elems_processed_per_iteration_y = kernel_dims.height;
@@ -104,7 +125,8 @@ Status validate_arguments_winograd_input_trans(const ITensorInfo *input, const I
     const PadStrideInfo &conv_info   = winograd_info.convolution_info;
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd input transform only supports unit strides");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
@@ -115,7 +137,7 @@ Status validate_arguments_winograd_input_trans(const ITensorInfo *input, const I
         const TensorShape output_shape = misc::shape_calculator::compute_winograd_input_transform_shape(*input, winograd_info);
 
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->data_type() != transformed_data_type(input->data_type()));
     }
 
     return Status{};
@@ -128,7 +150,7 @@ std::pair<Status, Window> validate_and_configure_window_winograd_input_trans(ITe
     const Size2D        kernel_dims      = winograd_info.kernel_size;
     const TensorShape   output_shape     = misc::shape_calculator::compute_winograd_input_transform_shape(*input, winograd_info);
     // Output auto inizialitation if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(output_shape));
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(output_shape).set_data_type(transformed_data_type(input->data_type())));
 
     unsigned int num_elems_read_per_iteration_x = (output_tile_size.width + kernel_dims.width - 1);
     unsigned int num_elems_read_per_iteration_y = (output_tile_size.height + kernel_dims.height - 1);
@@ -157,7 +179,8 @@ Status validate_arguments_winograd_output_trans(const ITensorInfo *input, const
 
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != num_tiles.area());
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
@@ -177,7 +200,15 @@ Status validate_arguments_winograd_output_trans(const ITensorInfo *input, const
     {
         const TensorInfo tensor_info_output = input->clone()->set_tensor_shape(arm_compute::misc::shape_calculator::compute_winograd_output_transform_shape(*input, winograd_info));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(output, &tensor_info_output);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        if(input->data_type() == DataType::S32)
+        {
+            // The S32 results of the quantized GEMMs are requantized to QASYMM8
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        }
     }
     return Status{};
 }
@@ -211,10 +242,10 @@ std::pair<Status, Window> validate_and_configure_window_winograd_output_trans(IT
 }
 } // namespace
 
-template <typename T>
-Status INEWinogradLayerTransformWeightsKernel<T>::validate(const ITensorInfo *input, const ITensorInfo *weights)
+Status INEWinogradLayerTransformWeightsKernel::validate(const ITensorInfo *input, const ITensorInfo *weights)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     const DataLayout   data_layout = input->data_layout();
     const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
@@ -225,8 +256,6 @@ Status INEWinogradLayerTransformWeightsKernel<T>::validate(const ITensorInfo *in
     return Status{};
 }
 
-template class INEWinogradLayerTransformWeightsKernel<float>;
-
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 unsigned int NEWinogradLayerTransformWeightsKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::get_weight_storage_size(int num_output_channels, int num_input_channels) const
 {
@@ -296,6 +325,7 @@ template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, in
 Status NEWinogradLayerTransformWeightsKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::validate(const ITensorInfo *input, const ITensorInfo *output,
                                                                                                                   const WinogradInfo &winograd_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_weight_trans(input, output, winograd_info));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_weight_trans(input->clone().get(), output->clone().get(), winograd_info).first);
     return Status{};
@@ -311,6 +341,11 @@ template class NEWinogradLayerTransformWeightsKernel<float, 1, 4, 1, 5>;
 template class NEWinogradLayerTransformWeightsKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformWeightsKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 1, 7, 1>;
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformWeightsKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformWeightsKernel<float16_t, 4, 4, 3, 3>;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 // Input transform
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -425,6 +460,7 @@ void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kern
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 Status NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_input_trans(input, output, winograd_info));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_input_trans(input->clone().get(), output->clone().get(), winograd_info).first);
 
@@ -442,6 +478,11 @@ template class NEWinogradLayerTransformInputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformInputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformInputKernel<float, 2, 1, 7, 1>;
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformInputKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformInputKernel<float16_t, 4, 4, 3, 3>;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
 // Output transform
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -548,6 +589,7 @@ template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, in
 Status NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output,
                                                                                                                  const WinogradInfo &winograd_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_output_trans(input, (bias != nullptr ? bias->clone().get() : nullptr), output, winograd_info));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_output_trans(input->clone().get(), (bias != nullptr ? bias->clone().get() : nullptr), output->clone().get(),
                                                                                     winograd_info)
@@ -567,4 +609,246 @@ template class NEWinogradLayerTransformOutputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformOutputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformOutputKernel<float, 2, 1, 7, 1>;
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformOutputKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformOutputKernel<float16_t, 4, 4, 3, 3>;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+// Quantized input transform
+
+NEWinogradLayerTransformInputKernelQASYMM8::NEWinogradLayerTransformInputKernelQASYMM8()
+    : _transform(nullptr), _input_nhwc(nullptr), _num_channels(0), _output(nullptr), _matrix_stride(0), _workspace(nullptr)
+{
+}
+
+unsigned int NEWinogradLayerTransformInputKernelQASYMM8::get_input_storage_size(int num_batches, int num_channels, int num_rows, int num_cols, bool same_padding) const
+{
+    const Tensor4DShape input_shape(num_batches, num_rows, num_cols, num_channels);
+    const KernelShape   kern_shape(1, 3, 3, num_channels);
+    const PaddingType   padding = (same_padding) ? PADDING_SAME : PADDING_VALID;
+    // Return the size, converted into units of the transformed data type
+    return static_cast<unsigned int>(WinogradConv::get_input_storage_size(kern_shape, input_shape, padding) / sizeof(WinogradConv::GemmInputType));
+}
+
+unsigned int NEWinogradLayerTransformInputKernelQASYMM8::get_working_space_size(unsigned int num_threads) const
+{
+    return _transform->get_working_space_size(num_threads) / sizeof(uint8_t);
+}
+
+int NEWinogradLayerTransformInputKernelQASYMM8::get_matrix_stride(const KernelShape &kernel_shape, const Tensor4DShape &input_shape, const PaddingType padding_type) const
+{
+    return WinogradConv::get_input_matrix_stride(kernel_shape, input_shape, padding_type);
+}
+
+void NEWinogradLayerTransformInputKernelQASYMM8::configure(const ITensor *input_nhwc, const int num_batches, const int num_rows, const int num_cols, const int num_channels,
+                                                           const PaddingType padding, ITensor *output, const int matrix_stride, ITensor *workspace)
+{
+    _input_nhwc    = input_nhwc;
+    _num_channels  = num_channels;
+    _output        = output;
+    _matrix_stride = matrix_stride;
+    _workspace     = workspace;
+
+    const QuantizationInfo       qinfo = input_nhwc->info()->quantization_info();
+    const qasymm8::QAsymm8Params input_quant{ static_cast<uint8_t>(qinfo.offset), qinfo.scale };
+    const int                    pad   = (padding == PADDING_SAME) ? 1 : 0;
+
+    _transform = arm_compute::support::cpp14::make_unique<winograd::QAsymm8InputTransform>(num_batches, num_rows, num_cols, num_channels, pad, pad, pad, pad, input_quant);
+
+    Window win;
+    auto   win_last = _transform->get_window();
+    win.set(Window::DimX, Window::Dimension(0, win_last, 1));
+    INEKernel::configure(win);
+}
+
+void NEWinogradLayerTransformInputKernelQASYMM8::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_workspace);
+
+    const int  element_size_in_bytes = _input_nhwc->info()->element_size();
+    const int  input_col_stride      = _input_nhwc->info()->strides_in_bytes().y() / element_size_in_bytes;
+    const int  input_row_stride      = _input_nhwc->info()->strides_in_bytes().z() / element_size_in_bytes;
+    const int  input_batch_stride    = _input_nhwc->info()->strides_in_bytes()[3] / element_size_in_bytes;
+    const auto input_nhwc_ptr        = reinterpret_cast<const uint8_t *>(_input_nhwc->buffer() + _input_nhwc->info()->offset_first_element_in_bytes());
+    auto       output_ptr            = reinterpret_cast<int16_t *>(_output->buffer() + _output->info()->offset_first_element_in_bytes());
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output_ptr);
+
+    _transform->set_input_tensor(input_nhwc_ptr, input_batch_stride, input_row_stride, input_col_stride);
+    _transform->set_output_matrices(output_ptr, _matrix_stride, _num_channels);
+    _transform->set_working_space(_workspace->buffer());
+
+    const size_t fst = window.x().start();
+    const size_t lst = window.x().end();
+    _transform->run(fst, lst, info.thread_id);
+}
+
+Status NEWinogradLayerTransformInputKernelQASYMM8::validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_winograd_qasymm8(input, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_input_trans(input, output, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_input_trans(input->clone().get(), output->clone().get(), winograd_info).first);
+
+    return Status{};
+}
+
+// Quantized weights transform
+
+NEWinogradLayerTransformWeightsKernelQASYMM8::NEWinogradLayerTransformWeightsKernelQASYMM8()
+    : _transform(nullptr), _weights_hwio(nullptr), _output(nullptr), _matrix_stride(0), _num_output_channels(0)
+{
+}
+
+unsigned int NEWinogradLayerTransformWeightsKernelQASYMM8::get_weight_storage_size(int num_output_channels, int num_input_channels) const
+{
+    const KernelShape shape(num_output_channels, 3, 3, num_input_channels);
+    return static_cast<unsigned int>(WinogradConv::get_kernel_storage_size(shape) / sizeof(WinogradConv::GemmInputType));
+}
+
+int NEWinogradLayerTransformWeightsKernelQASYMM8::get_matrix_stride(const KernelShape &kernel_shape) const
+{
+    return WinogradConv::get_kernel_matrix_stride(kernel_shape);
+}
+
+void NEWinogradLayerTransformWeightsKernelQASYMM8::configure(const ITensor *weights_hwio, ITensor *output, const int matrix_stride, const int num_output_channels, const int num_input_channels)
+{
+    _weights_hwio        = weights_hwio;
+    _output              = output;
+    _matrix_stride       = matrix_stride;
+    _num_output_channels = num_output_channels;
+
+    const QuantizationInfo       qinfo = weights_hwio->info()->quantization_info();
+    const qasymm8::QAsymm8Params weight_quant{ static_cast<uint8_t>(qinfo.offset), qinfo.scale };
+    _transform = arm_compute::support::cpp14::make_unique<winograd::QAsymm8WeightTransform>(num_output_channels, num_input_channels, weight_quant);
+
+    Window win;
+    auto   win_last = _transform->get_window();
+    win.set(Window::DimX, Window::Dimension(0, win_last, 1));
+    INEKernel::configure(win);
+}
+
+void NEWinogradLayerTransformWeightsKernelQASYMM8::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    const size_t fst = window.x().start();
+    const size_t lst = window.x().end();
+    _transform->set_weight_tensor(_weights_hwio->buffer());
+    const int matrix_row_stride = roundup(_num_output_channels, WinogradConv::N_BLOCK);
+    _transform->set_output_matrices(_output->buffer(), _matrix_stride, matrix_row_stride);
+
+    _transform->run(fst, lst);
+}
+
+bool NEWinogradLayerTransformWeightsKernelQASYMM8::is_parallelisable() const
+{
+    return false;
+}
+
+Status NEWinogradLayerTransformWeightsKernelQASYMM8::validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_winograd_qasymm8(input, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_weight_trans(input, output, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_weight_trans(input->clone().get(), output->clone().get(), winograd_info).first);
+    return Status{};
+}
+
+// Quantized output transform
+
+NEWinogradLayerTransformOutputKernelQASYMM8::NEWinogradLayerTransformOutputKernelQASYMM8()
+    : _transform(nullptr), _biases(nullptr), _transformed_output(nullptr), _workspace(nullptr), _matrix_stride(0), _matrix_row_stride(0), _output_nhwc(nullptr)
+{
+}
+
+unsigned int NEWinogradLayerTransformOutputKernelQASYMM8::get_output_storage_size(int num_batches, int num_rows, int num_cols, int num_output_channels, bool same_padding) const
+{
+    const Tensor4DShape input_shape(num_batches, num_rows, num_cols, 1);
+    const KernelShape   kern_shape(num_output_channels, 3, 3, 1);
+    const PaddingType   padding = (same_padding) ? PADDING_SAME : PADDING_VALID;
+
+    // Return the size, converted into units of the GEMM output data type
+    return static_cast<unsigned int>(WinogradConv::get_output_storage_size(kern_shape, input_shape, padding) / sizeof(WinogradConv::GemmOutputType));
+}
+
+int NEWinogradLayerTransformOutputKernelQASYMM8::get_matrix_stride(const KernelShape &kernel_shape, const Tensor4DShape &input_shape, const PaddingType padding_type) const
+{
+    return WinogradConv::get_output_matrix_stride(kernel_shape, input_shape, padding_type);
+}
+
+Tensor4DShape NEWinogradLayerTransformOutputKernelQASYMM8::get_output_shape(const KernelShape &kernel_shape, const Tensor4DShape &in_shape, const PaddingType padding) const
+{
+    return WinogradConv::get_output_shape(kernel_shape, in_shape, padding);
+}
+
+unsigned int NEWinogradLayerTransformOutputKernelQASYMM8::get_working_space_size(unsigned int num_threads) const
+{
+    return _transform->get_working_space_size(num_threads) / sizeof(uint8_t);
+}
+
+void NEWinogradLayerTransformOutputKernelQASYMM8::configure(const ITensor *biases, const ITensor *transformed_output, const int matrix_stride, ITensor *output_nhwc,
+                                                            const int num_batches, const int num_rows, const int num_cols, const int num_channels, ITensor *workspace)
+{
+    _biases             = biases;
+    _workspace          = workspace;
+    _transformed_output = transformed_output;
+    _matrix_stride      = matrix_stride;
+    _matrix_row_stride  = roundup(num_channels, WinogradConv::N_BLOCK);
+    _output_nhwc        = output_nhwc;
+
+    // The GEMM output is quantized with the product of the input and weights scales
+    const QuantizationInfo       output_qinfo = output_nhwc->info()->quantization_info();
+    const float                  gemm_scale   = transformed_output->info()->quantization_info().scale;
+    const qasymm8::QAsymm8Params output_quant{ static_cast<uint8_t>(output_qinfo.offset), output_qinfo.scale };
+
+    const float multiplier  = gemm_scale / output_qinfo.scale;
+    int         qmultiplier = 0;
+    int         qshift      = 0;
+    quantization::calculate_quantized_multiplier_less_than_one(multiplier, &qmultiplier, &qshift);
+    const qasymm8::QAsymm8RescaleParams rescale_params(qshift, qmultiplier, multiplier);
+
+    _transform = arm_compute::support::cpp14::make_unique<winograd::QAsymm8OutputTransform>(num_batches, num_rows, num_cols, num_channels, output_quant, rescale_params);
+    Window win;
+    auto   win_last = _transform->get_window();
+    win.set(Window::DimX, Window::Dimension(0, win_last, 1));
+    _output_nhwc->info()->set_valid_region(ValidRegion(Coordinates(), _output_nhwc->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradLayerTransformOutputKernelQASYMM8::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_workspace);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_transformed_output);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_output_nhwc);
+
+    const int out_batch_stride = _output_nhwc->info()->strides_in_bytes()[3] / sizeof(uint8_t);
+    const int out_row_stride   = _output_nhwc->info()->strides_in_bytes()[2] / sizeof(uint8_t);
+    const int out_col_stride   = _output_nhwc->info()->strides_in_bytes()[1] / sizeof(uint8_t);
+
+    _transform->set_input_matrices(_transformed_output->buffer(), _matrix_stride, _matrix_row_stride);
+    _transform->set_bias((_biases ? reinterpret_cast<int32_t *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr));
+    _transform->set_output_tensor(_output_nhwc->buffer() + _output_nhwc->info()->offset_first_element_in_bytes(), out_batch_stride, out_row_stride, out_col_stride);
+    _transform->set_working_space(_workspace->buffer());
+
+    const size_t fst = window.x().start();
+    const size_t lst = window.x().end();
+    _transform->run(fst, lst, info.thread_id);
+}
+
+Status NEWinogradLayerTransformOutputKernelQASYMM8::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const WinogradInfo &winograd_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_winograd_qasymm8(output, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_output_trans(input, (bias != nullptr ? bias->clone().get() : nullptr), output, winograd_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_winograd_output_trans(input->clone().get(), (bias != nullptr ? bias->clone().get() : nullptr), output->clone().get(),
+                                                                                    winograd_info)
+                                .first);
+
+    return Status{};
+}
+
 } // namespace arm_compute
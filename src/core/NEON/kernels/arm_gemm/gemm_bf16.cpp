@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// The BF16 kernels are only built for AArch64.
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include "gemm_common.hpp"
+#include "gemm_implementation.hpp"
+#include "gemm_interleaved.hpp"
+
+#include "kernels/a64_interleaved_bf16fp32_8x12.hpp"
+
+namespace arm_gemm {
+
+static const GemmImplementation<bfloat16, float> gemm_bf16_methods[] = {
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "interleaved_bf16fp32_8x12",
+    nullptr,
+    nullptr,
+    [](const GemmArgs<float> &args) { return new GemmInterleaved<interleaved_bf16fp32_8x12, bfloat16, float>(args); }
+},
+{
+    GemmMethod::DEFAULT,
+    "",
+    nullptr,
+    nullptr,
+    nullptr
+}
+};
+
+template<>
+const GemmImplementation<bfloat16, float> *gemm_implementation_list<bfloat16, float>() {
+    return gemm_bf16_methods;
+}
+
+/* Explicitly instantiate the external functions for these types. */
+template UniqueGemmCommon<bfloat16, float> gemm<bfloat16, float>(const GemmArgs<float> &args);
+template KernelDescription get_gemm_method<bfloat16, float>(const GemmArgs<float> &args);
+template bool method_is_compatible<bfloat16, float>(GemmMethod method, const GemmArgs<float> &args);
+template std::vector<KernelDescription> get_compatible_kernels<bfloat16, float> (const GemmArgs<float> &args);
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -146,10 +146,14 @@ public:
 
     // Execute
     void execute(unsigned int start, unsigned int end, int threadid) override {
+        execute_for_model(start, end, threadid, _ci->get_cpu_model());
+    }
+
+    void execute_for_model(unsigned int start, unsigned int end, int threadid, CPUModel model) override {
 #ifdef CYCLE_PROFILING
         profiler prof;
 #endif
-        strategy strat(_ci);
+        strategy strat = make_strategy<strategy>(_ci, model);
 
         /* Make sure we've been set up correctly. */
         assert(_B_transposed);
@@ -44,6 +44,12 @@ struct GemmImplementation {
 template<typename Top, typename Tret>
 const GemmImplementation<Top, Tret> *gemm_implementation_list();
 
+/* Can the given method read A through an indirection table or compute it from a convolution input? */
+template<typename Tret>
+bool method_supports_args(GemmMethod method, const GemmArgs<Tret> &args) {
+    return (args._indirect == nullptr && args._convolution == nullptr) || (method == GemmMethod::GEMM_INTERLEAVED);
+}
+
 /*
  * Select a GEMM implementation for the given arguments.
  *
@@ -72,6 +78,10 @@ bool find_implementation(const GemmArgs<Tret> &args, const GemmImplementation<To
             continue;
         }
 
+        if (!method_supports_args(i->method, args)) {
+            continue;
+        }
+
         /* Skip if a specific method is requested and this is a different one. */
         if (cfg && cfg->method != GemmMethod::DEFAULT && i->method != cfg->method) {
             continue;
@@ -127,6 +137,10 @@ std::vector<KernelDescription> get_compatible_kernels(const GemmArgs<Tret> &args
             continue;
         }
 
+        if (!method_supports_args(i->method, args)) {
+            continue;
+        }
+
         res.push_back(KernelDescription(i->method, i->name, i==default_impl));
     }
 
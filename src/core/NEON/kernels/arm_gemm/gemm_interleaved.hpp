@@ -25,6 +25,7 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 #include <algorithm>
 
@@ -75,6 +76,14 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
     int _nthreads;
     const bool _pretransposed;
 
+    /* Indirect A parameters (see IndirectParams), no table for a regular A matrix */
+    const int *_indirect_offsets=nullptr;
+    unsigned int _indirect_chunk=0;
+    unsigned int _indirect_batches=1;
+
+    /* Convolution A parameters (see ConvolutionParameters), nullptr for a regular A matrix */
+    const ConvolutionParameters *_convolution=nullptr;
+
     /* Blocking info */
     unsigned int _k_block=0;
     unsigned int _x_block=0;
@@ -161,14 +170,111 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
         return ROUND_UP(sizeof(Tri) * _x_block * strategy::out_height());
     }
 
+    // Is A gathered by the GEMM (indirect or convolution A) rather than read with a fixed row stride?
+    bool is_A_gathered() const {
+        return (_indirect_offsets != nullptr) || (_convolution != nullptr);
+    }
+
+    // Gather working size: One needed per thread for gathered A, holds one block of rows before it gets interleaved.
+    size_t get_a_gather_size() const {
+        return is_A_gathered() ? ROUND_UP(sizeof(To) * _k_block * strategy::out_height()) : 0;
+    }
+
+    // Gather columns [k0, kmax) of rows [y, ymax) of a batch of an indirect A matrix, with a row stride of kmax - k0.
+    void gather_A_indirect(To *out, const To *A, unsigned int batch, unsigned int y, unsigned int ymax, unsigned int k0, unsigned int kmax) {
+        const unsigned int chunks = _Ksize / _indirect_chunk;
+        const int *table = _indirect_offsets + ((batch % _indirect_batches) * _Msize * chunks);
+
+        for (unsigned int row=y; row<ymax; row++) {
+            const int *row_offsets = table + (row * chunks);
+
+            for (unsigned int k=k0; k<kmax;) {
+                const unsigned int chunk = k / _indirect_chunk;
+                const unsigned int start = k - (chunk * _indirect_chunk);
+                const unsigned int len = std::min(_indirect_chunk - start, kmax - k);
+
+                if (row_offsets[chunk] < 0) {
+                    memset(out, 0, len * sizeof(To));
+                } else {
+                    memcpy(out, A + row_offsets[chunk] + start, len * sizeof(To));
+                }
+
+                out += len;
+                k += len;
+            }
+        }
+    }
+
+    // Gather columns [k0, kmax) of rows [y, ymax) of a batch of a convolution A matrix, with a row stride of kmax - k0.
+    void gather_A_convolution(To *out, const To *A, unsigned int y, unsigned int ymax, unsigned int k0, unsigned int kmax) {
+        const ConvolutionParameters &conv = *_convolution;
+        const unsigned int kernel_area = conv.kernel_width * conv.kernel_height;
+        const unsigned int k_conv = std::min(kmax, kernel_area * conv.input_channels);
+
+        for (unsigned int row=y; row<ymax; row++) {
+            const int x_base = static_cast<int>((row % conv.output_width) * conv.stride_w) - static_cast<int>(conv.padding_left);
+            const int y_base = static_cast<int>((row / conv.output_width) * conv.stride_h) - static_cast<int>(conv.padding_top);
+
+            unsigned int kx = k0 % conv.kernel_width;
+            unsigned int ky = (k0 / conv.kernel_width) % conv.kernel_height;
+            const To *channel = A + ((k0 / kernel_area) * conv.channel_stride);
+
+            for (unsigned int k=k0; k<k_conv; k++) {
+                const int in_x = x_base + static_cast<int>(kx * conv.dilation_w);
+                const int in_y = y_base + static_cast<int>(ky * conv.dilation_h);
+
+                if (in_x < 0 || in_x >= static_cast<int>(conv.input_width) || in_y < 0 || in_y >= static_cast<int>(conv.input_height)) {
+                    *out++ = static_cast<To>(0);
+                } else {
+                    *out++ = channel[(in_y * conv.row_stride) + in_x];
+                }
+
+                if (++kx == conv.kernel_width) {
+                    kx = 0;
+                    if (++ky == conv.kernel_height) {
+                        ky = 0;
+                        channel += conv.channel_stride;
+                    }
+                }
+            }
+
+            // Bias column
+            for (unsigned int k=std::max(k0, k_conv); k<kmax; k++) {
+                *out++ = static_cast<To>(1);
+            }
+        }
+    }
+
+    // Prepare the A panel of rows [first_m, last_m) of a batch from a gathered A matrix.
+    // Each block of out_height rows is gathered in a per-thread buffer then interleaved with the strategy's transform.
+    void prepare_A_gathered(strategy &strat, Toi *a_panel, To *gather, unsigned int batch, unsigned int multi,
+                            unsigned int first_m, unsigned int last_m, unsigned int k0, unsigned int kmax) {
+        const unsigned int k_size = kmax - k0;
+        const unsigned int kern_k = iceildiv(k_size, strategy::k_unroll()) * strategy::k_unroll();
+        const unsigned int A_batch = (_indirect_offsets != nullptr) ? (batch / _indirect_batches) : batch;
+        const To *A = this->_Aptr + (A_batch * this->_A_batch_stride) + (multi * this->_A_multi_stride);
+
+        for (unsigned int y=first_m; y<last_m; y+=strategy::out_height()) {
+            const unsigned int ymax = std::min(last_m, y + strategy::out_height());
+
+            if (_indirect_offsets != nullptr) {
+                gather_A_indirect(gather, A, batch, y, ymax, k0, kmax);
+            } else {
+                gather_A_convolution(gather, A, y, ymax, k0, kmax);
+            }
+
+            strat.transforms.PrepareA(a_panel + ((y - first_m) * kern_k), gather, k_size, 0, ymax - y, 0, k_size, false);
+        }
+    }
+
     // Internal execute function.
     // This supports both the "pretransposed" and "standard" interfaces via the template parameter.
     template<bool pretransposed>
-    void execute_internal(unsigned int start, unsigned int end, int threadid) {
+    void execute_internal(unsigned int start, unsigned int end, int threadid, CPUModel model) {
 #ifdef CYCLE_PROFILING
         profiler prof;
 #endif
-        strategy strat(_ci);
+        strategy strat = make_strategy<strategy>(_ci, model);
 
         blockwalker current(*this);
         blockwalker next=current;
@@ -198,6 +304,8 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
         // Set a_panel to the base of the A buffers - compute offsets into it based on M/batches later.
         Toi * const a_panel = reinterpret_cast<Toi *>(working_space_bytes + (_maxthreads * get_c_working_size()));
         Tri * const c_panel = reinterpret_cast<Tri *>(working_space_bytes + (threadid * get_c_working_size()));
+        // Gather buffers (gathered A only) follow the A buffer, one per thread.
+        To * const a_gather = reinterpret_cast<To *>(working_space_bytes + (_maxthreads * get_c_working_size()) + get_a_working_size() + (threadid * get_a_gather_size()));
 
         // Shared buffers - these come either from BufferManager or _B_transposed.
         const Toi *b_panel;
@@ -223,6 +331,12 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
                     if (first_m >= last_m)
                         continue;
 
+                    if (is_A_gathered()) {
+                        prepare_A_gathered(strat, a_panel + ((batch * _Mround + first_m) * _k_block), a_gather, batch, current.multi(),
+                                           first_m, last_m, current.k0(), current.kmax());
+                        continue;
+                    }
+
                     strat.transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * _k_block),
                                               this->_Aptr + (batch * this->_A_batch_stride) + (current.multi() * this->_A_multi_stride),
                                               this->_lda, first_m, last_m, current.k0(), current.kmax(), _trA);
@@ -322,6 +436,19 @@ public:
               _nbatches(args._nbatches), _nmulti(args._nmulti), _trA(args._trA), _trB(args._trB),
               _alpha(args._alpha), _beta(args._beta), _maxthreads(args._maxthreads), _nthreads(args._maxthreads),
               _pretransposed(args._pretransposed_hint) {
+        if (args._indirect) {
+            assert(!_trA);
+            assert(args._indirect->chunk_size > 0 && (_Ksize % args._indirect->chunk_size) == 0);
+
+            _indirect_offsets = args._indirect->offsets;
+            _indirect_chunk = args._indirect->chunk_size;
+            _indirect_batches = args._indirect->table_batches;
+        } else if (args._convolution) {
+            assert(!_trA);
+
+            _convolution = args._convolution;
+        }
+
         const unsigned int L1_size = _ci->get_L1_cache_size();
         const unsigned int L2_size = _ci->get_L2_cache_size();
 
@@ -396,17 +523,21 @@ public:
 
     // Execute
     void execute(unsigned int start, unsigned int end, int threadid) override {
+        execute_for_model(start, end, threadid, _ci->get_cpu_model());
+    }
+
+    void execute_for_model(unsigned int start, unsigned int end, int threadid, CPUModel model) override {
         if (_pretransposed) {
-            execute_internal<true>(start, end, threadid);
+            execute_internal<true>(start, end, threadid, model);
         } else {
-            execute_internal<false>(start, end, threadid);
+            execute_internal<false>(start, end, threadid, model);
         }
     }
 
     // Interface implementation - working space
     size_t get_working_size() const override {
-        // In all cases, we need one A buffer plus a C buffer per thread.
-        size_t size = get_a_working_size() + (get_c_working_size() * _maxthreads);
+        // In all cases, we need one A buffer plus a C buffer per thread (and a gather buffer per thread for gathered A).
+        size_t size = get_a_working_size() + ((get_c_working_size() + get_a_gather_size()) * _maxthreads);
 
         // For pretransposed case, there is no working space needed for B.
         // Otherwise, we need a BufferManager.
@@ -65,6 +65,10 @@ public:
         _subgemm->execute(start, end, threadid);
     }
 
+    void execute_for_model(unsigned int start, unsigned int end, int threadid, CPUModel model) override {
+        _subgemm->execute_for_model(start, end, threadid, model);
+    }
+
     size_t get_working_size() const override {
         return _subgemm->get_working_size();
     }
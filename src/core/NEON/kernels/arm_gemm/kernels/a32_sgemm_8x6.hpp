@@ -67,8 +67,11 @@ public:
 
     kern_type kernel = a32_sgemm_8x6;
 
-    sgemm_8x6(const CPUInfo *ci) {
-        switch(ci->get_cpu_model()) {
+    sgemm_8x6(const CPUInfo *ci) : sgemm_8x6(ci, ci->get_cpu_model()) { }
+
+    // Select the kernel for a thread running on a core of the given model.
+    sgemm_8x6(const CPUInfo *, CPUModel model) {
+        switch(model) {
             case CPUModel::A53:
                 kernel = a32_sgemm_8x6_a53;
                 break;
@@ -70,8 +70,11 @@ public:
 
     kern_type kernel = a64_gemm_u8_12x8;
 
-    gemm_u8_12x8(const CPUInfo *ci) {
-        if (ci->get_cpu_model() == CPUModel::A55r1) {
+    gemm_u8_12x8(const CPUInfo *ci) : gemm_u8_12x8(ci, ci->get_cpu_model()) { }
+
+    // Select the kernel for a thread running on a core of the given model.
+    gemm_u8_12x8(const CPUInfo *, CPUModel model) {
+        if (model == CPUModel::A55r1) {
             kernel = a64_gemm_u8_12x8_a55r1;
         }
     }
@@ -65,8 +65,11 @@ public:
     // Default to the generic kernel
     kern_type kernel = a64_hgemm_asimd_24x8;
 
-    hgemm_24x8(const CPUInfo *ci) {
-        if (ci->get_cpu_model() == CPUModel::A55r1) {
+    hgemm_24x8(const CPUInfo *ci) : hgemm_24x8(ci, ci->get_cpu_model()) { }
+
+    // Select the kernel for a thread running on a core of the given model.
+    hgemm_24x8(const CPUInfo *, CPUModel model) {
+        if (model == CPUModel::A55r1) {
             kernel = a64_hgemm_asimd_24x8_a55r1;
         }
     }
@@ -64,9 +64,12 @@ public:
     // Default to the generic kernel
     kern_type kernel=a64_hybrid_s8s32_dot_16x4;
 
-    hybrid_s8s32_dot_16x4(const CPUInfo *ci)
+    hybrid_s8s32_dot_16x4(const CPUInfo *ci) : hybrid_s8s32_dot_16x4(ci, ci->get_cpu_model()) { }
+
+    // Select the kernel for a thread running on a core of the given model.
+    hybrid_s8s32_dot_16x4(const CPUInfo *, CPUModel model)
     {
-        if (ci->get_cpu_model() == CPUModel::A55r1) {
+        if (model == CPUModel::A55r1) {
             kernel = a64_hybrid_s8s32_dot_16x4_a55;
         }
     }
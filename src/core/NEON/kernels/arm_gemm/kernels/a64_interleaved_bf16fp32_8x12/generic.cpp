@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include <arm_neon.h>
+
+#include "arm_gemm.hpp"
+
+#include "../../asmlib.hpp"
+
+namespace arm_gemm {
+
+namespace {
+
+/* A bfloat16 value is the upper half of the corresponding fp32 value, so
+ * widening is a shift into the top of each 32-bit lane. */
+inline float32x4_t load_bf16x4(const bfloat16 *ptr) {
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+} // anonymous namespace
+
+void a64_interleaved_bf16fp32_8x12(const bfloat16 *Apanel, const bfloat16 *Bpanel, float *Cpanel, int ablocks, int bblocks, int K) {
+    const bfloat16 *a_ptr = Apanel;
+    float *c_ptr = Cpanel;
+
+    for (int yb=0; yb<ablocks; yb++) {
+        const bfloat16 *a_ptr0 = a_ptr;
+        const bfloat16 *b_ptr = Bpanel;
+
+        for (int xb=0; xb<bblocks; xb++) {
+            a_ptr = a_ptr0;
+
+            /* 8 rows of 12 accumulators, held as 3 vectors per row. */
+            float32x4_t acc[8][3];
+
+            for (int r=0; r<8; r++) {
+                acc[r][0] = vdupq_n_f32(0.0f);
+                acc[r][1] = vdupq_n_f32(0.0f);
+                acc[r][2] = vdupq_n_f32(0.0f);
+            }
+
+            prefetch_2x(a_ptr);
+            prefetch_2x(b_ptr);
+
+            for (int k=0; k<K; k++) {
+                const float32x4_t b0 = load_bf16x4(b_ptr);
+                const float32x4_t b1 = load_bf16x4(b_ptr + 4);
+                const float32x4_t b2 = load_bf16x4(b_ptr + 8);
+
+                for (int r=0; r<8; r++) {
+                    const float a = static_cast<float>(a_ptr[r]);
+
+                    acc[r][0] = vfmaq_n_f32(acc[r][0], b0, a);
+                    acc[r][1] = vfmaq_n_f32(acc[r][1], b1, a);
+                    acc[r][2] = vfmaq_n_f32(acc[r][2], b2, a);
+                }
+
+                a_ptr += 8;
+                b_ptr += 12;
+            }
+
+            for (int r=0; r<8; r++) {
+                vst1q_f32(c_ptr,     acc[r][0]);
+                vst1q_f32(c_ptr + 4, acc[r][1]);
+                vst1q_f32(c_ptr + 8, acc[r][2]);
+                c_ptr += 12;
+            }
+        }
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -68,9 +68,12 @@ public:
 
     kern_type kernel=a64_sgemm_asimd_12x8;
 
-    sgemm_12x8(const CPUInfo *ci) {
+    sgemm_12x8(const CPUInfo *ci) : sgemm_12x8(ci, ci->get_cpu_model()) { }
+
+    // Select the kernel for a thread running on a core of the given model.
+    sgemm_12x8(const CPUInfo *, CPUModel model) {
         // Select specific kernel if available
-        switch(ci->get_cpu_model()) {
+        switch(model) {
             case CPUModel::A53:
                 kernel = a64_sgemm_asimd_12x8_a53;
                 break;
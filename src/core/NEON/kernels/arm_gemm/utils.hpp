@@ -25,6 +25,9 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+
+#include "arm_gemm_local.hpp"
 
 // Macro for unreachable code (e.g. impossible default cases on switch)
 #define UNREACHABLE(why)  __builtin_unreachable()
@@ -84,6 +87,21 @@ inline unsigned long get_vector_length() {
 #endif
 }
 
+// Construct a strategy for a thread running on a core of the given model.
+// Strategies which select their kernel from the CPU model take the model as
+// a second argument, the others are constructed from the CPU info alone.
+template <typename strategy>
+inline typename std::enable_if<std::is_constructible<strategy, const CPUInfo *, CPUModel>::value, strategy>::type
+make_strategy(const CPUInfo *ci, CPUModel model) {
+    return strategy(ci, model);
+}
+
+template <typename strategy>
+inline typename std::enable_if<!std::is_constructible<strategy, const CPUInfo *, CPUModel>::value, strategy>::type
+make_strategy(const CPUInfo *ci, CPUModel) {
+    return strategy(ci);
+}
+
 } // utils namespace
 } // arm_gemm namespace
 
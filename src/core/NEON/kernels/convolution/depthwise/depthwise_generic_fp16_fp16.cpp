@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/convolution/common/arm.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/impl_generic.hpp"
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+namespace depthwise
+{
+
+template <>
+template <ActivationFunction Activation>
+void DepthwiseConvolutionGeneric<float16_t, float16_t, float16_t>::execute_tile(
+  const int channel_start,
+  const int n_channels,
+  const void* const packed_params,
+  const float16_t* const* const inptrs,
+  float16_t* const* const outptrs
+)
+{
+  constexpr int TileCols = Base::output_tile_cols;
+  const int n_taps = this->kernel_rows() * this->kernel_cols();
+  const int ld_weights = this->n_channels();
+
+  const float16_t* const biases = static_cast<const float16_t *>(packed_params);
+  const float16_t* const weights = biases + ld_weights;
+
+  int channel = channel_start;
+  const int stop_channel = channel_start + n_channels;
+  for (; channel <= stop_channel - 8; channel += 8)
+  {
+    // Initialise the accumulators with the bias
+    float16x8_t v[TileCols];
+    const float16x8_t vbias = vld1q_f16(biases + channel);
+    for (int t = 0; t < TileCols; t++)
+    {
+      v[t] = vbias;
+    }
+
+    // Accumulate each tap of the kernel, reusing the weights across the tile
+    for (int k = 0; k < n_taps; k++)
+    {
+      const float16x8_t w = vld1q_f16(weights + k*ld_weights + channel);
+      const float16_t* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        v[t] = vaddq_f16(v[t], vmulq_f16(w, vld1q_f16(tap_inptrs[t] + channel)));
+      }
+    }
+
+    // Apply the activation function and store
+    for (int t = 0; t < TileCols; t++)
+    {
+      if (Activation == ActivationFunction::ReLU ||
+          Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = vmaxq_f16(v[t], vdupq_n_f16(0.0f));
+      }
+      if (Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = vminq_f16(v[t], vdupq_n_f16(6.0f));
+      }
+      vst1q_f16(outptrs[t] + channel, v[t]);
+    }
+  }
+  for (; channel < stop_channel; channel++)
+  {
+    float16_t v[TileCols];
+    for (int t = 0; t < TileCols; t++)
+    {
+      v[t] = biases[channel];
+    }
+
+    for (int k = 0; k < n_taps; k++)
+    {
+      const float16_t w = weights[k*ld_weights + channel];
+      const float16_t* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        v[t] += w * tap_inptrs[t][channel];
+      }
+    }
+
+    for (int t = 0; t < TileCols; t++)
+    {
+      if (Activation == ActivationFunction::ReLU ||
+          Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = std::max<float16_t>(0.0f, v[t]);
+      }
+      if (Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = std::min<float16_t>(6.0f, v[t]);
+      }
+      outptrs[t][channel] = v[t];
+    }
+  }
+}
+
+template class DepthwiseConvolutionGenericBase<float16_t, float16_t, float16_t, DepthwiseConvolutionGeneric<float16_t, float16_t, float16_t>>;
+template class DepthwiseConvolutionGeneric<float16_t, float16_t, float16_t>;
+
+}  // namespace depthwise
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
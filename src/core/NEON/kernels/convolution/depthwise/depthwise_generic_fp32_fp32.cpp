@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/convolution/common/arm.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/impl_generic.hpp"
+
+namespace depthwise
+{
+
+template <>
+template <ActivationFunction Activation>
+void DepthwiseConvolutionGeneric<float, float, float>::execute_tile(
+  const int channel_start,
+  const int n_channels,
+  const void* const packed_params,
+  const float* const* const inptrs,
+  float* const* const outptrs
+)
+{
+  constexpr int TileCols = Base::output_tile_cols;
+  const int n_taps = this->kernel_rows() * this->kernel_cols();
+  const int ld_weights = this->n_channels();
+
+  const float* const biases = static_cast<const float *>(packed_params);
+  const float* const weights = biases + ld_weights;
+
+  int channel = channel_start;
+  const int stop_channel = channel_start + n_channels;
+  for (; channel <= stop_channel - 4; channel += 4)
+  {
+    // Initialise the accumulators with the bias
+    float32x4_t v[TileCols];
+    const float32x4_t vbias = vld1q_f32(biases + channel);
+    for (int t = 0; t < TileCols; t++)
+    {
+      v[t] = vbias;
+    }
+
+    // Accumulate each tap of the kernel, reusing the weights across the tile
+    for (int k = 0; k < n_taps; k++)
+    {
+      const float32x4_t w = vld1q_f32(weights + k*ld_weights + channel);
+      const float* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        v[t] = vmlaq_f32(v[t], w, vld1q_f32(tap_inptrs[t] + channel));
+      }
+    }
+
+    // Apply the activation function and store
+    for (int t = 0; t < TileCols; t++)
+    {
+      if (Activation == ActivationFunction::ReLU ||
+          Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = vmaxq_f32(v[t], vdupq_n_f32(0.0f));
+      }
+      if (Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = vminq_f32(v[t], vdupq_n_f32(6.0f));
+      }
+      vst1q_f32(outptrs[t] + channel, v[t]);
+    }
+  }
+  for (; channel < stop_channel; channel++)
+  {
+    float v[TileCols];
+    for (int t = 0; t < TileCols; t++)
+    {
+      v[t] = biases[channel];
+    }
+
+    for (int k = 0; k < n_taps; k++)
+    {
+      const float w = weights[k*ld_weights + channel];
+      const float* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        v[t] += w * tap_inptrs[t][channel];
+      }
+    }
+
+    for (int t = 0; t < TileCols; t++)
+    {
+      if (Activation == ActivationFunction::ReLU ||
+          Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = std::max(0.0f, v[t]);
+      }
+      if (Activation == ActivationFunction::ReLU6)
+      {
+        v[t] = std::min(6.0f, v[t]);
+      }
+      outptrs[t][channel] = v[t];
+    }
+  }
+}
+
+template class DepthwiseConvolutionGenericBase<float, float, float, DepthwiseConvolutionGeneric<float, float, float>>;
+template class DepthwiseConvolutionGeneric<float, float, float>;
+
+}  // namespace depthwise
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <limits>
+
+#include "arm_compute/core/NEON/kernels/convolution/common/arm.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/impl_generic.hpp"
+
+using namespace qasymm8;
+
+namespace
+{
+/** Requantize a vector of accumulators, each lane using its own multiplier and shift. */
+inline int32x4_t requantize(const int32x4_t acc, const int32x4_t multiplier, const int32x4_t shift)
+{
+  const int32x4_t x = vqrdmulhq_s32(acc, multiplier);
+  const int32x4_t neg_shift = vnegq_s32(shift);
+  const int32x4_t fixup = vshrq_n_s32(vandq_s32(x, neg_shift), 31);
+  const int32x4_t fixed = vqaddq_s32(x, fixup);
+  return vrshlq_s32(fixed, neg_shift);
+}
+
+/** Requantize a single accumulator. */
+inline int32_t requantize(const int32_t acc, const int32_t multiplier, const int32_t shift)
+{
+  const int32x2_t x = vqrdmulh_s32(vdup_n_s32(acc), vdup_n_s32(multiplier));
+  const int32x2_t neg_shift = vdup_n_s32(-shift);
+  const int32x2_t fixup = vshr_n_s32(vand_s32(x, neg_shift), 31);
+  const int32x2_t fixed = vqadd_s32(x, fixup);
+  return vget_lane_s32(vrshl_s32(fixed, neg_shift), 0);
+}
+}  // namespace
+
+namespace depthwise
+{
+
+QAsymm8DepthwiseConvolutionGeneric::QAsymm8DepthwiseConvolutionGeneric(
+  int n_batches, int n_input_rows, int n_input_cols, int n_channels,
+  int kernel_rows, int kernel_cols,
+  int stride_rows, int stride_cols,
+  int dilation_rows, int dilation_cols,
+  const ActivationFunction activation,
+  const QAsymm8Params& weight_quantisation,
+  const QAsymm8Params& input_quantisation,
+  const QAsymm8Params& output_quantisation,
+  const QAsymm8RescaleParams& rescale_parameters,
+  unsigned int padding_top,
+  unsigned int padding_left,
+  unsigned int padding_bottom,
+  unsigned int padding_right
+) : QAsymm8DepthwiseConvolutionGeneric(
+      n_batches, n_input_rows, n_input_cols, n_channels,
+      kernel_rows, kernel_cols, stride_rows, stride_cols, dilation_rows, dilation_cols,
+      activation, weight_quantisation, input_quantisation, output_quantisation,
+      std::vector<QAsymm8RescaleParams>(n_channels, rescale_parameters),
+      padding_top, padding_left, padding_bottom, padding_right
+    )
+{
+}
+
+QAsymm8DepthwiseConvolutionGeneric::QAsymm8DepthwiseConvolutionGeneric(
+  int n_batches, int n_input_rows, int n_input_cols, int n_channels,
+  int kernel_rows, int kernel_cols,
+  int stride_rows, int stride_cols,
+  int dilation_rows, int dilation_cols,
+  const ActivationFunction activation,
+  const QAsymm8Params& weight_quantisation,
+  const QAsymm8Params& input_quantisation,
+  const QAsymm8Params& output_quantisation,
+  const std::vector<QAsymm8RescaleParams>& rescale_parameters,
+  unsigned int padding_top,
+  unsigned int padding_left,
+  unsigned int padding_bottom,
+  unsigned int padding_right
+) : Base(
+      n_batches, n_input_rows, n_input_cols, n_channels,
+      kernel_rows, kernel_cols, stride_rows, stride_cols, dilation_rows, dilation_cols,
+      activation, padding_top, padding_left, padding_bottom, padding_right
+    ),
+    _weights_quant(weight_quantisation),
+    _inputs_quant(input_quantisation),
+    _output_quant(output_quantisation),
+    _rescale_parameters(rescale_parameters)
+{
+}
+
+uint8_t QAsymm8DepthwiseConvolutionGeneric::_input_padding_value(void) const
+{
+  return _inputs_quant.offset;
+}
+
+size_t QAsymm8DepthwiseConvolutionGeneric::_get_packed_params_per_channel_size(void) const
+{
+  // Bias, requantization multiplier and shift followed by the weights
+  return 3 * sizeof(int32_t) + this->kernel_rows() * this->kernel_cols();
+}
+
+void QAsymm8DepthwiseConvolutionGeneric::_pack_params(
+  void * const buffer,
+  const void * const weights,
+  const unsigned int weight_row_stride,
+  const unsigned int weight_col_stride,
+  const void * const biases
+) const
+{
+  const int n_channels = this->n_channels();
+  const uint8_t *wptr = static_cast<const uint8_t *>(weights);
+  const int32_t *bptr = static_cast<const int32_t *>(biases);
+  int32_t *out_bptr = static_cast<int32_t *>(buffer);
+  int32_t *out_mptr = out_bptr + n_channels;
+  int32_t *out_sptr = out_mptr + n_channels;
+  uint8_t *out_wptr = reinterpret_cast<uint8_t *>(out_sptr + n_channels);
+
+  for (int n = 0; n < n_channels; n++)
+  {
+    out_bptr[n] = (bptr != nullptr) ? bptr[n] : 0;
+    out_mptr[n] = _rescale_parameters[n].multiplier;
+    out_sptr[n] = _rescale_parameters[n].shift;
+  }
+
+  for (int i = 0; i < this->kernel_rows(); i++)
+  {
+    for (int j = 0; j < this->kernel_cols(); j++)
+    {
+      const uint8_t *const tap_wptr = wptr + i*weight_row_stride + j*weight_col_stride;
+      uint8_t *const tap_outptr = out_wptr + (i*this->kernel_cols() + j)*n_channels;
+      std::copy(tap_wptr, tap_wptr + n_channels, tap_outptr);
+    }
+  }
+}
+
+template <ActivationFunction Activation>
+void QAsymm8DepthwiseConvolutionGeneric::execute_tile(
+  const int channel_start,
+  const int n_channels,
+  const void* const packed_params,
+  const uint8_t* const* const inptrs,
+  uint8_t* const* const outptrs
+)
+{
+  constexpr int TileCols = Base::output_tile_cols;
+  const int n_taps = this->kernel_rows() * this->kernel_cols();
+  const int ld_params = this->n_channels();
+
+  const int32_t* const biases = static_cast<const int32_t *>(packed_params);
+  const int32_t* const multipliers = biases + ld_params;
+  const int32_t* const shifts = multipliers + ld_params;
+  const uint8_t* const weights = reinterpret_cast<const uint8_t *>(shifts + ld_params);
+
+  // Compute min/max clamp values
+  int32_t clamp_min = std::numeric_limits<uint8_t>::min();
+  int32_t clamp_max = std::numeric_limits<uint8_t>::max();
+  if (Activation == ActivationFunction::ReLU ||
+      Activation == ActivationFunction::ReLU6)
+  {
+    clamp_min = std::max<int32_t>(clamp_min, _output_quant.offset);
+  }
+  if (Activation == ActivationFunction::ReLU6)
+  {
+    clamp_max = std::min<int32_t>(clamp_max, _output_quant.quantize(6.0f));
+  }
+
+  const uint8_t input_offset = _inputs_quant.offset;
+  const uint8_t weight_offset = _weights_quant.offset;
+  const int32_t output_offset = _output_quant.offset;
+
+  int channel = channel_start;
+  const int stop_channel = channel_start + n_channels;
+  for (; channel <= stop_channel - 8; channel += 8)
+  {
+    // Initialise the accumulators with the bias
+    int32x4_t accs[TileCols][2];
+    const int32x4_t vbias[2] = { vld1q_s32(biases + channel), vld1q_s32(biases + channel + 4) };
+    for (int t = 0; t < TileCols; t++)
+    {
+      accs[t][0] = vbias[0];
+      accs[t][1] = vbias[1];
+    }
+
+    // Accumulate each tap of the kernel, reusing the weights across the tile
+    const uint8x8_t woffset = vdup_n_u8(weight_offset);
+    const uint8x8_t ioffset = vdup_n_u8(input_offset);
+    for (int k = 0; k < n_taps; k++)
+    {
+      const int16x8_t w = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(weights + k*ld_params + channel), woffset));
+      const uint8_t* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        const int16x8_t x = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(tap_inptrs[t] + channel), ioffset));
+        accs[t][0] = vmlal_s16(accs[t][0], vget_low_s16(w), vget_low_s16(x));
+        accs[t][1] = vmlal_s16(accs[t][1], vget_high_s16(w), vget_high_s16(x));
+      }
+    }
+
+    // Requantize, clamp and store
+    const int32x4_t vmult[2] = { vld1q_s32(multipliers + channel), vld1q_s32(multipliers + channel + 4) };
+    const int32x4_t vshift[2] = { vld1q_s32(shifts + channel), vld1q_s32(shifts + channel + 4) };
+    for (int t = 0; t < TileCols; t++)
+    {
+      int32x4_t y[2];
+      for (int i = 0; i < 2; i++)
+      {
+        y[i] = vaddq_s32(requantize(accs[t][i], vmult[i], vshift[i]), vdupq_n_s32(output_offset));
+        y[i] = vmaxq_s32(y[i], vdupq_n_s32(clamp_min));
+        y[i] = vminq_s32(y[i], vdupq_n_s32(clamp_max));
+      }
+      const int16x8_t y16 = vcombine_s16(vqmovn_s32(y[0]), vqmovn_s32(y[1]));
+      vst1_u8(outptrs[t] + channel, vqmovun_s16(y16));
+    }
+  }
+  for (; channel < stop_channel; channel++)
+  {
+    int32_t accs[TileCols];
+    for (int t = 0; t < TileCols; t++)
+    {
+      accs[t] = biases[channel];
+    }
+
+    for (int k = 0; k < n_taps; k++)
+    {
+      const int32_t w = static_cast<int32_t>(weights[k*ld_params + channel]) - weight_offset;
+      const uint8_t* const* const tap_inptrs = inptrs + k*TileCols;
+      for (int t = 0; t < TileCols; t++)
+      {
+        accs[t] += w * (static_cast<int32_t>(tap_inptrs[t][channel]) - input_offset);
+      }
+    }
+
+    for (int t = 0; t < TileCols; t++)
+    {
+      int32_t y = requantize(accs[t], multipliers[channel], shifts[channel]) + output_offset;
+      y = std::max(clamp_min, std::min(clamp_max, y));
+      outptrs[t][channel] = static_cast<uint8_t>(y);
+    }
+  }
+}
+
+template class DepthwiseConvolutionGenericBase<uint8_t, int32_t, uint8_t, QAsymm8DepthwiseConvolutionGeneric>;
+
+}  // namespace depthwise
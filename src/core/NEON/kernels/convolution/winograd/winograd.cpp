@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include <cstring>
+#include "arm.hpp"
 #include "winograd.hpp"
 using namespace winograd;
 
@@ -224,6 +225,13 @@ int WinogradGEMM<kernel_rows, kernel_cols, output_tile_rows, output_tile_cols, r
 template class WinogradGEMM<2, 2, 3, 3, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 template class WinogradGEMM<4, 4, 3, 3, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class WinogradGEMM<2, 2, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+template class WinogradGEMM<4, 4, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+#endif  // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+template class WinogradGEMM<2, 2, 3, 3, WinogradRoots::Integers>::Convolution<uint8_t, uint8_t, int16_t, int32_t>;
+
 template class WinogradGEMM<1, 6, 1, 3, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 template class WinogradGEMM<6, 1, 3, 1, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 
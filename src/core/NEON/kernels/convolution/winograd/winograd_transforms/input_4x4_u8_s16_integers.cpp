@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "arm.hpp"
+#include "utils.hpp"
+#include "winograd_quantized.hpp"
+
+namespace winograd
+{
+
+QAsymm8InputTransform::QAsymm8InputTransform(
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  const int padding_top,
+  const int padding_left,
+  const int padding_bottom,
+  const int padding_right,
+  const qasymm8::QAsymm8Params &input_quantisation
+) : _n_batches(n_batches), _n_rows(n_rows), _n_cols(n_cols), _n_channels(n_channels),
+    _padding_top(padding_top), _padding_left(padding_left), _padding_bottom(padding_bottom), _padding_right(padding_right),
+    _tiles_M(iceildiv(padding_top + n_rows + padding_bottom - kernel_rows + 1, inner_tile_rows - kernel_rows + 1)),
+    _tiles_N(iceildiv(padding_left + n_cols + padding_right - kernel_cols + 1, inner_tile_cols - kernel_cols + 1)),
+    _input_quant(input_quantisation),
+    _inptr(nullptr), _outptr(nullptr),
+    _matrix_stride(0), _matrix_row_stride(0), _matrix_batch_stride(0),
+    _in_col_stride(0), _in_row_stride(0), _in_batch_stride(0),
+    _working_space(nullptr)
+{
+}
+
+void QAsymm8InputTransform::set_input_tensor(const void* const inptr)
+{
+  set_input_tensor(inptr, _n_channels);
+}
+
+void QAsymm8InputTransform::set_input_tensor(const void* const inptr, const int ldcol)
+{
+  set_input_tensor(inptr, _n_cols * ldcol, ldcol);
+}
+
+void QAsymm8InputTransform::set_input_tensor(const void* const inptr, const int ldrow, const int ldcol)
+{
+  set_input_tensor(inptr, _n_rows * ldrow, ldrow, ldcol);
+}
+
+void QAsymm8InputTransform::set_input_tensor(const void* const inptr, const int ldbatch, const int ldrow, const int ldcol)
+{
+  _inptr = static_cast<const uint8_t *>(inptr);
+  _in_batch_stride = ldbatch;
+  _in_row_stride = ldrow;
+  _in_col_stride = ldcol;
+}
+
+void QAsymm8InputTransform::set_output_matrices(void * const mptr, const int ldmatrix, const int ldrow)
+{
+  _outptr = static_cast<int16_t *>(mptr);
+  _matrix_stride = ldmatrix;
+  _matrix_row_stride = ldrow;
+  _matrix_batch_stride = _tiles_M * _tiles_N * ldrow;
+}
+
+size_t QAsymm8InputTransform::get_working_space_size(const unsigned int nthreads) const
+{
+  // Each thread requires a row of zero points to stand in for padded pixels.
+  return sizeof(uint8_t) * _n_channels * nthreads;
+}
+
+void QAsymm8InputTransform::set_working_space(void * const buffer)
+{
+  _working_space = static_cast<uint8_t *>(buffer);
+}
+
+unsigned int QAsymm8InputTransform::get_window(void) const
+{
+  return iceildiv(_n_channels, WINDOW_BLOCK);
+}
+
+void QAsymm8InputTransform::run(
+  const unsigned int start,
+  const unsigned int stop,
+  const unsigned int threadid
+)
+{
+  // Determine the channels on which to work
+  if (start >= get_window())
+  {
+    return;  // No work to do beyond the end of the window
+  }
+  const unsigned int start_channel = start * WINDOW_BLOCK;
+  const unsigned int stop_channel = std::min<unsigned int>(_n_channels, stop * WINDOW_BLOCK);
+  const unsigned int n_channels = stop_channel - start_channel;
+
+  // Padded pixels read from a row of zero points, which the transform maps
+  // to zero exactly as zero-padding the real valued input would.
+  uint8_t* const padding = _working_space + threadid * _n_channels;
+  std::memset(padding, _input_quant.offset, n_channels);
+
+  // Loop over batches
+  for (int batch = 0; batch < _n_batches; batch++)
+  {
+    const uint8_t* const inptr_batch = _inptr + start_channel + batch*_in_batch_stride;
+    int16_t* const outptr_batch = _outptr + start_channel + batch*_matrix_batch_stride;
+
+    // Loop over rows of tiles
+    for (int tile_i = 0; tile_i < _tiles_M; tile_i++)
+    {
+      const int row_top = tile_i * (inner_tile_rows - kernel_rows + 1) - _padding_top;
+      int16_t* const outptr_row = outptr_batch + tile_i*_tiles_N*_matrix_row_stride;
+
+      // Loop over tiles within the row
+      for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
+      {
+        const int tile_left = tile_j * (inner_tile_cols - kernel_cols + 1) - _padding_left;
+
+        // Get pointers to each cell of the tile, pointing padded cells at
+        // the row of zero points.
+        const uint8_t* inptrs[inner_tile_rows][inner_tile_cols];
+        for (int i = 0; i < inner_tile_rows; i++)
+        {
+          const int row = row_top + i;
+          for (int j = 0; j < inner_tile_cols; j++)
+          {
+            const int col = tile_left + j;
+            const bool is_padding = row < 0 || _n_rows <= row || col < 0 || _n_cols <= col;
+            inptrs[i][j] = is_padding ? padding : inptr_batch + row*_in_row_stride + col*_in_col_stride;
+          }
+        }
+
+        transform_tile(
+          n_channels, inptrs, _input_quant.offset,
+          outptr_row + tile_j*_matrix_row_stride, _matrix_stride
+        );
+      }
+    }
+  }
+}
+
+void QAsymm8InputTransform::transform_tile(
+  const int n_channels,
+  const uint8_t* const inptrs[inner_tile_rows][inner_tile_cols],
+  const uint8_t zero_point,
+  int16_t* outptr,
+  const int matrix_stride
+)
+{
+  // Get pointers into the input tile
+  const uint8_t *x_ptrs[inner_tile_rows][inner_tile_cols];
+  for (int i = 0; i < inner_tile_rows; i++)
+  {
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x_ptrs[i][j] = inptrs[i][j];
+    }
+  }
+
+  // Perform the Winograd input transformation for each channel in the input
+  // tensor.
+  int channels_remaining = n_channels;
+#ifdef __arm_any__
+  const int16x8_t offset = vdupq_n_s16(zero_point);
+  for (; channels_remaining >= 8; channels_remaining -= 8)
+  {
+    // Matrices used/computed in this kernel.
+    int16x8_t x[inner_tile_rows][inner_tile_cols];
+    int16x8_t XTx[inner_tile_rows][inner_tile_cols];
+    int16x8_t U[inner_tile_rows][inner_tile_cols];
+
+    // Load x, removing the zero point
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[i][j] = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(x_ptrs[i][j]))), offset);
+        x_ptrs[i][j] += 8;
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      // XTx[0][j] = x[0][j] - x[2][j];
+      XTx[0][j] = vsubq_s16(x[0][j], x[2][j]);
+
+      // XTx[1][j] = x[1][j] + x[2][j];
+      XTx[1][j] = vaddq_s16(x[1][j], x[2][j]);
+
+      // XTx[2][j] = x[2][j] - x[1][j];
+      XTx[2][j] = vsubq_s16(x[2][j], x[1][j]);
+
+      // XTx[3][j] = x[1][j] - x[3][j];
+      XTx[3][j] = vsubq_s16(x[1][j], x[3][j]);
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      // U[i][0] = XTx[i][0] - XTx[i][2];
+      U[i][0] = vsubq_s16(XTx[i][0], XTx[i][2]);
+
+      // U[i][1] = XTx[i][1] + XTx[i][2];
+      U[i][1] = vaddq_s16(XTx[i][1], XTx[i][2]);
+
+      // U[i][2] = XTx[i][2] - XTx[i][1];
+      U[i][2] = vsubq_s16(XTx[i][2], XTx[i][1]);
+
+      // U[i][3] = XTx[i][1] - XTx[i][3];
+      U[i][3] = vsubq_s16(XTx[i][1], XTx[i][3]);
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        vst1q_s16(outptr + m*matrix_stride, U[i][j]);
+      }
+    }
+    outptr += 8;
+  }
+#endif  // __arm_any__
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Matrices used/computed in this kernel.
+    int x[inner_tile_rows][inner_tile_cols];
+    int XTx[inner_tile_rows][inner_tile_cols];
+    int U[inner_tile_rows][inner_tile_cols];
+
+    // Load x, removing the zero point
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[i][j] = static_cast<int>(*(x_ptrs[i][j]++)) - zero_point;
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      XTx[0][j] = x[0][j] - x[2][j];
+      XTx[1][j] = x[1][j] + x[2][j];
+      XTx[2][j] = x[2][j] - x[1][j];
+      XTx[3][j] = x[1][j] - x[3][j];
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      U[i][0] = XTx[i][0] - XTx[i][2];
+      U[i][1] = XTx[i][1] + XTx[i][2];
+      U[i][2] = XTx[i][2] - XTx[i][1];
+      U[i][3] = XTx[i][1] - XTx[i][3];
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = static_cast<int16_t>(U[i][j]);
+      }
+    }
+    outptr++;
+  }
+}
+
+}  // namespace winograd
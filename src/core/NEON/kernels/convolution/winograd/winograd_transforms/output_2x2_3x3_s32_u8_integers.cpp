@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <limits>
+
+#include "arm.hpp"
+#include "utils.hpp"
+#include "winograd_quantized.hpp"
+
+namespace
+{
+/** Saturating rounding doubling high multiply, matching the behaviour of VQRDMULH. */
+inline int32_t saturating_doubling_high_mul(const int32_t a, const int32_t b)
+{
+  if (a == std::numeric_limits<int32_t>::min() && b == std::numeric_limits<int32_t>::min())
+  {
+    return std::numeric_limits<int32_t>::max();
+  }
+  const int64_t ab = static_cast<int64_t>(a) * static_cast<int64_t>(b);
+  return static_cast<int32_t>((ab + (1ll << 30)) >> 31);
+}
+
+/** Divide by a power of two, rounding halves away from zero. */
+inline int32_t rounding_divide_by_exp2(const int32_t x, const int exponent)
+{
+  const int32_t mask = (1 << exponent) - 1;
+  const int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+  return (x >> exponent) + ((x & mask) > threshold ? 1 : 0);
+}
+
+#ifdef __arm_any__
+inline int32x4_t rounding_divide_by_exp2(const int32x4_t x, const int exponent)
+{
+  const int32x4_t shift = vdupq_n_s32(-exponent);
+  const int32x4_t fixup = vshrq_n_s32(vandq_s32(x, shift), 31);
+  const int32x4_t fixed = vqaddq_s32(x, fixup);
+  return vrshlq_s32(fixed, shift);
+}
+
+/** Compute the 2x2 output tile for four channels, adding the bias and
+ * requantizing the result.
+ *
+ * The additions wrap on overflow, since the final (scaled) result is known to
+ * fit in 32 bits the wrapped intermediate values still produce the exact
+ * result.
+ */
+inline void transform_tile_x4(
+  const int32_t* const inptr,
+  const int matrix_stride,
+  const int32x4_t b,
+  const int32_t multiplier,
+  const int shift,
+  const int32x4_t offset,
+  int32x4_t f[2][2]
+)
+{
+  int32x4_t F[4][4], FZ[4][2];
+
+  // Read a 4x4 tile in the Winograd domain
+  for (int i = 0, m = 0; i < 4; i++)
+  {
+    for (int j = 0; j < 4; j++, m++)
+    {
+      F[i][j] = vld1q_s32(inptr + m*matrix_stride);
+    }
+  }
+
+  // Compute the matrix F Z
+  for (int i = 0; i < 4; i++)
+  {
+    // FZ[i][0] =  F[i][0] + F[i][1] + F[i][2];
+    FZ[i][0] = vaddq_s32(vaddq_s32(F[i][0], F[i][1]), F[i][2]);
+
+    // FZ[i][1] =  F[i][1] - F[i][2] - F[i][3];
+    FZ[i][1] = vsubq_s32(vsubq_s32(F[i][1], F[i][2]), F[i][3]);
+  }
+
+  // Compute the output tile f = ZT F Z, removing the factor of four
+  // introduced by the weight transform, and requantize it.
+  for (int j = 0; j < 2; j++)
+  {
+    // f[0][j] =  FZ[0][j] + FZ[1][j] + FZ[2][j];
+    f[0][j] = vaddq_s32(vaddq_s32(FZ[0][j], FZ[1][j]), FZ[2][j]);
+
+    // f[1][j] =  FZ[1][j] - FZ[2][j] - FZ[3][j];
+    f[1][j] = vsubq_s32(vsubq_s32(FZ[1][j], FZ[2][j]), FZ[3][j]);
+  }
+
+  for (int i = 0; i < 2; i++)
+  {
+    for (int j = 0; j < 2; j++)
+    {
+      const int32x4_t acc = vaddq_s32(vshrq_n_s32(f[i][j], 2), b);
+      f[i][j] = vaddq_s32(rounding_divide_by_exp2(vqrdmulhq_n_s32(acc, multiplier), shift), offset);
+    }
+  }
+}
+#endif  // __arm_any__
+}  // namespace
+
+namespace winograd
+{
+
+QAsymm8OutputTransform::QAsymm8OutputTransform(
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  const qasymm8::QAsymm8Params &output_quantisation,
+  const qasymm8::QAsymm8RescaleParams &rescale_parameters
+) : _n_batches(n_batches), _n_rows(n_rows), _n_cols(n_cols), _n_channels(n_channels),
+    _tiles_M(iceildiv(n_rows, output_tile_rows)),
+    _tiles_N(iceildiv(n_cols, output_tile_cols)),
+    _output_quant(output_quantisation),
+    _rescale(rescale_parameters),
+    _matrix_base(nullptr),
+    _biases(nullptr),
+    _matrix_stride(0), _matrix_row_stride(0), _matrix_batch_stride(0),
+    _outptr(nullptr),
+    _out_col_stride(0), _out_row_stride(0), _out_batch_stride(0),
+    _working_space(nullptr)
+{
+}
+
+void QAsymm8OutputTransform::set_input_matrices(const void * const mptr, const int ldmatrix, const int ldrow)
+{
+  _matrix_base = static_cast<const int32_t *>(mptr);
+  _matrix_stride = ldmatrix;
+  _matrix_row_stride = ldrow;
+  _matrix_batch_stride = _tiles_M * _tiles_N * ldrow;
+}
+
+void QAsymm8OutputTransform::set_bias(const void * const bias)
+{
+  _biases = static_cast<const int32_t *>(bias);
+}
+
+void QAsymm8OutputTransform::set_output_tensor(void * const outptr)
+{
+  set_output_tensor(outptr, _n_channels);
+}
+
+void QAsymm8OutputTransform::set_output_tensor(void * const outptr, const int ldcol)
+{
+  set_output_tensor(outptr, _n_cols * ldcol, ldcol);
+}
+
+void QAsymm8OutputTransform::set_output_tensor(void * const outptr, const int ldrow, const int ldcol)
+{
+  set_output_tensor(outptr, _n_rows * ldrow, ldrow, ldcol);
+}
+
+void QAsymm8OutputTransform::set_output_tensor(void * const outptr, const int ldbatch, const int ldrow, const int ldcol)
+{
+  _outptr = static_cast<uint8_t *>(outptr);
+  _out_batch_stride = ldbatch;
+  _out_row_stride = ldrow;
+  _out_col_stride = ldcol;
+}
+
+size_t QAsymm8OutputTransform::get_working_space_size(const unsigned int nthreads) const
+{
+  // Each thread requires a row into which to write cropped pixels.
+  return sizeof(uint8_t) * _n_channels * nthreads;
+}
+
+void QAsymm8OutputTransform::set_working_space(void * const buffer)
+{
+  _working_space = static_cast<uint8_t *>(buffer);
+}
+
+unsigned int QAsymm8OutputTransform::get_window(void) const
+{
+  return iceildiv(_n_channels, WINDOW_BLOCK);
+}
+
+void QAsymm8OutputTransform::run(
+  const unsigned int start,
+  const unsigned int stop,
+  const unsigned int threadid
+)
+{
+  // Determine the channels on which to work
+  if (start >= get_window())
+  {
+    return;  // No work to do beyond the end of the window
+  }
+  const unsigned int start_channel = start * WINDOW_BLOCK;
+  const unsigned int stop_channel = std::min<unsigned int>(_n_channels, stop * WINDOW_BLOCK);
+  const unsigned int n_channels = stop_channel - start_channel;
+
+  const int32_t* const bptr = (_biases == nullptr) ? nullptr : _biases + start_channel;
+  uint8_t* const discard = _working_space + threadid * _n_channels;
+
+  // Loop over batches
+  for (int batch = 0; batch < _n_batches; batch++)
+  {
+    const int32_t* const matrix_batch = _matrix_base + start_channel + batch * _matrix_batch_stride;
+    uint8_t* const outptr_batch = _outptr + start_channel + batch * _out_batch_stride;
+
+    for (int tile_i = 0; tile_i < _tiles_M; tile_i++)
+    {
+      for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
+      {
+        const int32_t* const matrix_tile = matrix_batch + (tile_i * _tiles_N + tile_j) * _matrix_row_stride;
+
+        // Get pointers to each cell of the output tile, writing cropped
+        // cells into the working space.
+        uint8_t* outptrs[output_tile_rows][output_tile_cols];
+        for (int i = 0; i < output_tile_rows; i++)
+        {
+          const int row = tile_i * output_tile_rows + i;
+          for (int j = 0; j < output_tile_cols; j++)
+          {
+            const int col = tile_j * output_tile_cols + j;
+            outptrs[i][j] = (_n_rows <= row || _n_cols <= col) ? discard : outptr_batch + row*_out_row_stride + col*_out_col_stride;
+          }
+        }
+
+        transform_tile(n_channels, matrix_tile, bptr, outptrs);
+      }
+    }
+  }
+}
+
+void QAsymm8OutputTransform::transform_tile(
+  const int n_channels,
+  const int32_t* inptr,
+  const int32_t* bptr,
+  uint8_t* const outptrs_in[output_tile_rows][output_tile_cols]
+) const
+{
+  const int32_t multiplier = _rescale.multiplier;
+  const int shift = _rescale.shift;
+  const int32_t output_offset = _output_quant.offset;
+
+  uint8_t *outptrs[output_tile_rows][output_tile_cols];
+  for (int i = 0; i < output_tile_rows; i++)
+  {
+    for (int j = 0; j < output_tile_cols; j++)
+    {
+      outptrs[i][j] = outptrs_in[i][j];
+    }
+  }
+
+  // For each channel of the output
+  int channels_remaining = n_channels;
+#ifdef __arm_any__
+  const int32x4_t offset = vdupq_n_s32(output_offset);
+  for (; channels_remaining >= 8; channels_remaining -= 8)
+  {
+    // Load the bias vectors
+    int32x4_t b[2];
+    if (bptr != nullptr)
+    {
+      b[0] = vld1q_s32(bptr);
+      b[1] = vld1q_s32(bptr + 4);
+      bptr += 8;
+    }
+    else
+    {
+      b[0] = b[1] = vdupq_n_s32(0);
+    }
+
+    // Compute the requantized output tile for the two halves of the channels
+    int32x4_t f_lo[2][2], f_hi[2][2];
+    transform_tile_x4(inptr, _matrix_stride, b[0], multiplier, shift, offset, f_lo);
+    transform_tile_x4(inptr + 4, _matrix_stride, b[1], multiplier, shift, offset, f_hi);
+    inptr += 8;
+
+    // Write out the output tile, narrowing with saturation to [0, 255]
+    for (int i = 0; i < output_tile_rows; i++)
+    {
+      for (int j = 0; j < output_tile_cols; j++)
+      {
+        const uint16x8_t f16 = vcombine_u16(vqmovun_s32(f_lo[i][j]), vqmovun_s32(f_hi[i][j]));
+        vst1_u8(outptrs[i][j], vqmovn_u16(f16));
+        outptrs[i][j] += 8;
+      }
+    }
+  }
+#endif  // __arm_any__
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Matrices used and computed during this transform
+    int64_t F[4][4], FZ[4][2], f[2][2];
+
+    // Read a 4x4 tile in the Winograd domain
+    for (int i = 0, m = 0; i < 4; i++)
+    {
+      for (int j = 0; j < 4; j++, m++)
+      {
+        F[i][j] = *(inptr + m*_matrix_stride);
+      }
+    }
+    inptr++;
+
+    // Compute the matrix F Z
+    for (int i = 0; i < 4; i++)
+    {
+      FZ[i][0] =  F[i][0] + F[i][1] + F[i][2];
+      FZ[i][1] =  F[i][1] - F[i][2] - F[i][3];
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (int j = 0; j < 2; j++)
+    {
+      f[0][j] =  FZ[0][j] + FZ[1][j] + FZ[2][j];
+      f[1][j] =  FZ[1][j] - FZ[2][j] - FZ[3][j];
+    }
+
+    // Load the bias
+    const int32_t b = (bptr != nullptr) ? *(bptr++) : 0;
+
+    // Remove the factor of four introduced by the weight transform, then
+    // add the bias, requantize and write out the output tile.
+    for (int i = 0; i < output_tile_rows; i++)
+    {
+      for (int j = 0; j < output_tile_cols; j++)
+      {
+        const int32_t acc = static_cast<int32_t>(f[i][j] / 4) + b;
+        const int32_t y = rounding_divide_by_exp2(saturating_doubling_high_mul(acc, multiplier), shift) + output_offset;
+        *(outptrs[i][j]++) = static_cast<uint8_t>(std::max(0, std::min(255, y)));
+      }
+    }
+  }
+}
+
+}  // namespace winograd
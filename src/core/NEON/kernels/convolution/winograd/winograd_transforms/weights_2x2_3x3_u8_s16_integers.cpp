@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm.hpp"
+#include "winograd_quantized.hpp"
+
+namespace winograd
+{
+
+QAsymm8WeightTransform::QAsymm8WeightTransform(
+  const int n_output_channels,
+  const int n_input_channels,
+  const qasymm8::QAsymm8Params &weight_quantisation
+) : _n_output_channels(n_output_channels), _n_input_channels(n_input_channels),
+    _weight_quant(weight_quantisation),
+    _matrices(nullptr), _matrix_stride(0), _matrix_row_stride(0), _weights(nullptr)
+{
+}
+
+void QAsymm8WeightTransform::set_weight_tensor(const void * const weights)
+{
+  _weights = static_cast<const uint8_t *>(weights);
+}
+
+void QAsymm8WeightTransform::set_output_matrices(void * const mptr, const int ldmatrix, const int ldrow)
+{
+  _matrices = static_cast<int16_t *>(mptr);
+  _matrix_stride = ldmatrix;
+  _matrix_row_stride = ldrow;
+}
+
+size_t QAsymm8WeightTransform::get_working_space_size(unsigned int) const
+{
+  return 0;
+}
+
+void QAsymm8WeightTransform::set_working_space(void *)
+{
+}
+
+unsigned int QAsymm8WeightTransform::get_window(void) const
+{
+  // The weights are transformed as a single block, as for the other weight
+  // transforms.
+  return 1;
+}
+
+void QAsymm8WeightTransform::run(const unsigned int, const unsigned int, unsigned int)
+{
+  // Get pointers to each cell of the weight tensor (HWIO order)
+  const auto weight_col_stride = _n_input_channels * _n_output_channels;
+  const auto weight_row_stride = kernel_cols * weight_col_stride;
+  const uint8_t *inptrs[kernel_rows][kernel_cols];
+  for (int i = 0; i < kernel_rows; i++)
+  {
+    for (int j = 0; j < kernel_cols; j++)
+    {
+      inptrs[i][j] = _weights + i*weight_row_stride + j*weight_col_stride;
+    }
+  }
+
+  const int zero_point = _weight_quant.offset;
+
+  // For each input channel
+  for (int ic = 0; ic < _n_input_channels; ic++)
+  {
+    int16_t *outptr = _matrices + ic * _matrix_row_stride;
+
+    // For each output channel
+    for (int oc = 0; oc < _n_output_channels; oc++)
+    {
+      // Matrices used and computed in this kernel
+      int w[3][3], Ww[inner_tile_rows][3], V[inner_tile_rows][inner_tile_cols];
+
+      // Read weights, removing the zero point
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          w[i][j] = static_cast<int>(*(inptrs[i][j]++)) - zero_point;
+        }
+      }
+
+      // Compute the matrix (2W) w
+      for (int j = 0; j < 3; j++)
+      {
+        Ww[0][j] = 2*w[0][j];
+        Ww[1][j] = w[0][j] + w[1][j] + w[2][j];
+        Ww[2][j] = w[0][j] - w[1][j] + w[2][j];
+        Ww[3][j] = 2*w[2][j];
+      }
+
+      // Compute V = (2W) w (2W)T, four times the real valued transform
+      for (int i = 0; i < inner_tile_rows; i++)
+      {
+        V[i][0] = 2*Ww[i][0];
+        V[i][1] = Ww[i][0] + Ww[i][1] + Ww[i][2];
+        V[i][2] = Ww[i][0] - Ww[i][1] + Ww[i][2];
+        V[i][3] = 2*Ww[i][2];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < inner_tile_rows; i++)
+      {
+        for (int j = 0; j < inner_tile_cols; j++, m++)
+        {
+          *(outptr + m*_matrix_stride) = static_cast<int16_t>(V[i][j]);
+        }
+      }
+      outptr++;
+    }
+  }
+}
+
+}  // namespace winograd
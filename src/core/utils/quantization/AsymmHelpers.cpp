@@ -91,3 +91,28 @@ arm_compute::Status arm_compute::quantization::calculate_quantized_multiplier_gr
 
     return arm_compute::Status{};
 }
+
+arm_compute::Status arm_compute::quantization::calculate_quantized_multipliers_less_than_one(float                     input_scale,
+                                                                                             const std::vector<float> &weights_scales,
+                                                                                             float                     output_scale,
+                                                                                             std::vector<int32_t>     *quant_multipliers,
+                                                                                             std::vector<int32_t>     *right_shifts)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(quant_multipliers == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(right_shifts == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_scale == 0.f);
+
+    quant_multipliers->resize(weights_scales.size());
+    right_shifts->resize(weights_scales.size());
+
+    for(size_t i = 0; i < weights_scales.size(); ++i)
+    {
+        int quant_multiplier = 0;
+        int right_shift      = 0;
+        ARM_COMPUTE_RETURN_ON_ERROR(calculate_quantized_multiplier_less_than_one(input_scale * weights_scales[i] / output_scale, &quant_multiplier, &right_shift));
+        (*quant_multipliers)[i] = quant_multiplier;
+        (*right_shifts)[i]      = right_shift;
+    }
+
+    return arm_compute::Status{};
+}
@@ -26,6 +26,9 @@
 #include "arm_compute/graph.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -76,7 +79,8 @@ std::map<Target, MemoryManagerContext> &GraphContext::memory_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Concurrently executed tasks and streams need a pool each
+    const size_t num_pools = std::max(1u, std::max(_config.max_concurrent_tasks, _config.num_streams));
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -90,6 +94,14 @@ void GraphContext::finalize()
         if(mm_obj.second.cross_mm != nullptr)
         {
             mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, num_pools);
+
+            // Report the memory saved by planning the transition buffers
+            auto *interval_mgr = dynamic_cast<IntervalLifetimeManager *>(mm_obj.second.cross_mm->lifetime_manager());
+            if(interval_mgr != nullptr)
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Transition buffers of " << mm_obj.first << " : planned " << interval_mgr->planned_size()
+                                           << " bytes, naive " << interval_mgr->naive_size() << " bytes" << std::endl);
+            }
         }
     }
 }
@@ -25,19 +25,98 @@
 
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphProfiler.h"
+#include "arm_compute/graph/GraphSerializer.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/detail/ConcurrentTaskRunner.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/MultiStreamRunner.h"
 
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Binds external buffers to tensors and restores the memory of the tensors when going out of scope */
+class ExternalBufferBinding final
+{
+public:
+    /** Default constructor */
+    ExternalBufferBinding() = default;
+    /** Prevent instances of this class from being copied */
+    ExternalBufferBinding(const ExternalBufferBinding &) = delete;
+    /** Prevent instances of this class from being copied */
+    ExternalBufferBinding &operator=(const ExternalBufferBinding &) = delete;
+    /** Destructor: restores the memory of the bound tensors */
+    ~ExternalBufferBinding()
+    {
+        for(auto *handle : _handles)
+        {
+            handle->restore_memory();
+        }
+    }
+    /** Imports an external buffer as the backing memory of a tensor
+     *
+     * @param[in] tensor Tensor to bind the buffer to
+     * @param[in] memory Buffer to import
+     */
+    void bind(Tensor *tensor, void *memory)
+    {
+        ARM_COMPUTE_THROW_ON_ERROR(tensor->handle()->import_memory(memory));
+        _handles.push_back(tensor->handle());
+    }
+
+private:
+    std::vector<ITensorHandle *> _handles{};
+};
+
+/** Checks if an external buffer can be imported as the backing memory of a tensor
+ *
+ * @param[in] tensor Tensor to bind the buffer to
+ * @param[in] buffer External buffer
+ *
+ * @return A status
+ */
+Status validate_external_buffer(Tensor *tensor, const ExternalBuffer &buffer)
+{
+    // The accessor of the tensor is used when no buffer is given
+    if(buffer.ptr == nullptr)
+    {
+        return Status{};
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(tensor == nullptr || tensor->handle() == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tensor->handle()->is_subtensor(), "Can't bind an external buffer to a sub-tensor");
+
+    const ITensorInfo *info = tensor->handle()->tensor().info();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!arm_compute::utility::check_aligned(buffer.ptr, info->element_size()), "The buffer is not aligned to the element size");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(buffer.size < info->total_size(), "The buffer is smaller than the tensor");
+
+    if(buffer.strides.num_dimensions() == 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info->padding().empty(), "The tensor is padded, the buffer has to follow its strides");
+    }
+    else
+    {
+        for(unsigned int i = 0; i < info->num_dimensions(); ++i)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(buffer.strides[i] != info->strides_in_bytes()[i], "The strides of the buffer don't match the strides of the tensor");
+        }
+    }
+
+    return Status{};
+}
+} // namespace
+
 GraphManager::GraphManager()
     : _workloads()
 {
@@ -81,17 +160,59 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Check that the padding-free functions left the tensors unpadded
+    if(ctx.config().use_padding_free_kernels)
+    {
+        const unsigned int num_padded = detail::report_padded_tensors(graph);
+        if(num_padded != 0)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Padding-free kernels requested but " << num_padded << " tensors still require padding: their borders are filled at run time" << std::endl);
+        }
+    }
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
 
+    // Serialize the graph before the functions transform the constant tensors
+    if(!ctx.config().serialized_graph_file.empty())
+    {
+        const Status status = serialize_graph(graph, ctx.config().serialized_graph_file);
+        if(!bool(status))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Failed to serialize the graph: " << status.error_description() << std::endl);
+        }
+    }
+
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
+    // Execute several inferences or independent branches concurrently if requested
+    const bool use_streams = ctx.config().num_streams > 1;
+    if(use_streams)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(forced_target != Target::NEON, "Streams are only supported on NEON");
+        ARM_COMPUTE_EXIT_ON_MSG(!ctx.config().use_transition_memory_manager, "Streams need the transition memory manager");
+        ARM_COMPUTE_EXIT_ON_MSG(ctx.config().max_concurrent_tasks > 1, "Streams can't be combined with concurrent tasks");
+    }
+    const bool run_concurrently = (ctx.config().max_concurrent_tasks > 1) && (forced_target == Target::NEON);
+    if(run_concurrently)
+    {
+        detail::configure_task_dependencies(graph, workload, topological_sorted_nodes);
+        workload.runner = std::make_shared<detail::ConcurrentTaskRunner>(ctx.config().max_concurrent_tasks, Scheduler::get().num_threads());
+        if(ctx.config().use_transition_memory_manager)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("The transition memory manager is disabled when running tasks concurrently: "
+                                          "all the intermediate tensors are allocated statically, which increases the peak memory usage"
+                                          << std::endl);
+        }
+    }
+
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // The transition manager assumes a serial execution order so it can't be used when tasks overlap
+    if(ctx.config().use_transition_memory_manager && !run_concurrently)
     {
-        detail::configure_transition_manager(graph, ctx, workload);
+        detail::configure_transition_manager(graph, ctx, workload, use_streams);
     }
     else
     {
@@ -101,6 +222,12 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Finalize Graph context
     ctx.finalize();
 
+    // Streams bind the transition buffers to their own pool
+    if(use_streams)
+    {
+        workload.streams = std::make_shared<detail::MultiStreamRunner>(workload, ctx.config().num_streams, Scheduler::get().num_threads());
+    }
+
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
@@ -112,6 +239,13 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Streams call the accessors themselves
+    if(it->second.streams != nullptr)
+    {
+        it->second.streams->run(it->second);
+        return;
+    }
+
     while(true)
     {
         // Call input accessors
@@ -131,6 +265,72 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+void GraphManager::execute_graph(Graph &graph, const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs)
+{
+    ARM_COMPUTE_THROW_ON_ERROR(validate_external_buffers(graph, inputs, outputs));
+
+    ExecutionWorkload &workload = _workloads.find(graph.id())->second;
+
+    // The tensors get back their own memory once the execution is over
+    ExternalBufferBinding binding;
+
+    // Bind the input buffers or call the input accessors
+    for(unsigned int i = 0; i < workload.inputs.size(); ++i)
+    {
+        if(i < inputs.size() && inputs[i].ptr != nullptr)
+        {
+            binding.bind(workload.inputs[i], inputs[i].ptr);
+        }
+        else
+        {
+            workload.inputs[i]->call_accessor();
+        }
+    }
+
+    // Bind the output buffers
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        if(outputs[i].ptr != nullptr)
+        {
+            binding.bind(workload.outputs[i], outputs[i].ptr);
+        }
+    }
+
+    // Run graph
+    detail::call_all_tasks(workload);
+
+    // Call the accessors of the outputs without a buffer
+    for(unsigned int i = 0; i < workload.outputs.size(); ++i)
+    {
+        if(i >= outputs.size() || outputs[i].ptr == nullptr)
+        {
+            workload.outputs[i]->call_accessor();
+        }
+    }
+}
+
+Status GraphManager::validate_external_buffers(Graph &graph, const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    const ExecutionWorkload &workload = it->second;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(workload.streams != nullptr, "External buffers can't be bound when executing several streams");
+    ARM_COMPUTE_RETURN_ERROR_ON(inputs.size() > workload.inputs.size());
+    ARM_COMPUTE_RETURN_ERROR_ON(outputs.size() > workload.outputs.size());
+
+    for(unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_external_buffer(workload.inputs[i], inputs[i]));
+    }
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_external_buffer(workload.outputs[i], outputs[i]));
+    }
+
+    return Status{};
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
@@ -138,5 +338,22 @@ void GraphManager::invalidate_graph(Graph &graph)
 
     _workloads.erase(it);
 }
+
+void GraphManager::set_profiler(Graph &graph, std::shared_ptr<GraphProfiler> profiler)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    ExecutionWorkload &workload = it->second;
+    if(profiler != nullptr)
+    {
+        profiler->configure(workload);
+    }
+    for(auto &task : workload.tasks)
+    {
+        task.profiler = profiler.get();
+    }
+    workload.profiler = std::move(profiler);
+}
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphProfiler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/graph/nodes/FusedPointwiseNode.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Returns the number of elements of a tensor
+ *
+ * @param[in] tensor Tensor to get the number of elements of (Can be nullptr)
+ *
+ * @return The number of elements, 0 if @p tensor is nullptr
+ */
+uint64_t num_elements(const Tensor *tensor)
+{
+    return tensor != nullptr ? tensor->desc().shape.total_size() : 0;
+}
+
+/** Estimates the number of bytes read and written by a node
+ *
+ * Each input (including the constant ones) is assumed to be read once and each output to be written once.
+ *
+ * @param[in] node Node to estimate the bytes of
+ *
+ * @return The estimated number of bytes
+ */
+uint64_t estimate_bytes(const INode &node)
+{
+    uint64_t bytes = 0;
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *tensor = node.input(i);
+        bytes += (tensor != nullptr) ? num_elements(tensor) * data_size_from_type(tensor->desc().data_type) : 0;
+    }
+    for(size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *tensor = node.output(i);
+        bytes += (tensor != nullptr) ? num_elements(tensor) * data_size_from_type(tensor->desc().data_type) : 0;
+    }
+    return bytes;
+}
+
+/** Estimates the number of operations of a node from its tensor descriptors
+ *
+ * Every output element of a channel of a convolution or fully connected layer is computed with all the weights of the channel.
+ * The layers without arithmetic (concatenation, permute, reshape, ...) are estimated to 0 operations.
+ *
+ * @param[in] node Node to estimate the operations of
+ *
+ * @return The estimated number of operations, a multiply-accumulate counts as two
+ */
+uint64_t estimate_flops(const INode &node)
+{
+    const Tensor *output = (node.num_outputs() > 0) ? node.output(0) : nullptr;
+    if(output == nullptr)
+    {
+        return 0;
+    }
+
+    const uint64_t output_elements = num_elements(output);
+    const auto     macs_per_channel = [&](uint64_t num_weights, uint64_t num_channels, uint64_t num_elements_computed)
+    {
+        return (num_channels != 0) ? 2 * (num_elements_computed / num_channels) * num_weights : 0;
+    };
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+            return macs_per_channel(num_elements(node.input(1)), get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL), output_elements);
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            // Depthwise and pointwise weights
+            return macs_per_channel(num_elements(node.input(1)) + num_elements(node.input(3)), get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL), output_elements);
+        case NodeType::FullyConnectedLayer:
+            return macs_per_channel(num_elements(node.input(1)), output->desc().shape.x(), output_elements);
+        case NodeType::DeconvolutionLayer:
+        {
+            // Every input element is multiplied by all the weights of its channel
+            const Tensor *input = node.input(0);
+            return (input != nullptr) ? macs_per_channel(num_elements(node.input(1)), get_dimension_size(input->desc(), DataLayoutDimension::CHANNEL), num_elements(input)) : 0;
+        }
+        case NodeType::BatchNormalizationLayer:
+            return 2 * output_elements;
+        case NodeType::FusedPointwiseLayer:
+        {
+            // Scales and shifts count as two operations
+            uint64_t flops = 0;
+            for(const auto &op : arm_compute::utils::cast::polymorphic_downcast<const FusedPointwiseNode *>(&node)->operations())
+            {
+                const bool is_scale_shift = (op.type == PointwiseOperation::Type::SCALE_SHIFT) || (op.type == PointwiseOperation::Type::BATCH_NORMALIZATION);
+                flops += (is_scale_shift ? 2 : 1) * output_elements;
+            }
+            return flops;
+        }
+        case NodeType::PoolingLayer:
+            return num_elements(node.input(0));
+        case NodeType::ActivationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::NormalizationLayer:
+        case NodeType::NormalizePlanarYUVLayer:
+        case NodeType::SoftmaxLayer:
+            return output_elements;
+        default:
+            return 0;
+    }
+}
+
+/** Escapes a string to be used as a JSON string
+ *
+ * @param[in] str String to escape
+ *
+ * @return The escaped string
+ */
+std::string escape_json(const std::string &str)
+{
+    std::string escaped;
+    for(const char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += (static_cast<unsigned char>(c) < 0x20) ? ' ' : c;
+    }
+    return escaped;
+}
+
+/** Returns the name of a task: the name of its node or the type of the node if it is not named
+ *
+ * @param[in] profile Profile of the task
+ *
+ * @return The name of the task
+ */
+std::string task_name(const TaskProfile &profile)
+{
+    if(!profile.name.empty())
+    {
+        return profile.name;
+    }
+    std::stringstream ss;
+    ss << profile.type << "_" << profile.node_id;
+    return ss.str();
+}
+
+double to_us(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+} // namespace
+
+/** Scheduler recording the kernels scheduled by a task
+ *
+ * One instance is created per thread executing tasks and reused for all the tasks the thread executes: between @ref begin and @ref end
+ * it overrides the scheduler of the thread and forwards the kernels, the settings and the CPU information to the scheduler it replaces.
+ */
+class GraphProfiler::TaskScheduler final : public IScheduler
+{
+public:
+    /** Constructor
+     *
+     * @param[in] profiler Profiler to record the kernels into
+     */
+    TaskScheduler(GraphProfiler &profiler)
+        : _profiler(profiler), _task(0), _real_scheduler(&Scheduler::get()), _thread_scheduler(nullptr)
+    {
+    }
+    /** Overrides the scheduler of the calling thread until @ref end is called
+     *
+     * @param[in] task Index of the task scheduling the kernels
+     */
+    void begin(size_t task)
+    {
+        _task             = task;
+        _real_scheduler   = &Scheduler::get();
+        _thread_scheduler = Scheduler::get_thread_scheduler();
+        Scheduler::set_thread_scheduler(this);
+    }
+    /** Restores the scheduler of the calling thread */
+    void end()
+    {
+        Scheduler::set_thread_scheduler(_thread_scheduler);
+    }
+
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _real_scheduler->set_num_threads(num_threads);
+    }
+
+    unsigned int num_threads() const override
+    {
+        return _real_scheduler->num_threads();
+    }
+
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        const auto start = clock::now();
+        _real_scheduler->schedule(kernel, hints);
+        _profiler.record_kernel(_task, kernel->name(), start, clock::now() - start);
+    }
+
+    void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag) override
+    {
+        const auto start = clock::now();
+        _real_scheduler->run_tagged_workloads(workloads, tag);
+        _profiler.record_kernel(_task, tag != nullptr ? tag : "Unknown", start, clock::now() - start);
+    }
+
+    void set_wait_policy(WaitPolicy policy, unsigned int spin_count) override
+    {
+        IScheduler::set_wait_policy(policy, spin_count);
+        _real_scheduler->set_wait_policy(policy, spin_count);
+    }
+
+    void set_affinity(const std::vector<unsigned int> &cpu_ids) override
+    {
+        IScheduler::set_affinity(cpu_ids);
+        _real_scheduler->set_affinity(cpu_ids);
+    }
+
+    CPUInfo &cpu_info() override
+    {
+        return _real_scheduler->cpu_info();
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ARM_COMPUTE_UNUSED(workloads);
+        ARM_COMPUTE_ERROR("Can't be reached");
+    }
+
+private:
+    GraphProfiler &_profiler;
+    size_t         _task;
+    IScheduler    *_real_scheduler;
+    IScheduler    *_thread_scheduler;
+};
+
+GraphProfiler::GraphProfiler(bool record_trace)
+    : _first_task(nullptr), _tasks(), _events(), _events_mtx(), _schedulers(), _schedulers_mtx(), _origin(clock::now()), _record_trace(record_trace)
+{
+}
+
+GraphProfiler::~GraphProfiler() = default;
+
+void GraphProfiler::configure(const ExecutionWorkload &workload)
+{
+    _first_task = workload.tasks.data();
+    _tasks.clear();
+    _tasks.reserve(workload.tasks.size());
+    for(const auto &task : workload.tasks)
+    {
+        TaskProfile profile;
+        if(task.node != nullptr)
+        {
+            profile.node_id = task.node->id();
+            profile.name    = task.node->name();
+            profile.type    = task.node->type();
+            profile.target  = task.node->assigned_target();
+            profile.flops   = estimate_flops(*task.node);
+            profile.bytes   = estimate_bytes(*task.node);
+        }
+        _tasks.push_back(std::move(profile));
+    }
+    reset();
+
+#ifndef NO_MULTI_THREADING
+    // Create the scheduler of the configuring thread, which usually also executes the workload, before the first execution
+    thread_scheduler();
+#endif /* NO_MULTI_THREADING */
+}
+
+void GraphProfiler::run_task(ExecutionTask &task)
+{
+    const size_t index = static_cast<size_t>(&task - _first_task);
+    ARM_COMPUTE_ERROR_ON_MSG(index >= _tasks.size(), "The task doesn't belong to the profiled workload");
+
+#ifndef NO_MULTI_THREADING
+    TaskScheduler &scheduler = thread_scheduler();
+    scheduler.begin(index);
+#endif /* NO_MULTI_THREADING */
+
+    const auto start = clock::now();
+    TaskExecutor::get().execute_function(task);
+    const auto duration = clock::now() - start;
+
+#ifndef NO_MULTI_THREADING
+    scheduler.end();
+#endif /* NO_MULTI_THREADING */
+
+    // A task is never executed concurrently with itself: its profile isn't shared
+    TaskProfile &profile = _tasks[index];
+    ++profile.num_runs;
+    profile.total_time_us += to_us(duration);
+
+    if(_record_trace)
+    {
+        record_event(TraceEvent{ index, -1, to_us(start - _origin), to_us(duration), std::this_thread::get_id() });
+    }
+}
+
+GraphProfiler::TaskScheduler &GraphProfiler::thread_scheduler()
+{
+    const std::thread::id       tid = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(_schedulers_mtx);
+
+    auto it = std::find_if(_schedulers.begin(), _schedulers.end(), [&](const std::pair<std::thread::id, std::unique_ptr<TaskScheduler>> &scheduler)
+    {
+        return scheduler.first == tid;
+    });
+    if(it == _schedulers.end())
+    {
+        it = _schedulers.emplace(_schedulers.end(), tid, support::cpp14::make_unique<TaskScheduler>(*this));
+    }
+    return *it->second;
+}
+
+void GraphProfiler::record_kernel(size_t task, const std::string &name, clock::time_point start, clock::duration duration)
+{
+    std::vector<KernelProfile> &kernels = _tasks[task].kernels;
+
+    auto it = std::find_if(kernels.begin(), kernels.end(), [&](const KernelProfile & kernel)
+    {
+        return kernel.name == name;
+    });
+    if(it == kernels.end())
+    {
+        KernelProfile kernel;
+        kernel.name = name;
+        it          = kernels.insert(kernels.end(), std::move(kernel));
+    }
+    ++it->num_runs;
+    it->total_time_us += to_us(duration);
+
+    if(_record_trace)
+    {
+        record_event(TraceEvent{ task, static_cast<int>(it - kernels.begin()), to_us(start - _origin), to_us(duration), std::this_thread::get_id() });
+    }
+}
+
+void GraphProfiler::record_event(const TraceEvent &event)
+{
+    std::lock_guard<std::mutex> lock(_events_mtx);
+    _events.push_back(event);
+}
+
+void GraphProfiler::reset()
+{
+    for(auto &profile : _tasks)
+    {
+        profile.num_runs      = 0;
+        profile.total_time_us = 0;
+        profile.kernels.clear();
+    }
+    std::lock_guard<std::mutex> lock(_events_mtx);
+    _events.clear();
+    _origin = clock::now();
+}
+
+const std::vector<TaskProfile> &GraphProfiler::tasks() const
+{
+    return _tasks;
+}
+
+void GraphProfiler::print_table(std::ostream &os) const
+{
+    double total_time_us = 0;
+    for(const auto &profile : _tasks)
+    {
+        total_time_us += (profile.num_runs > 0) ? profile.total_time_us / profile.num_runs : 0;
+    }
+
+    const std::ios_base::fmtflags flags = os.flags();
+    os << std::left << std::setw(48) << "Layer" << std::setw(40) << "Type" << std::right << std::setw(8) << "Runs" << std::setw(14) << "Avg time (us)" << std::setw(8) << "% time"
+       << std::setw(12) << "GFLOP/s" << std::setw(10) << "GB/s" << std::setw(10) << "FLOP/B" << "  Kernels" << std::endl;
+    os << std::fixed;
+    for(const auto &profile : _tasks)
+    {
+        const double avg_time_us = (profile.num_runs > 0) ? profile.total_time_us / profile.num_runs : 0;
+
+        std::stringstream type;
+        type << profile.type << " (" << profile.target << ")";
+
+        os << std::left << std::setw(48) << task_name(profile) << std::setw(40) << type.str() << std::right << std::setw(8) << profile.num_runs;
+        os << std::setprecision(1) << std::setw(14) << avg_time_us << std::setw(8) << ((total_time_us > 0) ? 100. * avg_time_us / total_time_us : 0.);
+        // Operations (bytes) per microsecond * 1e-3 = GFLOP/s (GB/s)
+        os << std::setprecision(2) << std::setw(12) << ((avg_time_us > 0) ? profile.flops / avg_time_us * 1e-3 : 0.) << std::setw(10) << ((avg_time_us > 0) ? profile.bytes / avg_time_us * 1e-3 : 0.);
+        os << std::setw(10) << ((profile.bytes > 0) ? static_cast<double>(profile.flops) / profile.bytes : 0.) << " ";
+        for(const auto &kernel : profile.kernels)
+        {
+            os << " " << kernel.name;
+        }
+        os << std::endl;
+    }
+    os << std::left << std::setw(96) << "Total" << std::right << std::setprecision(1) << std::setw(14) << total_time_us << std::endl;
+    os.flags(flags);
+}
+
+void GraphProfiler::export_chrome_trace(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(_events_mtx);
+
+    // Chrome expects small integer thread ids
+    std::vector<std::thread::id> threads;
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for(size_t i = 0; i < _events.size(); ++i)
+    {
+        const TraceEvent  &event   = _events[i];
+        const TaskProfile &profile = _tasks[event.task];
+
+        auto thread = std::find(threads.begin(), threads.end(), event.tid);
+        if(thread == threads.end())
+        {
+            thread = threads.insert(threads.end(), event.tid);
+        }
+
+        std::stringstream type;
+        type << profile.type;
+
+        os << (i == 0 ? "" : ",") << std::endl;
+        os << "{\"name\":\"" << escape_json(event.kernel < 0 ? task_name(profile) : profile.kernels[event.kernel].name) << "\",";
+        os << "\"cat\":\"" << (event.kernel < 0 ? "task" : "kernel") << "\",\"ph\":\"X\",";
+        os << "\"ts\":" << std::fixed << std::setprecision(3) << event.start_us << ",\"dur\":" << event.dur_us << ",";
+        os << "\"pid\":0,\"tid\":" << (thread - threads.begin()) << ",";
+        os << "\"args\":{\"layer\":\"" << escape_json(task_name(profile)) << "\",\"type\":\"" << type.str() << "\"";
+        if(event.kernel < 0)
+        {
+            os << ",\"flops\":" << profile.flops << ",\"bytes\":" << profile.bytes;
+        }
+        os << "}}";
+    }
+    os << std::endl
+       << "]}" << std::endl;
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,1188 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphSerializer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using arm_compute::utils::cast::polymorphic_downcast;
+
+constexpr char serialized_graph_magic[8] = { 'A', 'C', 'L', 'G', 'R', 'A', 'P', 'H' };
+
+/** Appends the binary representation of values to a buffer */
+class GraphWriter final
+{
+public:
+    /** Appends an arithmetic value */
+    template <typename T>
+    void write(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be written");
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+        _buffer.insert(_buffer.end(), bytes, bytes + sizeof(T));
+    }
+    /** Appends an enumeration value */
+    template <typename T>
+    void write_enum(T value)
+    {
+        write(static_cast<uint32_t>(value));
+    }
+    /** Appends a string */
+    void write_string(const std::string &str)
+    {
+        write(static_cast<uint32_t>(str.size()));
+        _buffer.insert(_buffer.end(), str.begin(), str.end());
+    }
+    /** Appends raw bytes */
+    void write_bytes(const void *data, size_t size)
+    {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+        _buffer.insert(_buffer.end(), bytes, bytes + size);
+    }
+    /** Written bytes */
+    const std::vector<uint8_t> &buffer() const
+    {
+        return _buffer;
+    }
+
+private:
+    std::vector<uint8_t> _buffer{};
+};
+
+/** Reads values from the binary representation of a graph
+ *
+ * Reading past the end of the data invalidates the reader and returns default values.
+ */
+class GraphReader final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Data to read from
+     * @param[in] size Size of the data in bytes
+     */
+    GraphReader(const uint8_t *data, size_t size)
+        : _data(data), _size(size)
+    {
+    }
+    /** Reads an arithmetic value */
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be read");
+        T value{};
+        if(_is_valid && sizeof(T) <= _size - _offset)
+        {
+            std::memcpy(&value, _data + _offset, sizeof(T));
+            _offset += sizeof(T);
+        }
+        else
+        {
+            _is_valid = false;
+        }
+        return value;
+    }
+    /** Reads an enumeration value */
+    template <typename T>
+    T read_enum()
+    {
+        return static_cast<T>(read<uint32_t>());
+    }
+    /** Reads a string */
+    std::string read_string()
+    {
+        const auto size = read<uint32_t>();
+        if(!_is_valid || size > _size - _offset)
+        {
+            _is_valid = false;
+            return std::string();
+        }
+        std::string str(reinterpret_cast<const char *>(_data + _offset), size);
+        _offset += size;
+        return str;
+    }
+    /** Reads raw bytes */
+    bool read_bytes(void *data, size_t size)
+    {
+        if(!_is_valid || size > _size - _offset)
+        {
+            _is_valid = false;
+            return false;
+        }
+        std::memcpy(data, _data + _offset, size);
+        _offset += size;
+        return true;
+    }
+    /** Invalidates the reader, e.g. after reading a value out of range */
+    void invalidate()
+    {
+        _is_valid = false;
+    }
+    /** Checks if all the values read so far were within the data */
+    bool is_valid() const
+    {
+        return _is_valid;
+    }
+    /** Offset of the next value to read in bytes */
+    size_t offset() const
+    {
+        return _offset;
+    }
+
+private:
+    const uint8_t *_data;
+    size_t         _size;
+    size_t         _offset{ 0 };
+    bool           _is_valid{ true };
+};
+
+/** Serialized graph file, memory-mapped if the platform supports it */
+class SerializedGraphFile final
+{
+public:
+    /** Default constructor */
+    SerializedGraphFile() = default;
+    /** Prevent instances of this class from being copied */
+    SerializedGraphFile(const SerializedGraphFile &) = delete;
+    /** Prevent instances of this class from being copied */
+    SerializedGraphFile &operator=(const SerializedGraphFile &) = delete;
+    /** Destructor */
+    ~SerializedGraphFile()
+    {
+#ifndef BARE_METAL
+        if(_mapping != nullptr)
+        {
+            munmap(_mapping, _size);
+        }
+#endif /* BARE_METAL */
+    }
+    /** Opens a file
+     *
+     * @param[in] filename File to open
+     *
+     * @return A status
+     */
+    Status open(const std::string &filename)
+    {
+#ifndef BARE_METAL
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(fd < 0, "Failed to open %s", filename.c_str());
+
+        struct stat file_stat;
+        const bool  has_stat = (fstat(fd, &file_stat) == 0) && (file_stat.st_size > 0);
+        if(has_stat)
+        {
+            // Private mapping so that functions writing to their (const) inputs don't modify the file
+            _size    = static_cast<size_t>(file_stat.st_size);
+            _mapping = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            _mapping = (_mapping == MAP_FAILED) ? nullptr : _mapping;
+        }
+        close(fd);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(_mapping == nullptr, "Failed to map %s", filename.c_str());
+        _data = static_cast<uint8_t *>(_mapping);
+#else  /* BARE_METAL */
+        std::ifstream fs(filename, std::ios::in | std::ios::binary | std::ios::ate);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs.is_open(), "Failed to open %s", filename.c_str());
+
+        _buffer.resize(static_cast<size_t>(fs.tellg()));
+        fs.seekg(0, std::ios::beg);
+        fs.read(reinterpret_cast<char *>(_buffer.data()), _buffer.size());
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs, "Failed to read %s", filename.c_str());
+
+        _data = _buffer.data();
+        _size = _buffer.size();
+#endif /* BARE_METAL */
+        return Status{};
+    }
+    /** Contents of the file */
+    uint8_t *data() const
+    {
+        return _data;
+    }
+    /** Size of the file in bytes */
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    uint8_t             *_data{ nullptr };
+    size_t               _size{ 0 };
+    void                *_mapping{ nullptr };
+    std::vector<uint8_t> _buffer{};
+};
+
+/** Accessor which provides the data of a constant tensor from a serialized graph file
+ *
+ * The data is imported as the backing memory of the tensor if the backend supports it and the tensor has no padding,
+ * it is copied otherwise.
+ */
+class SerializedTensorAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] file   File the graph was restored from
+     * @param[in] offset Offset of the tensor data in the file
+     * @param[in] size   Size of the tensor data in bytes
+     * @param[in] tensor Graph tensor the accessor is set to, its handle is used to import the data
+     */
+    SerializedTensorAccessor(std::shared_ptr<SerializedGraphFile> file, size_t offset, size_t size, Tensor *tensor)
+        : _file(std::move(file)), _offset(offset), _size(size), _tensor(tensor)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const ITensorInfo *info = tensor.info();
+        if(info->tensor_shape().total_size() * info->element_size() != _size)
+        {
+            return false;
+        }
+
+        // The file stays alive with the accessor, which the graph tensor owns
+        uint8_t       *src    = _file->data() + _offset;
+        ITensorHandle *handle = _tensor->handle();
+        if(info->padding().empty() && handle != nullptr && !handle->is_subtensor() && &handle->tensor() == &tensor && bool(handle->import_memory(src)))
+        {
+            return true;
+        }
+
+        // The data is stored without padding, copy it one row at a time
+        for_each_row(tensor, [&](uint8_t *row, size_t row_size)
+        {
+            std::memcpy(row, src, row_size);
+            src += row_size;
+        });
+        return true;
+    }
+
+    /** Calls a function on every row of a tensor
+     *
+     * @param[in] tensor Tensor to iterate
+     * @param[in] func   Function to call with the address and the size in bytes of each row
+     */
+    template <typename F>
+    static void for_each_row(const ITensor &tensor, F &&func)
+    {
+        const ITensorInfo *info     = tensor.info();
+        const size_t       row_size = info->dimension(0) * info->element_size();
+
+        Window window;
+        window.use_tensor_dimensions(info->tensor_shape());
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            func(it.ptr(), row_size);
+        },
+        it);
+    }
+
+private:
+    std::shared_ptr<SerializedGraphFile> _file;
+    size_t                               _offset;
+    size_t                               _size;
+    Tensor                              *_tensor;
+};
+
+void write_quantization_info(GraphWriter &w, const QuantizationInfo &qinfo)
+{
+    w.write(qinfo.scale);
+    w.write(static_cast<int32_t>(qinfo.offset));
+    w.write(static_cast<uint32_t>(qinfo.channel_scales.size()));
+    for(const float scale : qinfo.channel_scales)
+    {
+        w.write(scale);
+    }
+}
+
+QuantizationInfo read_quantization_info(GraphReader &r)
+{
+    QuantizationInfo qinfo;
+    qinfo.scale                   = r.read<float>();
+    qinfo.offset                  = r.read<int32_t>();
+    const auto num_channel_scales = r.read<uint32_t>();
+    for(unsigned int i = 0; i < num_channel_scales && r.is_valid(); ++i)
+    {
+        qinfo.channel_scales.push_back(r.read<float>());
+    }
+    return qinfo;
+}
+
+void write_tensor_descriptor(GraphWriter &w, const TensorDescriptor &desc)
+{
+    w.write(static_cast<uint32_t>(desc.shape.num_dimensions()));
+    for(unsigned int i = 0; i < desc.shape.num_dimensions(); ++i)
+    {
+        w.write(static_cast<uint64_t>(desc.shape[i]));
+    }
+    w.write_enum(desc.data_type);
+    w.write_enum(desc.layout);
+    w.write_enum(desc.target);
+    write_quantization_info(w, desc.quant_info);
+}
+
+TensorDescriptor read_tensor_descriptor(GraphReader &r)
+{
+    TensorDescriptor desc;
+    const auto       num_dimensions = r.read<uint32_t>();
+    if(num_dimensions > TensorShape::num_max_dimensions)
+    {
+        r.invalidate();
+        return desc;
+    }
+    for(unsigned int i = 0; i < num_dimensions; ++i)
+    {
+        desc.shape.set(i, static_cast<size_t>(r.read<uint64_t>()), false);
+    }
+    desc.data_type  = r.read_enum<DataType>();
+    desc.layout     = r.read_enum<DataLayout>();
+    desc.target     = r.read_enum<Target>();
+    desc.quant_info = read_quantization_info(r);
+    return desc;
+}
+
+void write_activation_info(GraphWriter &w, const ActivationLayerInfo &act_info)
+{
+    w.write(static_cast<uint8_t>(act_info.enabled()));
+    w.write_enum(act_info.activation());
+    w.write(act_info.a());
+    w.write(act_info.b());
+}
+
+ActivationLayerInfo read_activation_info(GraphReader &r)
+{
+    const bool enabled = r.read<uint8_t>() != 0;
+    const auto act     = r.read_enum<ActivationLayerInfo::ActivationFunction>();
+    const auto a       = r.read<float>();
+    const auto b       = r.read<float>();
+    return enabled ? ActivationLayerInfo(act, a, b) : ActivationLayerInfo();
+}
+
+void write_pad_stride_info(GraphWriter &w, const PadStrideInfo &info)
+{
+    w.write(static_cast<uint32_t>(info.stride().first));
+    w.write(static_cast<uint32_t>(info.stride().second));
+    w.write(static_cast<uint32_t>(info.pad_left()));
+    w.write(static_cast<uint32_t>(info.pad_right()));
+    w.write(static_cast<uint32_t>(info.pad_top()));
+    w.write(static_cast<uint32_t>(info.pad_bottom()));
+    w.write_enum(info.round());
+}
+
+PadStrideInfo read_pad_stride_info(GraphReader &r)
+{
+    const auto stride_x   = r.read<uint32_t>();
+    const auto stride_y   = r.read<uint32_t>();
+    const auto pad_left   = r.read<uint32_t>();
+    const auto pad_right  = r.read<uint32_t>();
+    const auto pad_top    = r.read<uint32_t>();
+    const auto pad_bottom = r.read<uint32_t>();
+    const auto round      = r.read_enum<DimensionRoundingType>();
+    return PadStrideInfo(stride_x, stride_y, pad_left, pad_right, pad_top, pad_bottom, round);
+}
+
+/** Writes the attributes of a node which are not recovered from its output descriptors
+ *
+ * @param[in, out] w                Writer
+ * @param[in]      node             Node to write the attributes of
+ * @param[in]      weights_reshaped Whether the weights of the node are serialized already reshaped (Fully connected and convolution layers only)
+ *
+ * @return A status, an error if the node type can't be serialized
+ */
+Status write_node_attributes(GraphWriter &w, const INode &node, bool weights_reshaped)
+{
+    switch(node.type())
+    {
+        case NodeType::Input:
+        case NodeType::Output:
+        case NodeType::Const:
+        case NodeType::FlattenLayer:
+        case NodeType::ReshapeLayer:
+            break;
+        case NodeType::ActivationLayer:
+        {
+            const auto &n = *polymorphic_downcast<const ActivationLayerNode *>(&node);
+            write_activation_info(w, n.activation_info());
+            break;
+        }
+        case NodeType::BatchNormalizationLayer:
+        {
+            const auto &n = *polymorphic_downcast<const BatchNormalizationLayerNode *>(&node);
+            w.write(n.epsilon());
+            write_activation_info(w, n.fused_activation());
+            break;
+        }
+        case NodeType::ChannelShuffleLayer:
+        {
+            const auto &n = *polymorphic_downcast<const ChannelShuffleLayerNode *>(&node);
+            w.write(static_cast<uint32_t>(n.num_groups()));
+            break;
+        }
+        case NodeType::ConcatenateLayer:
+        {
+            const auto &n = *polymorphic_downcast<const ConcatenateLayerNode *>(&node);
+            w.write_enum(n.concatenation_axis());
+            write_quantization_info(w, n.output_quantization_info());
+            break;
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            const auto &n = *polymorphic_downcast<const ConvolutionLayerNode *>(&node);
+            write_pad_stride_info(w, n.convolution_info());
+            w.write(static_cast<uint32_t>(n.num_groups()));
+            w.write_enum(n.convolution_method());
+            w.write_enum(n.fast_math_hint());
+            write_activation_info(w, n.fused_activation());
+
+            // The kernel size of the weights reshaped for serialization is read from the weights before they are reshaped
+            const WeightsInfo       info    = n.weights_info();
+            const TensorDescriptor &weights = n.input(1)->desc();
+            w.write(static_cast<uint8_t>(info.are_reshaped() || weights_reshaped));
+            w.write(static_cast<uint32_t>(weights_reshaped ? get_dimension_size(weights, DataLayoutDimension::WIDTH) : info.kernel_size().first));
+            w.write(static_cast<uint32_t>(weights_reshaped ? get_dimension_size(weights, DataLayoutDimension::HEIGHT) : info.kernel_size().second));
+            w.write(static_cast<uint32_t>(weights_reshaped ? get_dimension_size(weights, DataLayoutDimension::BATCHES) : info.num_kernels()));
+            break;
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const auto &n = *polymorphic_downcast<const DepthwiseConvolutionLayerNode *>(&node);
+            write_pad_stride_info(w, n.convolution_info());
+            w.write(static_cast<int32_t>(n.depth_multiplier()));
+            w.write_enum(n.depthwise_convolution_method());
+            write_activation_info(w, n.fused_activation());
+            break;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto &n = *polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            w.write_enum(n.eltwise_operation());
+            w.write_enum(n.convert_policy());
+            w.write_enum(n.rounding_policy());
+            break;
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const auto &n    = *polymorphic_downcast<const FullyConnectedLayerNode *>(&node);
+            const auto  info = n.info();
+            w.write_enum(info.weights_trained_layout);
+            w.write(static_cast<uint8_t>(info.transpose_weights));
+            w.write(static_cast<uint8_t>(info.are_weights_reshaped || weights_reshaped));
+            w.write(static_cast<uint8_t>(info.retain_internal_weights));
+            w.write(static_cast<uint8_t>(info.dynamic_quantization));
+            break;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const auto &n = *polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(&node);
+            w.write(n.epsilon());
+            write_pad_stride_info(w, n.convolution_info());
+            w.write(static_cast<uint32_t>(n.num_groups()));
+            w.write_enum(n.convolution_method());
+            w.write_enum(n.fast_math_hint());
+            write_activation_info(w, n.fused_activation());
+            break;
+        }
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+        {
+            const auto &n = *polymorphic_downcast<const FusedDepthwiseSeparableConvolutionNode *>(&node);
+            write_pad_stride_info(w, n.depthwise_convolution_info());
+            write_pad_stride_info(w, n.pointwise_convolution_info());
+            write_activation_info(w, n.depthwise_fused_activation());
+            write_activation_info(w, n.fused_activation());
+            break;
+        }
+        case NodeType::FusedPointwiseLayer:
+        {
+            const auto &n = *polymorphic_downcast<const FusedPointwiseNode *>(&node);
+            w.write(static_cast<uint32_t>(n.operations().size()));
+            for(const auto &op : n.operations())
+            {
+                w.write_enum(op.type);
+                w.write(static_cast<uint32_t>(op.operand));
+                w.write(op.epsilon);
+                write_activation_info(w, op.act_info);
+            }
+            break;
+        }
+        case NodeType::NormalizationLayer:
+        {
+            const auto &n    = *polymorphic_downcast<const NormalizationLayerNode *>(&node);
+            const auto  info = n.normalization_info();
+            w.write_enum(info.type());
+            w.write(static_cast<uint32_t>(info.norm_size()));
+            w.write(info.alpha());
+            w.write(info.beta());
+            w.write(info.kappa());
+            w.write(static_cast<uint8_t>(info.is_scaled()));
+            break;
+        }
+        case NodeType::PermuteLayer:
+        {
+            const auto &n    = *polymorphic_downcast<const PermuteLayerNode *>(&node);
+            const auto &perm = n.permutation_vector();
+            w.write(static_cast<uint32_t>(perm.num_dimensions()));
+            for(unsigned int i = 0; i < perm.num_dimensions(); ++i)
+            {
+                w.write(static_cast<uint32_t>(perm[i]));
+            }
+            break;
+        }
+        case NodeType::PoolingLayer:
+        {
+            const auto &n    = *polymorphic_downcast<const PoolingLayerNode *>(&node);
+            const auto  info = n.pooling_info();
+            w.write_enum(info.pool_type());
+            w.write(static_cast<uint32_t>(info.pool_size().width));
+            w.write(static_cast<uint32_t>(info.pool_size().height));
+            write_pad_stride_info(w, info.pad_stride_info());
+            w.write(static_cast<uint8_t>(info.exclude_padding()));
+            w.write(static_cast<uint8_t>(info.is_global_pooling()));
+            break;
+        }
+        case NodeType::ResizeLayer:
+        {
+            const auto &n = *polymorphic_downcast<const ResizeLayerNode *>(&node);
+            w.write_enum(n.policy());
+            w.write(n.scaling_factor().first);
+            w.write(n.scaling_factor().second);
+            break;
+        }
+        case NodeType::SoftmaxLayer:
+        {
+            const auto &n = *polymorphic_downcast<const SoftmaxLayerNode *>(&node);
+            w.write(n.beta());
+            break;
+        }
+        case NodeType::SplitLayer:
+        {
+            const auto &n = *polymorphic_downcast<const SplitLayerNode *>(&node);
+            w.write(static_cast<uint32_t>(n.num_splits()));
+            w.write(static_cast<uint32_t>(n.axis()));
+            break;
+        }
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Node %s can't be serialized as its type is not supported", node.name().c_str());
+    }
+    return Status{};
+}
+
+/** Adds a node to a graph from its serialized attributes
+ *
+ * @param[in, out] r       Reader positioned at the attributes of the node
+ * @param[in, out] g       Graph to add the node to
+ * @param[in]      type    Type of the node
+ * @param[in]      inputs  Number of inputs of the node
+ * @param[in]      outputs Descriptors of the outputs of the node
+ *
+ * @return The ID of the added node, EmptyNodeID if the node type is not supported
+ */
+NodeID add_serialized_node(GraphReader &r, Graph &g, NodeType type, unsigned int inputs, const std::vector<TensorDescriptor> &outputs)
+{
+    if(outputs.empty() && type != NodeType::Output)
+    {
+        return EmptyNodeID;
+    }
+
+    switch(type)
+    {
+        case NodeType::Input:
+            return g.add_node<InputNode>(outputs[0]);
+        case NodeType::Output:
+            return g.add_node<OutputNode>();
+        case NodeType::Const:
+            return g.add_node<ConstNode>(outputs[0]);
+        case NodeType::FlattenLayer:
+            return g.add_node<FlattenLayerNode>();
+        case NodeType::ReshapeLayer:
+            return g.add_node<ReshapeLayerNode>(outputs[0].shape);
+        case NodeType::ActivationLayer:
+        {
+            const auto act_info = read_activation_info(r);
+            return g.add_node<ActivationLayerNode>(act_info, outputs[0].quant_info);
+        }
+        case NodeType::BatchNormalizationLayer:
+        {
+            const auto epsilon  = r.read<float>();
+            const auto act_info = read_activation_info(r);
+            return g.add_node<BatchNormalizationLayerNode>(epsilon, act_info);
+        }
+        case NodeType::ChannelShuffleLayer:
+        {
+            const auto num_groups = r.read<uint32_t>();
+            return g.add_node<ChannelShuffleLayerNode>(num_groups);
+        }
+        case NodeType::ConcatenateLayer:
+        {
+            const auto axis  = r.read_enum<DataLayoutDimension>();
+            const auto qinfo = read_quantization_info(r);
+            return g.add_node<ConcatenateLayerNode>(inputs, descriptors::ConcatLayerDescriptor(axis, qinfo));
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            const auto conv_info      = read_pad_stride_info(r);
+            const auto num_groups     = r.read<uint32_t>();
+            const auto method         = r.read_enum<ConvolutionMethod>();
+            const auto fast_math_hint = r.read_enum<FastMathHint>();
+            const auto act_info       = read_activation_info(r);
+            const auto are_reshaped   = r.read<uint8_t>() != 0;
+            const auto kernel_width   = r.read<uint32_t>();
+            const auto kernel_height  = r.read<uint32_t>();
+            const auto num_kernels    = r.read<uint32_t>();
+            const auto nid            = g.add_node<ConvolutionLayerNode>(conv_info, num_groups, method, fast_math_hint, outputs[0].quant_info,
+                                                                         WeightsInfo(are_reshaped, kernel_width, kernel_height, num_kernels));
+            polymorphic_downcast<ConvolutionLayerNode *>(g.node(nid))->set_fused_activation(act_info);
+            return nid;
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const auto conv_info        = read_pad_stride_info(r);
+            const auto depth_multiplier = r.read<int32_t>();
+            const auto method           = r.read_enum<DepthwiseConvolutionMethod>();
+            const auto act_info         = read_activation_info(r);
+            const auto nid              = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, depth_multiplier, method, outputs[0].quant_info);
+            polymorphic_downcast<DepthwiseConvolutionLayerNode *>(g.node(nid))->set_fused_activation(act_info);
+            return nid;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto op       = r.read_enum<EltwiseOperation>();
+            const auto c_policy = r.read_enum<ConvertPolicy>();
+            const auto r_policy = r.read_enum<RoundingPolicy>();
+            return g.add_node<EltwiseLayerNode>(op, c_policy, r_policy);
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            FullyConnectedLayerInfo info;
+            info.weights_trained_layout  = r.read_enum<DataLayout>();
+            info.transpose_weights       = r.read<uint8_t>() != 0;
+            info.are_weights_reshaped    = r.read<uint8_t>() != 0;
+            info.retain_internal_weights = r.read<uint8_t>() != 0;
+            info.dynamic_quantization    = r.read<uint8_t>() != 0;
+            return g.add_node<FullyConnectedLayerNode>(outputs[0].shape[0], outputs[0].quant_info, info);
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const auto epsilon        = r.read<float>();
+            const auto conv_info      = read_pad_stride_info(r);
+            const auto num_groups     = r.read<uint32_t>();
+            const auto method         = r.read_enum<ConvolutionMethod>();
+            const auto fast_math_hint = r.read_enum<FastMathHint>();
+            const auto act_info       = read_activation_info(r);
+            return g.add_node<FusedConvolutionBatchNormalizationNode>(epsilon, conv_info, num_groups, method, fast_math_hint, outputs[0].quant_info, act_info);
+        }
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+        {
+            const auto dw_info     = read_pad_stride_info(r);
+            const auto pw_info     = read_pad_stride_info(r);
+            const auto dw_act_info = read_activation_info(r);
+            const auto pw_act_info = read_activation_info(r);
+            return g.add_node<FusedDepthwiseSeparableConvolutionNode>(dw_info, pw_info, dw_act_info, pw_act_info, outputs[0].quant_info);
+        }
+        case NodeType::FusedPointwiseLayer:
+        {
+            if(inputs == 0)
+            {
+                return EmptyNodeID;
+            }
+            const auto                      num_operations = r.read<uint32_t>();
+            std::vector<PointwiseOperation> operations;
+            for(unsigned int i = 0; i < num_operations && r.is_valid(); ++i)
+            {
+                const auto op_type  = r.read_enum<PointwiseOperation::Type>();
+                const auto operand  = r.read<uint32_t>();
+                const auto epsilon  = r.read<float>();
+                const auto act_info = read_activation_info(r);
+                operations.push_back(op_type == PointwiseOperation::Type::ACTIVATION ? PointwiseOperation(act_info) : PointwiseOperation(op_type, operand, epsilon));
+            }
+            return g.add_node<FusedPointwiseNode>(std::move(operations), inputs - 1);
+        }
+        case NodeType::NormalizationLayer:
+        {
+            const auto norm_type = r.read_enum<NormType>();
+            const auto norm_size = r.read<uint32_t>();
+            const auto alpha     = r.read<float>();
+            const auto beta      = r.read<float>();
+            const auto kappa     = r.read<float>();
+            const auto is_scaled = r.read<uint8_t>() != 0;
+            return g.add_node<NormalizationLayerNode>(NormalizationLayerInfo(norm_type, norm_size, alpha, beta, kappa, is_scaled));
+        }
+        case NodeType::PermuteLayer:
+        {
+            const auto        num_dimensions = r.read<uint32_t>();
+            PermutationVector perm;
+            for(unsigned int i = 0; i < num_dimensions && i < PermutationVector::num_max_dimensions; ++i)
+            {
+                perm.set(i, r.read<uint32_t>());
+            }
+            return g.add_node<PermuteLayerNode>(perm, outputs[0].layout);
+        }
+        case NodeType::PoolingLayer:
+        {
+            const auto pool_type         = r.read_enum<PoolingType>();
+            const auto pool_width        = r.read<uint32_t>();
+            const auto pool_height       = r.read<uint32_t>();
+            const auto pad_stride_info   = read_pad_stride_info(r);
+            const auto exclude_padding   = r.read<uint8_t>() != 0;
+            const auto is_global_pooling = r.read<uint8_t>() != 0;
+            return g.add_node<PoolingLayerNode>(is_global_pooling ? PoolingLayerInfo(pool_type) :
+                                                PoolingLayerInfo(pool_type, Size2D(pool_width, pool_height), pad_stride_info, exclude_padding));
+        }
+        case NodeType::ResizeLayer:
+        {
+            const auto policy       = r.read_enum<InterpolationPolicy>();
+            const auto scale_width  = r.read<float>();
+            const auto scale_height = r.read<float>();
+            return g.add_node<ResizeLayerNode>(policy, scale_width, scale_height);
+        }
+        case NodeType::SoftmaxLayer:
+        {
+            const auto beta = r.read<float>();
+            return g.add_node<SoftmaxLayerNode>(beta);
+        }
+        case NodeType::SplitLayer:
+        {
+            const auto num_splits = r.read<uint32_t>();
+            const auto axis       = r.read<uint32_t>();
+            return g.add_node<SplitLayerNode>(num_splits, axis);
+        }
+        default:
+            return EmptyNodeID;
+    }
+}
+
+/** Size in bytes of the data of a constant tensor without padding */
+size_t dense_size(const TensorDescriptor &desc)
+{
+    return desc.shape.total_size() * data_size_from_type(desc.data_type);
+}
+
+/** Models of all the CPUs of the system
+ *
+ * The models of all the CPUs are compared rather than the model of the CPU the calling thread happens to run on,
+ * which differs between the clusters of heterogeneous systems.
+ */
+std::vector<CPUModel> cpu_models()
+{
+    const CPUInfo        &cpu_info = Scheduler::get().cpu_info();
+    std::vector<CPUModel> models(cpu_info.get_cpu_num());
+    for(unsigned int i = 0; i < models.size(); ++i)
+    {
+        models[i] = cpu_info.get_cpu_model(i);
+    }
+    return models;
+}
+
+/** Weights stored as the backend function would transform them when preparing */
+struct TransformedWeights
+{
+    TensorShape          shape{}; /**< Shape of the transformed weights */
+    std::vector<uint8_t> data{};  /**< Transformed weights, dense */
+};
+
+/** Returns the tensor of the weights of a node if they can be stored transformed
+ *
+ * @param[in] g    Graph
+ * @param[in] node Node consuming the weights on its second input
+ *
+ * @return The weights tensor, nullptr if the weights aren't provided by a constant node used by @p node only
+ */
+Tensor *transformable_weights(Graph &g, const INode &node)
+{
+    const Edge *weights_edge = g.edge(node.input_edges()[1]);
+    if(node.assigned_target() != Target::NEON || weights_edge == nullptr || weights_edge->producer()->type() != NodeType::Const || weights_edge->producer()->output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+
+    Tensor *weights = weights_edge->tensor();
+    return (weights != nullptr && weights->handle() != nullptr) ? weights : nullptr;
+}
+
+/** Transposes weights shaped [num_inputs, num_outputs], where num_inputs is the product of the lower dimensions, to [num_outputs, num_inputs]
+ *
+ * @param[in]  weights    Weights tensor
+ * @param[in]  num_inputs Number of inputs
+ * @param[out] dst        Transposed weights
+ */
+void transpose_weights(Tensor &weights, size_t num_inputs, TransformedWeights &dst)
+{
+    // Gather the rows of the weights
+    std::vector<uint8_t> src(dense_size(weights.desc()));
+    uint8_t             *dst_row = src.data();
+    weights.handle()->map(true);
+    SerializedTensorAccessor::for_each_row(weights.handle()->tensor(), [&](const uint8_t *row, size_t row_size)
+    {
+        std::memcpy(dst_row, row, row_size);
+        dst_row += row_size;
+    });
+    weights.handle()->unmap();
+
+    const size_t element_size = data_size_from_type(weights.desc().data_type);
+    const size_t num_outputs  = weights.desc().shape.total_size() / num_inputs;
+    dst.shape                 = TensorShape(num_outputs, num_inputs);
+    dst.data.resize(src.size());
+    for(size_t o = 0; o < num_outputs; ++o)
+    {
+        for(size_t i = 0; i < num_inputs; ++i)
+        {
+            std::memcpy(dst.data.data() + (i * num_outputs + o) * element_size, src.data() + (o * num_inputs + i) * element_size, element_size);
+        }
+    }
+}
+
+/** Transposes the weights of a fully connected layer as the function would do when preparing
+ *
+ * The weights are only transposed when the layer is executed on NEON, transposes them itself and
+ * doesn't quantize them, and when the constant node providing them isn't shared with other nodes.
+ *
+ * @param[in]  g    Graph
+ * @param[in]  node Fully connected layer node
+ * @param[out] dst  Transposed weights
+ *
+ * @return The ID of the constant node providing the weights, @ref EmptyNodeID if the weights can't be transposed
+ */
+NodeID transpose_fully_connected_weights(Graph &g, const FullyConnectedLayerNode &node, TransformedWeights &dst)
+{
+    const FullyConnectedLayerInfo info    = node.info();
+    Tensor                       *weights = transformable_weights(g, node);
+    if(weights == nullptr || !info.transpose_weights || info.are_weights_reshaped || info.retain_internal_weights || info.dynamic_quantization || weights->desc().shape.num_dimensions() > 2)
+    {
+        return EmptyNodeID;
+    }
+
+    transpose_weights(*weights, weights->desc().shape[0], dst);
+    return g.edge(node.input_edges()[1])->producer_id();
+}
+
+/** Reshapes the weights of a convolution layer as @ref NEConvolutionLayerReshapeWeights would do, without the biases
+ *
+ * The weights are only reshaped when the layer is executed on NEON as a GEMM convolution, isn't grouped, its weights
+ * aren't quantized per channel and the constant node providing them isn't shared with other nodes.
+ *
+ * @param[in]  g    Graph
+ * @param[in]  node Convolution layer node
+ * @param[out] dst  Reshaped weights, [OFM, kernel_x * kernel_y * IFM]
+ *
+ * @return The ID of the constant node providing the weights, @ref EmptyNodeID if the weights can't be reshaped
+ */
+NodeID reshape_convolution_weights(Graph &g, const ConvolutionLayerNode &node, TransformedWeights &dst)
+{
+    Tensor *weights = transformable_weights(g, node);
+    if(weights == nullptr || node.convolution_method() != ConvolutionMethod::GEMM || node.num_groups() != 1 || node.weights_info().are_reshaped()
+       || is_data_type_quantized_per_channel(weights->desc().data_type) || weights->desc().shape.num_dimensions() > 4)
+    {
+        return EmptyNodeID;
+    }
+
+    // Each kernel is a row of the reshaped weights
+    const TensorShape &shape = weights->desc().shape;
+    transpose_weights(*weights, shape[0] * shape[1] * shape[2], dst);
+    return g.edge(node.input_edges()[1])->producer_id();
+}
+} // namespace
+
+Status serialize_graph(Graph &g, const std::string &filename)
+{
+    // Assign contiguous IDs to the nodes left by the mutating passes
+    std::vector<NodeID> serialized_ids(g.nodes().size(), EmptyNodeID);
+    uint32_t            num_nodes = 0;
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            serialized_ids[node->id()] = num_nodes++;
+        }
+    }
+
+    // Store the weights of the fully connected layers transposed and the weights of the GEMM convolutions reshaped
+    // so that the functions don't transform them when preparing
+    std::map<NodeID, TransformedWeights> transformed_data;
+    std::vector<bool>                    weights_reshaped(g.nodes().size(), false);
+    for(auto &node : g.nodes())
+    {
+        TransformedWeights weights;
+        NodeID             weights_id = EmptyNodeID;
+        if(node != nullptr && node->type() == NodeType::FullyConnectedLayer)
+        {
+            weights_id = transpose_fully_connected_weights(g, *polymorphic_downcast<FullyConnectedLayerNode *>(node.get()), weights);
+        }
+        else if(node != nullptr && node->type() == NodeType::ConvolutionLayer)
+        {
+            weights_id = reshape_convolution_weights(g, *polymorphic_downcast<ConvolutionLayerNode *>(node.get()), weights);
+        }
+
+        if(weights_id != EmptyNodeID)
+        {
+            transformed_data[weights_id] = std::move(weights);
+            weights_reshaped[node->id()] = true;
+        }
+    }
+
+    // Nodes are written in ID order so that the input and output nodes are restored in the same order
+    GraphWriter          w;
+    std::vector<INode *> const_nodes;
+    uint64_t             data_size = 0;
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        w.write_enum(node->type());
+        w.write_string(node->name());
+        w.write_enum(node->assigned_target());
+        w.write(static_cast<uint32_t>(node->num_inputs()));
+        w.write(static_cast<uint32_t>(node->num_outputs()));
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(node->output(i) == nullptr, "Node %s has an unconnected output", node->name().c_str());
+            TensorDescriptor desc        = node->output(i)->desc();
+            const auto       transformed = transformed_data.find(node->id());
+            if(transformed != transformed_data.end())
+            {
+                desc.shape = transformed->second.shape;
+            }
+            write_tensor_descriptor(w, desc);
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(write_node_attributes(w, *node, weights_reshaped[node->id()]));
+
+        // Connections are stored as the producer of each input, optional inputs may be unconnected
+        for(const EdgeID eid : node->input_edges())
+        {
+            const Edge *e = g.edge(eid);
+            w.write(static_cast<uint32_t>((e != nullptr) ? serialized_ids[e->producer_id()] : EmptyNodeID));
+            w.write(static_cast<uint32_t>((e != nullptr) ? e->producer_idx() : 0));
+        }
+
+        // Constant tensors are stored after the nodes, each one aligned to serialized_graph_alignment
+        if(node->type() == NodeType::Const)
+        {
+            Tensor *tensor = node->output(0);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(tensor->handle() == nullptr, "The tensor of constant node %s is not allocated", node->name().c_str());
+
+            const auto     transformed = transformed_data.find(node->id());
+            const uint64_t size        = (transformed != transformed_data.end()) ? transformed->second.data.size() : dense_size(tensor->desc());
+            w.write(data_size);
+            w.write(size);
+            const_nodes.push_back(node.get());
+            data_size += ceil_to_multiple<uint64_t>(size, serialized_graph_alignment);
+        }
+    }
+
+    GraphWriter header;
+    header.write_bytes(serialized_graph_magic, sizeof(serialized_graph_magic));
+    header.write(static_cast<uint32_t>(serialized_graph_version));
+    const std::vector<CPUModel> models = cpu_models();
+    header.write(static_cast<uint32_t>(models.size()));
+    for(const CPUModel model : models)
+    {
+        header.write_enum(model);
+    }
+    header.write(num_nodes);
+    header.write(static_cast<uint64_t>(w.buffer().size()));
+
+    const size_t meta_size   = header.buffer().size() + sizeof(uint64_t) + w.buffer().size();
+    const size_t data_offset = ceil_to_multiple(meta_size, serialized_graph_alignment);
+    header.write(static_cast<uint64_t>(data_offset));
+
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs.is_open(), "Failed to open %s", filename.c_str());
+
+    const std::vector<char> zeros(serialized_graph_alignment, 0);
+    fs.write(reinterpret_cast<const char *>(header.buffer().data()), header.buffer().size());
+    fs.write(reinterpret_cast<const char *>(w.buffer().data()), w.buffer().size());
+    fs.write(zeros.data(), data_offset - meta_size);
+
+    for(INode *node : const_nodes)
+    {
+        const auto transformed = transformed_data.find(node->id());
+        if(transformed != transformed_data.end())
+        {
+            fs.write(reinterpret_cast<const char *>(transformed->second.data.data()), transformed->second.data.size());
+        }
+        else
+        {
+            ITensorHandle *handle = node->output(0)->handle();
+            handle->map(true);
+            SerializedTensorAccessor::for_each_row(handle->tensor(), [&](const uint8_t *row, size_t row_size)
+            {
+                fs.write(reinterpret_cast<const char *>(row), row_size);
+            });
+            handle->unmap();
+        }
+
+        const size_t size = (transformed != transformed_data.end()) ? transformed->second.data.size() : dense_size(node->output(0)->desc());
+        fs.write(zeros.data(), ceil_to_multiple(size, serialized_graph_alignment) - size);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs, "Failed to write %s", filename.c_str());
+    ARM_COMPUTE_LOG_GRAPH_INFO("Serialized " << num_nodes << " nodes and " << data_size << " bytes of constant data to " << filename << std::endl);
+
+    return Status{};
+}
+
+Status deserialize_graph(Graph &g, const std::string &filename)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!g.nodes().empty(), "Graphs can only be restored into an empty graph");
+
+    auto file = std::make_shared<SerializedGraphFile>();
+    ARM_COMPUTE_RETURN_ON_ERROR(file->open(filename));
+
+    GraphReader r(file->data(), file->size());
+
+    char magic[sizeof(serialized_graph_magic)];
+    r.read_bytes(magic, sizeof(magic));
+    const auto version = r.read<uint32_t>();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!r.is_valid() || std::memcmp(magic, serialized_graph_magic, sizeof(magic)) != 0, "%s is not a serialized graph", filename.c_str());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(version != serialized_graph_version, "%s was serialized with version %u, expected version %u",
+                                    filename.c_str(), version, serialized_graph_version);
+
+    const auto            num_cpus = r.read<uint32_t>();
+    std::vector<CPUModel> models;
+    for(unsigned int i = 0; i < num_cpus && r.is_valid(); ++i)
+    {
+        models.push_back(r.read_enum<CPUModel>());
+    }
+    const auto num_nodes = r.read<uint32_t>();
+    const auto meta_size = r.read<uint64_t>();
+    const auto data_off  = r.read<uint64_t>();
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!r.is_valid(), "%s is truncated", filename.c_str());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(models != cpu_models(), "%s was serialized on different CPU models", filename.c_str());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(data_off > file->size() || meta_size > data_off - r.offset(), "%s is truncated", filename.c_str());
+
+    struct SerializedInput
+    {
+        NodeID       producer;
+        unsigned int producer_idx;
+    };
+    std::vector<std::vector<SerializedInput>>  node_inputs(num_nodes);
+    std::vector<std::vector<TensorDescriptor>> node_outputs(num_nodes);
+
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        const auto type        = r.read_enum<NodeType>();
+        const auto name        = r.read_string();
+        const auto target      = r.read_enum<Target>();
+        const auto num_inputs  = r.read<uint32_t>();
+        const auto num_outputs = r.read<uint32_t>();
+        for(unsigned int j = 0; j < num_outputs && r.is_valid(); ++j)
+        {
+            node_outputs[i].push_back(read_tensor_descriptor(r));
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!r.is_valid(), "%s is truncated", filename.c_str());
+
+        const NodeID nid = add_serialized_node(r, g, type, num_inputs, node_outputs[i]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(nid == EmptyNodeID, "Node %s can't be restored as its type is not supported", name.c_str());
+
+        INode *node = g.node(nid);
+        node->set_common_node_parameters(NodeParams{ name, target });
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node->num_inputs() != num_inputs || node->num_outputs() != num_outputs, "Node %s doesn't match its serialized connections", name.c_str());
+
+        for(unsigned int j = 0; j < num_inputs; ++j)
+        {
+            const auto producer     = r.read<uint32_t>();
+            const auto producer_idx = r.read<uint32_t>();
+            node_inputs[i].push_back(SerializedInput{ producer, producer_idx });
+        }
+
+        if(type == NodeType::Const)
+        {
+            const auto offset = r.read<uint64_t>();
+            const auto size   = r.read<uint64_t>();
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(size != dense_size(node_outputs[i][0]) || offset > file->size() - data_off || size > file->size() - data_off - offset,
+                                            "The data of constant node %s is truncated", name.c_str());
+            node->output(0)->set_accessor(support::cpp14::make_unique<SerializedTensorAccessor>(file, data_off + offset, size, node->output(0)));
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!r.is_valid(), "%s is truncated", filename.c_str());
+    }
+
+    // Connect the nodes once they all exist as the producers may follow their consumers
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        for(unsigned int j = 0; j < node_inputs[i].size(); ++j)
+        {
+            const SerializedInput &input = node_inputs[i][j];
+            if(input.producer == EmptyNodeID)
+            {
+                continue;
+            }
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(input.producer >= num_nodes || input.producer_idx >= node_outputs[input.producer].size(), "%s has an invalid connection", filename.c_str());
+            ARM_COMPUTE_RETURN_ERROR_ON(g.add_connection(input.producer, input.producer_idx, i, j) == EmptyEdgeID);
+        }
+    }
+
+    // Restore the descriptors computed by the mutating passes
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        for(unsigned int j = 0; j < node_outputs[i].size(); ++j)
+        {
+            g.node(i)->output(j)->desc() = node_outputs[i][j];
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Restored " << num_nodes << " nodes from " << filename << std::endl);
+
+    return Status{};
+}
+} // namespace graph
+} // namespace arm_compute
@@ -36,6 +36,7 @@ arm_compute::DataType data_type_from_name(const std::string &name)
         { "f16", DataType::F16 },
         { "f32", DataType::F32 },
         { "qasymm8", DataType::QASYMM8 },
+        { "qasymm8_signed", DataType::QASYMM8_SIGNED },
     };
 
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
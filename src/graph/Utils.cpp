@@ -82,6 +82,7 @@ PassManager create_default_pass_manager(Target target)
 
     // Passes that mutate graph IR
     pm.append(support::cpp14::make_unique<NodeFusionMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<PointwiseFusionMutator>(), !is_target_gc);
     pm.append(support::cpp14::make_unique<GroupedConvolutionMutator>());
     pm.append(support::cpp14::make_unique<InPlaceOperationMutator>(), !is_target_gc);
 
@@ -93,6 +94,20 @@ PassManager create_default_pass_manager(Target target)
     return pm;
 }
 
+PassManager create_restore_pass_manager(Target target)
+{
+    PassManager pm;
+
+    const bool is_target_gc = target == Target::GC;
+
+    // The in-place operations and sub-tensors are not serialized, the execution methods were validated before serializing
+    pm.append(support::cpp14::make_unique<InPlaceOperationMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<DepthConcatSubTensorMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<SplitLayerSubTensorMutator>(), !is_target_gc);
+
+    return pm;
+}
+
 void release_default_graph_context(GraphContext &ctx)
 {
     for(const auto &backend : backends::BackendRegistry::get().backends())
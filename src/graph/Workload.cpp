@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/graph/Workload.h"
 
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorHandle.h"
 
@@ -32,7 +33,14 @@ namespace graph
 {
 void ExecutionTask::operator()()
 {
-    TaskExecutor::get().execute_function(*this);
+    if(profiler != nullptr)
+    {
+        profiler->run_task(*this);
+    }
+    else
+    {
+        TaskExecutor::get().execute_function(*this);
+    }
 }
 
 void execute_task(ExecutionTask &task)
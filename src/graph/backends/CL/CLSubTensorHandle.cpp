@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -96,6 +96,16 @@ Target CLSubTensorHandle::target() const
 {
     return Target::CL;
 }
+
+Status CLSubTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Importing memory is not supported by sub-tensors");
+}
+
+void CLSubTensorHandle::restore_memory()
+{
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,6 +100,16 @@ Target CLTensorHandle::target() const
 {
     return Target::CL;
 }
+
+Status CLTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Importing memory is not supported by the OpenCL backend");
+}
+
+void CLTensorHandle::restore_memory()
+{
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
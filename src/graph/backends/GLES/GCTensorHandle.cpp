@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,6 +100,16 @@ Target GCTensorHandle::target() const
 {
     return Target::GC;
 }
+
+Status GCTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Importing memory is not supported by the OpenGL ES backend");
+}
+
+void GCTensorHandle::restore_memory()
+{
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
@@ -37,26 +38,51 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 #include "support/ToolchainSupport.h"
 
+#include <fstream>
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register NEON backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _gemm_tuner(false), _gemm_tuner_file(), _conv_method_table()
+{
+}
+
+NEDeviceBackend::~NEDeviceBackend()
 {
+    NEGEMMAssemblyDispatch::set_tuner(nullptr);
+    NEConvolutionLayer::set_method_table(nullptr);
+    if(_gemm_tuner.tune_new_kernels() && !_gemm_tuner.kernel_table().empty() && !_gemm_tuner_file.empty())
+    {
+        _gemm_tuner.save_to_file(_gemm_tuner_file);
+    }
 }
 
 void NEDeviceBackend::initialize_backend()
@@ -78,13 +104,32 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup GEMM tuner
+    _gemm_tuner_file = ctx.config().gemm_tuner_file;
+    // Load tuner data if available
+    if(file_exists(_gemm_tuner_file))
+    {
+        _gemm_tuner.load_from_file(_gemm_tuner_file);
+    }
+    _gemm_tuner.set_tune_new_kernels(ctx.config().use_tuner);
+    NEGEMMAssemblyDispatch::set_tuner(&_gemm_tuner);
+
+    // Load the convolution methods measured offline if available
+    if(file_exists(ctx.config().convolution_method_file))
+    {
+        _conv_method_table.load_from_file(ctx.config().convolution_method_file);
+        NEConvolutionLayer::set_method_table(&_conv_method_table);
+    }
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
+        const MemoryManagerAffinity affinity = ctx.config().use_interval_memory_planner ? MemoryManagerAffinity::Interval : MemoryManagerAffinity::Offset;
+
         MemoryManagerContext mm_ctx;
         mm_ctx.target      = Target::NEON;
-        mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
+        mm_ctx.intra_mm    = create_memory_manager(affinity);
+        mm_ctx.cross_mm    = create_memory_manager(affinity);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
 
@@ -131,8 +176,44 @@ std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &n
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring NEON node with ID : " << node.id() << std::endl);
     ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
 
+    if(!ctx.config().use_padding_free_kernels)
+    {
+        // Configure node
+        return NEFunctionFactory::create(&node, ctx);
+    }
+
+    // Record the tensors of the node that are not padded yet
+    std::vector<Tensor *> unpadded_tensors;
+    auto                  record_if_unpadded = [&](Tensor * tensor)
+    {
+        if(tensor != nullptr && tensor->handle() != nullptr && !tensor->handle()->is_subtensor() && tensor->handle()->tensor().info()->padding().empty())
+        {
+            unpadded_tensors.push_back(tensor);
+        }
+    };
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        record_if_unpadded(node.input(i));
+    }
+    for(size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        record_if_unpadded(node.output(i));
+    }
+
     // Configure node
-    return NEFunctionFactory::create(&node, ctx);
+    std::unique_ptr<arm_compute::IFunction> func = NEFunctionFactory::create(&node, ctx);
+
+    // Report the nodes that have no padding-free function
+    for(auto &tensor : unpadded_tensors)
+    {
+        if(!tensor->handle()->tensor().info()->padding().empty())
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Node " << node.name() << " (" << node.type() << ") cannot run padding-free: it pads tensor " << tensor->id()
+                                          << " by " << tensor->handle()->tensor().info()->padding() << std::endl);
+        }
+    }
+
+    return func;
 }
 
 arm_compute::Status NEDeviceBackend::validate_node(INode &node)
@@ -150,6 +231,10 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
     {
         lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
+    else if(affinity == MemoryManagerAffinity::Interval)
+    {
+        lifetime_mgr = std::make_shared<IntervalLifetimeManager>();
+    }
     else
     {
         lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
@@ -107,9 +107,26 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     }
 
     const PadStrideInfo       conv_info      = node.convolution_info();
-    const ConvolutionMethod   conv_algorithm = node.convolution_method();
+    ConvolutionMethod         conv_algorithm = node.convolution_method();
     const ActivationLayerInfo fused_act      = node.fused_activation();
 
+    // The direct convolution needs its input borders to be filled, the GEMM based one handles them in-kernel
+    if(ctx.config().use_padding_free_kernels && conv_algorithm == ConvolutionMethod::Direct)
+    {
+        const Status gemm_status = NEGEMMConvolutionLayer::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info,
+                                                                   WeightsInfo(), Size2D(1, 1), fused_act);
+        if(bool(gemm_status))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Node " << node.name() << ": replacing the requested direct convolution by a GEMM based one to avoid padding" << std::endl);
+            conv_algorithm = ConvolutionMethod::GEMM;
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Node " << node.name() << ": keeping the requested direct convolution, which pads its input, as the GEMM based one is not supported: "
+                                          << gemm_status.error_description() << std::endl);
+        }
+    }
+
     // Create and configure function (we assume that functions have been validated before creation)
     std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, Target::NEON);
     std::unique_ptr<IFunction>      func;
@@ -122,7 +139,7 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEGEMMConvolutionLayer>(
-                                        std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1, 1), fused_act);
+                                        std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info, node.weights_info(), Size2D(1, 1), fused_act);
     }
     else if(conv_algorithm == ConvolutionMethod::Winograd)
     {
@@ -186,6 +203,53 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return std::move(func);
 }
+
+/** Create a NEON resize layer function
+ *
+ * When the graph runs padding-free the NHWC scale kernel handles the out of bound accesses in-kernel,
+ * otherwise the generic resize layer (which fills the input borders) is created.
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend resize layer function
+ */
+std::unique_ptr<IFunction> create_resize_layer(ResizeLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input  = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *output = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+    const InterpolationPolicy policy = node.policy();
+
+    const bool use_padding = !ctx.config().use_padding_free_kernels
+                             || !bool(NEScale::validate(input->info(), output->info(), policy, BorderMode::CONSTANT, PixelValue(), SamplingPolicy::CENTER, false /* use_padding */));
+    if(use_padding)
+    {
+        return create_resize_layer<NEScale, NETargetInfo>(node);
+    }
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<NEScale>();
+    func->configure(input, output, policy, BorderMode::CONSTANT, PixelValue(), SamplingPolicy::CENTER, false /* use_padding */);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Interpolation: " << policy
+                               << " Padding-free"
+                               << std::endl);
+
+    return std::move(func);
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -222,6 +286,11 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::FusedConvolutionBatchNormalizationLayer:
             return detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node));
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::create_fused_depthwise_separable_convolution_layer<NEDepthwiseSeparableConvolutionLayer, NETargetInfo>(
+                       *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node), ctx);
+        case NodeType::FusedPointwiseLayer:
+            return detail::create_fused_pointwise_layer<NEFusedPointwiseLayer, NETargetInfo>(*polymorphic_downcast<FusedPointwiseNode *>(node));
         case NodeType::NormalizationLayer:
             return detail::create_normalization_layer<NENormalizationLayer, NETargetInfo>(*polymorphic_downcast<NormalizationLayerNode *>(node), ctx);
         case NodeType::PermuteLayer:
@@ -235,7 +304,7 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::ReshapeLayer:
             return detail::create_reshape_layer<NEReshapeLayer, NETargetInfo>(*polymorphic_downcast<ReshapeLayerNode *>(node));
         case NodeType::ResizeLayer:
-            return detail::create_resize_layer<NEScale, NETargetInfo>(*polymorphic_downcast<ResizeLayerNode *>(node));
+            return detail::create_resize_layer(*polymorphic_downcast<ResizeLayerNode *>(node), ctx);
         case NodeType::SoftmaxLayer:
             return detail::create_softmax_layer<NESoftmaxLayer, NETargetInfo>(*polymorphic_downcast<SoftmaxLayerNode *>(node), ctx);
         case NodeType::StackLayer:
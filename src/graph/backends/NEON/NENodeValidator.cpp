@@ -62,6 +62,10 @@ Status NENodeValidator::validate(INode *node)
                    NEDepthwiseConvolutionLayer3x3>(*polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
         case NodeType::DetectionOutputLayer:
             return detail::validate_detection_output_layer<CPPDetectionOutputLayer>(*polymorphic_downcast<DetectionOutputLayerNode *>(node));
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::validate_fused_depthwise_separable_convolution_layer<NEDepthwiseSeparableConvolutionLayer>(*polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node));
+        case NodeType::FusedPointwiseLayer:
+            return detail::validate_fused_pointwise_layer<NEFusedPointwiseLayer>(*polymorphic_downcast<FusedPointwiseNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : GenerateProposalsLayer");
         case NodeType::NormalizePlanarYUVLayer:
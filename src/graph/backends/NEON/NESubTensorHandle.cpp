@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,16 @@ Target NESubTensorHandle::target() const
 {
     return Target::NEON;
 }
+
+Status NESubTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Importing memory is not supported by sub-tensors");
+}
+
+void NESubTensorHandle::restore_memory()
+{
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
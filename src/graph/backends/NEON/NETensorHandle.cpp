@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 
 #include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "support/ToolchainSupport.h"
 
 namespace arm_compute
 {
@@ -33,19 +35,29 @@ namespace graph
 namespace backends
 {
 NETensorHandle::NETensorHandle(const ITensorInfo &info)
-    : _tensor()
+    : _tensor(), _memory(nullptr), _is_managed(false), _is_imported(false)
 {
     _tensor.allocator()->init(info);
 }
 
 void NETensorHandle::allocate()
 {
-    _tensor.allocator()->allocate();
+    if(_is_managed)
+    {
+        _tensor.allocator()->allocate();
+    }
+    else
+    {
+        // The allocator releases its own memory when importing a buffer, hence keep the memory in the handle to restore it
+        _memory = support::cpp14::make_unique<MemoryRegion>(_tensor.info()->total_size(), _tensor.allocator()->alignment());
+        ARM_COMPUTE_THROW_ON_ERROR(_tensor.allocator()->import_memory(_memory->buffer()));
+    }
 }
 
 void NETensorHandle::free()
 {
     _tensor.allocator()->free();
+    _memory.reset();
 }
 
 void NETensorHandle::manage(IMemoryGroup *mg)
@@ -54,6 +66,7 @@ void NETensorHandle::manage(IMemoryGroup *mg)
     {
         auto *ne_mg = arm_compute::utils::cast::polymorphic_downcast<MemoryGroup *>(mg);
         ne_mg->manage(&_tensor);
+        _is_managed = true;
     }
 }
 
@@ -71,7 +84,7 @@ void NETensorHandle::release_if_unused()
     // TODO (geopin01): Release tensor only if all sub-tensors are marked as not used
     if(!_tensor.is_used())
     {
-        _tensor.allocator()->free();
+        free();
     }
 }
 
@@ -99,6 +112,33 @@ Target NETensorHandle::target() const
 {
     return Target::NEON;
 }
+
+Status NETensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(_tensor.allocator()->import_memory(memory));
+    _is_imported = true;
+
+    return Status{};
+}
+
+void NETensorHandle::restore_memory()
+{
+    if(!_is_imported)
+    {
+        return;
+    }
+
+    if(_memory != nullptr)
+    {
+        ARM_COMPUTE_THROW_ON_ERROR(_tensor.allocator()->import_memory(_memory->buffer()));
+    }
+    else
+    {
+        // The memory of the tensor was released by the import: allocate it again
+        _tensor.allocator()->allocate();
+    }
+    _is_imported = false;
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
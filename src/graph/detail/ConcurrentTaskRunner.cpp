@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/ConcurrentTaskRunner.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+std::vector<SchedulerPartition> create_scheduler_partitions(unsigned int num_partitions, unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON(num_partitions == 0);
+    const unsigned int num_threads_per_partition = std::max(1u, num_threads / num_partitions);
+
+    std::vector<SchedulerPartition> partitions(num_partitions);
+
+    // Split the cores the active scheduler is pinned to between the partitions
+    const std::vector<unsigned int> &cpu_ids = Scheduler::get().affinity();
+    if(!cpu_ids.empty())
+    {
+        for(unsigned int p = 0; p < num_partitions; ++p)
+        {
+            for(unsigned int t = 0; t < num_threads_per_partition; ++t)
+            {
+                partitions[p].cpu_ids.push_back(cpu_ids[(p * num_threads_per_partition + t) % cpu_ids.size()]);
+            }
+        }
+    }
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    for(auto &partition : partitions)
+    {
+        partition.scheduler = support::cpp14::make_unique<CPPScheduler>();
+        partition.scheduler->set_num_threads(num_threads_per_partition);
+        partition.scheduler->set_wait_policy(Scheduler::get().wait_policy(), Scheduler::get().spin_count());
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    return partitions;
+}
+
+void bind_scheduler_partition(SchedulerPartition *partition)
+{
+    if(partition == nullptr)
+    {
+        Scheduler::set_thread_scheduler(nullptr);
+    }
+    else if(partition->scheduler != nullptr)
+    {
+        Scheduler::set_thread_scheduler(partition->scheduler.get());
+        // Pinning is applied to the calling thread too, hence has to be done from the thread using the partition
+        if(!partition->cpu_ids.empty())
+        {
+            partition->scheduler->set_affinity(partition->cpu_ids);
+        }
+    }
+}
+
+void configure_task_dependencies(Graph &g, ExecutionWorkload &workload, const std::vector<NodeID> &node_order)
+{
+    std::map<NodeID, size_t> node_to_task;
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(workload.tasks[i].node == nullptr);
+        node_to_task[workload.tasks[i].node->id()] = i;
+    }
+
+    // Tasks producing the outputs of each node
+    std::map<NodeID, std::set<size_t>> producers;
+    std::vector<std::set<size_t>>      predecessors(workload.tasks.size());
+
+    for(auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        // Collect the tasks producing the inputs of the node
+        std::set<size_t> input_producers;
+        for(auto &edge_id : node->input_edges())
+        {
+            const Edge *edge = g.edge(edge_id);
+            if(edge != nullptr && producers.find(edge->producer_id()) != std::end(producers))
+            {
+                const std::set<size_t> &edge_producers = producers[edge->producer_id()];
+                input_producers.insert(std::begin(edge_producers), std::end(edge_producers));
+            }
+        }
+
+        auto task_it = node_to_task.find(node_id);
+        if(task_it != std::end(node_to_task))
+        {
+            predecessors[task_it->second] = std::move(input_producers);
+            producers[node_id]            = { task_it->second };
+        }
+        else
+        {
+            // Nodes without a task forward the producers of their inputs
+            producers[node_id] = std::move(input_producers);
+        }
+    }
+
+    workload.dependencies.clear();
+    workload.dependencies.resize(workload.tasks.size());
+    for(size_t i = 0; i < predecessors.size(); ++i)
+    {
+        workload.dependencies[i].num_predecessors = predecessors[i].size();
+        for(auto &predecessor : predecessors[i])
+        {
+            workload.dependencies[predecessor].successors.push_back(i);
+        }
+    }
+}
+
+ConcurrentTaskRunner::ConcurrentTaskRunner(unsigned int num_lanes, unsigned int num_threads)
+    : _partitions(), _threads(), _m(), _cv(), _done_cv(), _workload(nullptr), _remaining_predecessors(), _ready_tasks(), _num_completed_tasks(0), _generation(0), _num_active_lanes(0), _exit(false),
+      _exception(nullptr)
+{
+    ARM_COMPUTE_ERROR_ON(num_lanes == 0);
+    _partitions = create_scheduler_partitions(num_lanes, num_threads);
+
+    for(unsigned int lane = 0; lane < num_lanes; ++lane)
+    {
+        _threads.emplace_back(&ConcurrentTaskRunner::lane_thread, this, lane);
+    }
+}
+
+ConcurrentTaskRunner::~ConcurrentTaskRunner()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _exit = true;
+    }
+    _cv.notify_all();
+    for(auto &thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+unsigned int ConcurrentTaskRunner::num_lanes() const
+{
+    return _threads.size();
+}
+
+void ConcurrentTaskRunner::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.dependencies.size() != workload.tasks.size());
+    if(workload.tasks.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _workload = &workload;
+        _remaining_predecessors.resize(workload.tasks.size());
+        _ready_tasks = decltype(_ready_tasks)();
+        for(size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            _remaining_predecessors[i] = workload.dependencies[i].num_predecessors;
+            if(_remaining_predecessors[i] == 0)
+            {
+                _ready_tasks.push(i);
+            }
+        }
+        _num_completed_tasks = 0;
+        _num_active_lanes    = _threads.size();
+        _exception           = nullptr;
+        ++_generation;
+    }
+    _cv.notify_all();
+
+    std::unique_lock<std::mutex> lock(_m);
+    _done_cv.wait(lock, [&] { return _num_active_lanes == 0; });
+    _workload = nullptr;
+
+    if(_exception)
+    {
+        std::rethrow_exception(_exception);
+    }
+}
+
+void ConcurrentTaskRunner::lane_thread(unsigned int lane)
+{
+    // Functions executed by this lane are scheduled on the lane's pool of threads
+    bind_scheduler_partition(&_partitions[lane]);
+
+    unsigned int last_generation = 0;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _cv.wait(lock, [&] { return _exit || _generation != last_generation; });
+            if(_exit)
+            {
+                break;
+            }
+            last_generation = _generation;
+        }
+
+        process_tasks();
+
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            --_num_active_lanes;
+        }
+        _done_cv.notify_one();
+    }
+
+    bind_scheduler_partition(nullptr);
+}
+
+void ConcurrentTaskRunner::process_tasks()
+{
+    std::unique_lock<std::mutex> lock(_m);
+    const size_t num_tasks = _workload->tasks.size();
+    while(true)
+    {
+        _cv.wait(lock, [&] { return !_ready_tasks.empty() || _num_completed_tasks == num_tasks || _exception; });
+        if(_num_completed_tasks == num_tasks || _exception)
+        {
+            return;
+        }
+
+        // Pick the ready task which comes first in topological order
+        const size_t task_index = _ready_tasks.top();
+        _ready_tasks.pop();
+        lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            _workload->tasks[task_index]();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            lock.lock();
+            _exception = std::current_exception();
+            lock.unlock();
+            _cv.notify_all();
+            return;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+        ++_num_completed_tasks;
+        for(auto &successor : _workload->dependencies[task_index].successors)
+        {
+            if(--_remaining_predecessors[successor] == 0)
+            {
+                _ready_tasks.push(successor);
+            }
+        }
+        _cv.notify_all();
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
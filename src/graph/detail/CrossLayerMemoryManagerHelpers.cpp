@@ -71,13 +71,18 @@ IMemoryGroup *get_memory_group_from_handle(GraphContext &ctx, ITensorHandle *han
 
 /** Get handles of const tensors of graph
  *
- * @param[in] g Graph
+ * @param[in] g         Graph
+ * @param[in] manage_io Don't consider the input and output tensors of the graph as const
  *
  * @return Handles of const tensors of graph
  */
-std::set<ITensorHandle *> get_const_handles(const Graph &g)
+std::set<ITensorHandle *> get_const_handles(const Graph &g, bool manage_io)
 {
     std::set<NodeType> const_node_types = { NodeType::Input, NodeType::Output, NodeType::Const };
+    if(manage_io)
+    {
+        const_node_types = { NodeType::Const };
+    }
 
     std::set<ITensorHandle *> const_tensors;
 
@@ -232,14 +237,26 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
 }
 } // namespace
 
-void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload)
+void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload, bool manage_io)
 {
     // Get const tensors (un-managed)
-    std::set<ITensorHandle *> const_tensors = get_const_handles(g);
+    std::set<ITensorHandle *> const_tensors = get_const_handles(g, manage_io);
 
     std::vector<TaskHandles> tasks_handles;
     TargetHandleCounter      target_handle_count;
 
+    // Inputs are in flight before the first task
+    if(manage_io)
+    {
+        TaskHandles input_handles;
+        for(auto &input : workload.inputs)
+        {
+            ITensorHandle *tensor_handle = input->handle()->parent_handle();
+            input_handles.output_handles.emplace_back(std::make_pair(tensor_handle, get_memory_group_from_handle(ctx, tensor_handle)));
+        }
+        tasks_handles.push_back(std::move(input_handles));
+    }
+
     // Count handles
     for(auto &task : workload.tasks)
     {
@@ -250,6 +267,19 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         count_input_handles_per_target(tasks_handles.back(), target_handle_count);
     }
 
+    // Outputs are in flight until after the last task
+    if(manage_io)
+    {
+        TaskHandles output_handles;
+        for(auto &output : workload.outputs)
+        {
+            ITensorHandle *tensor_handle = output->handle()->parent_handle();
+            output_handles.input_handles.emplace_back(std::make_pair(tensor_handle, get_memory_group_from_handle(ctx, tensor_handle)));
+        }
+        count_input_handles_per_target(output_handles, target_handle_count);
+        tasks_handles.push_back(std::move(output_handles));
+    }
+
     // Setup memory managers
     for(auto &hc : target_handle_count)
     {
@@ -26,8 +26,11 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/ConcurrentTaskRunner.h"
 
 namespace arm_compute
 {
@@ -172,6 +175,25 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+unsigned int report_padded_tensors(Graph &g)
+{
+    unsigned int num_padded = 0;
+    for(auto &tensor : g.tensors())
+    {
+        // Sub-tensors share the padding of their parent
+        if(tensor && tensor->handle() != nullptr && !tensor->handle()->is_subtensor())
+        {
+            const PaddingSize padding = tensor->handle()->tensor().info()->padding();
+            if(!padding.empty())
+            {
+                ARM_COMPUTE_LOG_GRAPH_WARNING("Tensor " << tensor->id() << " requires padding " << padding << std::endl);
+                ++num_padded;
+            }
+        }
+    }
+    return num_padded;
+}
+
 void release_unused_tensors(Graph &g)
 {
     for(auto &tensor : g.tensors())
@@ -237,9 +259,16 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+    if(workload.runner != nullptr)
     {
-        task();
+        workload.runner->run(workload);
+    }
+    else
+    {
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
     }
 
     // Release memory for the transition buffers
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/MultiStreamRunner.h"
+
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <thread>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Returns the parent handles of the input and output tensors of a task
+ *
+ * @param[in] task Task to get the tensors of
+ *
+ * @return Parent handles of the tensors used by the task
+ */
+std::vector<ITensorHandle *> get_task_handles(ExecutionTask &task)
+{
+    ARM_COMPUTE_ERROR_ON(task.node == nullptr);
+    std::vector<ITensorHandle *> handles;
+    for(unsigned int i = 0; i < task.node->num_inputs(); ++i)
+    {
+        Tensor *tensor = task.node->input(i);
+        if(tensor != nullptr && tensor->handle() != nullptr)
+        {
+            handles.push_back(tensor->handle()->parent_handle());
+        }
+    }
+    for(unsigned int i = 0; i < task.node->num_outputs(); ++i)
+    {
+        Tensor *tensor = task.node->output(i);
+        if(tensor != nullptr && tensor->handle() != nullptr)
+        {
+            handles.push_back(tensor->handle()->parent_handle());
+        }
+    }
+    return handles;
+}
+} // namespace
+
+class MultiStreamRunner::BindingScope
+{
+public:
+    /** Constructor: locks the tensors of the binding and binds them to the given pool
+     *
+     * @param[in] runner  Runner owning the mutexes
+     * @param[in] binding Binding to acquire
+     * @param[in] pool    Pool to bind the tensors to
+     */
+    BindingScope(MultiStreamRunner &runner, Binding &binding, IMemoryPool &pool)
+        : _runner(runner), _binding(binding)
+    {
+        for(auto &lock : _binding.locks)
+        {
+            _runner._mutexes[lock].lock();
+        }
+        if(!_binding.mappings.empty())
+        {
+            pool.acquire(_binding.mappings);
+        }
+    }
+    /** Prevent instances of this class from being copied */
+    BindingScope(const BindingScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    BindingScope &operator=(const BindingScope &) = delete;
+    /** Destructor: unlocks the tensors of the binding */
+    ~BindingScope()
+    {
+        for(auto it = _binding.locks.rbegin(); it != _binding.locks.rend(); ++it)
+        {
+            _runner._mutexes[*it].unlock();
+        }
+    }
+
+private:
+    MultiStreamRunner &_runner;
+    Binding           &_binding;
+};
+
+MultiStreamRunner::MultiStreamRunner(ExecutionWorkload &workload, unsigned int num_streams, unsigned int num_threads)
+    : _pool_manager(nullptr), _partitions(), _input_bindings(), _task_bindings(), _output_bindings(), _mutexes(), _input_mutex(), _sequence_mutex(), _sequence_cv(),
+      _next_input_sequence(0), _next_output_sequence(0), _stop_sequence(0), _exception(nullptr)
+{
+    ARM_COMPUTE_ERROR_ON(num_streams == 0);
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr || workload.tasks.empty() || workload.tasks.front().node == nullptr);
+
+    MemoryManagerContext *mm_ctx = workload.ctx->memory_management_ctx(workload.tasks.front().node->assigned_target());
+    ARM_COMPUTE_ERROR_ON_MSG(mm_ctx == nullptr || mm_ctx->cross_mm == nullptr || mm_ctx->cross_group == nullptr, "Streams need a cross-layer memory manager");
+    _pool_manager = mm_ctx->cross_mm->pool_manager();
+    ARM_COMPUTE_ERROR_ON(_pool_manager == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_pool_manager->num_pools() < num_streams, "Streams need a pool each");
+
+    // Collect the tensors used together
+    std::vector<std::vector<ITensorHandle *>> input_handles;
+    std::vector<std::vector<ITensorHandle *>> task_handles;
+    std::vector<std::vector<ITensorHandle *>> output_handles;
+    for(auto &input : workload.inputs)
+    {
+        input_handles.emplace_back();
+        if(input != nullptr && input->handle() != nullptr)
+        {
+            input_handles.back().push_back(input->handle()->parent_handle());
+        }
+    }
+    for(auto &task : workload.tasks)
+    {
+        task_handles.push_back(get_task_handles(task));
+    }
+    for(auto &output : workload.outputs)
+    {
+        output_handles.emplace_back();
+        if(output != nullptr && output->handle() != nullptr)
+        {
+            output_handles.back().push_back(output->handle()->parent_handle());
+        }
+    }
+
+    std::map<ITensorHandle *, size_t> handle_ids;
+    for(auto *group : { &input_handles, &task_handles, &output_handles })
+    {
+        for(auto &handles : *group)
+        {
+            for(auto &handle : handles)
+            {
+                handle_ids.emplace(handle, handle_ids.size());
+            }
+        }
+    }
+
+    // The memory mappings of the transition buffers are indexed by the memory objects backing the managed tensors:
+    // take the memory object of each tensor from the plan of the lifetime manager.
+    const auto *lifetime_mgr = dynamic_cast<const ISimpleLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+    ARM_COMPUTE_ERROR_ON_MSG(lifetime_mgr == nullptr, "Streams need a lifetime manager planning the memory of each tensor");
+    const MemoryMappings &mappings = mm_ctx->cross_group->mappings();
+
+    std::map<ITensorHandle *, std::pair<IMemory *, size_t>> handle_mappings;
+    for(auto &handle_id : handle_ids)
+    {
+        IMemory *memory = lifetime_mgr->finalized_memory(mm_ctx->cross_group.get(), static_cast<void *>(&handle_id.first->tensor()));
+        auto     mapping = mappings.find(memory);
+        if(mapping != std::end(mappings))
+        {
+            handle_mappings.emplace(handle_id.first, *mapping);
+        }
+    }
+
+    // Create the bindings: a task holds its own mutex and the ones of its managed tensors
+    const size_t num_tasks       = workload.tasks.size();
+    auto         create_bindings = [&](const std::vector<std::vector<ITensorHandle *>> &groups, bool is_task)
+    {
+        std::vector<Binding> bindings(groups.size());
+        for(size_t i = 0; i < groups.size(); ++i)
+        {
+            if(is_task)
+            {
+                bindings[i].locks.push_back(i);
+            }
+            for(auto &handle : groups[i])
+            {
+                auto mapping = handle_mappings.find(handle);
+                if(mapping != std::end(handle_mappings))
+                {
+                    bindings[i].mappings.insert(mapping->second);
+                    bindings[i].locks.push_back(num_tasks + handle_ids[handle]);
+                }
+            }
+            // Always lock in the same order to prevent deadlocks
+            std::sort(bindings[i].locks.begin(), bindings[i].locks.end());
+            bindings[i].locks.erase(std::unique(bindings[i].locks.begin(), bindings[i].locks.end()), bindings[i].locks.end());
+        }
+        return bindings;
+    };
+    _input_bindings  = create_bindings(input_handles, false);
+    _task_bindings   = create_bindings(task_handles, true);
+    _output_bindings = create_bindings(output_handles, false);
+
+    std::vector<std::mutex> mutexes(num_tasks + handle_ids.size());
+    _mutexes.swap(mutexes);
+
+    _partitions = create_scheduler_partitions(num_streams, num_threads);
+}
+
+unsigned int MultiStreamRunner::num_streams() const
+{
+    return _partitions.size();
+}
+
+void MultiStreamRunner::run(ExecutionWorkload &workload)
+{
+    _next_input_sequence  = 0;
+    _next_output_sequence = 0;
+    _stop_sequence        = std::numeric_limits<unsigned int>::max();
+    _exception            = nullptr;
+
+    std::vector<std::thread> threads;
+    for(unsigned int stream = 0; stream < _partitions.size(); ++stream)
+    {
+        threads.emplace_back(&MultiStreamRunner::stream_thread, this, std::ref(workload), stream);
+    }
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    if(_exception)
+    {
+        std::rethrow_exception(_exception);
+    }
+}
+
+void MultiStreamRunner::stream_thread(ExecutionWorkload &workload, unsigned int stream)
+{
+    // Functions executed by this stream are scheduled on the stream's pool of threads
+    bind_scheduler_partition(&_partitions[stream]);
+
+    IMemoryPool *pool = _pool_manager->lock_pool();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        process_inferences(workload, *pool);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sequence_mutex);
+            if(!_exception)
+            {
+                _exception = std::current_exception();
+            }
+        }
+        // Stop all the inferences, including the ones waiting to call their output accessors
+        stop_at(0);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    _pool_manager->unlock_pool(pool);
+
+    bind_scheduler_partition(nullptr);
+}
+
+void MultiStreamRunner::stop_at(unsigned int sequence)
+{
+    {
+        std::lock_guard<std::mutex> lock(_sequence_mutex);
+        _stop_sequence = std::min(_stop_sequence, sequence);
+    }
+    _sequence_cv.notify_all();
+}
+
+void MultiStreamRunner::process_inferences(ExecutionWorkload &workload, IMemoryPool &pool)
+{
+    while(true)
+    {
+        unsigned int sequence = 0;
+
+        // Call input accessors: the inferences read their inputs one after the other and are numbered in that order
+        {
+            std::lock_guard<std::mutex> input_lock(_input_mutex);
+            {
+                std::lock_guard<std::mutex> lock(_sequence_mutex);
+                if(_next_input_sequence >= _stop_sequence)
+                {
+                    return;
+                }
+                sequence = _next_input_sequence++;
+            }
+
+            bool is_valid = true;
+            for(size_t i = 0; i < workload.inputs.size(); ++i)
+            {
+                BindingScope scope(*this, _input_bindings[i], pool);
+                bool         valid_input = (workload.inputs[i] != nullptr) && workload.inputs[i]->call_accessor();
+                is_valid                 = is_valid && valid_input;
+            }
+            if(!is_valid)
+            {
+                stop_at(sequence);
+                return;
+            }
+        }
+
+        // Run graph
+        for(size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            BindingScope scope(*this, _task_bindings[i], pool);
+            workload.tasks[i]();
+        }
+
+        // Wait for the previous inferences to call their output accessors so that outputs are returned in the order the inputs were read
+        {
+            std::unique_lock<std::mutex> lock(_sequence_mutex);
+            _sequence_cv.wait(lock, [&]()
+            {
+                return (_next_output_sequence == sequence) || (sequence >= _stop_sequence);
+            });
+            if(sequence >= _stop_sequence)
+            {
+                return;
+            }
+        }
+
+        // Call output accessors
+        bool is_valid = true;
+        for(size_t i = 0; i < workload.outputs.size(); ++i)
+        {
+            BindingScope scope(*this, _output_bindings[i], pool);
+            bool         valid_output = (workload.outputs[i] != nullptr) && workload.outputs[i]->call_accessor();
+            is_valid                  = is_valid && valid_output;
+        }
+        {
+            // The following inferences, which may have already read their inputs, are dropped
+            std::lock_guard<std::mutex> lock(_sequence_mutex);
+            ++_next_output_sequence;
+            if(!is_valid)
+            {
+                _stop_sequence = std::min(_stop_sequence, sequence + 1);
+            }
+        }
+        _sequence_cv.notify_all();
+        if(!is_valid)
+        {
+            return;
+        }
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/graph/frontend/Stream.h"
 
+#include "arm_compute/graph/GraphSerializer.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/frontend/ILayer.h"
 
@@ -44,11 +45,39 @@ void Stream::finalize(Target target, const GraphConfig &config)
     _manager.finalize_graph(_g, _ctx, pm, target);
 }
 
+void Stream::restore(Target target, const GraphConfig &config, const std::string &filename)
+{
+    ARM_COMPUTE_THROW_ON_ERROR(deserialize_graph(_g, filename));
+
+    // The constant tensors are mapped from the file, it must not be overwritten
+    GraphConfig restore_config           = config;
+    restore_config.serialized_graph_file = std::string();
+
+    PassManager pm = create_restore_pass_manager(target);
+    _ctx.set_config(restore_config);
+    _manager.finalize_graph(_g, _ctx, pm, target);
+}
+
 void Stream::run()
 {
     _manager.execute_graph(_g);
 }
 
+void Stream::run(const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs)
+{
+    _manager.execute_graph(_g, inputs, outputs);
+}
+
+Status Stream::validate_external_buffers(const std::vector<ExternalBuffer> &inputs, const std::vector<ExternalBuffer> &outputs)
+{
+    return _manager.validate_external_buffers(_g, inputs, outputs);
+}
+
+void Stream::set_profiler(std::shared_ptr<GraphProfiler> profiler)
+{
+    _manager.set_profiler(_g, std::move(profiler));
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -37,7 +37,7 @@ const char *InPlaceOperationMutator::name()
 
 void InPlaceOperationMutator::mutate(Graph &g)
 {
-    std::set<NodeType> in_place_nodes = { NodeType::BatchNormalizationLayer, NodeType::ActivationLayer };
+    std::set<NodeType> in_place_nodes = { NodeType::BatchNormalizationLayer, NodeType::ActivationLayer, NodeType::FusedPointwiseLayer };
 
     // Not interested in the order of nodes
     for(auto &node : g.nodes())
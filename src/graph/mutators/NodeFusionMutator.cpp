@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/nodes/FusedDepthwiseSeparableConvolutionNode.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
 #include "arm_compute/core/utils/misc/Cast.h"
@@ -125,6 +126,92 @@ void fuse_convolution_with_batch_normalization(Graph &g, const Edge *output_edge
     }
 }
 
+void fuse_depthwise_convolution_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *dwc_node  = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(output_edge->producer());
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->consumer());
+
+    // Only fuse 1x1 non-grouped convolutions with unit strides and no padding
+    const Tensor       *conv_weights = conv_node->input(1);
+    const PadStrideInfo conv_info    = conv_node->convolution_info();
+    if(conv_weights == nullptr || conv_node->num_groups() > 1 || conv_info.has_padding() || conv_info.stride() != std::make_pair(1U, 1U)
+       || get_dimension_size(conv_weights->desc(), DataLayoutDimension::WIDTH) != 1 || get_dimension_size(conv_weights->desc(), DataLayoutDimension::HEIGHT) != 1)
+    {
+        return;
+    }
+
+    // The pointwise convolution must run on the same target
+    if(conv_node->assigned_target() != dwc_node->assigned_target())
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : " << output_edge->producer_id()
+                                  << " with Convolution Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if the depthwise output has an accessor
+    if(dwc_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = dwc_node->assigned_target();
+
+        // Extract depthwise inputs
+        const auto dwc_input_id   = dwc_node->input_edge(0)->producer_id();
+        const auto dwc_weights_id = dwc_node->input_edge(1)->producer_id();
+        const auto dwc_info       = dwc_node->convolution_info();
+        const auto dwc_act_info   = dwc_node->fused_activation();
+
+        // Extract pointwise inputs
+        const auto conv_weights_id = conv_node->input_edge(1)->producer_id();
+        const auto conv_act_info   = conv_node->fused_activation();
+        const auto out_quant_info  = conv_node->output(0)->desc().quant_info;
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<FusedDepthwiseSeparableConvolutionNode>(dwc_info, conv_info, dwc_act_info, conv_act_info, out_quant_info);
+
+        // Add connections from the depthwise/pointwise inputs to the fused node
+        g.add_connection(dwc_input_id, 0, fused_id, 0);
+        g.add_connection(dwc_weights_id, 0, fused_id, 1);
+        if(dwc_node->input_edge(2) != nullptr)
+        {
+            g.add_connection(dwc_node->input_edge(2)->producer_id(), 0, fused_id, 2);
+        }
+        g.add_connection(conv_weights_id, 0, fused_id, 3);
+        if(conv_node->input_edge(2) != nullptr)
+        {
+            g.add_connection(conv_node->input_edge(2)->producer_id(), 0, fused_id, 4);
+        }
+
+        auto                     fused_node         = g.node(fused_id);
+        std::vector<NodeIdxPair> conv_driving_nodes = get_driving_nodes(*conv_node);
+
+        // Extract convolution node accessor if any
+        auto conv_node_accessor = conv_node->output(0)->extract_accessor();
+        auto conv_node_name     = conv_node->name();
+
+        // Remove convolution node
+        g.remove_node(conv_node->id());
+
+        // Update fused node outputs
+        for(auto &driving_node : conv_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        fused_node->output(0)->set_accessor(std::move(conv_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ dwc_node->name() + "+" + conv_node_name, assigned_target });
+
+        // Remove depthwise convolution node
+        g.remove_node(dwc_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of depthwise convolution with convolution due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set<Activation> &supported_fused_activations)
 {
@@ -177,9 +264,11 @@ void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set
 template <typename N1, typename N2, typename F, typename... Args>
 void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse_fcn, Args &&... optional_arguments)
 {
-    // Not interested in the order of nodes
-    for(auto &node : g.nodes())
+    // Not interested in the order of nodes, iterate over indices as fusion functions may add nodes to the graph
+    for(size_t i = 0; i < g.nodes().size(); ++i)
     {
+        auto &node = g.nodes()[i];
+
         // Check if the node is of type N and not a branching node
         if(node && node->type() == N1::node_type && node->output_edges().size() == 1)
         {
@@ -219,15 +308,25 @@ void NodeFusionMutator::mutate(Graph &g)
         const auto output_edge    = g.edge(output_edge_id);
         // To perform fusion the two nodes must have same output quantization information
         const bool same_qinfo     = n.output(0)->desc().quant_info == output_edge->producer()->output(0)->desc().quant_info;
-        const bool output_qasymm8 = n.output(0)->desc().data_type == DataType::QASYMM8;
+        const bool output_qasymm8 = is_data_type_quantized_asymmetric(n.output(0)->desc().data_type);
 
         return (output_qasymm8 && same_qinfo) || !output_qasymm8;
     };
+    auto dwc_pointwise_prec = [](INode & n)
+    {
+        ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
+
+        // Only the NEON backend provides a fused depthwise separable convolution, for NHWC floating point tensors
+        const auto *dwc_node = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(&n);
+        const auto &desc     = n.output(0)->desc();
+        return n.assigned_target() == Target::NEON && dwc_node->depth_multiplier() == 1 && desc.layout == DataLayout::NHWC && is_data_type_float(desc.data_type);
+    };
 
     // Fusion mutations
     detail::fuse_layer<BatchNormalizationLayerNode, ActivationLayerNode>(g, empty_prec, detail::fuse_node_with_activation<BatchNormalizationLayerNode>, supported_fused_activations);
     detail::fuse_layer<ConvolutionLayerNode, ActivationLayerNode>(g, empty_prec, detail::fuse_node_with_activation<ConvolutionLayerNode>, supported_fused_activations);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, ActivationLayerNode>(g, qs8_prec, detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>, supported_fused_activations);
+    detail::fuse_layer<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>(g, dwc_pointwise_prec, detail::fuse_depthwise_convolution_with_pointwise_convolution);
 
     // TODO (COMPMID-2055): re-enable once we fuse bias and activations to convolution
     // detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(g, empty_prec, detail::fuse_convolution_with_batch_normalization);
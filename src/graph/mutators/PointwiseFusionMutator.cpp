@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PointwiseFusionMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks if a node can be part of a fused chain of pointwise operations
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node can be fused else false
+ */
+bool is_fusable_pointwise_node(const INode &node)
+{
+    const NodeType type = node.type();
+    if(type != NodeType::ActivationLayer && type != NodeType::BatchNormalizationLayer && type != NodeType::EltwiseLayer)
+    {
+        return false;
+    }
+
+    // Only the NEON backend provides a fused pointwise function, for F32 tensors
+    const Tensor *input  = node.input(0);
+    const Tensor *output = node.output(0);
+    if(node.assigned_target() != Target::NEON || node.num_outputs() != 1 || input == nullptr || output == nullptr)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &desc = output->desc();
+    if(desc.data_type != DataType::F32 || input->desc().data_type != desc.data_type || input->desc().shape != desc.shape || input->desc().layout != desc.layout)
+    {
+        return false;
+    }
+
+    if(type == NodeType::BatchNormalizationLayer)
+    {
+        return (node.input(1) != nullptr) && (node.input(2) != nullptr);
+    }
+    else if(type == NodeType::EltwiseLayer)
+    {
+        // Broadcasting is not supported
+        const Tensor *other = node.input(1);
+        return (other != nullptr) && (other->desc().data_type == desc.data_type) && (other->desc().shape == desc.shape) && (other->desc().layout == desc.layout);
+    }
+    return true;
+}
+
+/** Returns the edge linking a node to the next node of a chain of pointwise operations
+ *
+ * @param[in] g    Graph the node belongs to
+ * @param[in] node Node to get the link of
+ *
+ * @return The link edge if the next node can be fused with @p node else nullptr
+ */
+const Edge *chain_link(const Graph &g, const INode &node)
+{
+    // Intermediate results must have a single consumer and no accessor as they are not computed anymore
+    if(!is_fusable_pointwise_node(node) || node.output_edges().size() != 1 || node.output(0)->accessor() != nullptr)
+    {
+        return nullptr;
+    }
+
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    return ((edge != nullptr) && (edge->consumer() != nullptr) && is_fusable_pointwise_node(*edge->consumer())) ? edge : nullptr;
+}
+
+/** Checks if a node is the first node of a chain of pointwise operations
+ *
+ * @param[in] g    Graph the node belongs to
+ * @param[in] node Node to check
+ *
+ * @return True if none of the producers of @p node can be fused with it
+ */
+bool is_chain_head(const Graph &g, const INode &node)
+{
+    const size_t num_value_inputs = (node.type() == NodeType::EltwiseLayer) ? 2 : 1;
+    for(size_t i = 0; i < num_value_inputs; ++i)
+    {
+        const Edge *input_edge = node.input_edge(i);
+        if((input_edge != nullptr) && (input_edge->producer() != nullptr) && (chain_link(g, *input_edge->producer()) != nullptr))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Appends the operations of a node to a fused chain
+ *
+ * @param[in]      node       Node to append
+ * @param[in]      value_idx  Index of the input of @p node that receives the result of the chain
+ * @param[in, out] operations Operations of the chain
+ * @param[in, out] operands   Operands of the chain. Operands that are not connected are @ref EmptyNodeID
+ */
+void append_operations(const INode &node, size_t value_idx, std::vector<PointwiseOperation> &operations, std::vector<NodeIdxPair> &operands)
+{
+    using Type = PointwiseOperation::Type;
+
+    auto append_operand = [&](size_t idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        operands.push_back((edge != nullptr) ? NodeIdxPair{ edge->producer_id(), edge->producer_idx() } : NodeIdxPair{ EmptyNodeID, 0 });
+    };
+
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        {
+            const auto *act_node = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node);
+            operations.emplace_back(act_node->activation_info());
+            break;
+        }
+        case NodeType::BatchNormalizationLayer:
+        {
+            const auto *bn_node = arm_compute::utils::cast::polymorphic_downcast<const BatchNormalizationLayerNode *>(&node);
+            operations.emplace_back(Type::BATCH_NORMALIZATION, operands.size(), bn_node->epsilon());
+            for(size_t idx = 1; idx <= 4; ++idx)
+            {
+                append_operand(idx);
+            }
+            if(bn_node->fused_activation().enabled())
+            {
+                operations.emplace_back(bn_node->fused_activation());
+            }
+            break;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            switch(eltwise_node->eltwise_operation())
+            {
+                case EltwiseOperation::Add:
+                    operations.emplace_back(Type::ADD, operands.size());
+                    break;
+                case EltwiseOperation::Sub:
+                    operations.emplace_back((value_idx == 0) ? Type::SUB : Type::REVERSE_SUB, operands.size());
+                    break;
+                case EltwiseOperation::Mul:
+                    operations.emplace_back(Type::MUL, operands.size());
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported eltwise operation");
+            }
+            append_operand(1 - value_idx);
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported pointwise node");
+    }
+}
+
+/** Replaces a chain of pointwise nodes with a fused pointwise node
+ *
+ * @param[in, out] g     Graph to mutate
+ * @param[in]      chain Nodes of the chain paired with the index of the input that receives the result of the chain
+ */
+void fuse_pointwise_chain(Graph &g, const std::vector<std::pair<INode *, size_t>> &chain)
+{
+    INode *head = chain.front().first;
+    INode *tail = chain.back().first;
+
+    // Collect the operations and operands of the chain
+    std::vector<PointwiseOperation> operations;
+    std::vector<NodeIdxPair>        operands;
+    std::string                     name;
+    for(const auto &link : chain)
+    {
+        append_operations(*link.first, link.second, operations, operands);
+        name += (name.empty() ? "" : "+") + link.first->name();
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing chain of " << chain.size() << " pointwise nodes starting at node with ID : " << head->id()
+                                  << " and ending at node with ID : " << tail->id() << std::endl);
+
+    const Target assigned_target = head->assigned_target();
+    const Edge  *input_edge      = head->input_edge(0);
+    const NodeID input_id        = input_edge->producer_id();
+    const size_t input_idx       = input_edge->producer_idx();
+
+    // Create the fused node and connect its inputs
+    const NodeID fused_id = g.add_node<FusedPointwiseNode>(operations, operands.size());
+    g.add_connection(input_id, input_idx, fused_id, 0);
+    for(size_t i = 0; i < operands.size(); ++i)
+    {
+        if(operands[i].node_id != EmptyNodeID)
+        {
+            g.add_connection(operands[i].node_id, operands[i].index, fused_id, 1 + i);
+        }
+    }
+
+    // Extract the outputs of the chain
+    std::vector<NodeIdxPair> tail_driving_nodes = get_driving_nodes(*tail);
+    auto                     tail_accessor      = tail->output(0)->extract_accessor();
+
+    // Remove the chain
+    for(const auto &link : chain)
+    {
+        g.remove_node(link.first->id());
+    }
+
+    // Update fused node outputs
+    INode *fused_node = g.node(fused_id);
+    for(auto &driving_node : tail_driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    configure_tensor(fused_node->output(0));
+    fused_node->output(0)->set_accessor(std::move(tail_accessor));
+    fused_node->set_assigned_target(assigned_target);
+    fused_node->set_common_node_parameters(NodeParams{ name, assigned_target });
+}
+} // namespace
+
+const char *PointwiseFusionMutator::name()
+{
+    return "PointwiseFusionMutator";
+}
+
+void PointwiseFusionMutator::mutate(Graph &g)
+{
+    // Not interested in the order of nodes, iterate over indices as fusions add nodes to the graph
+    for(size_t i = 0; i < g.nodes().size(); ++i)
+    {
+        INode *node = g.node(i);
+        if(node == nullptr || !is_fusable_pointwise_node(*node) || node->input_edge(0) == nullptr || !is_chain_head(g, *node))
+        {
+            continue;
+        }
+
+        // Follow the chain starting at the node
+        std::vector<std::pair<INode *, size_t>> chain{ std::make_pair(node, size_t(0)) };
+        for(const Edge *link = chain_link(g, *node); link != nullptr; link = chain_link(g, *link->consumer()))
+        {
+            chain.emplace_back(link->consumer(), link->consumer_idx());
+        }
+
+        // Single nodes are better served by their own functions
+        if(chain.size() > 1)
+        {
+            fuse_pointwise_chain(g, chain);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
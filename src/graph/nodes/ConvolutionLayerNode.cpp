@@ -36,8 +36,9 @@ ConvolutionLayerNode::ConvolutionLayerNode(PadStrideInfo     info,
                                            unsigned int      num_groups,
                                            ConvolutionMethod method,
                                            FastMathHint      fast_math_hint,
-                                           QuantizationInfo  out_quant_info)
-    : _info(std::move(info)), _num_groups(num_groups), _method(method), _fast_math_hint(fast_math_hint), _out_quant_info(out_quant_info), _fused_activation()
+                                           QuantizationInfo  out_quant_info,
+                                           WeightsInfo       weights_info)
+    : _info(std::move(info)), _num_groups(num_groups), _method(method), _fast_math_hint(fast_math_hint), _out_quant_info(out_quant_info), _fused_activation(), _weights_info(weights_info)
 {
     _input_edges.resize(3, EmptyEdgeID);
     _outputs.resize(1, NullTensorID);
@@ -83,6 +84,11 @@ void ConvolutionLayerNode::set_fused_activation(ActivationLayerInfo fused_activa
     _fused_activation = fused_activation;
 }
 
+WeightsInfo ConvolutionLayerNode::weights_info() const
+{
+    return _weights_info;
+}
+
 TensorDescriptor ConvolutionLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                  const TensorDescriptor &weights_descriptor,
                                                                  const PadStrideInfo    &info)
@@ -126,7 +132,17 @@ TensorDescriptor ConvolutionLayerNode::configure_output(size_t idx) const
 
     ARM_COMPUTE_ERROR_ON(src == nullptr || weights == nullptr);
 
-    TensorDescriptor output_info = compute_output_descriptor(src->desc(), weights->desc(), _info);
+    // Reshaped weights are a [OFM, kernel_x * kernel_y * IFM] matrix, the kernel size and number of kernels are held by the weights information
+    TensorDescriptor weights_desc = weights->desc();
+    if(_weights_info.are_reshaped())
+    {
+        weights_desc.layout = src->desc().layout;
+        weights_desc.shape  = TensorShape(1U, 1U, 1U, _weights_info.num_kernels());
+        weights_desc.shape.set(get_dimension_idx(weights_desc.layout, DataLayoutDimension::WIDTH), _weights_info.kernel_size().first);
+        weights_desc.shape.set(get_dimension_idx(weights_desc.layout, DataLayoutDimension::HEIGHT), _weights_info.kernel_size().second);
+    }
+
+    TensorDescriptor output_info = compute_output_descriptor(src->desc(), weights_desc, _info);
     if(!_out_quant_info.empty())
     {
         output_info.quant_info = _out_quant_info;
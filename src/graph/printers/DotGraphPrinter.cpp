@@ -85,6 +85,21 @@ void DotGraphVisitor::visit(FusedConvolutionBatchNormalizationNode &n)
     _info = ss.str();
 }
 
+void DotGraphVisitor::visit(FusedDepthwiseSeparableConvolutionNode &n)
+{
+    ARM_COMPUTE_UNUSED(n);
+    std::stringstream ss;
+    ss << "FusedDepthwiseSeparableConvolutionNode";
+    _info = ss.str();
+}
+
+void DotGraphVisitor::visit(FusedPointwiseNode &n)
+{
+    std::stringstream ss;
+    ss << "FusedPointwiseNode (" << n.operations().size() << " operations)";
+    _info = ss.str();
+}
+
 void DotGraphVisitor::visit(NormalizationLayerNode &n)
 {
     std::stringstream ss;
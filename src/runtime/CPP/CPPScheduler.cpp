@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2018 ARM Limited.
+ * Copyright (c) 2016-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,6 +88,39 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
     while(feeder.get_next(workload_index));
 }
 
+/** Hint the CPU that the calling thread is busy-waiting. */
+inline void cpu_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::
+                             : "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__("pause" ::
+                             : "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+}
+
+/** Busy-wait until the condition becomes true or the number of iterations is exhausted.
+ *
+ * @param[in] condition  Condition to poll.
+ * @param[in] spin_count Maximum number of times the condition is polled.
+ *
+ * @return True if the condition became true before the end of the spin budget.
+ */
+template <typename Condition>
+bool spin_wait(Condition &&condition, unsigned int spin_count)
+{
+    for(unsigned int i = 0; i < spin_count; ++i)
+    {
+        if(condition())
+        {
+            return true;
+        }
+        cpu_relax();
+    }
+    return false;
+}
+
 } //namespace
 
 class CPPScheduler::Thread
@@ -117,6 +150,20 @@ public:
     /** Wait for the current kernel execution to complete. */
     void wait();
 
+    /** Set the number of busy-wait iterations done before blocking on the condition variable.
+     *
+     * @param[in] spin_count Number of iterations, 0 to block straight away.
+     */
+    void set_spin_count(unsigned int spin_count);
+
+    /** Set the core the worker thread must run on.
+     *
+     * @note The new affinity is applied by the worker thread itself before it runs its next workloads.
+     *
+     * @param[in] cpu_id Id of the core to pin the thread to, negative to give the thread the affinity it was created with back.
+     */
+    void set_cpu_id(int cpu_id);
+
     /** Function ran by the worker thread. */
     void worker_thread();
 
@@ -128,7 +175,12 @@ private:
     std::mutex                         _m{};
     std::condition_variable            _cv{};
     bool                               _wait_for_work{ false };
-    bool                               _job_complete{ true };
+    bool                               _worker_blocked{ false };
+    bool                               _caller_blocked{ false };
+    std::atomic<bool>                  _job_complete{ true };
+    std::atomic<unsigned int>          _job_sequence{ 0 };
+    std::atomic<unsigned int>          _spin_count{ 0 };
+    std::atomic<int>                   _cpu_id{ -1 };
     std::exception_ptr                 _current_exception{ nullptr };
 };
 
@@ -153,19 +205,32 @@ void CPPScheduler::Thread::start(std::vector<IScheduler::Workload> *workloads, T
     _workloads = workloads;
     _feeder    = &feeder;
     _info      = info;
+    bool notify_worker;
     {
         std::lock_guard<std::mutex> lock(_m);
         _wait_for_work = true;
-        _job_complete  = false;
+        _job_complete.store(false, std::memory_order_relaxed);
+        _job_sequence.fetch_add(1, std::memory_order_release);
+        // A spinning worker will see the new job sequence number: only blocked workers need to be woken up.
+        notify_worker = _worker_blocked;
+    }
+    if(notify_worker)
+    {
+        _cv.notify_one();
     }
-    _cv.notify_one();
 }
 
 void CPPScheduler::Thread::wait()
 {
+    if(!spin_wait([&] { return _job_complete.load(std::memory_order_acquire); }, _spin_count.load(std::memory_order_relaxed)))
     {
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        while(!_job_complete.load(std::memory_order_relaxed))
+        {
+            _caller_blocked = true;
+            _cv.wait(lock);
+            _caller_blocked = false;
+        }
     }
 
     if(_current_exception)
@@ -174,13 +239,36 @@ void CPPScheduler::Thread::wait()
     }
 }
 
+void CPPScheduler::Thread::set_spin_count(unsigned int spin_count)
+{
+    _spin_count.store(spin_count, std::memory_order_relaxed);
+}
+
+void CPPScheduler::Thread::set_cpu_id(int cpu_id)
+{
+    _cpu_id.store(cpu_id, std::memory_order_relaxed);
+}
+
 void CPPScheduler::Thread::worker_thread()
 {
+    // Affinity inherited from the thread which created the worker, restored when the worker is unpinned
+    const ThreadAffinity original_affinity = get_thread_affinity();
+    unsigned int         last_job_sequence = 0;
+    int                  current_cpu_id    = -1;
     while(true)
     {
+        spin_wait([&] { return _job_sequence.load(std::memory_order_acquire) != last_job_sequence; }, _spin_count.load(std::memory_order_relaxed));
+
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
-        _wait_for_work = false;
+        while(!_wait_for_work)
+        {
+            _worker_blocked = true;
+            _cv.wait(lock);
+            _worker_blocked = false;
+        }
+        _wait_for_work    = false;
+        last_job_sequence = _job_sequence.load(std::memory_order_relaxed);
+        lock.unlock();
 
         _current_exception = nullptr;
 
@@ -190,6 +278,21 @@ void CPPScheduler::Thread::worker_thread()
             return;
         }
 
+        const int cpu_id = _cpu_id.load(std::memory_order_relaxed);
+        if(cpu_id != current_cpu_id)
+        {
+            if(cpu_id < 0)
+            {
+                restore_thread_affinity(original_affinity);
+            }
+            else
+            {
+                set_thread_affinity(static_cast<unsigned int>(cpu_id));
+            }
+            current_cpu_id = cpu_id;
+        }
+        _info.cpu_model = _info.cpu_info->get_cpu_model();
+
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
         try
         {
@@ -203,9 +306,15 @@ void CPPScheduler::Thread::worker_thread()
             _current_exception = std::current_exception();
         }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        _job_complete = true;
+        bool notify_caller;
+        lock.lock();
+        _job_complete.store(true, std::memory_order_release);
+        notify_caller = _caller_blocked;
         lock.unlock();
-        _cv.notify_one();
+        if(notify_caller)
+        {
+            _cv.notify_one();
+        }
     }
 }
 
@@ -221,10 +330,67 @@ CPPScheduler::CPPScheduler()
 {
 }
 
+CPPScheduler::~CPPScheduler()
+{
+    restore_thread_affinity(_caller_affinity);
+}
+
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
+    // New worker threads inherit the affinity of the calling thread: unpin it before creating them
+    restore_thread_affinity(_caller_affinity);
+    _caller_affinity = ThreadAffinity();
+
     _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
     _threads.resize(_num_threads - 1);
+    for(auto &thread : _threads)
+    {
+        thread.set_spin_count(spin_count());
+    }
+    if(!affinity().empty())
+    {
+        apply_affinity();
+    }
+}
+
+void CPPScheduler::set_affinity(const std::vector<unsigned int> &cpu_ids)
+{
+    IScheduler::set_affinity(cpu_ids);
+    apply_affinity();
+}
+
+void CPPScheduler::apply_affinity()
+{
+    const std::vector<unsigned int> &cpu_ids = affinity();
+    auto get_cpu_id = [&](unsigned int thread_id)
+    {
+        return cpu_ids.empty() ? -1 : static_cast<int>(cpu_ids[thread_id % cpu_ids.size()]);
+    };
+
+    // The calling thread runs on the first core, which is the fastest one for BIG_CORES_FIRST
+    unsigned int t = 1;
+    for(auto &thread : _threads)
+    {
+        thread.set_cpu_id(get_cpu_id(t++));
+    }
+
+    // Give the calling thread its original affinity back before pinning it again
+    restore_thread_affinity(_caller_affinity);
+    _caller_affinity = ThreadAffinity();
+    if(!cpu_ids.empty())
+    {
+        _caller_affinity = get_thread_affinity();
+        set_thread_affinity(cpu_ids[0]);
+    }
+}
+
+void CPPScheduler::set_wait_policy(WaitPolicy policy, unsigned int spin_count)
+{
+    IScheduler::set_wait_policy(policy, spin_count);
+    for(auto &thread : _threads)
+    {
+        thread.set_spin_count(this->spin_count());
+    }
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -253,6 +419,7 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     }
 
     info.thread_id = t;
+    info.cpu_model = _cpu_info.get_cpu_model();
     process_workloads(workloads, feeder, info);
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     try
@@ -288,7 +455,8 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     if(!kernel->is_parallelisable() || num_threads == 1)
     {
         ThreadInfo info;
-        info.cpu_info = &_cpu_info;
+        info.cpu_info  = &_cpu_info;
+        info.cpu_model = _cpu_info.get_cpu_model();
         kernel->run(max_window, info);
     }
     else
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CPUUtils.h"
+#include "support/ToolchainSupport.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace arm_compute
+{
+namespace
+{
+/** Number of windows created per thread when the DYNAMIC strategy is requested */
+constexpr unsigned int windows_per_thread = 4;
+/** Size in bytes of a cache line, used to keep the queues of different threads apart */
+constexpr size_t cache_line_size = 64;
+} // namespace
+
+/** Lock-free double-ended queue of workload indices owned by a single worker thread.
+ *
+ * The queue is a simplified Chase-Lev deque: it is filled with a contiguous range of indices
+ * before the workers are started and is never pushed to afterwards. The owner pops indices from
+ * the bottom end while other threads steal from the top end.
+ */
+class CPPWorkStealingScheduler::WorkQueue
+{
+public:
+    /** Fill the queue with the range of indices [first, last)
+     *
+     * @note Must not be called while the queue is accessed by other threads.
+     *
+     * @param[in] first First index of the range.
+     * @param[in] last  End of the range (The last index in the queue will be last - 1).
+     */
+    void reset(unsigned int first, unsigned int last)
+    {
+        _top.store(static_cast<int>(first), std::memory_order_relaxed);
+        _bottom.store(static_cast<int>(last), std::memory_order_relaxed);
+    }
+    /** Pop an index from the bottom of the queue. Must only be called by the owner of the queue.
+     *
+     * @param[out] next Will contain the popped index if there was one.
+     *
+     * @return False if the queue was empty and next wasn't set.
+     */
+    bool pop(unsigned int &next)
+    {
+        const int b = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int t = _top.load(std::memory_order_relaxed);
+
+        if(t > b)
+        {
+            // Empty queue
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if(t == b)
+        {
+            // Last element: race against the thieves
+            const bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            if(!won)
+            {
+                return false;
+            }
+        }
+
+        next = static_cast<unsigned int>(b);
+        return true;
+    }
+    /** Steal an index from the top of the queue. Can be called by any thread.
+     *
+     * @param[out] next Will contain the stolen index if there was one.
+     *
+     * @return False if the queue was empty and next wasn't set.
+     */
+    bool steal(unsigned int &next)
+    {
+        while(true)
+        {
+            int t = _top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int b = _bottom.load(std::memory_order_acquire);
+
+            if(t >= b)
+            {
+                return false;
+            }
+
+            if(_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                next = static_cast<unsigned int>(t);
+                return true;
+            }
+        }
+    }
+
+private:
+    std::atomic<int> _top{ 0 };
+    char             _pad0[cache_line_size - sizeof(std::atomic<int>)];
+    std::atomic<int> _bottom{ 0 };
+    char             _pad1[cache_line_size - sizeof(std::atomic<int>)];
+};
+
+namespace
+{
+/** Run all the workloads of the queue owned by the calling thread, then steal workloads from the other queues until they are all empty.
+ *
+ * @param[in]     workloads The array of workloads
+ * @param[in,out] queues    The per-thread queues of workload indices.
+ * @param[in]     info      Threading and CPU info.
+ */
+template <typename Queues>
+void process_workloads(std::vector<IScheduler::Workload> &workloads, Queues &queues, const ThreadInfo &info)
+{
+    const unsigned int num_queues     = info.num_threads;
+    unsigned int       workload_index = 0;
+
+    auto &own_queue = *queues[info.thread_id];
+    while(own_queue.pop(workload_index))
+    {
+        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+        workloads[workload_index](info);
+    }
+
+    // Nothing is ever pushed back to the queues: once a victim is found empty it stays empty.
+    for(unsigned int offset = 1; offset < num_queues; ++offset)
+    {
+        auto &victim = *queues[(info.thread_id + offset) % num_queues];
+        while(victim.steal(workload_index))
+        {
+            ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+            workloads[workload_index](info);
+        }
+    }
+}
+} // namespace
+
+class CPPWorkStealingScheduler::Thread
+{
+public:
+    /** Start a new thread. */
+    Thread();
+
+    Thread(const Thread &) = delete;
+    Thread &operator=(const Thread &) = delete;
+    Thread(Thread &&)                 = delete;
+    Thread &operator=(Thread &&) = delete;
+
+    /** Destructor. Make the thread join. */
+    ~Thread();
+
+    /** Request the worker thread to start executing workloads.
+     *
+     * The thread will start by executing the workloads of queues[info.thread_id] and will then steal workloads from the other queues.
+     *
+     * @note This function will return as soon as the workloads have been sent to the worker thread.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start(std::vector<IScheduler::Workload> *workloads, std::vector<std::unique_ptr<WorkQueue>> *queues, const ThreadInfo &info);
+
+    /** Wait for the current kernel execution to complete. */
+    void wait();
+
+    /** Function ran by the worker thread. */
+    void worker_thread();
+
+private:
+    std::thread                              _thread{};
+    ThreadInfo                               _info{};
+    std::vector<IScheduler::Workload>       *_workloads{ nullptr };
+    std::vector<std::unique_ptr<WorkQueue>> *_queues{ nullptr };
+    std::mutex                               _m{};
+    std::condition_variable                  _cv{};
+    bool                                     _wait_for_work{ false };
+    bool                                     _job_complete{ true };
+    std::exception_ptr                       _current_exception{ nullptr };
+};
+
+CPPWorkStealingScheduler::Thread::Thread()
+{
+    _thread = std::thread(&Thread::worker_thread, this);
+}
+
+CPPWorkStealingScheduler::Thread::~Thread()
+{
+    // Make sure worker thread has ended
+    if(_thread.joinable())
+    {
+        start(nullptr, nullptr, ThreadInfo());
+        _thread.join();
+    }
+}
+
+void CPPWorkStealingScheduler::Thread::start(std::vector<IScheduler::Workload> *workloads, std::vector<std::unique_ptr<WorkQueue>> *queues, const ThreadInfo &info)
+{
+    _workloads = workloads;
+    _queues    = queues;
+    _info      = info;
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _wait_for_work = true;
+        _job_complete  = false;
+    }
+    _cv.notify_one();
+}
+
+void CPPWorkStealingScheduler::Thread::wait()
+{
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _job_complete; });
+    }
+
+    if(_current_exception)
+    {
+        std::rethrow_exception(_current_exception);
+    }
+}
+
+void CPPWorkStealingScheduler::Thread::worker_thread()
+{
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _wait_for_work; });
+        _wait_for_work = false;
+
+        _current_exception = nullptr;
+
+        // Time to exit
+        if(_workloads == nullptr)
+        {
+            return;
+        }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            _info.cpu_model = _info.cpu_info->get_cpu_model();
+            process_workloads(*_workloads, *_queues, _info);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _job_complete = true;
+        lock.unlock();
+        _cv.notify_one();
+    }
+}
+
+CPPWorkStealingScheduler &CPPWorkStealingScheduler::get()
+{
+    static CPPWorkStealingScheduler scheduler;
+    return scheduler;
+}
+
+CPPWorkStealingScheduler::CPPWorkStealingScheduler()
+    : _num_threads(0), _queues(), _threads()
+{
+    set_num_threads(num_threads_hint());
+}
+
+CPPWorkStealingScheduler::~CPPWorkStealingScheduler() = default;
+
+void CPPWorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
+    _threads.resize(_num_threads - 1);
+
+    _queues.resize(_num_threads);
+    for(auto &queue : _queues)
+    {
+        if(queue == nullptr)
+        {
+            queue = support::cpp14::make_unique<WorkQueue>();
+        }
+    }
+}
+
+unsigned int CPPWorkStealingScheduler::num_threads() const
+{
+    return _num_threads;
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPWorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    const unsigned int num_threads = std::min(_num_threads, static_cast<unsigned int>(workloads.size()));
+    if(num_threads < 1)
+    {
+        return;
+    }
+
+    // Seed each queue with a contiguous block of workloads
+    const unsigned int num_workloads = workloads.size();
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        _queues[t]->reset(t * num_workloads / num_threads, (t + 1) * num_workloads / num_threads);
+    }
+
+    ThreadInfo info;
+    info.cpu_info          = &_cpu_info;
+    info.num_threads       = num_threads;
+    unsigned int t         = 0;
+    auto         thread_it = _threads.begin();
+    for(; t < num_threads - 1; ++t, ++thread_it)
+    {
+        info.thread_id = t;
+        thread_it->start(&workloads, &_queues, info);
+    }
+
+    info.thread_id = t;
+    info.cpu_model = _cpu_info.get_cpu_model();
+    process_workloads(workloads, _queues, info);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        thread_it = _threads.begin();
+        for(t = 0; t < num_threads - 1; ++t, ++thread_it)
+        {
+            thread_it->wait();
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPWorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int num_threads    = std::min(num_iterations, _num_threads);
+
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
+    if(!kernel->is_parallelisable() || num_threads == 1)
+    {
+        ThreadInfo info;
+        info.cpu_info  = &_cpu_info;
+        info.cpu_model = _cpu_info.get_cpu_model();
+        kernel->run(max_window, info);
+    }
+    else
+    {
+        unsigned int num_windows = 0;
+        switch(hints.strategy())
+        {
+            case StrategyHint::STATIC:
+                num_windows = num_threads;
+                break;
+            case StrategyHint::DYNAMIC:
+            {
+                // Stealing is cheap compared to a shared counter, so the window can be split more finely than in CPPScheduler
+                const unsigned int max_iterations = _num_threads * windows_per_thread;
+                num_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unknown strategy");
+        }
+        std::vector<IScheduler::Workload> workloads(num_windows);
+        for(unsigned int t = 0; t < num_windows; t++)
+        {
+            //Capture 't' by copy, all the other variables by reference:
+            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            {
+                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                win.validate();
+                kernel->run(win, info);
+            };
+        }
+        run_workloads(workloads);
+    }
+}
+} // namespace arm_compute
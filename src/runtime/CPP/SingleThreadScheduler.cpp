@@ -45,14 +45,16 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ARM_COMPUTE_UNUSED(hints);
     ThreadInfo info;
-    info.cpu_info = &_cpu_info;
+    info.cpu_info  = &_cpu_info;
+    info.cpu_model = _cpu_info.get_cpu_model();
     kernel->run(kernel->window(), info);
 }
 
 void SingleThreadScheduler::run_workloads(std::vector<Workload> &workloads)
 {
     ThreadInfo info;
-    info.cpu_info = &_cpu_info;
+    info.cpu_info  = &_cpu_info;
+    info.cpu_model = _cpu_info.get_cpu_model();
     for(auto &wl : workloads)
     {
         wl(info);
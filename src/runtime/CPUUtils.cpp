@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <cstring>
@@ -34,7 +35,9 @@
 #include <fstream>
 #include <map>
 #include <sched.h>
+#include <sstream>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -344,6 +347,40 @@ int get_max_cpus()
 }
 #endif /* !defined(BARE_METAL) && (defined(__arm__) || defined(__aarch64__)) */
 
+bool is_little_core(CPUModel model)
+{
+    switch(model)
+    {
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+            return true;
+        default:
+            return false;
+    }
+}
+
+unsigned int get_cpu_max_frequency(unsigned int cpu_id)
+{
+    unsigned int max_freq = 0;
+#ifndef BARE_METAL
+    std::stringstream str;
+    str << "/sys/devices/system/cpu/cpu" << cpu_id << "/cpufreq/cpuinfo_max_freq";
+    std::ifstream file;
+    file.open(str.str(), std::ios::in);
+    if(file.is_open())
+    {
+        std::string line;
+        if(bool(getline(file, line)))
+        {
+            max_freq = support::cpp11::stoul(line, nullptr);
+        }
+    }
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(cpu_id);
+#endif /* BARE_METAL */
+    return max_freq;
+}
 } // namespace
 
 namespace arm_compute
@@ -457,4 +494,81 @@ unsigned int get_threads_hint()
     return num_threads_hint;
 }
 
+std::vector<unsigned int> get_cpu_ids_big_cores_first(const CPUInfo &cpuinfo)
+{
+    const unsigned int        num_cpus = cpuinfo.get_cpu_num();
+    std::vector<unsigned int> cpu_ids(num_cpus);
+    std::vector<unsigned int> max_freqs(num_cpus);
+    for(unsigned int i = 0; i < num_cpus; ++i)
+    {
+        cpu_ids[i]   = i;
+        max_freqs[i] = get_cpu_max_frequency(i);
+    }
+
+    std::stable_sort(cpu_ids.begin(), cpu_ids.end(), [&](unsigned int a, unsigned int b)
+    {
+        if(max_freqs[a] != max_freqs[b])
+        {
+            return max_freqs[a] > max_freqs[b];
+        }
+        return !is_little_core(cpuinfo.get_cpu_model(a)) && is_little_core(cpuinfo.get_cpu_model(b));
+    });
+
+    return cpu_ids;
+}
+
+bool set_thread_affinity(unsigned int cpu_id)
+{
+#if !defined(BARE_METAL)
+    ARM_COMPUTE_ERROR_ON(cpu_id >= CPU_SETSIZE);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu_id, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(cpu_id);
+    return false;
+#endif /* !defined(BARE_METAL) */
+}
+
+ThreadAffinity get_thread_affinity()
+{
+    ThreadAffinity affinity;
+#if !defined(BARE_METAL)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        affinity.tid = static_cast<int>(syscall(SYS_gettid));
+        for(int i = 0; i < CPU_SETSIZE; ++i)
+        {
+            if(CPU_ISSET(i, &set))
+            {
+                affinity.cpu_ids.push_back(i);
+            }
+        }
+    }
+#endif /* !defined(BARE_METAL) */
+    return affinity;
+}
+
+bool restore_thread_affinity(const ThreadAffinity &affinity)
+{
+#if !defined(BARE_METAL)
+    if(affinity.tid < 0 || affinity.tid != static_cast<int>(syscall(SYS_gettid)))
+    {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(const unsigned int cpu_id : affinity.cpu_ids)
+    {
+        CPU_SET(cpu_id, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(affinity);
+    return false;
+#endif /* !defined(BARE_METAL) */
+}
 } // namespace arm_compute
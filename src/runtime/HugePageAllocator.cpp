@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
+using namespace arm_compute;
+
+namespace
+{
+/** Memory region owning an allocation of a @ref HugePageAllocator */
+class HugePageMemoryRegion final : public IMemoryRegion
+{
+public:
+    HugePageMemoryRegion(HugePageAllocator &allocator, size_t size, size_t alignment)
+        : IMemoryRegion(size), _allocator(allocator), _ptr(allocator.allocate(size, alignment))
+    {
+    }
+    HugePageMemoryRegion(const HugePageMemoryRegion &) = delete;
+    HugePageMemoryRegion &operator=(const HugePageMemoryRegion &) = delete;
+    ~HugePageMemoryRegion()
+    {
+        if(_ptr != nullptr)
+        {
+            _allocator.free(_ptr);
+        }
+    }
+
+    void *buffer() final
+    {
+        return _ptr;
+    }
+    void *buffer() const final
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) final
+    {
+        if(_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return support::cpp14::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+private:
+    HugePageAllocator &_allocator;
+    void              *_ptr;
+};
+
+size_t round_up(size_t value, size_t multiple)
+{
+    return ((value + multiple - 1) / multiple) * multiple;
+}
+
+/** Returns the backing memory of an allocation to the OS or the heap
+ *
+ * @param[in] base   Pointer returned by the OS or the heap
+ * @param[in] length Length of the mapping, 0 for heap allocations
+ */
+void release(void *base, size_t length)
+{
+#ifndef BARE_METAL
+    if(length != 0)
+    {
+        munmap(base, length);
+        return;
+    }
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(length);
+#endif /* BARE_METAL */
+    ::operator delete(base);
+}
+} // namespace
+
+constexpr size_t HugePageAllocator::huge_page_size;
+
+HugePageAllocator::HugePageAllocator(size_t threshold, int numa_node)
+    : _threshold(threshold), _numa_node(numa_node), _mtx(), _allocations()
+{
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    // Release the allocations which were not freed
+    for(auto &allocation : _allocations)
+    {
+        release(allocation.second.base, allocation.second.length);
+    }
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    Allocation allocation{ nullptr, 0 };
+    void      *ptr = nullptr;
+
+#ifndef BARE_METAL
+    if(size >= _threshold)
+    {
+        // Over-allocate so that the memory can start on a huge page boundary: the extra address space is never touched
+        const size_t page_alignment = std::max(huge_page_size, alignment);
+        const size_t length         = round_up(size, huge_page_size) + page_alignment;
+        void        *base           = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(base != MAP_FAILED)
+        {
+            allocation = Allocation{ base, length };
+            ptr        = reinterpret_cast<void *>(round_up(reinterpret_cast<uintptr_t>(base), page_alignment));
+
+#ifdef MADV_HUGEPAGE
+            // Only a hint: the kernel silently falls back to normal pages if transparent huge pages are disabled
+            madvise(ptr, round_up(size, huge_page_size), MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+
+#ifdef __NR_mbind
+            if(_numa_node >= 0)
+            {
+                constexpr int              mpol_bind     = 2;
+                const size_t               bits_per_word = 8 * sizeof(unsigned long);
+                std::vector<unsigned long> node_mask(_numa_node / bits_per_word + 1, 0);
+                node_mask[_numa_node / bits_per_word] = 1UL << (_numa_node % bits_per_word);
+                syscall(__NR_mbind, ptr, round_up(size, huge_page_size), mpol_bind, node_mask.data(), node_mask.size() * bits_per_word + 1, 0);
+            }
+#endif /* __NR_mbind */
+        }
+    }
+#endif /* BARE_METAL */
+
+    if(ptr == nullptr)
+    {
+        size_t space = size + alignment;
+        void  *base  = ::operator new(space);
+        allocation   = Allocation{ base, 0 };
+        ptr          = base;
+        if(alignment != 0)
+        {
+            support::cpp11::align(alignment, size, ptr, space);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _allocations.emplace(ptr, allocation);
+    return ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    Allocation allocation{ nullptr, 0 };
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto                        it = _allocations.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_allocations), "Pointer not allocated by this allocator");
+        allocation = it->second;
+        _allocations.erase(it);
+    }
+
+    release(allocation.base, allocation.length);
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    return arm_compute::support::cpp14::make_unique<HugePageMemoryRegion>(*this, size, alignment);
+}
@@ -45,6 +45,48 @@ unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
+
+void IScheduler::set_wait_policy(WaitPolicy policy, unsigned int spin_count)
+{
+    _wait_policy = policy;
+    _spin_count  = (policy == WaitPolicy::BLOCK) ? 0 : spin_count;
+}
+
+IScheduler::WaitPolicy IScheduler::wait_policy() const
+{
+    return _wait_policy;
+}
+
+unsigned int IScheduler::spin_count() const
+{
+    return _spin_count;
+}
+
+void IScheduler::set_affinity_policy(AffinityPolicy policy)
+{
+    switch(policy)
+    {
+        case AffinityPolicy::NONE:
+            set_affinity(std::vector<unsigned int>());
+            break;
+        case AffinityPolicy::BIG_CORES_FIRST:
+            set_affinity(get_cpu_ids_big_cores_first(cpu_info()));
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unknown affinity policy");
+    }
+}
+
+void IScheduler::set_affinity(const std::vector<unsigned int> &cpu_ids)
+{
+    _affinity = cpu_ids;
+}
+
+const std::vector<unsigned int> &IScheduler::affinity() const
+{
+    return _affinity;
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
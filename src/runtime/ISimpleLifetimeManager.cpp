@@ -118,6 +118,17 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     }
 }
 
+IMemory *ISimpleLifetimeManager::finalized_memory(IMemoryGroup *group, void *obj) const
+{
+    const auto group_it = _finalized_groups.find(group);
+    if(group_it == std::end(_finalized_groups))
+    {
+        return nullptr;
+    }
+    const auto element_it = group_it->second.find(obj);
+    return (element_it != std::end(group_it->second)) ? element_it->second.handle : nullptr;
+}
+
 bool ISimpleLifetimeManager::are_all_finalized() const
 {
     return !std::any_of(std::begin(_active_elements), std::end(_active_elements), [](const std::pair<void *, Element> &e)
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+
+/** Placement of an object in the blob */
+struct Placement
+{
+    IMemory *handle;    /**< Object's memory handle */
+    size_t   start;     /**< Start of the object's lifetime */
+    size_t   end;       /**< End of the object's lifetime */
+    size_t   size;      /**< Object's size */
+    size_t   alignment; /**< Object's alignment */
+    size_t   offset;    /**< Object's offset in the blob */
+};
+} // namespace
+
+IntervalLifetimeManager::IntervalLifetimeManager()
+    : _blob(0), _naive_size(0), _time(0), _intervals()
+{
+}
+
+size_t IntervalLifetimeManager::planned_size() const
+{
+    return _blob.size;
+}
+
+size_t IntervalLifetimeManager::naive_size() const
+{
+    return _naive_size;
+}
+
+void IntervalLifetimeManager::start_lifetime(void *obj)
+{
+    _intervals[obj] = Interval{ _time++, std::numeric_limits<size_t>::max() };
+    ISimpleLifetimeManager::start_lifetime(obj);
+}
+
+void IntervalLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(_intervals.find(obj) == std::end(_intervals));
+    _intervals[obj].end = _time++;
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
+std::unique_ptr<IMemoryPool> IntervalLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return support::cpp14::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+MappingType IntervalLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void IntervalLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    std::vector<Placement> placements;
+    size_t                 group_naive_size = 0;
+    for(auto &active_element : _active_elements)
+    {
+        const Element &el       = active_element.second;
+        const Interval interval = _intervals[active_element.first];
+        placements.push_back(Placement{ el.handle, interval.start, interval.end, el.size, el.alignment, 0 });
+        group_naive_size += align_offset(el.size, el.alignment);
+        _blob.alignment = std::max(_blob.alignment, el.alignment);
+    }
+
+    // Place the largest objects first, breaking ties by order of creation
+    std::sort(std::begin(placements), std::end(placements), [](const Placement & a, const Placement & b)
+    {
+        return (a.size != b.size) ? (a.size > b.size) : (a.start < b.start);
+    });
+
+    size_t group_size = 0;
+    for(size_t i = 0; i < placements.size(); ++i)
+    {
+        Placement &p = placements[i];
+
+        // Collect the already placed objects alive at the same time sorted by offset
+        std::vector<const Placement *> overlapping;
+        for(size_t j = 0; j < i; ++j)
+        {
+            if(placements[j].start < p.end && p.start < placements[j].end)
+            {
+                overlapping.push_back(&placements[j]);
+            }
+        }
+        std::sort(std::begin(overlapping), std::end(overlapping), [](const Placement * a, const Placement * b)
+        {
+            return a->offset < b->offset;
+        });
+
+        // Find the smallest gap the object fits in, or place it after all the overlapping objects
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t gap_start   = 0;
+        for(const Placement *o : overlapping)
+        {
+            const size_t offset = align_offset(gap_start, p.alignment);
+            if(o->offset >= offset && (o->offset - offset) >= p.size && (o->offset - offset) < best_gap)
+            {
+                best_offset = offset;
+                best_gap    = o->offset - offset;
+            }
+            gap_start = std::max(gap_start, o->offset + o->size);
+        }
+        p.offset   = (best_offset != std::numeric_limits<size_t>::max()) ? best_offset : align_offset(gap_start, p.alignment);
+        group_size = std::max(group_size, p.offset + p.size);
+    }
+
+    // Update blob size
+    _blob.owners = std::max(_blob.owners, placements.size());
+    _blob.size   = std::max(_blob.size, group_size);
+    _naive_size  = std::max(_naive_size, group_naive_size);
+
+    // Calculate group mappings
+    auto &group_mappings = _active_group->mappings();
+    for(auto &p : placements)
+    {
+        group_mappings[p.handle] = p.offset;
+    }
+
+    // Reset the clock for the next group
+    _intervals.clear();
+    _time = 0;
+}
+} // namespace arm_compute
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTable.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+const std::string &string_from_convolution_method(ConvolutionMethod method)
+{
+    static const std::map<ConvolutionMethod, const std::string> method_map =
+    {
+        { ConvolutionMethod::GEMM, "GEMM" },
+        { ConvolutionMethod::DIRECT, "DIRECT" },
+        { ConvolutionMethod::WINOGRAD, "WINOGRAD" },
+        { ConvolutionMethod::FFT, "FFT" },
+    };
+
+    return method_map.find(method)->second;
+}
+
+ConvolutionMethod convolution_method_from_string(const std::string &name)
+{
+    static const std::map<std::string, ConvolutionMethod> method_map =
+    {
+        { "GEMM", ConvolutionMethod::GEMM },
+        { "DIRECT", ConvolutionMethod::DIRECT },
+        { "WINOGRAD", ConvolutionMethod::WINOGRAD },
+        { "FFT", ConvolutionMethod::FFT },
+    };
+
+    const auto it = method_map.find(name);
+    if(it == method_map.end())
+    {
+        ARM_COMPUTE_ERROR("Unknown convolution method '%s'", name.c_str());
+    }
+    return it->second;
+}
+
+/** Add the entries of the configurations of well known networks */
+void add_known_network_configs(NEConvolutionMethodTable &table)
+{
+    /* Input spatial dims, kernel size, IFM/OFM, conv info*/
+    using ConvolutionConfiguration = std::tuple<Size2D, Size2D, Size2D, PadStrideInfo>;
+    using ConfigurationMethod      = std::pair<ConvolutionConfiguration, ConvolutionMethod>;
+
+    const std::vector<ConfigurationMethod> known_configs =
+    {
+        // Alexnet
+        ConfigurationMethod(ConvolutionConfiguration(Size2D(27U, 27U), Size2D(5U, 5U), Size2D(48U, 128U), PadStrideInfo(1U, 1U, 2U, 2U)), ConvolutionMethod::GEMM),
+        // VGG16 / VGG19
+        ConfigurationMethod(ConvolutionConfiguration(Size2D(224U, 224U), Size2D(3U, 3U), Size2D(3U, 64U), PadStrideInfo(1U, 1U, 1U, 1U)), ConvolutionMethod::GEMM),
+        // Mobilenet 224
+        ConfigurationMethod(ConvolutionConfiguration(Size2D(224U, 224U), Size2D(3U, 3U), Size2D(3U, 32U), PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR)), ConvolutionMethod::GEMM),
+        // Mobilenet 160
+        ConfigurationMethod(ConvolutionConfiguration(Size2D(160U, 160U), Size2D(3U, 3U), Size2D(3U, 24U), PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR)), ConvolutionMethod::GEMM)
+    };
+
+    for(const auto &config : known_configs)
+    {
+        const Size2D        input_dims  = std::get<0>(config.first);
+        const Size2D        kernel_dims = std::get<1>(config.first);
+        const Size2D        ifm_ofm     = std::get<2>(config.first);
+        const PadStrideInfo conv_info   = std::get<3>(config.first);
+
+        for(auto data_type : { DataType::F32, DataType::F16, DataType::QASYMM8 })
+        {
+            const TensorInfo input_nchw(TensorShape(input_dims.width, input_dims.height, ifm_ofm.width), 1, data_type);
+            const TensorInfo weights_nchw(TensorShape(kernel_dims.width, kernel_dims.height, ifm_ofm.width, ifm_ofm.height), 1, data_type);
+            table.add_method(NEConvolutionMethodTable::config_id(&input_nchw, &weights_nchw, conv_info, Size2D(1U, 1U), NEConvolutionMethodTable::any_num_threads), config.second);
+
+            TensorInfo input_nhwc(TensorShape(ifm_ofm.width, input_dims.width, input_dims.height), 1, data_type);
+            TensorInfo weights_nhwc(TensorShape(ifm_ofm.width, kernel_dims.width, kernel_dims.height, ifm_ofm.height), 1, data_type);
+            input_nhwc.set_data_layout(DataLayout::NHWC);
+            weights_nhwc.set_data_layout(DataLayout::NHWC);
+            table.add_method(NEConvolutionMethodTable::config_id(&input_nhwc, &weights_nhwc, conv_info, Size2D(1U, 1U), NEConvolutionMethodTable::any_num_threads), config.second);
+        }
+    }
+}
+} // namespace
+
+constexpr unsigned int NEConvolutionMethodTable::any_num_threads;
+
+NEConvolutionMethodTable::NEConvolutionMethodTable(bool add_known_configs)
+    : _table()
+{
+    if(add_known_configs)
+    {
+        add_known_network_configs(*this);
+    }
+}
+
+std::string NEConvolutionMethodTable::config_id(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
+
+    const DataLayout data_layout = input->data_layout();
+    const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const size_t     idx_n       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+    std::stringstream ss;
+    ss << string_from_data_type(input->data_type()) << "_" << string_from_data_layout(data_layout)
+       << "_IN" << input->dimension(idx_w) << "x" << input->dimension(idx_h) << "x" << input->dimension(idx_c) << "x" << input->dimension(idx_n)
+       << "_K" << weights->dimension(idx_w) << "x" << weights->dimension(idx_h) << "x" << weights->dimension(3)
+       << "_S" << conv_info.stride().first << "x" << conv_info.stride().second
+       << "_P" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom()
+       << "_D" << dilation.width << "x" << dilation.height
+       << "_T" << num_threads;
+    return ss.str();
+}
+
+void NEConvolutionMethodTable::add_method(const std::string &config_id, ConvolutionMethod method)
+{
+    _table[config_id] = method;
+}
+
+bool NEConvolutionMethodTable::find_method(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, unsigned int num_threads,
+                                           ConvolutionMethod &method) const
+{
+    for(unsigned int threads : { num_threads, any_num_threads })
+    {
+        const auto it = _table.find(config_id(input, weights, conv_info, dilation, threads));
+        if(it != _table.end())
+        {
+            method = it->second;
+            return true;
+        }
+    }
+    return false;
+}
+
+void NEConvolutionMethodTable::clear()
+{
+    _table.clear();
+}
+
+const std::unordered_map<std::string, ConvolutionMethod> &NEConvolutionMethodTable::table() const
+{
+    return _table;
+}
+
+void NEConvolutionMethodTable::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        config_id;
+        std::string        method;
+        if(std::getline(ss, config_id, ';').fail() || std::getline(ss, method, ';').fail())
+        {
+            ARM_COMPUTE_ERROR("Malformed row '%s' in %s (Should be of the form 'config_id;method')", ss.str().c_str(), filename.c_str());
+        }
+        add_method(config_id, convolution_method_from_string(method));
+    }
+    fs.close();
+}
+
+void NEConvolutionMethodTable::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for(auto const &entry : _table)
+    {
+        fs << entry.first << ";" << string_from_convolution_method(entry.second) << std::endl;
+    }
+    fs.close();
+}
+} // namespace arm_compute
@@ -26,15 +26,126 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTable.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <tuple>
 #include <utility>
 
 namespace arm_compute
 {
+namespace
+{
+/** Table of convolution methods set by the user, nullptr to use the default table */
+std::atomic<const NEConvolutionMethodTable *> method_table{ nullptr };
+
+/** Rough throughputs of a NEON core used by the cost model: only the relative costs of the methods matter */
+constexpr float gemm_macs_per_cycle       = 8.f;  /**< Two 4-lane FMAs per cycle */
+constexpr float copy_elements_per_cycle   = 2.f;  /**< Reshapes such as im2col */
+constexpr float transform_ops_per_cycle   = 4.f;  /**< Winograd and FFT transforms */
+constexpr float pointwise_cmacs_per_cycle = 0.5f; /**< Complex multiply-accumulates of the FFT convolution */
+
+const NEConvolutionMethodTable &default_method_table()
+{
+    static const NEConvolutionMethodTable table{};
+    return table;
+}
+
+Status validate_method(ConvolutionMethod method, const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation,
+                       const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    // Only the GEMM-based convolution supports dilation
+    ARM_COMPUTE_RETURN_ERROR_ON(method != ConvolutionMethod::GEMM && dilation != Size2D(1U, 1U));
+
+    switch(method)
+    {
+        case ConvolutionMethod::GEMM:
+            // Always used as fallback
+            return Status{};
+        case ConvolutionMethod::WINOGRAD:
+            return NEWinogradConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math);
+        case ConvolutionMethod::DIRECT:
+            return NEDirectConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info);
+        case ConvolutionMethod::FFT:
+            return NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info);
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Not supported.");
+    }
+}
+
+Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type)
+{
+    if(kernel_dims == Size2D(3U, 3U))
+    {
+        // QASYMM8 only has an F(2x2, 3x3) implementation
+        const bool small_input = input_dims.width <= 4 && input_dims.height <= 4;
+        return (small_input || is_data_type_quantized_asymmetric(data_type)) ? Size2D(2U, 2U) : Size2D(4U, 4U);
+    }
+    if(kernel_dims.width == 1U || kernel_dims.height == 1U)
+    {
+        // 1xN and Nx1 kernels use output tiles of 6, 4 and 2 elements for N equal to 3, 5 and 7
+        const unsigned int n    = std::max(kernel_dims.width, kernel_dims.height);
+        const unsigned int tile = (n == 3U) ? 6U : ((n == 5U) ? 4U : 2U);
+        return (kernel_dims.width == 1U) ? Size2D(1U, tile) : Size2D(tile, 1U);
+    }
+    return Size2D(2U, 2U);
+}
+
+/** Estimate the number of cycles a convolution method takes on a single core
+ *
+ * The estimate accounts for the multiply-accumulates and the reshapes or transforms of each method,
+ * the transformation of the weights is ignored as it only happens once.
+ */
+float estimate_cost(ConvolutionMethod method, const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info)
+{
+    const DataLayout data_layout = input->data_layout();
+    const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const size_t     idx_n       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+    const Size2D input_dims(input->dimension(idx_w), input->dimension(idx_h));
+    const Size2D kernel_dims(weights->dimension(idx_w), weights->dimension(idx_h));
+    const float  batches = input->dimension(idx_n);
+    const float  ifm     = input->dimension(idx_c);
+    const float  ofm     = weights->dimension(3);
+
+    const auto  output_dims     = scaled_dimensions(input_dims.width, input_dims.height, kernel_dims.width, kernel_dims.height, conv_info);
+    const float output_points   = batches * output_dims.first * output_dims.second;
+    const float kernel_volume   = kernel_dims.area() * ifm;
+    const bool  requires_im2col = !(kernel_dims == Size2D(1U, 1U) && conv_info.stride() == std::make_pair(1U, 1U));
+
+    switch(method)
+    {
+        case ConvolutionMethod::WINOGRAD:
+        {
+            const Size2D tile       = winograd_output_tile(input_dims, kernel_dims, input->data_type());
+            const Size2D input_tile(tile.width + kernel_dims.width - 1, tile.height + kernel_dims.height - 1);
+            const float  tile_area  = input_tile.area();
+            const float  num_tiles  = batches * DIV_CEIL(output_dims.first, tile.width) * DIV_CEIL(output_dims.second, tile.height);
+            const float  efficiency = std::min(1.f, ifm / 16.f); // The batched GEMMs have a depth of IFM
+            const float  gemm       = num_tiles * tile_area * ifm * ofm / (gemm_macs_per_cycle * efficiency);
+            const float  input_tr   = num_tiles * ifm * tile_area * (input_tile.width + input_tile.height) / transform_ops_per_cycle;
+            const float  output_tr  = num_tiles * ofm * tile_area * (tile.width + tile.height) / transform_ops_per_cycle;
+            return gemm + input_tr + output_tr;
+        }
+        case ConvolutionMethod::FFT:
+        {
+            const float fft_points = (input_dims.width + kernel_dims.width - 1) * (input_dims.height + kernel_dims.height - 1);
+            const float fft        = 5.f * fft_points * std::log2(fft_points) / transform_ops_per_cycle;
+            const float pointwise  = batches * fft_points * ifm * ofm / pointwise_cmacs_per_cycle;
+            return batches * (ifm + ofm) * fft + pointwise;
+        }
+        case ConvolutionMethod::GEMM:
+        default:
+            return output_points * kernel_volume * ofm / gemm_macs_per_cycle + (requires_im2col ? output_points * kernel_volume / copy_elements_per_cycle : 0.f);
+    }
+}
+} // namespace
+
 NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
     : _memory_manager(std::move(memory_manager)),
       _function()
@@ -50,7 +161,7 @@ void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
                                                             enable_fast_math));
 
-    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info))
+    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math))
     {
         case ConvolutionMethod::WINOGRAD:
         {
@@ -91,7 +202,7 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
 {
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
 
-    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info))
+    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math))
     {
         case ConvolutionMethod::WINOGRAD:
             //Validate Winograd
@@ -102,8 +213,9 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
             ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info));
             break;
         case ConvolutionMethod::DIRECT:
-            //Validate Gemm-based Convolution
+            //Validate Direct Convolution
             ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info));
+            break;
         case ConvolutionMethod::FFT:
             // Validate FFT-based convolution layer
             ARM_COMPUTE_RETURN_ON_ERROR(NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info));
@@ -123,58 +235,41 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
     ARM_COMPUTE_UNUSED(weights_info);
 
-    const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
-    const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
-    const size_t idx_c = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
-
-    /* Input spatial dims, kernel size, IFM/OFM, conv info*/
-    using ConvolutionConfiguration = std::tuple<Size2D, Size2D, Size2D, PadStrideInfo>;
-    using ConfigurationMethod      = std::pair<ConvolutionConfiguration, ConvolutionMethod>;
-
-    const std::vector<ConfigurationMethod> known_configs =
+    const auto is_valid = [&](ConvolutionMethod method)
     {
-        // Alexnet
-        ConfigurationMethod(ConvolutionConfiguration(Size2D(27U, 27U), Size2D(5U, 5U), Size2D(48U, 128U), PadStrideInfo(1U, 1U, 2U, 2U)), ConvolutionMethod::GEMM),
-        // VGG16 / VGG19
-        ConfigurationMethod(ConvolutionConfiguration(Size2D(224U, 224U), Size2D(3U, 3U), Size2D(3U, 64U), PadStrideInfo(1U, 1U, 1U, 1U)), ConvolutionMethod::GEMM),
-        // Mobilenet 224
-        ConfigurationMethod(ConvolutionConfiguration(Size2D(224U, 224U), Size2D(3U, 3U), Size2D(3U, 32U), PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR)), ConvolutionMethod::GEMM),
-        // Mobilenet 160
-        ConfigurationMethod(ConvolutionConfiguration(Size2D(160U, 160U), Size2D(3U, 3U), Size2D(3U, 24U), PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR)), ConvolutionMethod::GEMM)
-    };
-
-    const auto find_config = [&](ConfigurationMethod c)
-    {
-        const ConvolutionConfiguration config = c.first;
-        const PadStrideInfo            info   = std::get<3>(config);
-
-        return std::get<0>(config) == Size2D(input->dimension(idx_w), input->dimension(idx_h)) && std::get<1>(config) == Size2D(weights->dimension(idx_w), weights->dimension(idx_h))
-               && std::get<2>(config) == Size2D(weights->dimension(idx_c), weights->dimension(3)) && info.pad_top() == conv_info.pad_top() && info.pad_right() == conv_info.pad_right()
-               && info.pad_bottom() == conv_info.pad_bottom() && info.pad_left() == conv_info.pad_left() && info.stride() == conv_info.stride();
+        return bool(validate_method(method, input, weights, output, conv_info, dilation, act_info, enable_fast_math));
     };
 
-    std::vector<ConfigurationMethod>::const_iterator found;
-    if((found = std::find_if(known_configs.begin(), known_configs.end(), find_config)) != known_configs.end())
+    // Use the method measured for this configuration if any
+    const NEConvolutionMethodTable *table  = method_table.load();
+    ConvolutionMethod               method = ConvolutionMethod::GEMM;
+    if(((table != nullptr) ? table : &default_method_table())->find_method(input, weights, conv_info, dilation, NEScheduler::get().num_threads(), method) && is_valid(method))
     {
-        return (*found).second;
+        return method;
     }
 
-    if(dilation != Size2D(1U, 1U))
+    // Otherwise pick the cheapest method according to the cost model: GEMM supports all the configurations.
+    // Direct convolution is only used when selected by the table as its performance varies too much across kernel sizes to be modelled.
+    method    = ConvolutionMethod::GEMM;
+    float min = estimate_cost(ConvolutionMethod::GEMM, input, weights, conv_info);
+    for(auto candidate : { ConvolutionMethod::WINOGRAD, ConvolutionMethod::FFT })
     {
-        return ConvolutionMethod::GEMM;
-    }
-    else
-    {
-        if((weights->dimension(idx_h) > 7) && (input->dimension(idx_c) > output->dimension(idx_c)) && (NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info)))
-        {
-            return ConvolutionMethod::FFT;
-        }
-        if(input->dimension(idx_c) < 16)
+        if(is_valid(candidate))
         {
-            return ConvolutionMethod::GEMM;
+            const float cost = estimate_cost(candidate, input, weights, conv_info);
+            if(cost < min)
+            {
+                min    = cost;
+                method = candidate;
+            }
         }
-        return bool(NEWinogradConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)) ? ConvolutionMethod::WINOGRAD : ConvolutionMethod::GEMM;
     }
+    return method;
+}
+
+void NEConvolutionLayer::set_method_table(const NEConvolutionMethodTable *table)
+{
+    method_table.store(table);
 }
 
 void NEConvolutionLayer::run()
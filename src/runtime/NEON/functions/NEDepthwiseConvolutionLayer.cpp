@@ -357,20 +357,76 @@ void NEDepthwiseConvolutionLayer3x3::prepare()
     }
 }
 
-NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer()
-    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _permute_input(),
-      _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(), _permuted_weights(),
-      _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_activationlayer_enabled(false), _original_weights(nullptr)
+NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _dwc_optimized_func(memory_manager), _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(),
+      _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _permute_input(), _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(),
+      _output_reshaped(), _permuted_input(), _permuted_weights(), _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_activationlayer_enabled(false), _is_optimized(false),
+      _original_weights(nullptr)
 {
 }
 
+void NEDepthwiseConvolutionLayer::configure_optimized(const ITensor             *input,
+                                                      const ITensor             *weights,
+                                                      const ITensor             *biases,
+                                                      ITensor                   *output,
+                                                      const PadStrideInfo       &conv_info,
+                                                      unsigned int               depth_multiplier,
+                                                      const ActivationLayerInfo &act_info,
+                                                      const Size2D              &dilation)
+{
+    // Only ReLU and ReLU6 are fused in the engine
+    ActivationLayerInfo act_info_to_use = ActivationLayerInfo();
+    const bool          is_relu         = arm_compute::utils::info_helpers::is_relu(act_info);
+    const bool          is_relu6        = arm_compute::utils::info_helpers::is_relu6(act_info);
+    _is_activationlayer_enabled         = act_info.enabled() && !(is_relu || is_relu6);
+    if(!_is_activationlayer_enabled)
+    {
+        act_info_to_use = act_info;
+    }
+
+    _original_weights = weights;
+
+    if(!_is_nhwc)
+    {
+        _memory_group.manage(&_permuted_input);
+        _memory_group.manage(&_permuted_output);
+
+        // Configure the function to transform the input tensor from NCHW -> NHWC
+        _permute_input.configure(input, &_permuted_input, PermutationVector(2U, 0U, 1U));
+        _permuted_input.info()->set_data_layout(DataLayout::NHWC);
+
+        // Configure the function to transform the weights tensor from IHW -> HWI
+        _permute_weights.configure(weights, &_permuted_weights, PermutationVector(2U, 0U, 1U));
+        _permuted_weights.info()->set_data_layout(DataLayout::NHWC);
+
+        // The permuted output keeps the quantization info of the output
+        TensorShape permuted_output_shape = output->info()->tensor_shape();
+        permute(permuted_output_shape, PermutationVector(2U, 0U, 1U));
+        _permuted_output.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_output_shape).set_data_layout(DataLayout::NHWC));
+
+        // Configure optimized depthwise
+        _dwc_optimized_func.configure(&_permuted_input, &_permuted_weights, biases, &_permuted_output, conv_info, depth_multiplier, act_info_to_use, dilation);
+
+        // Configure the function to transform the convoluted output to ACL's native ordering format NCHW
+        _permute_output.configure(&_permuted_output, output, PermutationVector(1U, 2U, 0U));
+
+        // Allocate tensors
+        _permuted_input.allocator()->allocate();
+        _permuted_output.allocator()->allocate();
+    }
+    else
+    {
+        _dwc_optimized_func.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info_to_use, dilation);
+    }
+}
+
 void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
                                             unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     const unsigned int channel_idx = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
     ARM_COMPUTE_UNUSED(channel_idx);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_ERROR_ON(!is_data_type_quantized_per_channel(weights->info()->data_type()) && (input->info()->data_type() != weights->info()->data_type()));
     ARM_COMPUTE_ERROR_ON((input->info()->dimension(channel_idx) * depth_multiplier) != weights->info()->dimension(channel_idx));
     // idx_w and idx_h only used for validation
     const size_t idx_w = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::WIDTH);
@@ -381,8 +437,35 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     ARM_COMPUTE_ERROR_ON(weights->info()->dimension(idx_w) + (weights->info()->dimension(idx_w) - 1) * (dilation.x() - 1) > input->info()->dimension(idx_w) + conv_info.pad_left() + conv_info.pad_right());
     ARM_COMPUTE_ERROR_ON(weights->info()->dimension(idx_h) + (weights->info()->dimension(idx_h) - 1) * (dilation.y() - 1) > input->info()->dimension(idx_h) + conv_info.pad_top() + conv_info.pad_bottom());
 
-    _is_nhwc = input->info()->data_layout() == DataLayout::NHWC;
+    _is_nhwc      = input->info()->data_layout() == DataLayout::NHWC;
+    _is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _is_prepared  = false;
+    _is_optimized = NEDepthwiseConvolutionAssemblyDispatch::is_generic_supported(input->info(), weights->info(), conv_info, depth_multiplier, dilation);
 
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
+
+    // Configure appropriate pipeline
+    if(_is_optimized)
+    {
+        configure_optimized(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation);
+    }
+    else
+    {
+        configure_generic(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation);
+    }
+
+    // Configure activation
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+}
+
+void NEDepthwiseConvolutionLayer::configure_generic(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                    unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
     ITensor       *input_to_use   = input;
     const ITensor *weights_to_use = weights;
     ITensor       *output_to_use  = output;
@@ -402,8 +485,6 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     const size_t weights_h = weights_to_use->info()->dimension(1);
     const size_t weights_z = weights_to_use->info()->dimension(2);
 
-    _is_quantized     = is_data_type_quantized_asymmetric(input->info()->data_type());
-    _is_prepared      = false;
     _original_weights = weights_to_use;
 
     // Should bias be appended ?
@@ -496,13 +577,7 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     _input_reshaped.allocator()->allocate();
     _v2mm_output.allocator()->allocate();
 
-    //Configure Activation Layer
     _is_activationlayer_enabled = act_info.enabled();
-
-    if(_is_activationlayer_enabled)
-    {
-        _activationlayer_function.configure(output, nullptr, act_info);
-    }
 }
 
 Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
@@ -517,6 +592,25 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
 
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(width_idx) + (weights->dimension(width_idx) - 1) * (dilation.x() - 1) > input->dimension(width_idx) + conv_info.pad_left() + conv_info.pad_right());
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(height_idx) + (weights->dimension(height_idx) - 1) * (dilation.y() - 1) > input->dimension(height_idx) + conv_info.pad_top() + conv_info.pad_bottom());
+
+    if(NEDepthwiseConvolutionAssemblyDispatch::is_generic_supported(input, weights, conv_info, depth_multiplier, dilation))
+    {
+        // Only ReLU and ReLU6 are fused in the engine
+        const bool is_relu  = arm_compute::utils::info_helpers::is_relu(act_info);
+        const bool is_relu6 = arm_compute::utils::info_helpers::is_relu6(act_info);
+        const bool is_fused = is_relu || is_relu6;
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseConvolutionAssemblyDispatch::validate(input, weights, biases, output, conv_info, depth_multiplier,
+                                                                                     is_fused ? act_info : ActivationLayerInfo(), dilation));
+        if(act_info.enabled() && !is_fused)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+        }
+        return Status{};
+    }
+
+    // Per channel quantized weights are only supported by the assembly engine
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(weights->data_type()), "Per channel quantized weights require a depth multiplier of 1");
+
     // Clone output to use auto init
     auto output_clone = output->clone();
 
@@ -603,10 +697,8 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
     return Status{};
 }
 
-void NEDepthwiseConvolutionLayer::run()
+void NEDepthwiseConvolutionLayer::run_generic()
 {
-    prepare();
-
     if(_is_nhwc)
     {
         _permute_input.run();
@@ -625,6 +717,33 @@ void NEDepthwiseConvolutionLayer::run()
     {
         _permute_output.run();
     }
+}
+
+void NEDepthwiseConvolutionLayer::run_optimized()
+{
+    // Permute input
+    if(!_is_nhwc)
+    {
+        _permute_input.run();
+    }
+
+    // Run assembly function
+    _dwc_optimized_func.run();
+
+    // Permute output
+    if(!_is_nhwc)
+    {
+        _permute_output.run();
+    }
+}
+
+void NEDepthwiseConvolutionLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _is_optimized ? run_optimized() : run_generic();
 
     if(_is_activationlayer_enabled)
     {
@@ -634,6 +753,26 @@ void NEDepthwiseConvolutionLayer::run()
 
 void NEDepthwiseConvolutionLayer::prepare()
 {
+    if(!_is_prepared && _is_optimized)
+    {
+        // Permute weights
+        if(!_is_nhwc)
+        {
+            _permuted_weights.allocator()->allocate();
+            _permute_weights.run();
+            _original_weights->mark_as_unused();
+        }
+
+        // Prepare optimized function
+        _dwc_optimized_func.prepare();
+        if(!_permuted_weights.is_used())
+        {
+            _permuted_weights.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+
     if(!_is_prepared)
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
@@ -25,13 +25,14 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
 
-NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer()
-    : _depthwise_conv(), _pointwise_conv()
+NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _depthwise_conv(), _pointwise_conv(), _fused_kernel(), _depthwise_out(), _workspace(), _is_fused(false)
 {
 }
 
@@ -39,20 +40,108 @@ void NEDepthwiseSeparableConvolutionLayer::configure(ITensor *input, const ITens
                                                      const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
                                                      const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info)
 {
+    _is_fused = false;
     _depthwise_conv.configure(input, depthwise_weights, depthwise_biases, depthwise_out, depthwise_conv_info);
     _pointwise_conv.configure(depthwise_out, pointwise_weights, pointwise_biases, output, pointwise_conv_info);
 }
 
+void NEDepthwiseSeparableConvolutionLayer::configure(ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases,
+                                                     const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
+                                                     const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                     const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseSeparableConvolutionLayer::validate(input->info(), depthwise_weights->info(), (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr,
+                                                                              pointwise_weights->info(), (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr, output->info(),
+                                                                              depthwise_conv_info, pointwise_conv_info, depthwise_act_info, pointwise_act_info));
+
+    _is_fused = is_fused_supported(input->info(), depthwise_weights->info(), (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr,
+                                   pointwise_weights->info(), (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr, output->info(),
+                                   depthwise_conv_info, pointwise_conv_info, depthwise_act_info, pointwise_act_info);
+
+    if(_is_fused)
+    {
+        // Output auto inizialitation if not yet initialized
+        TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *depthwise_weights->info(), depthwise_conv_info, 1);
+        output_shape.set(0, pointwise_weights->info()->dimension(3));
+        auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
+
+        // One tile of depthwise outputs per thread
+        const TensorShape workspace_shape = NEDepthwiseSeparableConvolutionLayerKernel::compute_workspace_shape(input->info(), output->info()->dimension(1), NEScheduler::get().num_threads());
+        _workspace.allocator()->init(TensorInfo(workspace_shape, 1, input->info()->data_type()));
+        _memory_group.manage(&_workspace);
+
+        _fused_kernel.configure(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, &_workspace, depthwise_conv_info,
+                                depthwise_act_info, pointwise_act_info);
+
+        _workspace.allocator()->allocate();
+    }
+    else
+    {
+        _memory_group.manage(&_depthwise_out);
+
+        _depthwise_conv.configure(input, depthwise_weights, depthwise_biases, &_depthwise_out, depthwise_conv_info, 1, depthwise_act_info);
+        _pointwise_conv.configure(&_depthwise_out, pointwise_weights, pointwise_biases, output, pointwise_conv_info, pointwise_act_info);
+
+        _depthwise_out.allocator()->allocate();
+    }
+}
+
+Status NEDepthwiseSeparableConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases,
+                                                      const ITensorInfo *pointwise_weights, const ITensorInfo *pointwise_biases, const ITensorInfo *output,
+                                                      const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                      const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+
+    if(is_fused_supported(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, depthwise_conv_info, pointwise_conv_info,
+                          depthwise_act_info, pointwise_act_info))
+    {
+        return Status{};
+    }
+
+    const TensorShape depthwise_out_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input, *depthwise_weights, depthwise_conv_info, 1);
+    const TensorInfo  depthwise_out       = input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(depthwise_out_shape);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseConvolutionLayer::validate(input, depthwise_weights, depthwise_biases, &depthwise_out, depthwise_conv_info, 1, depthwise_act_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer::validate(&depthwise_out, pointwise_weights, pointwise_biases, output, pointwise_conv_info, pointwise_act_info));
+
+    return Status{};
+}
+
+bool NEDepthwiseSeparableConvolutionLayer::is_fused_supported(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases,
+                                                              const ITensorInfo *pointwise_weights, const ITensorInfo *pointwise_biases, const ITensorInfo *output,
+                                                              const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                              const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    const bool is_pointwise = pointwise_conv_info.stride().first == 1 && pointwise_conv_info.stride().second == 1 && !pointwise_conv_info.has_padding();
+
+    return is_pointwise && bool(NEDepthwiseSeparableConvolutionLayerKernel::validate(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output,
+                                                                                      depthwise_conv_info, depthwise_act_info, pointwise_act_info));
+}
+
 void NEDepthwiseSeparableConvolutionLayer::run()
 {
     prepare();
 
-    _depthwise_conv.run();
-    _pointwise_conv.run();
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    if(_is_fused)
+    {
+        NEScheduler::get().schedule(&_fused_kernel, Window::DimZ);
+    }
+    else
+    {
+        _depthwise_conv.run();
+        _pointwise_conv.run();
+    }
 }
 
 void NEDepthwiseSeparableConvolutionLayer::prepare()
 {
-    _depthwise_conv.prepare();
-    _pointwise_conv.prepare();
-}
\ No newline at end of file
+    if(!_is_fused)
+    {
+        _depthwise_conv.prepare();
+        _pointwise_conv.prepare();
+    }
+}
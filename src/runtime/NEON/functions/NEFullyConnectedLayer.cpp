@@ -38,9 +38,18 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace
 {
-Status validate_mm(const ITensorInfo &input, const ITensorInfo &weights, const ITensorInfo &output)
+Status validate_mm(const ITensorInfo &input, const ITensorInfo &weights, const ITensorInfo &output, bool is_dynamic)
 {
-    if(is_data_type_quantized_asymmetric(input.data_type()))
+    if(is_dynamic)
+    {
+        // The input is quantized per row, the weights have already been quantized per output channel
+        const TensorInfo quantized_input(input.clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo()));
+        const TensorInfo input_scales(TensorShape(input.dimension(1)), 1, DataType::F32);
+
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDynamicQuantizationLayerKernel::validate(&input, &quantized_input, &input_scales));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(&quantized_input, &weights, nullptr, &output, GEMMInfo(false, false, true /* Reshape weights only for the first run */)));
+    }
+    else if(is_data_type_quantized_asymmetric(input.data_type()))
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
@@ -75,15 +84,29 @@ Status NEFullyConnectedLayerReshapeWeights::validate(const ITensorInfo *input, c
 }
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _flatten_kernel(), _convert_weights(), _reshape_weights_function(), _mm_gemm(), _mm_gemmlowp(), _gemmlowp_output_stage(), _accumulate_biases_kernel(),
-      _flatten_output(), _gemmlowp_output(), _converted_weights_output(), _reshape_weights_output(), _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false),
-      _is_fc_after_conv(false), _accumulate_biases(false), _is_quantized(false), _is_prepared(false)
+    : _memory_group(std::move(memory_manager)), _flatten_kernel(), _quantize_weights_kernel(), _quantize_input_kernel(), _dequantize_kernel(), _convert_weights(), _reshape_weights_function(),
+      _mm_gemm(), _mm_gemmlowp(), _gemmlowp_output_stage(), _accumulate_biases_kernel(), _flatten_output(), _gemmlowp_output(), _converted_weights_output(), _reshape_weights_output(),
+      _quantized_weights(), _weights_scales(), _quantized_input(), _input_scales(), _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false), _is_fc_after_conv(false),
+      _accumulate_biases(false), _is_quantized(false), _is_dynamic(false), _is_prepared(false)
 {
 }
 
 void NEFullyConnectedLayer::configure_mm(const ITensor *input, const ITensor *weights, ITensor *output)
 {
-    if(_is_quantized)
+    if(_is_dynamic)
+    {
+        // Quantize each row of the input with its own scale
+        _quantized_input.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo()));
+        _memory_group.manage(&_quantized_input);
+        _memory_group.manage(&_input_scales);
+        _quantize_input_kernel.configure(input, &_quantized_input, &_input_scales);
+
+        // Configure gemmlowp function, both operands are symmetric so there is no offset contribution
+        _mm_gemmlowp.configure(&_quantized_input, weights, nullptr, output, GEMMInfo(false, false, true /* Reshape weights only for the first run */));
+
+        _quantized_input.allocator()->allocate();
+    }
+    else if(_is_quantized)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
@@ -153,16 +176,17 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     _is_fc_after_conv      = true;
     _accumulate_biases     = false;
     _is_quantized          = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _is_dynamic            = fc_info.dynamic_quantization;
     _original_weights      = weights;
 
     // Configure gemmlowp output
-    if(_is_quantized)
+    if(_is_quantized || _is_dynamic)
     {
         _gemmlowp_output.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S32));
     }
 
     // Configure accumulate biases kernel for non quantized asymmetric types
-    if(biases != nullptr && !_is_quantized)
+    if(biases != nullptr && !_is_quantized && !_is_dynamic)
     {
         _accumulate_biases = true;
 
@@ -191,11 +215,20 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         _is_fc_after_conv = input->info()->num_dimensions() > 1;
     }
 
+    // Quantize the weights per output channel if needed
+    if(_is_dynamic)
+    {
+        _quantized_weights.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo()));
+        _quantize_weights_kernel.configure(weights, &_quantized_weights, &_weights_scales);
+        _weights_scales.allocator()->allocate();
+        weights_to_use = &_quantized_weights;
+    }
+
     // Reshape weights if needed
     if(!_are_weights_reshaped)
     {
         // Reshape the weights
-        _reshape_weights_function.configure(weights, &_reshape_weights_output);
+        _reshape_weights_function.configure(weights_to_use, &_reshape_weights_output);
         weights_to_use = &_reshape_weights_output;
     }
 
@@ -212,7 +245,7 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         _are_weights_converted = false;
     }
 
-    ITensor *tmp_output = (_is_quantized) ? &_gemmlowp_output : output;
+    ITensor *tmp_output = (_is_quantized || _is_dynamic) ? &_gemmlowp_output : output;
     if(_is_fc_after_conv)
     {
         // Fully Connected layer after a Convolution Layer without batches
@@ -235,6 +268,14 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         _gemmlowp_output.allocator()->allocate();
     }
 
+    // Configure dequantization and bias addition for dynamically quantized types
+    if(_is_dynamic)
+    {
+        _dequantize_kernel.configure(&_gemmlowp_output, &_input_scales, &_weights_scales, biases, output);
+        _gemmlowp_output.allocator()->allocate();
+        _input_scales.allocator()->allocate();
+    }
+
     _are_weights_reshaped = _are_weights_reshaped || fc_info.retain_internal_weights;
 }
 
@@ -243,23 +284,41 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
 {
     ARM_COMPUTE_UNUSED(fc_info.retain_internal_weights);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::BFLOAT16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    if(input->data_type() == DataType::BFLOAT16)
+    {
+        // The GEMM accumulates BFLOAT16 inputs into F32
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    if(fc_info.dynamic_quantization)
+    {
+        // The weights are quantized per output channel, i.e. per row, before being transposed
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fc_info.transpose_weights || fc_info.are_weights_reshaped || fc_info.retain_internal_weights, "Dynamic quantization requires the original weights");
+    }
 
     bool weights_reshaped = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
     bool is_fc_after_conv = true;
     bool is_quantized     = is_data_type_quantized_asymmetric(input->data_type());
+    bool is_dynamic       = fc_info.dynamic_quantization;
 
     const ITensorInfo &flatten_input     = TensorInfo(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_flatten_shape(input)));
-    const ITensorInfo &reshaped_weights  = TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_transposed_shape(*weights)));
+    const ITensorInfo &quantized_weights = TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo()));
+    const ITensorInfo &weights_scales    = TensorInfo(TensorShape(weights->dimension(1)), 1, DataType::F32);
+    const ITensorInfo &reshaped_weights  = TensorInfo((is_dynamic ? quantized_weights : *weights).clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_transposed_shape(*weights)));
     const ITensorInfo &converted_weights = weights_reshaped ? TensorInfo(weights->clone()->set_is_resizable(true).reset_padding()) : TensorInfo(*reshaped_weights.clone());
     const ITensorInfo &gemmlowp_output   = TensorInfo(output->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::S32));
 
     // Configure accumulate biases kernel for non quantized asymmetric types
-    if(biases != nullptr && !is_quantized)
+    if(biases != nullptr && !is_quantized && !is_dynamic)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(output, biases);
         ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixAccumulateBiasesKernel::validate(output, biases));
     }
 
@@ -271,7 +330,7 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
 
     const ITensorInfo *input_to_use   = input;
     const ITensorInfo *weights_to_use = weights;
-    const ITensorInfo *tmp_output     = (is_quantized) ? &gemmlowp_output : output;
+    const ITensorInfo *tmp_output     = (is_quantized || is_dynamic) ? &gemmlowp_output : output;
 
     // Check if we have a fully connected layer with batches
     const bool is_batched_fc_layer = output->dimension(1) > 1;
@@ -287,10 +346,17 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
         is_fc_after_conv = input->num_dimensions() > 1;
     }
 
+    if(is_dynamic)
+    {
+        // Validate weights quantization kernel
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDynamicQuantizationLayerKernel::validate(weights, &quantized_weights, &weights_scales));
+        weights_to_use = &quantized_weights;
+    }
+
     if(!weights_reshaped)
     {
         // Validate reshape weights kernel
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(weights, &reshaped_weights));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(weights_to_use, &reshaped_weights));
         weights_to_use = &reshaped_weights;
     }
 
@@ -319,7 +385,7 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
         ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != weights_to_use->dimension(1));
     }
     // Validate matrix multiply kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(*input_to_use, *weights_to_use, *tmp_output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(*input_to_use, *weights_to_use, *tmp_output, is_dynamic));
 
     // Validate output stage for asymmetric quantized types
     if(is_quantized)
@@ -327,6 +393,13 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
         ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint::validate(&gemmlowp_output, biases, output));
     }
 
+    // Validate dequantization for dynamically quantized types
+    if(is_dynamic)
+    {
+        const TensorInfo input_scales(TensorShape(input_to_use->dimension(1)), 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpDynamicDequantizeKernel::validate(&gemmlowp_output, &input_scales, &weights_scales, biases, output));
+    }
+
     return Status{};
 }
 
@@ -342,8 +415,14 @@ void NEFullyConnectedLayer::run()
         NEScheduler::get().schedule(&_flatten_kernel, Window::DimY);
     }
 
+    // Quantize the input rows
+    if(_is_dynamic)
+    {
+        NEScheduler::get().schedule(&_quantize_input_kernel, Window::DimY);
+    }
+
     // Run matrix multiply
-    if(_is_quantized)
+    if(_is_quantized || _is_dynamic)
     {
         _mm_gemmlowp.run();
     }
@@ -353,7 +432,11 @@ void NEFullyConnectedLayer::run()
     }
 
     // Accumulate biases if provided
-    if(_is_quantized)
+    if(_is_dynamic)
+    {
+        NEScheduler::get().schedule(&_dequantize_kernel, Window::DimY);
+    }
+    else if(_is_quantized)
     {
         _gemmlowp_output_stage.run();
     }
@@ -383,6 +466,16 @@ void NEFullyConnectedLayer::prepare()
         // Pointer to current weights
         const ITensor *cur_weights = _original_weights;
 
+        // Quantization of the weights (happens only once)
+        if(_is_dynamic)
+        {
+            _quantized_weights.allocator()->allocate();
+            NEScheduler::get().schedule(&_quantize_weights_kernel, Window::DimY);
+
+            cur_weights->mark_as_unused();
+            cur_weights = &_quantized_weights;
+        }
+
         // Reshape of the weights (happens only once)
         if(!_are_weights_reshaped)
         {
@@ -405,11 +498,16 @@ void NEFullyConnectedLayer::prepare()
             _are_weights_converted = true;
         }
 
-        // Release reshaped weights if unused
+        // Release quantized and reshaped weights if unused
+        release_unused(&_quantized_weights);
         release_unused(&_reshape_weights_output);
 
         // Prepare GEMM prepare and release unused weights
-        if(!_is_quantized)
+        if(_is_dynamic)
+        {
+            _mm_gemmlowp.prepare();
+        }
+        else if(!_is_quantized)
         {
             _mm_gemm.prepare();
         }
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFusedPointwiseLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_batch_normalization(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const PointwiseOperation &op)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(op.operand + 3 >= operands.size(), "Operand index out of range");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(operands[op.operand], operands[op.operand + 1]);
+
+    const size_t channels = input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+    for(unsigned int i = op.operand; i <= op.operand + 3; ++i)
+    {
+        const ITensorInfo *operand = operands[i];
+        if(operand != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, operand);
+            ARM_COMPUTE_RETURN_ERROR_ON(operand->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(operand->dimension(0) != channels);
+        }
+    }
+    return Status{};
+}
+} // namespace
+
+NEFusedPointwiseLayer::NEFusedPointwiseLayer()
+    : _kernel(), _batch_normalizations(), _is_prepared(false)
+{
+}
+
+void NEFusedPointwiseLayer::configure(const ITensor *input, const std::vector<const ITensor *> &operands, ITensor *output, const std::vector<PointwiseOperation> &operations)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    std::vector<const ITensorInfo *> operands_info;
+    for(const ITensor *operand : operands)
+    {
+        operands_info.emplace_back((operand != nullptr) ? operand->info() : nullptr);
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(NEFusedPointwiseLayer::validate(input->info(), operands_info, output->info(), operations));
+
+    _is_prepared = false;
+    _batch_normalizations.clear();
+
+    // Replace the batch normalizations with scale and shift operations whose operands are computed in prepare()
+    const size_t channels = input->info()->dimension(get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL));
+
+    std::vector<const ITensor *>    kernel_operands(operands);
+    std::vector<PointwiseOperation> kernel_operations;
+    for(const auto &op : operations)
+    {
+        if(op.type == PointwiseOperation::Type::BATCH_NORMALIZATION)
+        {
+            BatchNormalization bn{ operands[op.operand], operands[op.operand + 1], operands[op.operand + 2], operands[op.operand + 3], op.epsilon,
+                                   support::cpp14::make_unique<Tensor>(), support::cpp14::make_unique<Tensor>() };
+            bn.scale->allocator()->init(TensorInfo(TensorShape(channels), 1, input->info()->data_type()));
+            bn.shift->allocator()->init(TensorInfo(TensorShape(channels), 1, input->info()->data_type()));
+
+            kernel_operations.emplace_back(PointwiseOperation::Type::SCALE_SHIFT, kernel_operands.size());
+            kernel_operands.emplace_back(bn.scale.get());
+            kernel_operands.emplace_back(bn.shift.get());
+            _batch_normalizations.emplace_back(std::move(bn));
+        }
+        else
+        {
+            kernel_operations.emplace_back(op);
+        }
+    }
+
+    _kernel.configure(input, kernel_operands, output, kernel_operations);
+}
+
+Status NEFusedPointwiseLayer::validate(const ITensorInfo *input, const std::vector<const ITensorInfo *> &operands, const ITensorInfo *output, const std::vector<PointwiseOperation> &operations)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+
+    const size_t     channels = input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+    const TensorInfo scale_shift_info(TensorShape(channels), 1, input->data_type());
+
+    std::vector<const ITensorInfo *> kernel_operands(operands);
+    std::vector<PointwiseOperation>  kernel_operations;
+    for(const auto &op : operations)
+    {
+        if(op.type == PointwiseOperation::Type::BATCH_NORMALIZATION)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_batch_normalization(input, operands, op));
+            kernel_operations.emplace_back(PointwiseOperation::Type::SCALE_SHIFT, kernel_operands.size());
+            kernel_operands.emplace_back(&scale_shift_info);
+            kernel_operands.emplace_back(&scale_shift_info);
+        }
+        else
+        {
+            kernel_operations.emplace_back(op);
+        }
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFusedPointwiseKernel::validate(input, kernel_operands, output, kernel_operations));
+    return Status{};
+}
+
+void NEFusedPointwiseLayer::run()
+{
+    prepare();
+    NEScheduler::get().schedule(&_kernel, Window::DimY);
+}
+
+void NEFusedPointwiseLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        for(auto &bn : _batch_normalizations)
+        {
+            bn.scale->allocator()->allocate();
+            bn.shift->allocator()->allocate();
+
+            const size_t channels = bn.scale->info()->dimension(0);
+            for(size_t c = 0; c < channels; ++c)
+            {
+                const Coordinates id(c);
+                const float       mean  = *reinterpret_cast<const float *>(bn.mean->ptr_to_element(id));
+                const float       var   = *reinterpret_cast<const float *>(bn.var->ptr_to_element(id));
+                const float       beta  = (bn.beta != nullptr) ? *reinterpret_cast<const float *>(bn.beta->ptr_to_element(id)) : 0.f;
+                const float       gamma = (bn.gamma != nullptr) ? *reinterpret_cast<const float *>(bn.gamma->ptr_to_element(id)) : 1.f;
+                const float       scale = gamma / std::sqrt(var + bn.epsilon);
+
+                *reinterpret_cast<float *>(bn.scale->ptr_to_element(id)) = scale;
+                *reinterpret_cast<float *>(bn.shift->ptr_to_element(id)) = beta - mean * scale;
+            }
+        }
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
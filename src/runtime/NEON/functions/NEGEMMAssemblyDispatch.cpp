@@ -25,16 +25,294 @@
 
 #include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMNativeWrapperKernel.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NESimpleAssemblyFunction.h"
 #include "arm_compute/runtime/NEON/functions/assembly/NEGEMMInterleavedWrapper.h"
 
 #include <arm_neon.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <tuple>
+#include <vector>
 
 namespace arm_compute
 {
 namespace
 {
+/** Tuner used to select the assembly kernels, nullptr to always use the arm_gemm heuristics */
+std::atomic<NEGEMMTuner *> gemm_tuner{ nullptr };
+
+/** Build the identifier of a GEMM configuration in the tuner's table
+ *
+ * @param[in] data_type Data type of the input matrices.
+ * @param[in] args      Matrix multiplication information.
+ *
+ * @return The identifier of the GEMM configuration
+ */
+template <typename TypeOutput>
+std::string gemm_config_id(DataType data_type, const arm_gemm::GemmArgs<TypeOutput> &args)
+{
+    std::stringstream ss;
+    ss << string_from_data_type(data_type) << "_" << cpu_model_to_string(args._ci->get_cpu_model())
+       << "_M" << args._Msize << "_N" << args._Nsize << "_K" << args._Ksize
+       << "_B" << args._nbatches << "_MU" << args._nmulti << "_T" << args._maxthreads
+       << "_PT" << args._pretransposed_hint << "_A" << (args._alpha == static_cast<TypeOutput>(1));
+    if(args._indirect != nullptr)
+    {
+        ss << "_I" << args._indirect->chunk_size;
+    }
+    if(args._convolution != nullptr)
+    {
+        ss << "_C" << args._convolution->kernel_width << "x" << args._convolution->kernel_height;
+    }
+    return ss.str();
+}
+
+/** Fill the parameters used to compute the im2col matrix of a planar input inside arm_gemm
+ *
+ * @param[out] conv        Parameters to fill.
+ * @param[in]  input       NCHW input tensor info.
+ * @param[in]  kernel_dims Width and height of the convolution kernel.
+ * @param[in]  conv_info   Padding and stride information.
+ * @param[in]  dilation    Kernel dilation.
+ * @param[in]  append_bias True if the im2col matrix has a column of ones.
+ */
+void fill_convolution_parameters(arm_gemm::ConvolutionParameters &conv, const ITensorInfo &input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                 bool append_bias)
+{
+    conv.input_width     = input.dimension(0);
+    conv.input_height    = input.dimension(1);
+    conv.input_channels  = input.dimension(2);
+    conv.kernel_width    = kernel_dims.width;
+    conv.kernel_height   = kernel_dims.height;
+    conv.output_width    = scaled_dimensions(conv.input_width, conv.input_height, kernel_dims.width, kernel_dims.height, conv_info, dilation).first;
+    conv.stride_w        = conv_info.stride().first;
+    conv.stride_h        = conv_info.stride().second;
+    conv.dilation_w      = dilation.x();
+    conv.dilation_h      = dilation.y();
+    conv.padding_left    = conv_info.pad_left();
+    conv.padding_top     = conv_info.pad_top();
+    conv.row_stride      = input.strides_in_bytes()[1] / input.element_size();
+    conv.channel_stride  = input.strides_in_bytes()[2] / input.element_size();
+    conv.has_bias_column = append_bias;
+}
+
+/** Fill the table of offsets used to read matrix A of a convolution computed as an indirect GEMM
+ *
+ * The table contains for each output pixel and each kernel position the offset in elements of the corresponding
+ * input pixel from the first element of the batch, or -1 if the kernel position is in the padding area.
+ *
+ * @param[out] offsets     Table to fill, resized to conv_w * conv_h * kernel_dims.area() entries.
+ * @param[in]  input       NHWC input tensor info.
+ * @param[in]  kernel_dims Width and height of the convolution kernel.
+ * @param[in]  conv_info   Padding and stride information.
+ * @param[in]  dilation    Kernel dilation.
+ * @param[in]  conv_w      Width of the output.
+ * @param[in]  conv_h      Height of the output.
+ */
+void fill_indirect_offsets(std::vector<int> &offsets, const ITensorInfo &input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                           unsigned int conv_w, unsigned int conv_h)
+{
+    const int     input_w      = input.dimension(1);
+    const int     input_h      = input.dimension(2);
+    const Strides strides      = input.strides_in_bytes();
+    const size_t  element_size = input.element_size();
+
+    offsets.resize(conv_w * conv_h * kernel_dims.area());
+
+    auto out = offsets.begin();
+    for(unsigned int y = 0; y < conv_h; ++y)
+    {
+        for(unsigned int x = 0; x < conv_w; ++x)
+        {
+            for(unsigned int ky = 0; ky < kernel_dims.height; ++ky)
+            {
+                for(unsigned int kx = 0; kx < kernel_dims.width; ++kx)
+                {
+                    const int in_x = static_cast<int>(x * conv_info.stride().first + kx * dilation.x()) - static_cast<int>(conv_info.pad_left());
+                    const int in_y = static_cast<int>(y * conv_info.stride().second + ky * dilation.y()) - static_cast<int>(conv_info.pad_top());
+
+                    const bool is_padding = (in_x < 0) || (in_x >= input_w) || (in_y < 0) || (in_y >= input_h);
+                    *out++                = is_padding ? -1 : static_cast<int>((in_x * strides[1] + in_y * strides[2]) / element_size);
+                }
+            }
+        }
+    }
+}
+
+/** Allocate a zero initialised scratch buffer */
+void allocate_scratch(Tensor &tensor, size_t size, size_t alignment)
+{
+    tensor.allocator()->init(TensorInfo(TensorShape{ (size + alignment) }, 1, DataType::U8), alignment);
+    tensor.allocator()->allocate();
+    std::memset(tensor.buffer(), 0, size + alignment);
+}
+
+/** Time every arm_gemm kernel compatible with a GEMM configuration
+ *
+ * @note The kernels run on scratch operands: the run time of the kernels doesn't depend on the values of the matrices.
+ *
+ * @param[in] args           Matrix multiplication information.
+ * @param[in] num_iterations Number of timed runs of each kernel.
+ *
+ * @return The description of the fastest kernel, or a default KernelDescription if none could be run.
+ */
+template <typename TypeInput, typename TypeOutput>
+arm_gemm::KernelDescription find_fastest_kernel(const arm_gemm::GemmArgs<TypeOutput> &args, unsigned int num_iterations)
+{
+    const int lda            = args._Ksize;
+    int       batch_stride_a = lda * args._Msize;
+    int       multi_stride_a = batch_stride_a * args._nbatches;
+    if(args._indirect != nullptr)
+    {
+        // Indirect A: a batch of the table must cover the furthest offset of the table
+        const arm_gemm::IndirectParams &indirect   = *args._indirect;
+        const size_t                    table_size = args._Msize * indirect.table_batches * (args._Ksize / indirect.chunk_size);
+        batch_stride_a                             = *std::max_element(indirect.offsets, indirect.offsets + table_size) + indirect.chunk_size;
+        multi_stride_a                             = batch_stride_a * (args._nbatches / indirect.table_batches);
+    }
+    else if(args._convolution != nullptr)
+    {
+        // Convolution A: a batch is an input image
+        batch_stride_a = args._convolution->channel_stride * args._convolution->input_channels;
+        multi_stride_a = batch_stride_a * args._nbatches;
+    }
+    const int ldb            = args._Nsize;
+    const int multi_stride_b = ldb * args._Ksize;
+    const int ldd            = args._Nsize;
+    const int batch_stride_d = ldd * args._Msize;
+    const int multi_stride_d = batch_stride_d * args._nbatches;
+
+    Tensor a{};
+    Tensor b{};
+    Tensor d{};
+    allocate_scratch(a, multi_stride_a * args._nmulti * sizeof(TypeInput), 128);
+    allocate_scratch(b, multi_stride_b * args._nmulti * sizeof(TypeInput), 128);
+    allocate_scratch(d, multi_stride_d * args._nmulti * sizeof(TypeOutput), 128);
+
+    arm_gemm::KernelDescription fastest_kernel{};
+    double                      fastest_time = std::numeric_limits<double>::max();
+
+    for(const auto &candidate : arm_gemm::get_compatible_kernels<TypeInput, TypeOutput>(args))
+    {
+        // GemvBatched forwards its configuration to the GEMM it wraps, therefore it can't be forced through a filter
+        arm_gemm::GemmConfig           cfg(candidate.method);
+        arm_gemm::GemmArgs<TypeOutput> candidate_args = args;
+        cfg.filter                                    = candidate.name;
+        candidate_args._cfg                           = (candidate.method == arm_gemm::GemmMethod::GEMV_BATCHED) ? nullptr : &cfg;
+
+        std::unique_ptr<arm_gemm::GemmCommon<TypeInput, TypeOutput>> gemm = arm_gemm::gemm<TypeInput, TypeOutput>(candidate_args);
+        if(gemm == nullptr)
+        {
+            continue;
+        }
+
+        Tensor workspace{};
+        if(gemm->get_working_size() > 0)
+        {
+            allocate_scratch(workspace, gemm->get_working_size(), 4096);
+            gemm->set_working_space(reinterpret_cast<void *>(workspace.buffer()));
+        }
+        const unsigned int window_size = gemm->get_window_size();
+        const unsigned int num_threads = NEScheduler::get().num_threads();
+        if(window_size < num_threads)
+        {
+            gemm->set_nthreads(window_size);
+        }
+
+        const auto *b_ptr = reinterpret_cast<const TypeInput *>(b.buffer());
+        Tensor      pretranspose{};
+        if(gemm->B_pretranspose_required())
+        {
+            allocate_scratch(pretranspose, gemm->get_B_pretransposed_array_size(), 128);
+            gemm->pretranspose_B_array(pretranspose.buffer(), b_ptr, ldb, multi_stride_b);
+        }
+        gemm->set_arrays(reinterpret_cast<const TypeInput *>(a.buffer()), lda, batch_stride_a, multi_stride_a,
+                         gemm->B_is_pretransposed() ? nullptr : b_ptr, ldb, multi_stride_b,
+                         reinterpret_cast<TypeOutput *>(d.buffer()), ldd, batch_stride_d, multi_stride_d);
+
+        NEGEMMAssemblyWrapperKernel<TypeInput, TypeOutput> kernel;
+        kernel.configure(gemm.get(), candidate.name);
+
+        // Warm-up run
+        NEScheduler::get().schedule(&kernel, Window::DimX);
+
+        double kernel_time = std::numeric_limits<double>::max();
+        for(unsigned int i = 0; i < num_iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            NEScheduler::get().schedule(&kernel, Window::DimX);
+            const auto stop = std::chrono::steady_clock::now();
+            kernel_time     = std::min(kernel_time, std::chrono::duration<double>(stop - start).count());
+        }
+
+        if(kernel_time < fastest_time)
+        {
+            fastest_time   = kernel_time;
+            fastest_kernel = candidate;
+        }
+    }
+
+    return fastest_kernel;
+}
+
+/** Select the arm_gemm kernel to use for a GEMM configuration
+ *
+ * Uses the kernel stored in the tuner's table if any, otherwise tunes the configuration if the tuner allows it,
+ * otherwise falls back to the arm_gemm heuristics.
+ *
+ * @param[in] data_type Data type of the input matrices.
+ * @param[in] args      Matrix multiplication information.
+ *
+ * @return The description of the kernel to use
+ */
+template <typename TypeInput, typename TypeOutput>
+arm_gemm::KernelDescription select_kernel(DataType data_type, const arm_gemm::GemmArgs<TypeOutput> &args)
+{
+    arm_gemm::KernelDescription default_kernel = arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args);
+    default_kernel.is_default                  = true;
+
+    NEGEMMTuner *tuner = gemm_tuner.load();
+    if(tuner == nullptr)
+    {
+        return default_kernel;
+    }
+
+    const std::string gemm_id = gemm_config_id(data_type, args);
+    std::string       kernel_name;
+    if(tuner->find_kernel(gemm_id, kernel_name))
+    {
+        for(const auto &candidate : arm_gemm::get_compatible_kernels<TypeInput, TypeOutput>(args))
+        {
+            if(candidate.name == kernel_name)
+            {
+                return candidate;
+            }
+        }
+        // The kernel isn't available in this build: retune the configuration
+    }
+
+    if(!tuner->tune_new_kernels())
+    {
+        return default_kernel;
+    }
+
+    arm_gemm::KernelDescription fastest_kernel = find_fastest_kernel<TypeInput, TypeOutput>(args, tuner->num_iterations());
+    if(fastest_kernel.method == arm_gemm::GemmMethod::DEFAULT)
+    {
+        return default_kernel;
+    }
+    fastest_kernel.is_default = (fastest_kernel.name == default_kernel.name);
+    tuner->add_kernel_to_table(gemm_id, fastest_kernel.name);
+    return fastest_kernel;
+}
+
 std::unique_ptr<IFunction> create_function_all_types(const arm_gemm::KernelDescription &gemm_kernel_info,
                                                      const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, bool pretranspose_hint,
                                                      std::shared_ptr<IMemoryManager> memory_manager)
@@ -83,9 +361,46 @@ public:
      * @param[in]  b            Input tensor containing the Matrix B.
      * @param[out] d            Output tensor to store the result of matrix multiplication.
      * @param[in]  args         Matrix multiplication information.
+     * @param[in]  kernel_info  Description of the arm_gemm kernel to use.
+     * @param[in]  memory_group Memory group to be used by the function.
+     */
+    void configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const arm_gemm::KernelDescription &kernel_info, MemoryGroup &memory_group);
+    /** Initialise the functions's input and output to compute a convolution as an indirect GEMM.
+     *
+     * @param[in]  a            NHWC input tensor.
+     * @param[in]  b            Input tensor containing the reshaped weights (Matrix B).
+     * @param[out] d            NHWC output tensor.
+     * @param[in]  args         Matrix multiplication information.
+     * @param[in]  kernel_dims  Width and height of the convolution kernel.
+     * @param[in]  conv_info    Padding and stride information.
+     * @param[in]  dilation     Kernel dilation.
+     * @param[in]  memory_group Memory group to be used by the function.
+     */
+    void configure_indirect(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                            const Size2D &dilation, MemoryGroup &memory_group);
+    /** Initialise the functions's input and output to multiply the im2col matrix of the input by matrix B without running im2col.
+     *
+     * @param[in]  a            NCHW input tensor.
+     * @param[in]  b            Input tensor containing the reshaped weights (Matrix B).
+     * @param[out] d            Output tensor to store the result of matrix multiplication.
+     * @param[in]  args         Matrix multiplication information.
+     * @param[in]  kernel_dims  Width and height of the convolution kernel.
+     * @param[in]  conv_info    Padding and stride information.
+     * @param[in]  dilation     Kernel dilation.
+     * @param[in]  append_bias  True if the im2col matrix has a column of ones.
+     * @param[in]  memory_group Memory group to be used by the function.
+     */
+    void configure_fused_im2col(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                const Size2D &dilation, bool append_bias, MemoryGroup &memory_group);
+    /** Initialise the functions's input and output to compute a batch of matrix multiplications.
+     *
+     * @param[in]  a            Input tensor containing one Matrix A per head and batch.
+     * @param[in]  b            Input tensor containing a single Matrix B or one Matrix B per head.
+     * @param[out] d            Output tensor to store the result of the matrix multiplications.
+     * @param[in]  args         Matrix multiplication information.
      * @param[in]  memory_group Memory group to be used by the function.
      */
-    void configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group);
+    void configure_batched(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group);
 
     // Inherited methods overridden:
     void run() override;
@@ -123,16 +438,75 @@ private:
     Tensor _pretranspose{};
     /** Prepared flag */
     bool _is_prepared{ false };
+    /** Offsets of the rows of an indirect matrix A */
+    std::vector<int> _indirect_offsets{};
+    /** Indirect matrix A description passed to arm_gemm */
+    arm_gemm::IndirectParams _indirect_params{};
+    /** Convolution A matrix description passed to arm_gemm */
+    arm_gemm::ConvolutionParameters _convolution_params{};
+    /** True if arm_gemm computes the im2col matrix of the input */
+    bool _is_fused_im2col{ false };
+    /** Input strides the indirect offsets or the convolution parameters were computed for */
+    Strides _indirect_strides{};
+    /** Convolution kernel dimensions, padding, stride and dilation of an indirect or fused im2col GEMM */
+    Size2D        _kernel_dims{};
+    PadStrideInfo _conv_info{};
+    Size2D        _dilation{};
+    bool          _append_bias{ false };
+    /** True if the heads of a batched GEMM are mapped onto the multis of arm_gemm */
+    bool _is_batched{ false };
 };
 
 template <typename TypeInput, typename TypeOutput>
-void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group)
+void Fallback<TypeInput, TypeOutput>::configure_indirect(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const Size2D &kernel_dims,
+                                                         const PadStrideInfo &conv_info, const Size2D &dilation, MemoryGroup &memory_group)
 {
-    arm_gemm::GemmConfig              gemm_cfg;
-    const arm_gemm::KernelDescription gemm_kernel_info = arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args);
-    if(gemm_kernel_info.method != arm_gemm::GemmMethod::GEMV_BATCHED)
+    _kernel_dims      = kernel_dims;
+    _conv_info        = conv_info;
+    _dilation         = dilation;
+    _indirect_strides = a->info()->strides_in_bytes();
+    fill_indirect_offsets(_indirect_offsets, *a->info(), kernel_dims, conv_info, dilation, d->info()->dimension(1), d->info()->dimension(2));
+
+    // A batch of the GEMM is a row of the output: the table covers all the rows of an image
+    _indirect_params = arm_gemm::IndirectParams(_indirect_offsets.data(), a->info()->dimension(0), d->info()->dimension(2));
+    args._indirect   = &_indirect_params;
+
+    configure(a, b, d, args, select_kernel<TypeInput, TypeOutput>(a->info()->data_type(), args), memory_group);
+}
+
+template <typename TypeInput, typename TypeOutput>
+void Fallback<TypeInput, TypeOutput>::configure_fused_im2col(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const Size2D &kernel_dims,
+                                                             const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias, MemoryGroup &memory_group)
+{
+    _kernel_dims      = kernel_dims;
+    _conv_info        = conv_info;
+    _dilation         = dilation;
+    _append_bias      = append_bias;
+    _is_fused_im2col  = true;
+    _indirect_strides = a->info()->strides_in_bytes();
+    fill_convolution_parameters(_convolution_params, *a->info(), kernel_dims, conv_info, dilation, append_bias);
+
+    args._convolution = &_convolution_params;
+
+    configure(a, b, d, args, select_kernel<TypeInput, TypeOutput>(a->info()->data_type(), args), memory_group);
+}
+
+template <typename TypeInput, typename TypeOutput>
+void Fallback<TypeInput, TypeOutput>::configure_batched(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group)
+{
+    _is_batched = true;
+
+    configure(a, b, d, args, select_kernel<TypeInput, TypeOutput>(a->info()->data_type(), args), memory_group);
+}
+
+template <typename TypeInput, typename TypeOutput>
+void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, const arm_gemm::KernelDescription &kernel_info,
+                                                MemoryGroup &memory_group)
+{
+    arm_gemm::GemmConfig gemm_cfg(kernel_info.method);
+    if(kernel_info.method != arm_gemm::GemmMethod::GEMV_BATCHED)
     {
-        gemm_cfg.filter = gemm_kernel_info.name;
+        gemm_cfg.filter = kernel_info.name;
         args._cfg       = &gemm_cfg;
     }
     _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeOutput>(args);
@@ -218,6 +592,21 @@ bool Fallback<TypeInput, TypeOutput>::is_configured() const
 template <typename TypeInput, typename TypeOutput>
 void Fallback<TypeInput, TypeOutput>::run()
 {
+    const bool is_gathered = (_indirect_params.offsets != nullptr) || _is_fused_im2col;
+    if(is_gathered && _a->info()->strides_in_bytes() != _indirect_strides)
+    {
+        // The input padding was extended after configuration: update the parameters in place as arm_gemm holds a pointer to them
+        _indirect_strides = _a->info()->strides_in_bytes();
+        if(_is_fused_im2col)
+        {
+            fill_convolution_parameters(_convolution_params, *_a->info(), _kernel_dims, _conv_info, _dilation, _append_bias);
+        }
+        else
+        {
+            fill_indirect_offsets(_indirect_offsets, *_a->info(), _kernel_dims, _conv_info, _dilation, _d->info()->dimension(1), _d->info()->dimension(2));
+        }
+    }
+
     const int lda = _a->info()->strides_in_bytes().y() / sizeof(TypeInput);
     int       ldb = 0;
     const int ldd = _d->info()->strides_in_bytes().y() / sizeof(TypeOutput);
@@ -227,12 +616,27 @@ void Fallback<TypeInput, TypeOutput>::run()
     const bool is_nhwc           = _a->info()->data_layout() == DataLayout::NHWC;
     const int  stride_in_bytes_a = is_nhwc ? _a->info()->strides_in_bytes().y() * _d->info()->dimension(1) : _a->info()->strides_in_bytes().z();
 
-    const int batch_stride_a = stride_in_bytes_a / sizeof(TypeInput);
-    const int batch_stride_d = _d->info()->strides_in_bytes().z() / sizeof(TypeOutput);
+    // For a gathered A matrix the batch stride is the stride between images, as it is for the output of a fused im2col GEMM
+    int batch_stride_a = is_gathered ? _a->info()->strides_in_bytes()[3] / sizeof(TypeInput) : stride_in_bytes_a / sizeof(TypeInput);
+    int batch_stride_d = _d->info()->strides_in_bytes()[_is_fused_im2col ? 3 : 2] / sizeof(TypeOutput);
+
+    int multi_stride_a = _a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
+    int multi_stride_b = 0;
+    int multi_stride_d = _d->info()->strides_in_bytes()[3] / sizeof(TypeOutput);
+
+    if(_is_batched)
+    {
+        // With one matrix B per head the heads are the multis and the 4th dimension the batches,
+        // otherwise B is broadcast and the heads and 4th dimension are all batches of the same multi
+        const bool   per_head_b = _b->info()->tensor_shape().total_size_upper(2) > 1;
+        const size_t batch_dim  = per_head_b ? 3 : 2;
+        const size_t multi_dim  = per_head_b ? 2 : 3;
 
-    const int multi_stride_a = _a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
-    int       multi_stride_b = 0;
-    const int multi_stride_d = _d->info()->strides_in_bytes()[3] / sizeof(TypeOutput);
+        batch_stride_a = _a->info()->strides_in_bytes()[batch_dim] / sizeof(TypeInput);
+        batch_stride_d = _d->info()->strides_in_bytes()[batch_dim] / sizeof(TypeOutput);
+        multi_stride_a = _a->info()->strides_in_bytes()[multi_dim] / sizeof(TypeInput);
+        multi_stride_d = _d->info()->strides_in_bytes()[multi_dim] / sizeof(TypeOutput);
+    }
 
     const auto       in0_ptr = reinterpret_cast<const TypeInput *>(_a->buffer() + _a->info()->offset_first_element_in_bytes());
     const TypeInput *in1_ptr = nullptr;
@@ -279,19 +683,129 @@ void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::
 
     arm_gemm::GemmArgs<TypeOutput> args(&ci, p.M, p.N, p.K, p.batches, p.multis, false, false, alpha, beta, num_threads, pretranspose_hint);
 
-    //Try to create an ACL function:
-    acl_function = create_function_all_types(arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args), a, b, d, alpha, beta, pretranspose_hint, std::move(memory_manager));
+    const arm_gemm::KernelDescription kernel_info = select_kernel<TypeInput, TypeOutput>(a->info()->data_type(), args);
+
+    //Try to create an ACL function: the ACL functions select their kernel through the arm_gemm heuristics so only use them for the default kernel
+    //Note: The ACL functions don't have BFLOAT16 strategies, BFLOAT16 always goes through arm_gemm
+    if(kernel_info.is_default && a->info()->data_type() != DataType::BFLOAT16)
+    {
+        acl_function = create_function_all_types(kernel_info, a, b, d, alpha, beta, pretranspose_hint, std::move(memory_manager));
+    }
 
     //If we still don't have an ACL function:
     if(acl_function == nullptr)
     {
         //Fallback onto arm_gemm function if ACL doesn't support this method.
         auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
-        fallback->configure(a, b, d, args, memory_group);
+        fallback->configure(a, b, d, args, kernel_info, memory_group);
         arm_gemm = std::move(fallback);
     }
 }
 
+template <typename TypeOutput>
+arm_gemm::GemmArgs<TypeOutput> indirect_gemm_args(const ITensorInfo *b, const ITensorInfo *d)
+{
+    const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    // Each row of the output is a batch of M = output width rows
+    const unsigned int M       = d->dimension(1);
+    const unsigned int N       = d->dimension(0);
+    const unsigned int K       = b->dimension(1);
+    const unsigned int batches = d->dimension(2) * d->dimension(3);
+
+    return arm_gemm::GemmArgs<TypeOutput>(&ci, M, N, K, batches, 1, false, false, 1.f, 0.f, num_threads, true);
+}
+
+template <typename TypeInput, typename TypeOutput>
+bool has_indirect_arm_gemm(const ITensorInfo *b, const ITensorInfo *d)
+{
+    // Only the presence of the indirect description matters to the kernel selection
+    const arm_gemm::IndirectParams indirect_params{};
+    arm_gemm::GemmArgs<TypeOutput> args = indirect_gemm_args<TypeOutput>(b, d);
+    args._indirect                      = &indirect_params;
+    return arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args).method != arm_gemm::GemmMethod::DEFAULT;
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_indirect_arm_gemm(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group, const ITensor *a, const ITensor *b, ITensor *d,
+                              const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    const arm_gemm::GemmArgs<TypeOutput> args = indirect_gemm_args<TypeOutput>(b->info(), d->info());
+
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure_indirect(a, b, d, args, kernel_dims, conv_info, dilation, memory_group);
+    arm_gemm = std::move(fallback);
+}
+
+template <typename TypeOutput>
+arm_gemm::GemmArgs<TypeOutput> fused_im2col_gemm_args(const ITensorInfo *b, const ITensorInfo *d)
+{
+    const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    const unsigned int M       = d->dimension(1);
+    const unsigned int N       = d->dimension(0);
+    const unsigned int K       = b->dimension(1);
+    const unsigned int batches = d->tensor_shape().total_size_upper(2);
+
+    return arm_gemm::GemmArgs<TypeOutput>(&ci, M, N, K, batches, 1, false, false, 1.f, 0.f, num_threads, true);
+}
+
+template <typename TypeInput, typename TypeOutput>
+bool has_fused_im2col_arm_gemm(const ITensorInfo *b, const ITensorInfo *d)
+{
+    // Only the presence of the convolution description matters to the kernel selection
+    const arm_gemm::ConvolutionParameters convolution_params{};
+    arm_gemm::GemmArgs<TypeOutput>        args = fused_im2col_gemm_args<TypeOutput>(b, d);
+    args._convolution                          = &convolution_params;
+    return arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args).method != arm_gemm::GemmMethod::DEFAULT;
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_fused_im2col_arm_gemm(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group, const ITensor *a, const ITensor *b, ITensor *d,
+                                  const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias)
+{
+    const arm_gemm::GemmArgs<TypeOutput> args = fused_im2col_gemm_args<TypeOutput>(b->info(), d->info());
+
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure_fused_im2col(a, b, d, args, kernel_dims, conv_info, dilation, append_bias, memory_group);
+    arm_gemm = std::move(fallback);
+}
+
+template <typename TypeOutput>
+arm_gemm::GemmArgs<TypeOutput> batched_gemm_args(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint)
+{
+    const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    const unsigned int M       = d->dimension(1);
+    const unsigned int N       = d->dimension(0);
+    const unsigned int K       = a->dimension(0);
+    const unsigned int multis  = b->tensor_shape().total_size_upper(2);
+    const unsigned int batches = d->tensor_shape().total_size_upper(2) / multis;
+
+    return arm_gemm::GemmArgs<TypeOutput>(&ci, M, N, K, batches, multis, false, false, alpha, beta, num_threads, pretranspose_hint);
+}
+
+template <typename TypeInput, typename TypeOutput>
+bool has_batched_arm_gemm(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint)
+{
+    const arm_gemm::GemmArgs<TypeOutput> args = batched_gemm_args<TypeOutput>(a, b, d, alpha, beta, pretranspose_hint);
+    return arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args).method != arm_gemm::GemmMethod::DEFAULT;
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_batched_arm_gemm(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group, const ITensor *a, const ITensor *b, ITensor *d,
+                             float alpha, float beta, bool pretranspose_hint)
+{
+    const arm_gemm::GemmArgs<TypeOutput> args = batched_gemm_args<TypeOutput>(a->info(), b->info(), d->info(), alpha, beta, pretranspose_hint);
+
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure_batched(a, b, d, args, memory_group);
+    arm_gemm = std::move(fallback);
+}
+
 } //namespace
 
 NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager)
@@ -299,6 +813,11 @@ NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> m
 {
 }
 
+void NEGEMMAssemblyDispatch::set_tuner(NEGEMMTuner *tuner)
+{
+    gemm_tuner.store(tuner);
+}
+
 Status NEGEMMAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint)
 {
     ARM_COMPUTE_UNUSED(alpha);
@@ -307,15 +826,20 @@ Status NEGEMMAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
 #ifndef __aarch64__
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 || a->data_type() == DataType::S8 || a->data_type() == DataType::QASYMM8, "8bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 || a->data_type() == DataType::S8 || a->data_type() == DataType::QASYMM8 || a->data_type() == DataType::QASYMM8_SIGNED, "8bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16, "16bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::BFLOAT16, "BFLOAT16 only supported for aarch64");
 #endif /* __aarch64__ */
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::U8, DataType::QASYMM8, DataType::S8, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::S8, DataType::S16, DataType::F16, DataType::BFLOAT16);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::F32 && d->data_type() != DataType::F32, "Only F32 output supported for F32 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::F16 && d->data_type() != DataType::F16, "Only F16 output supported for F16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 && d->data_type() != DataType::U32, "Only U32 output supported for U8 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::QASYMM8 && d->data_type() != DataType::S32 && d->data_type() != DataType::U32, "Only U32/S32 output supported for QASYMM8 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S8 && d->data_type() != DataType::S32, "Only S32 output supported for S8 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::QASYMM8_SIGNED && d->data_type() != DataType::S32, "Only S32 output supported for QASYMM8_SIGNED input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16 && d->data_type() != DataType::S32, "Only S32 output supported for S16 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::BFLOAT16 && d->data_type() != DataType::F32, "Only F32 output supported for BFLOAT16 input");
     return Status{};
 }
 
@@ -342,8 +866,15 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, ITens
             create_function_or_arm_gemm<uint8_t, uint32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
             break;
         case DataType::S8:
+        case DataType::QASYMM8_SIGNED:
             create_function_or_arm_gemm<int8_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
             break;
+        case DataType::S16:
+            create_function_or_arm_gemm<int16_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            break;
+        case DataType::BFLOAT16:
+            create_function_or_arm_gemm<bfloat16, float>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            break;
 #endif /* __aarch64__ */
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
@@ -355,6 +886,191 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, ITens
     }
 }
 
+Status NEGEMMAssemblyDispatch::validate_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                 const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(a, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(a, d);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.area() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(0) != d->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(1) != kernel_dims.area() * a->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(2) != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(3) != a->dimension(3));
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(a->dimension(1), a->dimension(2), kernel_dims.width, kernel_dims.height, conv_info, dilation);
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(1) != conv_w || d->dimension(2) != conv_h);
+
+    // The offsets of the table are stored as int
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->strides_in_bytes()[3] / a->element_size() > static_cast<size_t>(std::numeric_limits<int>::max()), "Input too large for an indirect GEMM");
+
+    bool has_kernel = false;
+    switch(a->data_type())
+    {
+        case DataType::F32:
+            has_kernel = has_indirect_arm_gemm<float, float>(b, d);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            has_kernel = has_indirect_arm_gemm<float16_t, float16_t>(b, d);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!has_kernel, "No assembly kernel found for the indirect GEMM");
+    return Status{};
+}
+
+void NEGEMMAssemblyDispatch::configure_indirect(const ITensor *a, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMAssemblyDispatch::validate_indirect(a->info(), b->info(), d->info(), kernel_dims, conv_info, dilation));
+
+    switch(a->info()->data_type())
+    {
+        case DataType::F32:
+            create_indirect_arm_gemm<float, float>(_arm_gemm, _memory_group, a, b, d, kernel_dims, conv_info, dilation);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            create_indirect_arm_gemm<float16_t, float16_t>(_arm_gemm, _memory_group, a, b, d, kernel_dims, conv_info, dilation);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+            break;
+    }
+}
+
+Status NEGEMMAssemblyDispatch::validate_fused_im2col(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                     const Size2D &dilation, bool append_bias)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(a, DataLayout::NCHW);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.area() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(0) != d->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(1) != kernel_dims.area() * a->dimension(2) + (append_bias ? 1 : 0));
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(2) != 1);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(a->dimension(0), a->dimension(1), kernel_dims.width, kernel_dims.height, conv_info, dilation);
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(1) != conv_w * conv_h);
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(2) != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(d->tensor_shape().total_size_upper(3) != a->tensor_shape().total_size_upper(3));
+
+    // The strides passed to arm_gemm are stored as int
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->strides_in_bytes()[3] / a->element_size() > static_cast<size_t>(std::numeric_limits<int>::max()), "Input too large for a fused im2col GEMM");
+
+    bool has_kernel = false;
+    switch(a->data_type())
+    {
+        case DataType::F32:
+            has_kernel = has_fused_im2col_arm_gemm<float, float>(b, d);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            has_kernel = has_fused_im2col_arm_gemm<float16_t, float16_t>(b, d);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!has_kernel, "No assembly kernel found for the fused im2col GEMM");
+    return Status{};
+}
+
+void NEGEMMAssemblyDispatch::configure_fused_im2col(const ITensor *a, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                                    bool append_bias)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMAssemblyDispatch::validate_fused_im2col(a->info(), b->info(), d->info(), kernel_dims, conv_info, dilation, append_bias));
+
+    switch(a->info()->data_type())
+    {
+        case DataType::F32:
+            create_fused_im2col_arm_gemm<float, float>(_arm_gemm, _memory_group, a, b, d, kernel_dims, conv_info, dilation, append_bias);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            create_fused_im2col_arm_gemm<float16_t, float16_t>(_arm_gemm, _memory_group, a, b, d, kernel_dims, conv_info, dilation, append_bias);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+            break;
+    }
+}
+
+Status NEGEMMAssemblyDispatch::validate_batched(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON(a->num_dimensions() > 4 || b->num_dimensions() > 4 || d->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1), "The number of columns of A must match the number of rows of B");
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(0) != b->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(1) != a->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(2) != a->dimension(2) || d->dimension(3) != a->dimension(3));
+
+    // B is either broadcast to all the heads or has one matrix per head, which can itself be broadcast along the 4th dimension
+    const bool is_broadcast_b = b->tensor_shape().total_size_upper(2) == 1;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_broadcast_b && (b->dimension(2) != d->dimension(2) || (b->dimension(3) != 1 && b->dimension(3) != d->dimension(3))),
+                                    "B must be a single matrix or have one matrix per head");
+
+    // The strides passed to arm_gemm are stored as int
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->strides_in_bytes()[3] / a->element_size() > static_cast<size_t>(std::numeric_limits<int>::max()), "Input too large for a batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->strides_in_bytes()[3] / d->element_size() > static_cast<size_t>(std::numeric_limits<int>::max()), "Output too large for a batched GEMM");
+
+    bool has_kernel = false;
+    switch(a->data_type())
+    {
+        case DataType::F32:
+            has_kernel = has_batched_arm_gemm<float, float>(a, b, d, alpha, beta, pretranspose_hint);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            has_kernel = has_batched_arm_gemm<float16_t, float16_t>(a, b, d, alpha, beta, pretranspose_hint);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!has_kernel, "No assembly kernel found for the batched GEMM");
+    return Status{};
+}
+
+void NEGEMMAssemblyDispatch::configure_batched(const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, bool pretranspose_hint)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMAssemblyDispatch::validate_batched(a->info(), b->info(), d->info(), alpha, beta, pretranspose_hint));
+
+    switch(a->info()->data_type())
+    {
+        case DataType::F32:
+            create_batched_arm_gemm<float, float>(_arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            create_batched_arm_gemm<float16_t, float16_t>(_arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+            break;
+    }
+}
+
 void NEGEMMAssemblyDispatch::prepare()
 {
     if(_function != nullptr)
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape compute_batched_gemm_output_shape(const ITensorInfo &a, const ITensorInfo &b)
+{
+    TensorShape output_shape = a.tensor_shape();
+    output_shape.set(0, b.dimension(0));
+    return output_shape;
+}
+} // namespace
+
+NEGEMMBatched::NEGEMMBatched(std::shared_ptr<IMemoryManager> memory_manager)
+    : _asm_glue(std::move(memory_manager))
+{
+}
+
+void NEGEMMBatched::configure(const ITensor *a, const ITensor *b, ITensor *d, float alpha, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+
+    // Auto initialize the output if not initialized
+    auto_init_if_empty(*d->info(), a->info()->clone()->set_tensor_shape(compute_batched_gemm_output_shape(*a->info(), *b->info())));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMBatched::validate(a->info(), b->info(), d->info(), alpha, gemm_info));
+
+    _asm_glue.configure_batched(a, b, d, alpha, 0.f, gemm_info.reshape_b_only_on_first_run());
+    ARM_COMPUTE_ERROR_ON_MSG(!_asm_glue.is_configured(), "No assembly kernel found for the batched GEMM");
+}
+
+Status NEGEMMBatched::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped() || gemm_info.is_b_reshaped(), "Reshaped matrices are not supported");
+
+    if(d->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(d->tensor_shape(), compute_batched_gemm_output_shape(*a, *b));
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate_batched(a, b, d, alpha, 0.f, gemm_info.reshape_b_only_on_first_run()));
+    return Status{};
+}
+
+void NEGEMMBatched::run()
+{
+    _asm_glue.run();
+}
+
+void NEGEMMBatched::prepare()
+{
+    _asm_glue.prepare();
+}
+} // namespace arm_compute
@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 #include <tuple>
@@ -38,6 +39,60 @@
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
+namespace
+{
+/** Check if a convolution can be computed as an indirect GEMM reading the input directly instead of an im2col matrix */
+bool use_indirect_gemm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    if(input->data_layout() != DataLayout::NHWC || is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        return false;
+    }
+
+    const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(*weights), 1, input->data_type());
+    const Size2D     kernel_dims(weights->dimension(1), weights->dimension(2));
+    return bool(NEGEMMAssemblyDispatch::validate_indirect(input, &weights_reshaped_info, output, kernel_dims, conv_info, dilation));
+}
+
+/** Check if the im2col matrix of a convolution can be computed inside the GEMM, one block of rows at a time, rather than by @ref NEIm2ColKernel */
+bool use_fused_im2col(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias)
+{
+    if(input->data_layout() != DataLayout::NCHW || is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        return false;
+    }
+
+    const Size2D kernel_dims(weights->dimension(0), weights->dimension(1));
+    TensorShape  shape_gemm = compute_im2col_conv_shape(input, kernel_dims, conv_info, append_bias, dilation, false);
+    shape_gemm.set(0, weights->dimension(3));
+
+    const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(*weights, append_bias), 1, input->data_type());
+    const TensorInfo gemm_output_info(shape_gemm, 1, input->data_type());
+    return bool(NEGEMMAssemblyDispatch::validate_fused_im2col(input, &weights_reshaped_info, &gemm_output_info, kernel_dims, conv_info, dilation, append_bias));
+}
+
+/** Computes the info of the kernels a weights matrix reshaped by @ref NEConvolutionLayerReshapeWeights without biases was computed from
+ *
+ * @param[in] weights      Reshaped weights, [OFM, kernel_x * kernel_y * IFM]
+ * @param[in] weights_info Size of the kernels
+ * @param[in] data_layout  Data layout of the convolution
+ *
+ * @return The info of the 4D weights
+ */
+TensorInfo kernels_info_from_reshaped(const ITensorInfo &weights, const WeightsInfo &weights_info, DataLayout data_layout)
+{
+    const unsigned int kernel_width  = weights_info.kernel_size().first;
+    const unsigned int kernel_height = weights_info.kernel_size().second;
+    const unsigned int num_channels  = weights.dimension(1) / std::max(kernel_width * kernel_height, 1U);
+    const TensorShape  shape         = (data_layout == DataLayout::NCHW) ? TensorShape(kernel_width, kernel_height, num_channels, weights.dimension(0)) :
+                                       TensorShape(num_channels, kernel_width, kernel_height, weights.dimension(0));
+
+    TensorInfo info(shape, 1, weights.data_type());
+    info.set_quantization_info(weights.quantization_info()).set_data_layout(data_layout);
+    return info;
+}
+} // namespace
+
 NEConvolutionLayerReshapeWeights::NEConvolutionLayerReshapeWeights()
     : _weights_reshape_kernel()
 {
@@ -51,7 +106,7 @@ void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const I
                                                                           (biases != nullptr) ? biases->info() : nullptr,
                                                                           output->info()));
 
-    const bool     append_biases = (biases != nullptr) && !is_data_type_quantized_asymmetric(weights->info()->data_type());
+    const bool     append_biases = (biases != nullptr) && !is_data_type_quantized_asymmetric(weights->info()->data_type()) && (weights->info()->data_type() != DataType::BFLOAT16);
     const ITensor *biases_to_use = (append_biases) ? biases : nullptr;
 
     _weights_reshape_kernel.configure(weights, biases_to_use, output);
@@ -62,13 +117,14 @@ void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const I
 Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     if(biases != nullptr)
     {
         const int idx_kernels = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::BATCHES);
         ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized_asymmetric(weights->data_type()));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->data_type() == DataType::BFLOAT16, "Biases cannot be appended to BFLOAT16 weights");
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(weights, biases);
         ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(idx_kernels));
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
@@ -90,9 +146,10 @@ void NEConvolutionLayerReshapeWeights::run()
 }
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _reshape_weights(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager), _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(),
-      _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false),
-      _skip_col2im(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
+    : _memory_group(memory_manager), _convert_weights_kernel(), _reshape_weights(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_im2col_free(memory_manager), _mm_gemmlowp(memory_manager),
+      _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_converted(), _weights_reshaped(), _gemm_output(),
+      _tmp_output(), _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false), _skip_col2im(false), _use_indirect(false), _fuse_im2col(false), _add_bias(false),
+      _is_quantized(false), _is_quantized_per_channel(false), _is_activationlayer_enabled(false), _are_weights_reshaped(false), _is_prepared(false)
 {
 }
 
@@ -149,6 +206,14 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
         output_info.gemmlowp_min_bound  = min_activation;
         output_info.gemmlowp_max_bound  = max_activation;
 
+        // Requantize each output channel with its own multiplier and shift
+        if(weights_quantization_info.is_per_channel())
+        {
+            output_info.is_quantized_per_channel = true;
+            quantization::calculate_quantized_multipliers_less_than_one(input_quantization_info.scale, weights_quantization_info.channel_scales, output_quant_info.scale,
+                                                                        &output_info.gemmlowp_multipliers, &output_info.gemmlowp_shifts);
+        }
+
         _mm_gemmlowp.configure(input, weights, biases, output, GEMMInfo(false, false, true, gemm_3d_depth, _skip_im2col, false, output_info));
 
         // Revert back QuantizatioInfo as input and weights could be used in other convolution layers
@@ -214,6 +279,14 @@ Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITens
         output_info.gemmlowp_min_bound  = min_activation;
         output_info.gemmlowp_max_bound  = max_activation;
 
+        // Requantize each output channel with its own multiplier and shift
+        if(weights_quantization_info.is_per_channel())
+        {
+            output_info.is_quantized_per_channel = true;
+            ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers_less_than_one(input_quantization_info.scale, weights_quantization_info.channel_scales, output_quant_info.scale,
+                                                                                                    &output_info.gemmlowp_multipliers, &output_info.gemmlowp_shifts));
+        }
+
         // Perform validation step on GEMMLowp
         return NEGEMMLowpMatrixMultiplyCore::validate(input_qa.get(), weights_qa.get(), biases, output, GEMMInfo(false, false, true, gemm_3d_depth, skip_im2col, false, output_info));
     }
@@ -226,14 +299,15 @@ Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITens
 
 Status NEGEMMConvolutionLayer::validate_gemm3d(const ITensorInfo *input_info, const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col)
 {
-    const DataType     data_type = input_info->data_type();
-    const unsigned int mult_y    = skip_im2col ? 1U : gemm_3d_depth;
-    const unsigned int mult_z    = skip_im2col ? gemm_3d_depth : 1U;
+    const DataType     data_type        = input_info->data_type();
+    const DataType     output_data_type = (data_type == DataType::BFLOAT16) ? DataType::F32 : data_type;
+    const unsigned int mult_y           = skip_im2col ? 1U : gemm_3d_depth;
+    const unsigned int mult_z           = skip_im2col ? gemm_3d_depth : 1U;
 
     // Set dummy tensor shapes for the validation
     const TensorInfo dummy_input_info(TensorShape(4U, 4U * mult_y, 1U * mult_z), 1, data_type, input_info->quantization_info());
     const TensorInfo dummy_weights_info(TensorShape(4U, 4U), 1, data_type);
-    const TensorInfo dummy_output_info(TensorShape(4U, 4U, gemm_3d_depth), 1, data_type, input_info->quantization_info());
+    const TensorInfo dummy_output_info(TensorShape(4U, 4U, gemm_3d_depth), 1, output_data_type, input_info->quantization_info());
 
     return validate_mm(&dummy_input_info, &dummy_weights_info, nullptr, &dummy_output_info, act_info, gemm_3d_depth, skip_im2col);
 }
@@ -254,20 +328,27 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                                 num_groups));
 
     const DataType   data_type   = input->info()->data_type();
+    const bool       is_bf16     = data_type == DataType::BFLOAT16;
     const DataLayout data_layout = input->info()->data_layout();
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const int        idx_kernels = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
 
-    const unsigned int kernel_width  = weights->info()->dimension(idx_width);
-    const unsigned int kernel_height = weights->info()->dimension(idx_height);
+    // The shapes of the kernels are recovered from weights_info if the weights are already reshaped
+    const TensorInfo   reshaped_kernels_info = weights_info.are_reshaped() ? kernels_info_from_reshaped(*weights->info(), weights_info, data_layout) : TensorInfo();
+    const ITensorInfo *kernels_info          = weights_info.are_reshaped() ? &reshaped_kernels_info : weights->info();
+
+    const unsigned int kernel_width  = kernels_info->dimension(idx_width);
+    const unsigned int kernel_height = kernels_info->dimension(idx_height);
 
     _is_prepared                = weights_info.retain_internal_weights();
     _original_weights           = weights;
+    _are_weights_reshaped       = weights_info.are_reshaped();
     _is_quantized               = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _is_quantized_per_channel   = is_data_type_quantized_per_channel(weights->info()->data_type());
     _data_layout                = data_layout;
     _skip_im2col                = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
-    _append_bias                = (biases != nullptr) && (!_is_quantized);
+    _append_bias                = (biases != nullptr) && (!_is_quantized) && (!is_bf16) && (!_are_weights_reshaped);
     _is_activationlayer_enabled = act_info.enabled();
 
     const ITensor *gemm_input_to_use  = input;
@@ -298,34 +379,61 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         _skip_col2im = false;
     }
 
+    // Read the rows of the GEMM from the input through a table of offsets rather than from an im2col matrix when possible
+    _use_indirect = !_skip_im2col && use_indirect_gemm(input->info(), kernels_info, output->info(), conv_info, dilation);
+    if(_use_indirect)
+    {
+        _skip_im2col = true;
+        _skip_col2im = true;
+    }
+
+    // Otherwise let the GEMM compute the im2col matrix by blocks of rows rather than running im2col when possible
+    _fuse_im2col = !_skip_im2col && use_fused_im2col(input->info(), kernels_info, conv_info, dilation, _append_bias);
+
     const ITensor *biases_to_use = (_append_bias && !_skip_im2col) ? biases : nullptr;
 
+    // The F32 biases of a BFLOAT16 convolution and the biases of weights passed reshaped are not appended to the weights:
+    // add them to the output of the GEMM instead
+    _add_bias = (biases != nullptr) && (!_is_quantized) && (_skip_im2col || is_bf16 || _are_weights_reshaped);
+
     // Get parameters from conv_info
     unsigned int stride_x = 0;
     unsigned int stride_y = 0;
     std::tie(stride_x, stride_y) = conv_info.stride();
 
-    unsigned int mat_weights_cols = weights->info()->dimension(idx_kernels);
+    unsigned int mat_weights_cols = kernels_info->dimension(idx_kernels);
+
+    const ITensor *gemm_weights = weights;
+    if(!_are_weights_reshaped)
+    {
+        // Per channel quantized weights are signed: convert them to QASYMM8 with an offset of 128 so that they can be used by NEGEMMLowpMatrixMultiplyCore
+        const ITensor *weights_to_reshape = weights;
+        if(_is_quantized_per_channel)
+        {
+            _convert_weights_kernel.configure(weights, &_weights_converted);
+            weights_to_reshape = &_weights_converted;
+        }
 
-    // _weights_reshaped will be auto configured in the kernel.
-    // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
-    _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped);
+        // _weights_reshaped will be auto configured in the kernel.
+        // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
+        _reshape_weights.configure(weights_to_reshape, biases_to_use, &_weights_reshaped);
+        gemm_weights = &_weights_reshaped;
+    }
 
     // Create tensor to store im2col reshaped inputs
     if(!_skip_im2col)
     {
-        _memory_group.manage(&_im2col_output);
+        // No im2col tensor is needed if the GEMM computes the im2col matrix
+        if(!_fuse_im2col)
+        {
+            _memory_group.manage(&_im2col_output);
 
-        // Configure
-        _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, _append_bias, dilation);
+            // Configure
+            _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, _append_bias, dilation);
 
-        // Update GEMM input
-        gemm_input_to_use = &_im2col_output;
-    }
-    else if(_append_bias)
-    {
-        // Configure add bias kernel
-        _add_bias_kernel.configure(output, biases, output, ConvertPolicy::SATURATE);
+            // Update GEMM input
+            gemm_input_to_use = &_im2col_output;
+        }
     }
 
     // Create temporary GEMM output tensor in case we cannot skip col2im
@@ -334,12 +442,12 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         TensorShape shape_gemm;
 
         // Calculate GEMM output shape
-        shape_gemm = _im2col_output.info()->tensor_shape();
+        shape_gemm = _fuse_im2col ? compute_im2col_conv_shape(input->info(), Size2D(kernel_width, kernel_height), conv_info, _append_bias, dilation, false) : _im2col_output.info()->tensor_shape();
         shape_gemm.set(0, mat_weights_cols);
         shape_gemm.set(1, conv_w * conv_h);
 
         // FIXME: input->clone() doesn't work with subtensors for grouped convolutions.
-        TensorInfo info_gemm(shape_gemm, 1, data_type);
+        TensorInfo info_gemm(shape_gemm, 1, is_bf16 ? DataType::F32 : data_type);
         info_gemm.set_quantization_info(output->info()->quantization_info()).set_data_layout(input->info()->data_layout());
         _gemm_output.allocator()->init(info_gemm);
         _memory_group.manage(&_gemm_output);
@@ -351,9 +459,26 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Configure GEMM
     // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
     const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
-    configure_mm(gemm_input_to_use, &_weights_reshaped, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    if(_use_indirect)
+    {
+        _mm_im2col_free.configure_indirect(input, gemm_weights, output, Size2D(kernel_width, kernel_height), conv_info, dilation);
+    }
+    else if(_fuse_im2col)
+    {
+        _mm_im2col_free.configure_fused_im2col(input, gemm_weights, gemm_output_to_use, Size2D(kernel_width, kernel_height), conv_info, dilation, _append_bias);
+    }
+    else
+    {
+        configure_mm(gemm_input_to_use, gemm_weights, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    }
 
-    if(!_skip_im2col)
+    if(_add_bias)
+    {
+        // Configure add bias kernel
+        _add_bias_kernel.configure(gemm_output_to_use, biases, gemm_output_to_use, ConvertPolicy::SATURATE);
+    }
+
+    if(!_skip_im2col && !_fuse_im2col)
     {
         _im2col_output.allocator()->allocate();
     }
@@ -390,27 +515,57 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     {
         _activationlayer_function.configure(output, nullptr, act_info);
     }
-
-    ARM_COMPUTE_UNUSED(weights_info);
 }
 
 Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
                                         const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported on NEON");
 
+    // Weights already reshaped are validated through the kernels they were computed from
+    const ITensorInfo *reshaped_weights = nullptr;
+    TensorInfo         reshaped_kernels_info{};
+    if(weights_info.are_reshaped())
+    {
+        const unsigned int kernel_area = weights_info.kernel_size().first * weights_info.kernel_size().second;
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(weights->data_type()), "Per channel quantized weights can't be passed reshaped");
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(kernel_area == 0 || (weights->dimension(1) % kernel_area) != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != weights_info.num_kernels());
+
+        reshaped_kernels_info = kernels_info_from_reshaped(*weights, weights_info, input->data_layout());
+        reshaped_weights      = weights;
+        weights               = &reshaped_kernels_info;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+
     const DataLayout data_layout = input->data_layout();
     const DataType   data_type   = input->data_type();
+    const bool       is_bf16     = data_type == DataType::BFLOAT16;
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
     const int        idx_kernels = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
 
+    if(is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->quantization_info().channel_scales.size() != weights->dimension(idx_kernels), "Weights must have one scale per output channel");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
+
+    // The GEMM accumulates BFLOAT16 inputs into F32
+    const DataType gemm_output_data_type = is_bf16 ? DataType::F32 : data_type;
+    if(is_bf16 && output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    }
+
     const unsigned int kernel_width  = weights->dimension(idx_width);
     const unsigned int kernel_height = weights->dimension(idx_height);
 
@@ -423,7 +578,7 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     const ITensorInfo *weights_to_use     = weights;
 
     const bool is_quantized          = is_data_type_quantized_asymmetric(data_type);
-    const bool append_bias           = (biases != nullptr) && (!is_quantized);
+    const bool append_bias           = (biases != nullptr) && (!is_quantized) && (!is_bf16) && (reshaped_weights == nullptr);
     bool       skip_im2col           = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
     bool       is_activation_enabled = act_info.enabled();
 
@@ -460,8 +615,18 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         }
     }
 
+    // Read the rows of the GEMM from the input through a table of offsets rather than from an im2col matrix when possible
+    const bool use_indirect = !skip_im2col && use_indirect_gemm(input, weights, output, conv_info, dilation);
+    if(use_indirect)
+    {
+        skip_im2col = true;
+        skip_col2im = true;
+    }
+    const bool fuse_im2col = !skip_im2col && use_fused_im2col(input, weights, conv_info, dilation, append_bias);
+
     const unsigned     bias_element  = (append_bias && !skip_im2col) ? 1 : 0;
     const ITensorInfo *biases_to_use = (append_bias && !skip_im2col) ? biases : nullptr;
+    const bool         add_bias      = (biases != nullptr) && (!is_quantized) && (skip_im2col || is_bf16 || reshaped_weights != nullptr);
 
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
@@ -473,6 +638,10 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         {
             ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
         }
+        else if(is_bf16)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        }
         else
         {
             ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
@@ -489,10 +658,21 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     unsigned int mat_weights_cols = weights->dimension(idx_kernels);
     unsigned int mat_weights_rows = weights->dimension(idx_width) * weights->dimension(idx_height) * weights->dimension(idx_channel) + bias_element;
 
+    // Validate the conversion of per channel quantized weights to QASYMM8
+    std::unique_ptr<ITensorInfo> weights_converted_info = weights->clone();
+    if(is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        QuantizationInfo weights_converted_qinfo = weights->quantization_info();
+        weights_converted_qinfo.offset           = 128;
+        weights_converted_info->set_data_type(DataType::QASYMM8).set_quantization_info(weights_converted_qinfo);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConvertQuantizedSignednessKernel::validate(weights, weights_converted_info.get()));
+    }
+
     // Output tensor auto inizialization if not yet initialized
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, biases_to_use, nullptr));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights_converted_info.get(), biases_to_use, nullptr));
     weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, (append_bias && !skip_im2col)), 1, data_type);
-    weights_to_use        = &weights_reshaped_info;
+    weights_reshaped_info.set_quantization_info(weights_converted_info->quantization_info());
+    weights_to_use = (reshaped_weights != nullptr) ? reshaped_weights : &weights_reshaped_info;
 
     if(!skip_im2col)
     {
@@ -510,11 +690,6 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_reshaped_info, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation));
         gemm_input_to_use = &im2col_reshaped_info;
     }
-    else if(append_bias)
-    {
-        // Validate add bias kernel
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(output, biases, output, ConvertPolicy::SATURATE));
-    }
 
     // Create temporary GEMM output tensor in case we cannot skip col2im
     if(!skip_col2im)
@@ -522,15 +697,25 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         TensorShape shape_gemm = gemm_input_to_use->tensor_shape();
         shape_gemm.set(0, mat_weights_cols);
         shape_gemm.set(1, conv_w * conv_h);
-        info_gemm = TensorInfo(shape_gemm, 1, data_type);
+        info_gemm = TensorInfo(shape_gemm, 1, gemm_output_data_type);
     }
     else
     {
-        info_gemm = TensorInfo(output->tensor_shape(), 1, data_type);
+        info_gemm = TensorInfo(output->tensor_shape(), 1, gemm_output_data_type);
     }
     info_gemm.set_quantization_info(output->quantization_info()).set_data_layout(input->data_layout());
     gemm_output_to_use = &info_gemm;
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col));
+    if(!use_indirect && !fuse_im2col)
+    {
+        // The GEMMs reading the input were validated by use_indirect_gemm() and use_fused_im2col()
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col));
+    }
+
+    if(add_bias)
+    {
+        // Validate add bias kernel
+        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(gemm_output_to_use, biases, gemm_output_to_use, ConvertPolicy::SATURATE));
+    }
 
     // Validate Col2Im/ReshapeLayer
     if(!skip_col2im && (data_layout == DataLayout::NCHW))
@@ -553,15 +738,20 @@ void NEGEMMConvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_fuse_im2col)
     {
         // Run input reshaping
         unsigned int y_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
         NEScheduler::get().schedule(&_im2col_kernel, y_dim);
     }
 
-    // Runs NEGEMM or NEGEMMLowpMatrixMultiplyCore functions
-    if(_is_quantized)
+    // Runs NEGEMM, NEGEMMAssemblyDispatch or NEGEMMLowpMatrixMultiplyCore functions
+    if(_use_indirect || _fuse_im2col)
+    {
+        // Run the gemm reading the input
+        _mm_im2col_free.run();
+    }
+    else if(_is_quantized)
     {
         // Run gemmlowp
         _mm_gemmlowp.run();
@@ -572,7 +762,7 @@ void NEGEMMConvolutionLayer::run()
         _mm_gemm.run();
     }
 
-    if(_skip_im2col && _append_bias)
+    if(_add_bias)
     {
         NEScheduler::get().schedule(&_add_bias_kernel, Window::DimY);
     }
@@ -602,14 +792,37 @@ void NEGEMMConvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
-        // Run weights reshaping and mark original weights tensor as unused
-        _weights_reshaped.allocator()->allocate();
-        _reshape_weights.run();
-        _original_weights->mark_as_unused();
+        // Weights passed reshaped are used by the GEMM directly, which marks them as unused once it doesn't need them anymore
+        if(!_are_weights_reshaped)
+        {
+            // Convert per channel quantized weights to QASYMM8
+            if(_is_quantized_per_channel)
+            {
+                _weights_converted.allocator()->allocate();
+                NEScheduler::get().schedule(&_convert_weights_kernel, Window::DimY);
+            }
+
+            // Run weights reshaping and mark original weights tensor as unused
+            _weights_reshaped.allocator()->allocate();
+            _reshape_weights.run();
+            _original_weights->mark_as_unused();
+
+            if(_is_quantized_per_channel)
+            {
+                _weights_converted.allocator()->free();
+            }
+        }
 
         // Prepare GEMM
-        _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
-        if(!_weights_reshaped.is_used())
+        if(_use_indirect || _fuse_im2col)
+        {
+            _mm_im2col_free.prepare();
+        }
+        else
+        {
+            _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        }
+        if(!_are_weights_reshaped && !_weights_reshaped.is_used())
         {
             _weights_reshaped.allocator()->free();
         }
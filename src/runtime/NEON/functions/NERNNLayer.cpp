@@ -34,13 +34,13 @@
 namespace arm_compute
 {
 NERNNLayer::NERNNLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _gemm_state_f(), _add_kernel(), _activation_kernel(), _fully_connected_kernel(), _copy_kernel(), _fully_connected_out(), _gemm_output(), _add_output(),
-      _is_prepared(false)
+    : _memory_group(std::move(memory_manager)), _gemm_state_f(), _add_kernel(), _activation_kernel(), _fully_connected_kernel(), _transpose_recurrent_weights(), _fully_connected_state(), _copy_kernel(),
+      _fully_connected_out(), _gemm_output(), _add_output(), _recurrent_weights_transposed(), _run_dynamic_quantization(false), _is_prepared(false)
 {
 }
 
 Status NERNNLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *recurrent_weights, const ITensorInfo *bias, const ITensorInfo *hidden_state,
-                            const ITensorInfo *output, const ActivationLayerInfo &info)
+                            const ITensorInfo *output, const ActivationLayerInfo &info, FullyConnectedLayerInfo fc_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
 
@@ -57,7 +57,14 @@ Status NERNNLayer::validate(const ITensorInfo *input, const ITensorInfo *weights
 
     auto shape_info = TensorInfo(misc::shape_calculator::compute_rnn_shape(recurrent_weights, hidden_state->dimension(idx_height)), 1, input->data_type());
 
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, weights, bias, &shape_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, weights, bias, &shape_info, fc_info));
+    if(fc_info.dynamic_quantization)
+    {
+        // The fully connected layer expects the recurrent weights as [num_inputs, num_outputs]
+        const TensorInfo recurrent_weights_transposed(recurrent_weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(misc::shape_calculator::compute_transposed_shape(*recurrent_weights)));
+        ARM_COMPUTE_RETURN_ON_ERROR(NETransposeKernel::validate(recurrent_weights, &recurrent_weights_transposed));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(hidden_state, &recurrent_weights_transposed, nullptr, &shape_info, fc_info));
+    }
     ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(&shape_info, &shape_info, &shape_info, ConvertPolicy::SATURATE));
     ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&shape_info, &shape_info, info));
 
@@ -65,15 +72,16 @@ Status NERNNLayer::validate(const ITensorInfo *input, const ITensorInfo *weights
 }
 
 void NERNNLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output,
-                           ActivationLayerInfo &info)
+                           ActivationLayerInfo &info, FullyConnectedLayerInfo fc_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
-    ARM_COMPUTE_ERROR_THROW_ON(NERNNLayer::validate(input->info(), weights->info(), recurrent_weights->info(), bias->info(), hidden_state->info(), output->info(), info));
+    ARM_COMPUTE_ERROR_THROW_ON(NERNNLayer::validate(input->info(), weights->info(), recurrent_weights->info(), bias->info(), hidden_state->info(), output->info(), info, fc_info));
 
     const int   idx_height = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT);
     TensorShape shape      = misc::shape_calculator::compute_rnn_shape(recurrent_weights->info(), hidden_state->info()->dimension(idx_height));
 
-    _is_prepared = false;
+    _is_prepared              = false;
+    _run_dynamic_quantization = fc_info.dynamic_quantization;
 
     // Manage intermediate buffers and configure
     _fully_connected_out.allocator()->init(TensorInfo(shape, 1, input->info()->data_type()));
@@ -81,10 +89,20 @@ void NERNNLayer::configure(const ITensor *input, const ITensor *weights, const I
 
     // Manage intermediate buffers and configure
     _memory_group.manage(&_fully_connected_out);
-    _fully_connected_kernel.configure(input, weights, bias, &_fully_connected_out);
+    _fully_connected_kernel.configure(input, weights, bias, &_fully_connected_out, fc_info);
 
     _memory_group.manage(&_gemm_output);
-    _gemm_state_f.configure(hidden_state, recurrent_weights, nullptr, &_gemm_output, 1.f, 0.f);
+    if(_run_dynamic_quantization)
+    {
+        // The recurrent weights are transposed once in prepare() and then quantized by the fully connected layer
+        _recurrent_weights_transposed.allocator()->init(TensorInfo(misc::shape_calculator::compute_transposed_shape(*recurrent_weights->info()), 1, recurrent_weights->info()->data_type()));
+        _transpose_recurrent_weights.configure(recurrent_weights, &_recurrent_weights_transposed);
+        _fully_connected_state.configure(hidden_state, &_recurrent_weights_transposed, nullptr, &_gemm_output, fc_info);
+    }
+    else
+    {
+        _gemm_state_f.configure(hidden_state, recurrent_weights, nullptr, &_gemm_output, 1.f, 0.f);
+    }
 
     _add_output.allocator()->init(TensorInfo(shape, 1, input->info()->data_type()));
     _memory_group.manage(&_add_output);
@@ -108,7 +126,14 @@ void NERNNLayer::run()
 
     _fully_connected_kernel.run();
 
-    _gemm_state_f.run();
+    if(_run_dynamic_quantization)
+    {
+        _fully_connected_state.run();
+    }
+    else
+    {
+        _gemm_state_f.run();
+    }
 
     NEScheduler::get().schedule(&_add_kernel, Window::DimY);
     NEScheduler::get().schedule(&_activation_kernel, Window::DimY);
@@ -122,7 +147,23 @@ void NERNNLayer::prepare()
     if(!_is_prepared)
     {
         _fully_connected_kernel.prepare();
-        _gemm_state_f.prepare();
+
+        if(_run_dynamic_quantization)
+        {
+            // Transpose the recurrent weights and release them once they have been quantized
+            _recurrent_weights_transposed.allocator()->allocate();
+            NEScheduler::get().schedule(&_transpose_recurrent_weights, Window::DimY);
+            _fully_connected_state.prepare();
+
+            if(!_recurrent_weights_transposed.is_used())
+            {
+                _recurrent_weights_transposed.allocator()->free();
+            }
+        }
+        else
+        {
+            _gemm_state_f.prepare();
+        }
 
         _is_prepared = true;
     }
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerKernel.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -34,6 +35,7 @@
 #include "support/ToolchainSupport.h"
 
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd.hpp"
+#include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_quantized.hpp"
 
 namespace arm_compute
 {
@@ -42,7 +44,30 @@ namespace
 inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
-    if(input_dims.width > 4 && input_dims.height > 4)
+    if(is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernelQASYMM8::validate(input, input0, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernelQASYMM8::validate(weights, input1, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernelQASYMM8::validate(batched_mm_output, biases, output, winograd_info)));
+    }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    else if(input->data_type() == DataType::F16)
+    {
+        if(input_dims.width > 4 && input_dims.height > 4)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float16_t, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float16_t, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float16_t, 4, 4, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float16_t, 2, 2, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float16_t, 2, 2, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float16_t, 2, 2, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
+    }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    else if(input_dims.width > 4 && input_dims.height > 4)
     {
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
@@ -167,22 +192,50 @@ inline Tensor4DShape internal_get_input_shape(const arm_compute::ITensor *input)
 
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info)
 {
-    ARM_COMPUTE_UNUSED(output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd layer only supports unit strides.");
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+#ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::F16, "F16 Winograd requires FP16 vector arithmetic support");
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    const size_t idx_width  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
+    const size_t idx_height = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+    if(input->data_type() != DataType::F32)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_width) != 3 || weights->dimension(idx_height) != 3, "Only 3x3 kernels are supported for F16 and QASYMM8");
+    }
+    if(is_data_type_quantized_asymmetric(input->data_type()))
+    {
+#ifndef __aarch64__
+        ARM_COMPUTE_RETURN_ERROR_MSG("QASYMM8 Winograd only supported for aarch64");
+#endif /* __aarch64__ */
+        const size_t idx_channel = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->dimension(idx_channel) > static_cast<size_t>(winograd::qasymm8_max_input_channels), "Too many input channels for the S32 accumulators");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->quantization_info().scale * weights->quantization_info().scale >= output->quantization_info().scale);
+    }
     if(biases != nullptr)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        if(is_data_type_quantized_asymmetric(input->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        }
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
-    return INEWinogradLayerTransformWeightsKernel<float>::validate(input, weights);
+    return INEWinogradLayerTransformWeightsKernel::validate(input, weights);
 }
 
-Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims)
+Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type)
 {
     Size2D output_tile = Size2D{};
     if(kernel_dims == Size2D(3U, 3U))
     {
-        output_tile = (input_dims.width <= 4 && input_dims.height <= 4) ? Size2D(2U, 2U) : Size2D(4U, 4U);
+        // The quantized transforms only implement F(2x2, 3x3)
+        const bool small_input = input_dims.width <= 4 && input_dims.height <= 4;
+        output_tile            = (small_input || is_data_type_quantized_asymmetric(data_type)) ? Size2D(2U, 2U) : Size2D(4U, 4U);
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
@@ -237,7 +290,7 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
 NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
     : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
       _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
-      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false)
+      _weights_hwio(), _input(), _weights(), _output(), _gemm_s16_function(memory_manager), _is_prepared(false), _is_activationlayer_enabled(false), _is_quantized(false)
 {
 }
 
@@ -255,7 +308,7 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
 
     const Size2D input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
     const Size2D kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->info()->data_type());
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
@@ -268,14 +321,49 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     _output      = output;
     _is_prepared = false;
 
-    std::unique_ptr<INEWinogradLayerTransformInputKernel<float>>   transform_input_kernel;
-    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<float>> transform_weights_kernel;
-    std::unique_ptr<INEWinogradLayerTransformOutputKernel<float>>  transform_output_kernel;
+    std::unique_ptr<INEWinogradLayerTransformInputKernel>   transform_input_kernel;
+    std::unique_ptr<INEWinogradLayerTransformWeightsKernel> transform_weights_kernel;
+    std::unique_ptr<INEWinogradLayerTransformOutputKernel>  transform_output_kernel;
 
     int n_gemms = 0;
     int N_BLOCK = 0; // Size of block used by GEMM.
 
-    if(kernel_size == Size2D(3, 3))
+    const DataType data_type = input->info()->data_type();
+    _is_quantized            = is_data_type_quantized_asymmetric(data_type);
+
+    if(_is_quantized)
+    {
+        using config             = NEWinogradLayerConfiguration<uint8_t, uint8_t, 2, 2, 3, 3>;
+        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+        n_gemms                  = config::WinogradBase::N_GEMMS;
+        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+    }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    else if(data_type == DataType::F16)
+    {
+        if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 4, 4, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 2, 2, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+    }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    else if(kernel_size == Size2D(3, 3))
     {
         if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
         {
@@ -372,26 +460,28 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int out_channels = output->info()->dimension(channel_idx);
 
     const Tensor4DShape in_shape(internal_get_input_shape(input));
-    const DataType      data_type      = input->info()->data_type();
-    const size_t        data_type_size = input->info()->element_size();
+    // Quantized tensors are transformed into S16 matrices multiplied into S32 results
+    const DataType gemm_input_type       = _is_quantized ? DataType::S16 : data_type;
+    const DataType gemm_output_type      = _is_quantized ? DataType::S32 : data_type;
+    const size_t   gemm_input_type_size  = data_size_from_type(gemm_input_type);
+    const size_t   gemm_output_type_size = data_size_from_type(gemm_output_type);
     // Get the memory required to instantiate a new Winograd operator.
     constexpr size_t storage_alignment = 64;
 
     // Kernel Storage
     const size_t kernel_storage_size = transform_weights_kernel->get_weight_storage_size(out_channels,
                                                                                          in_channels)
-                                       * data_type_size;
+                                       * gemm_input_type_size;
 
     // Input storage
     const size_t input_storage_size = transform_input_kernel->get_input_storage_size(in_shape.n_batches, in_shape.n_channels, in_shape.n_rows, in_shape.n_cols,
                                                                                      use_same_padding)
-                                      * data_type_size;
+                                      * gemm_input_type_size;
 
     // Output storage
     const size_t output_storage_size = transform_output_kernel->get_output_storage_size(in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, out_channels,
                                                                                         use_same_padding)
-                                       * data_type_size;
-    ;
+                                       * gemm_output_type_size;
     const KernelShape kernel_shape({ out_channels, static_cast<int>(kernel_size.height), static_cast<int>(kernel_size.width), in_channels });
     const int         kernel_matrix_stride = transform_weights_kernel->get_matrix_stride(kernel_shape);
 
@@ -410,30 +500,35 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int output_matrix_row_stride = kernel_matrix_row_stride;
 
     TensorShape a_shape(k, m, 1, n_gemms);
-    Strides     a_strides(data_type_size);
+    Strides     a_strides(gemm_input_type_size);
     a_strides.set(1, a_strides[0] * k);
-    //a_strides.set(2, data_type_size * input_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+    //a_strides.set(2, gemm_input_type_size * input_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
     a_strides.set(2, 0);
-    a_strides.set(3, data_type_size * input_matrix_stride);
+    a_strides.set(3, gemm_input_type_size * input_matrix_stride);
 
     TensorShape b_shape(n, k, n_gemms);
-    Strides     b_strides(data_type_size);
-    b_strides.set(1, data_type_size * kernel_matrix_row_stride);
-    b_strides.set(2, data_type_size * kernel_matrix_stride);
+    Strides     b_strides(gemm_input_type_size);
+    b_strides.set(1, gemm_input_type_size * kernel_matrix_row_stride);
+    b_strides.set(2, gemm_input_type_size * kernel_matrix_stride);
 
     TensorShape d_shape(n, m, 1, n_gemms);
-    Strides     d_strides(data_type_size);
-    d_strides.set(1, data_type_size * output_matrix_row_stride);
-    //d_strides.set(2, data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+    Strides     d_strides(gemm_output_type_size);
+    d_strides.set(1, gemm_output_type_size * output_matrix_row_stride);
+    //d_strides.set(2, gemm_output_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
     d_strides.set(2, 0);
-    d_strides.set(3, data_type_size * output_matrix_stride);
+    d_strides.set(3, gemm_output_type_size * output_matrix_stride);
 
     TensorInfo a_info{};
     TensorInfo b_info{};
     TensorInfo d_info{};
-    a_info.init(a_shape, 1, data_type, a_strides, 0, input_storage_size);
-    b_info.init(b_shape, 1, data_type, b_strides, 0, kernel_storage_size);
-    d_info.init(d_shape, 1, data_type, d_strides, 0, output_storage_size);
+    a_info.init(a_shape, 1, gemm_input_type, a_strides, 0, input_storage_size);
+    b_info.init(b_shape, 1, gemm_input_type, b_strides, 0, kernel_storage_size);
+    d_info.init(d_shape, 1, gemm_output_type, d_strides, 0, output_storage_size);
+    if(_is_quantized)
+    {
+        // The output transform requantizes the S32 results from the product of the input and weights scales
+        d_info.set_quantization_info(QuantizationInfo(input->info()->quantization_info().scale * weights->info()->quantization_info().scale, 0));
+    }
 
     _input_transformed.allocator()->init(a_info, storage_alignment);
     _kernel_storage.allocator()->init(b_info, storage_alignment);
@@ -442,7 +537,7 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     // configure and allocate dst tensor to be used to convert from winograd domain to spatial domain when calling to reshape_output()
     TensorInfo info(TensorShape(_output->info()->dimension(2), _output->info()->dimension(0),
                                 _output->info()->dimension(1), _output->info()->dimension(3)),
-                    1, _output->info()->data_type());
+                    1, _output->info()->data_type(), _output->info()->quantization_info());
     _output_nhwc.allocator()->init(info);
 
     const ITensor     *input_to_use  = _input;
@@ -479,7 +574,15 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
 
     // Configure GEMM function
     _memory_group.manage(&_output_transformed);
-    _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    if(_is_quantized)
+    {
+        _gemm_s16_function.configure(&_input_transformed, &_kernel_storage, &_output_transformed, 1.0f, 0.f, false);
+        ARM_COMPUTE_ERROR_ON_MSG(!_gemm_s16_function.is_configured(), "No S16 GEMM available for the quantized Winograd layer");
+    }
+    else
+    {
+        _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    }
     _input_transformed.allocator()->allocate();
 
     // Configure output transform function
@@ -535,7 +638,14 @@ void NEWinogradConvolutionLayer::run()
     NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
 
     //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    _gemm_function.run();
+    if(_is_quantized)
+    {
+        _gemm_s16_function.run();
+    }
+    else
+    {
+        _gemm_function.run();
+    }
 
     // Transform output tensor to the spatial domain
     NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
@@ -565,7 +675,7 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->dimension(idx_width), input->dimension(idx_height));
     const Size2D kernel_size = Size2D(weights->dimension(idx_width), weights->dimension(idx_height));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->data_type());
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
@@ -579,16 +689,21 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
                                                     conv_info,
                                                     input->data_layout());
 
+    // Quantized tensors are transformed into S16 matrices multiplied into S32 results
+    const bool     is_quantized     = is_data_type_quantized_asymmetric(input->data_type());
+    const DataType gemm_input_type  = is_quantized ? DataType::S16 : input->data_type();
+    const DataType gemm_output_type = is_quantized ? DataType::S32 : input->data_type();
+
     // Validate input transform
     const TensorShape input0_shape = misc::shape_calculator::compute_winograd_input_transform_shape(*input, winograd_info);
-    const TensorInfo  input0       = input->clone()->set_tensor_shape(input0_shape);
+    const TensorInfo  input0       = input->clone()->set_tensor_shape(input0_shape).set_data_type(gemm_input_type);
     // Validate filter transform
     const TensorShape input1_shape = misc::shape_calculator::compute_winograd_filter_transform_shape(*weights, winograd_info);
-    const TensorInfo  input1       = weights->clone()->set_tensor_shape(input1_shape);
+    const TensorInfo  input1       = weights->clone()->set_tensor_shape(input1_shape).set_data_type(gemm_input_type);
     // Validate batched matrix multiply
     TensorShape batched_mm_output_shape = input0.tensor_shape();
     batched_mm_output_shape[0]          = input1.tensor_shape()[0];
-    const TensorInfo batched_mm_output  = input0.clone()->set_tensor_shape(batched_mm_output_shape);
+    const TensorInfo batched_mm_output  = input0.clone()->set_tensor_shape(batched_mm_output_shape).set_data_type(gemm_output_type);
 
     if(kernel_size == Size2D(3, 3))
     {
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/convolution/depthwise/depthwise_generic.hpp"
 #include "arm_compute/core/NEON/kernels/convolution/depthwise/depthwise_quantized.hpp"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/InfoHelpers.h"
@@ -42,7 +43,8 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
                                                                    const ITensor      *weights,
                                                                    ITensor            *output,
                                                                    PadStrideInfo       conv_info,
-                                                                   ActivationLayerInfo act_info)
+                                                                   ActivationLayerInfo act_info,
+                                                                   const Size2D       &dilation)
 {
     const DataType    data_type = input->info()->data_type();
     const TensorShape shape     = input->info()->tensor_shape();
@@ -57,6 +59,14 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
     const int padding_right  = conv_info.pad_right();
 
     const unsigned int stride_x = conv_info.stride().first;
+    const unsigned int stride_y = conv_info.stride().second;
+
+    // The generic engine handles the configurations the tiled kernels do not support
+    const bool use_generic  = !NEDepthwiseConvolutionAssemblyDispatch::is_optimized_supported(input->info(), weights->info(), conv_info, 1, dilation);
+    const int  kernel_rows  = weights->info()->dimension(2);
+    const int  kernel_cols  = weights->info()->dimension(1);
+    const int  dilation_row = dilation.y();
+    const int  dilation_col = dilation.x();
 
     // Map activation function
     neon_convolution_kernels::ActivationFunction activation = neon_convolution_kernels::ActivationFunction::None;
@@ -81,9 +91,31 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
         ARM_COMPUTE_ERROR_ON(weights_qinfo.offset < 0 || weights_qinfo.offset > 255);
         ARM_COMPUTE_ERROR_ON(output_qinfo.offset < 0 || output_qinfo.offset > 255);
         const qasymm8::QAsymm8Params iqinfo{ static_cast<uint8_t>(input_qinfo.offset), input_qinfo.scale };
-        const qasymm8::QAsymm8Params wqinfo{ static_cast<uint8_t>(weights_qinfo.offset), weights_qinfo.scale };
         const qasymm8::QAsymm8Params oqinfo{ static_cast<uint8_t>(output_qinfo.offset), output_qinfo.scale };
 
+        // Per channel quantized weights are converted to QASYMM8 with an offset of 128 and rescaled channel by channel
+        if(weights_qinfo.is_per_channel())
+        {
+            const qasymm8::QAsymm8Params wqinfo{ 128, 0.f };
+
+            std::vector<int32_t> qmultipliers;
+            std::vector<int32_t> qshifts;
+            quantization::calculate_quantized_multipliers_less_than_one(iqinfo.scale, weights_qinfo.channel_scales, oqinfo.scale, &qmultipliers, &qshifts);
+
+            std::vector<qasymm8::QAsymm8RescaleParams> rescale_params;
+            rescale_params.reserve(weights_qinfo.channel_scales.size());
+            for(size_t i = 0; i < weights_qinfo.channel_scales.size(); ++i)
+            {
+                rescale_params.emplace_back(qshifts[i], qmultipliers[i], iqinfo.scale * weights_qinfo.channel_scales[i] / oqinfo.scale);
+            }
+
+            return arm_compute::support::cpp14::make_unique<depthwise::QAsymm8DepthwiseConvolutionGeneric>(
+                       n_batches, in_rows, in_cols, n_channels, kernel_rows, kernel_cols, stride_y, stride_x, dilation_row, dilation_col,
+                       activation, wqinfo, iqinfo, oqinfo, rescale_params, padding_top, padding_left, padding_bottom, padding_right);
+        }
+
+        const qasymm8::QAsymm8Params wqinfo{ static_cast<uint8_t>(weights_qinfo.offset), weights_qinfo.scale };
+
         // Calculate rescale parameters
         const float fmultipler  = iqinfo.scale * wqinfo.scale / oqinfo.scale;
         int         qmultiplier = 0;
@@ -92,6 +124,12 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
         qasymm8::QAsymm8RescaleParams rescale_params(qshift, qmultiplier, fmultipler);
 
         // Create convolver
+        if(use_generic)
+        {
+            return arm_compute::support::cpp14::make_unique<depthwise::QAsymm8DepthwiseConvolutionGeneric>(
+                       n_batches, in_rows, in_cols, n_channels, kernel_rows, kernel_cols, stride_y, stride_x, dilation_row, dilation_col,
+                       activation, wqinfo, iqinfo, oqinfo, rescale_params, padding_top, padding_left, padding_bottom, padding_right);
+        }
         switch(stride_x)
         {
             case 1:
@@ -112,6 +150,12 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
             case DataType::F16:
             {
+                if(use_generic)
+                {
+                    return arm_compute::support::cpp14::make_unique<depthwise::DepthwiseConvolutionGeneric<float16_t, float16_t, float16_t>>(
+                               n_batches, in_rows, in_cols, n_channels, kernel_rows, kernel_cols, stride_y, stride_x, dilation_row, dilation_col,
+                               activation, padding_top, padding_left, padding_bottom, padding_right);
+                }
                 switch(stride_x)
                 {
                     case 1:
@@ -128,6 +172,12 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
             case DataType::F32:
             {
+                if(use_generic)
+                {
+                    return arm_compute::support::cpp14::make_unique<depthwise::DepthwiseConvolutionGeneric<float, float, float>>(
+                               n_batches, in_rows, in_cols, n_channels, kernel_rows, kernel_cols, stride_y, stride_x, dilation_row, dilation_col,
+                               activation, padding_top, padding_left, padding_bottom, padding_right);
+                }
                 switch(stride_x)
                 {
                     case 1:
@@ -150,8 +200,8 @@ std::unique_ptr<depthwise::IDepthwiseConvolution> create_convolver(const ITensor
 
 #ifndef DOXYGEN_SKIP_THIS
 NEDepthwiseConvolutionAssemblyDispatch::NEDepthwiseConvolutionAssemblyDispatch(std::shared_ptr<arm_compute::IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr), _packed_weights(), _workspace(), _is_prepared(false), _dwc_assembly_kernel(nullptr),
-      _dwc_acl_kernel()
+    : _memory_group(std::move(memory_manager)), _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr), _packed_weights(), _workspace(), _weights_converted(), _is_prepared(false),
+      _is_quantized_per_channel(false), _dwc_assembly_kernel(nullptr), _dwc_acl_kernel(), _convert_weights_kernel()
 {
 }
 #endif /* DOXYGEN_SKIP_THIS */
@@ -162,7 +212,8 @@ void NEDepthwiseConvolutionAssemblyDispatch::configure(const ITensor
                                                        ITensor                   *output,
                                                        const PadStrideInfo       &conv_info,
                                                        unsigned int               depth_multiplier,
-                                                       const ActivationLayerInfo &act_info)
+                                                       const ActivationLayerInfo &act_info,
+                                                       const Size2D              &dilation)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_UNUSED(depth_multiplier);
@@ -172,20 +223,28 @@ void NEDepthwiseConvolutionAssemblyDispatch::configure(const ITensor
                                                                                 output->info(),
                                                                                 conv_info,
                                                                                 depth_multiplier,
-                                                                                act_info));
+                                                                                act_info,
+                                                                                dilation));
 
     // Output auto inizialitation if not yet initialized
-    const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier);
+    const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
     auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
 
-    _input       = input;
-    _weights     = weights;
-    _bias        = bias;
-    _output      = output;
-    _is_prepared = false;
+    _input                    = input;
+    _weights                  = weights;
+    _bias                     = bias;
+    _output                   = output;
+    _is_prepared              = false;
+    _is_quantized_per_channel = is_data_type_quantized_per_channel(weights->info()->data_type());
+
+    // The engine reads QASYMM8 weights, convert the signed per channel quantized ones
+    if(_is_quantized_per_channel)
+    {
+        _convert_weights_kernel.configure(weights, &_weights_converted);
+    }
 
     // Create convolver
-    _dwc_assembly_kernel = create_convolver(input, weights, output, conv_info, act_info);
+    _dwc_assembly_kernel = create_convolver(input, weights, output, conv_info, act_info, dilation);
     ARM_COMPUTE_ERROR_ON(_dwc_assembly_kernel == nullptr);
 
     // Create assembly kernel wrapper
@@ -213,20 +272,29 @@ Status NEDepthwiseConvolutionAssemblyDispatch::validate(const ITensorInfo
                                                         const ITensorInfo         *output,
                                                         const PadStrideInfo       &conv_info,
                                                         unsigned int               depth_multiplier,
-                                                        const ActivationLayerInfo &act_info)
+                                                        const ActivationLayerInfo &act_info,
+                                                        const Size2D              &dilation)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
 
-    const auto       strides     = conv_info.stride();
-    const DataLayout data_layout = input->data_layout();
-    unsigned int     width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
-    unsigned int     height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(width_idx) != 3 || weights->dimension(height_idx) != 3);
-    ARM_COMPUTE_RETURN_ERROR_ON(!((strides.first == strides.second) && ((strides.first == 1) || (strides.first == 2))));
-    ARM_COMPUTE_RETURN_ERROR_ON(depth_multiplier != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(!is_generic_supported(input, weights, conv_info, depth_multiplier, dilation));
+
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(channel_idx) != input->dimension(channel_idx) * depth_multiplier);
+
+    if(is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->quantization_info().channel_scales.size() != weights->dimension(channel_idx), "Weights must have one scale per channel");
+        const TensorInfo weights_converted_info{};
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConvertQuantizedSignednessKernel::validate(weights, &weights_converted_info));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
 
     const bool is_relu  = arm_compute::utils::info_helpers::is_relu(act_info);
     const bool is_relu6 = arm_compute::utils::info_helpers::is_relu6(act_info);
@@ -235,15 +303,22 @@ Status NEDepthwiseConvolutionAssemblyDispatch::validate(const ITensorInfo
     // Check bias
     if(bias != nullptr)
     {
-        unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
         ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
         ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != weights->dimension(channel_idx));
+        if(is_data_type_quantized_asymmetric(input->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+        }
     }
 
     // Check output
     if(output->total_size() != 0)
     {
-        const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier);
+        const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
@@ -296,6 +371,30 @@ bool NEDepthwiseConvolutionAssemblyDispatch::is_optimized_supported(const ITenso
     return is_data_type_valid && weights_supported && supported_strides && supported_padding && (depth_multiplier == 1) && is_dilation_1;
 }
 
+bool NEDepthwiseConvolutionAssemblyDispatch::is_generic_supported(const ITensorInfo *input,
+                                                                  const ITensorInfo *weights,
+                                                                  PadStrideInfo      conv_info,
+                                                                  unsigned int       depth_multiplier,
+                                                                  const Size2D      &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
+
+    // Check data type
+    const DataType data_type          = weights->data_type();
+    bool           is_data_type_valid = is_data_type_float(data_type) || is_data_type_quantized_asymmetric(data_type);
+    is_data_type_valid                = is_data_type_valid || (is_data_type_quantized_per_channel(data_type) && is_data_type_quantized_asymmetric(input->data_type()));
+#ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    is_data_type_valid = is_data_type_valid && (data_type != DataType::F16);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+    // Check kernel geometry
+    const auto &strides            = conv_info.stride();
+    const bool  supported_strides  = (strides.first >= 1) && (strides.second >= 1);
+    const bool  supported_dilation = (dilation.x() >= 1) && (dilation.y() >= 1);
+
+    return is_data_type_valid && supported_strides && supported_dilation && (depth_multiplier == 1);
+}
+
 void NEDepthwiseConvolutionAssemblyDispatch::run()
 {
     // Prepare assembly kernel
@@ -334,17 +433,31 @@ void NEDepthwiseConvolutionAssemblyDispatch::prepare()
         _packed_weights.allocator()->allocate();
         ARM_COMPUTE_ERROR_ON(_packed_weights.buffer() == nullptr);
 
+        // Convert per channel quantized weights to QASYMM8
+        const ITensor *weights_to_pack = _weights;
+        if(_is_quantized_per_channel)
+        {
+            _weights_converted.allocator()->allocate();
+            NEScheduler::get().schedule(&_convert_weights_kernel, Window::DimY);
+            weights_to_pack = &_weights_converted;
+        }
+
         // Pack weights and bias
-        const int weights_element_size = _weights->info()->element_size();
-        const int weights_row_stride   = _weights->info()->strides_in_bytes().z() / weights_element_size;
-        const int weights_col_stride   = _weights->info()->strides_in_bytes().y() / weights_element_size;
+        const int weights_element_size = weights_to_pack->info()->element_size();
+        const int weights_row_stride   = weights_to_pack->info()->strides_in_bytes().z() / weights_element_size;
+        const int weights_col_stride   = weights_to_pack->info()->strides_in_bytes().y() / weights_element_size;
         _dwc_assembly_kernel->pack_params(_packed_weights.buffer(),
-                                          _weights->buffer() + _weights->info()->offset_first_element_in_bytes(),
+                                          weights_to_pack->buffer() + weights_to_pack->info()->offset_first_element_in_bytes(),
                                           weights_row_stride,
                                           weights_col_stride,
                                           (_bias != nullptr) ? _bias->buffer() : nullptr);
         _dwc_assembly_kernel->set_packed_params_buffer(_packed_weights.buffer());
 
+        if(_is_quantized_per_channel)
+        {
+            _weights_converted.allocator()->free();
+        }
+
         _weights->mark_as_unused();
         if(_bias != nullptr)
         {
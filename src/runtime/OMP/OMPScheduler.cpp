@@ -68,7 +68,8 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     if(!kernel->is_parallelisable() || num_threads == 1)
     {
         ThreadInfo info;
-        info.cpu_info = &_cpu_info;
+        info.cpu_info  = &_cpu_info;
+        info.cpu_model = _cpu_info.get_cpu_model();
         kernel->run(max_window, info);
     }
     else
@@ -105,6 +106,7 @@ void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>
     {
         const int tid  = omp_get_thread_num();
         info.thread_id = tid;
+        info.cpu_model = _cpu_info.get_cpu_model();
         workloads[tid](info);
     }
 }
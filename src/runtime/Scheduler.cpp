@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -36,6 +37,14 @@
 
 using namespace arm_compute;
 
+#ifndef NO_MULTI_THREADING
+namespace
+{
+/** Scheduler overriding the active scheduler in the current thread */
+thread_local IScheduler *thread_scheduler = nullptr;
+} // namespace
+#endif /* NO_MULTI_THREADING */
+
 #if !ARM_COMPUTE_CPP_SCHEDULER && ARM_COMPUTE_OPENMP_SCHEDULER
 Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::OMP;
 #elif ARM_COMPUTE_CPP_SCHEDULER && !ARM_COMPUTE_OPENMP_SCHEDULER
@@ -66,6 +75,14 @@ bool Scheduler::is_available(Type t)
             return true;
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             return false;
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+        }
+        case Type::CPP_WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return true;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            return false;
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
         }
         case Type::OMP:
@@ -95,6 +112,13 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+#ifndef NO_MULTI_THREADING
+    if(thread_scheduler != nullptr)
+    {
+        return *thread_scheduler;
+    }
+#endif /* NO_MULTI_THREADING */
+
     switch(_scheduler_type)
     {
         case Type::ST:
@@ -107,6 +131,15 @@ IScheduler &Scheduler::get()
             return CPPScheduler::get();
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+            break;
+        }
+        case Type::CPP_WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return CPPWorkStealingScheduler::get();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 work-stealing scheduler.");
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
             break;
         }
@@ -147,3 +180,22 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+#ifndef NO_MULTI_THREADING
+    thread_scheduler = scheduler;
+#else  /* NO_MULTI_THREADING */
+    ARM_COMPUTE_UNUSED(scheduler);
+    ARM_COMPUTE_ERROR("Per-thread schedulers are not supported in builds without multi-threading support.");
+#endif /* NO_MULTI_THREADING */
+}
+
+IScheduler *Scheduler::get_thread_scheduler()
+{
+#ifndef NO_MULTI_THREADING
+    return thread_scheduler;
+#else  /* NO_MULTI_THREADING */
+    return nullptr;
+#endif /* NO_MULTI_THREADING */
+}
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 #include "support/ToolchainSupport.h"
@@ -67,7 +68,7 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 } // namespace
 
 TensorAllocator::TensorAllocator(Tensor *owner)
-    : _associated_memory_group(nullptr), _memory(), _owner(owner)
+    : _associated_memory_group(nullptr), _memory(), _owner(owner), _allocator(nullptr)
 {
 }
 
@@ -80,11 +81,13 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _associated_memory_group(o._associated_memory_group),
       _memory(std::move(o._memory)),
-      _owner(o._owner)
+      _owner(o._owner),
+      _allocator(o._allocator)
 {
     o._associated_memory_group = nullptr;
     o._memory                  = Memory();
     o._owner                   = nullptr;
+    o._allocator               = nullptr;
 }
 
 TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
@@ -100,6 +103,9 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _owner   = o._owner;
         o._owner = nullptr;
 
+        _allocator   = o._allocator;
+        o._allocator = nullptr;
+
         ITensorAllocator::operator=(std::move(o));
     }
     return *this;
@@ -134,7 +140,14 @@ void TensorAllocator::allocate()
 {
     if(_associated_memory_group == nullptr)
     {
-        _memory.set_owned_region(support::cpp14::make_unique<MemoryRegion>(info().total_size(), alignment()));
+        if(_allocator != nullptr)
+        {
+            _memory.set_owned_region(_allocator->make_region(info().total_size(), alignment()));
+        }
+        else
+        {
+            _memory.set_owned_region(support::cpp14::make_unique<MemoryRegion>(info().total_size(), alignment()));
+        }
     }
     else
     {
@@ -161,6 +174,11 @@ Status TensorAllocator::import_memory(void *memory)
     return Status{};
 }
 
+void TensorAllocator::set_allocator(IAllocator *allocator)
+{
+    _allocator = allocator;
+}
+
 void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
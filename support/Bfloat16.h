@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_BFLOAT16_H__
+#define __ARM_COMPUTE_BFLOAT16_H__
+
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+/** Brain floating point representation class
+ *
+ * A bfloat16 value is the upper half of the corresponding IEEE-754 single precision value: it has the same
+ * 8-bit exponent as a float (and hence the same range) but only a 7-bit mantissa.
+ */
+class bfloat16
+{
+public:
+    /** Default Constructor */
+    bfloat16()
+        : value(0)
+    {
+    }
+    /** Constructor
+     *
+     * @note The value is rounded to the nearest bfloat16, ties to even.
+     *
+     * @param[in] v Floating-point value
+     */
+    bfloat16(float v)
+        : value(float_to_bf16(v))
+    {
+    }
+    /** Assignment operator
+     *
+     * @param[in] v Floating point value to assign
+     *
+     * @return The updated object
+     */
+    bfloat16 &operator=(float v)
+    {
+        value = float_to_bf16(v);
+        return *this;
+    }
+    /** Floating point conversion operator
+     *
+     * @return Floating point representation of the value
+     */
+    operator float() const
+    {
+        return bf16_to_float(value);
+    }
+    /** Lowest representative value
+     *
+     * @return Returns the lowest finite value representable by bfloat16
+     */
+    static bfloat16 lowest()
+    {
+        bfloat16 val;
+        val.value = 0xFF7F;
+        return val;
+    }
+    /** Largest representative value
+     *
+     * @return Returns the largest finite value representable by bfloat16
+     */
+    static bfloat16 max()
+    {
+        bfloat16 val;
+        val.value = 0x7F7F;
+        return val;
+    }
+
+private:
+    /** Convert a float to its bfloat16 bit pattern, rounding to nearest even
+     *
+     * @param[in] v Floating-point value to convert
+     *
+     * @return The bfloat16 bit pattern
+     */
+    static uint16_t float_to_bf16(const float v)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &v, sizeof(v));
+
+        // Keep NaNs quiet rather than rounding them to infinity
+        if((bits & 0x7FFFFFFF) > 0x7F800000)
+        {
+            return static_cast<uint16_t>((bits >> 16) | 0x0040);
+        }
+
+        const uint32_t lsb = (bits >> 16) & 1;
+        return static_cast<uint16_t>((bits + 0x7FFF + lsb) >> 16);
+    }
+
+    /** Convert a bfloat16 bit pattern to a float
+     *
+     * @param[in] v Bfloat16 bit pattern to convert
+     *
+     * @return The converted float value
+     */
+    static float bf16_to_float(const uint16_t v)
+    {
+        const uint32_t bits = static_cast<uint32_t>(v) << 16;
+        float          res  = 0.f;
+        std::memcpy(&res, &bits, sizeof(res));
+        return res;
+    }
+
+    uint16_t value;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_BFLOAT16_H__ */
@@ -355,6 +355,8 @@ void store_value_with_data_type(void *ptr, T value, DataType data_type)
             *reinterpret_cast<uint8_t *>(ptr) = value;
             break;
         case DataType::S8:
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8_PER_CHANNEL:
             *reinterpret_cast<int8_t *>(ptr) = value;
             break;
         case DataType::U16:
@@ -375,6 +377,9 @@ void store_value_with_data_type(void *ptr, T value, DataType data_type)
         case DataType::S64:
             *reinterpret_cast<int64_t *>(ptr) = value;
             break;
+        case DataType::BFLOAT16:
+            *reinterpret_cast<bfloat16 *>(ptr) = bfloat16(static_cast<float>(value));
+            break;
         case DataType::F16:
             *reinterpret_cast<half *>(ptr) = value;
             break;
@@ -743,6 +748,8 @@ inline std::string get_typestring(DataType data_type)
         case DataType::U8:
             return no_endianness + "u" + support::cpp11::to_string(sizeof(uint8_t));
         case DataType::S8:
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8_PER_CHANNEL:
             return no_endianness + "i" + support::cpp11::to_string(sizeof(int8_t));
         case DataType::U16:
             return endianness + "u" + support::cpp11::to_string(sizeof(uint16_t));
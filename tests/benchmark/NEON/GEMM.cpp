@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,7 +23,9 @@
  */
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -51,9 +53,17 @@ const auto data_types = framework::dataset::make("DataType",
     DataType::F32
 });
 const auto reshape_b_only_once = framework::dataset::make("ReshapeBOnlyOnce", { false, true });
+
+// Multi-head attention of a sequence of 128 tokens with 12 heads of size 64: Q * K^T and scores * V (one B per head),
+// then a projection broadcast to all the heads of 4 sequences
+const auto attention_shapes = framework::dataset::zip(framework::dataset::zip(framework::dataset::make("A", { TensorShape(64U, 128U, 12U), TensorShape(128U, 128U, 12U), TensorShape(64U, 128U, 12U, 4U) }),
+                                                                              framework::dataset::make("B", { TensorShape(128U, 64U, 12U), TensorShape(64U, 128U, 12U), TensorShape(64U, 64U) })),
+                                                      framework::dataset::make("Out", { TensorShape(128U, 128U, 12U), TensorShape(64U, 128U, 12U), TensorShape(64U, 128U, 12U, 4U) }));
 } // namespace
 
-using NEGEMMFixture = GEMMFixture<Tensor, NEGEMM, Accessor>;
+using NEGEMMFixture          = GEMMFixture<Tensor, NEGEMM, Accessor>;
+using NEGEMMHugePagesFixture = GEMMFixture<Tensor, NEGEMM, Accessor, HugePageAllocator>;
+using NEGEMMBatchedFixture   = GEMMBatchedFixture<Tensor, NEGEMMBatched, Accessor>;
 
 TEST_SUITE(NEON)
 
@@ -68,6 +78,18 @@ REGISTER_FIXTURE_DATA_TEST_CASE(GoogleNetGEMM, NEGEMMFixture, framework::Dataset
                                 data_types),
                                 reshape_b_only_once));
 
+// Compare the TLB misses reported by the PMU instrument with the ones of MatrixMultiplyGEMM
+REGISTER_FIXTURE_DATA_TEST_CASE(MatrixMultiplyGEMMHugePages, NEGEMMHugePagesFixture, framework::DatasetMode::NIGHTLY,
+                                framework::dataset::combine(framework::dataset::combine(datasets::MatrixMultiplyGEMMDataset(),
+                                                                                        framework::dataset::make("DataType", DataType::F32)),
+                                                            reshape_b_only_once));
+
+// Compute all the heads with a single function
+REGISTER_FIXTURE_DATA_TEST_CASE(MultiHeadAttentionGEMM, NEGEMMBatchedFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(attention_shapes,
+                                                                                        data_types),
+                                                            reshape_b_only_once));
+
 TEST_SUITE_END()
 } // namespace benchmark
 } // namespace test
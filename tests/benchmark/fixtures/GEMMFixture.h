@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,18 +26,25 @@
 
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IAllocator.h"
 #include "tests/Globals.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
 
+#include <memory>
+#include <type_traits>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace benchmark
 {
-/** Fixture that can be used for NEON and CL */
-template <typename TensorType, typename Function, typename Accessor>
+/** Fixture that can be used for NEON and CL
+ *
+ * If AllocatorType is not void, the tensors are allocated using an instance of it.
+ */
+template <typename TensorType, typename Function, typename Accessor, typename AllocatorType = void>
 class GEMMFixture : public framework::Fixture
 {
 public:
@@ -50,6 +57,8 @@ public:
         c   = create_tensor<TensorType>(shape_c, data_type, 1);
         dst = create_tensor<TensorType>(shape_dst, data_type, 1);
 
+        set_allocator<AllocatorType>();
+
         // Create and configure function
         gemm.configure(&a, &b, &c, &dst, alpha, beta, GEMMInfo(false, false, reshape_b_only_on_first_run));
 
@@ -79,10 +88,74 @@ public:
         dst.allocator()->free();
     }
 
+private:
+    template <typename T>
+    typename std::enable_if<std::is_void<T>::value>::type set_allocator()
+    {
+    }
+
+    template <typename T>
+    typename std::enable_if < !std::is_void<T>::value >::type set_allocator()
+    {
+        allocator = support::cpp14::make_unique<T>();
+        a.allocator()->set_allocator(allocator.get());
+        b.allocator()->set_allocator(allocator.get());
+        c.allocator()->set_allocator(allocator.get());
+        dst.allocator()->set_allocator(allocator.get());
+    }
+
+    // Declared first so that it outlives the memory of the tensors
+    std::unique_ptr<IAllocator> allocator{ nullptr };
+    TensorType                  a{};
+    TensorType                  b{};
+    TensorType                  c{};
+    TensorType                  dst{};
+    Function                    gemm{};
+};
+
+/** Fixture that can be used to benchmark a batch of GEMMs computed by a single function */
+template <typename TensorType, typename Function, typename Accessor>
+class GEMMBatchedFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_dst, DataType data_type, bool reshape_b_only_on_first_run)
+    {
+        // Create tensors
+        a   = create_tensor<TensorType>(shape_a, data_type, 1);
+        b   = create_tensor<TensorType>(shape_b, data_type, 1);
+        dst = create_tensor<TensorType>(shape_dst, data_type, 1);
+
+        // Create and configure function
+        gemm.configure(&a, &b, &dst, 1.f, GEMMInfo(false, false, reshape_b_only_on_first_run));
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
+    void run()
+    {
+        gemm.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        a.allocator()->free();
+        b.allocator()->free();
+        dst.allocator()->free();
+    }
+
 private:
     TensorType a{};
     TensorType b{};
-    TensorType c{};
     TensorType dst{};
     Function   gemm{};
 };
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SCHEDULERFIXTURE
+#define ARM_COMPUTE_TEST_SCHEDULERFIXTURE
+
+#include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that runs an activation kernel through a given scheduler and split strategy. */
+template <typename TensorType, typename Accessor>
+class SchedulerFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, Scheduler::Type scheduler_type, IScheduler::StrategyHint strategy)
+    {
+        // Use the same number of threads as the scheduler selected on the command line
+        const unsigned int num_threads = Scheduler::get().num_threads();
+        _default_scheduler_type        = Scheduler::get_type();
+        Scheduler::set(scheduler_type);
+        Scheduler::get().set_num_threads(num_threads);
+
+        // Create tensors
+        src = create_tensor<TensorType>(shape, DataType::F32);
+        dst = create_tensor<TensorType>(shape, DataType::F32);
+
+        // Create and configure kernel
+        kernel.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+        _strategy = strategy;
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
+    void run()
+    {
+        Scheduler::get().schedule(&kernel, IScheduler::Hints(Window::DimY, _strategy));
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        dst.allocator()->free();
+        Scheduler::set(_default_scheduler_type);
+    }
+
+private:
+    TensorType               src{};
+    TensorType               dst{};
+    NEActivationLayerKernel  kernel{};
+    IScheduler::StrategyHint _strategy{ IScheduler::StrategyHint::STATIC };
+    Scheduler::Type          _default_scheduler_type{ Scheduler::Type::ST };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCHEDULERFIXTURE */
@@ -238,6 +238,21 @@ public:
         add_config(TensorShape(64U, 64U, 128U), Size2D(3U, 3U), PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::CEIL));
     }
 };
+/** Dataset containing small, 5x5 depthwise convolution shapes. */
+class SmallDepthwiseConvolutionLayerDataset5x5 final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallDepthwiseConvolutionLayerDataset5x5()
+    {
+        // Stride 1
+        add_config(TensorShape(7U, 7U, 16U), Size2D(5U, 5U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(9U, 9U, 17U), Size2D(5U, 5U), PadStrideInfo(1, 1, 2, 2));
+        // Stride 2
+        add_config(TensorShape(11U, 9U, 13U, 2U), Size2D(5U, 5U), PadStrideInfo(2, 2, 2, 2));
+        // Asymmetric padding
+        add_config(TensorShape(13U, 11U, 8U), Size2D(5U, 5U), PadStrideInfo(2, 1, 1, 2, 2, 1, DimensionRoundingType::FLOOR));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
@@ -153,6 +153,22 @@ private:
     std::vector<PadStrideInfo> _depthwise_infos{};
     std::vector<PadStrideInfo> _pointwise_infos{};
 };
+
+class SmallDepthwiseSeparableConvolutionLayerDataset final : public DepthwiseSeparableConvolutionLayerDataset
+{
+public:
+    SmallDepthwiseSeparableConvolutionLayerDataset()
+    {
+        add_config(TensorShape(7U, 7U, 8U), TensorShape(3U, 3U, 8U), TensorShape(8U), TensorShape(7U, 7U, 8U), TensorShape(1U, 1U, 8U, 12U), TensorShape(12U), TensorShape(7U, 7U, 12U),
+                   PadStrideInfo(1, 1, 1, 1, DimensionRoundingType::FLOOR), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::FLOOR));
+        add_config(TensorShape(13U, 9U, 19U), TensorShape(3U, 3U, 19U), TensorShape(19U), TensorShape(7U, 5U, 19U), TensorShape(1U, 1U, 19U, 5U), TensorShape(5U), TensorShape(7U, 5U, 5U),
+                   PadStrideInfo(2, 2, 1, 1, DimensionRoundingType::FLOOR), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::FLOOR));
+        add_config(TensorShape(11U, 10U, 6U), TensorShape(5U, 5U, 6U), TensorShape(6U), TensorShape(11U, 10U, 6U), TensorShape(1U, 1U, 6U, 33U), TensorShape(33U), TensorShape(11U, 10U, 33U),
+                   PadStrideInfo(1, 1, 2, 2, DimensionRoundingType::FLOOR), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::FLOOR));
+        add_config(TensorShape(9U, 9U, 16U, 2U), TensorShape(3U, 3U, 16U), TensorShape(16U), TensorShape(7U, 7U, 16U, 2U), TensorShape(1U, 1U, 16U, 7U), TensorShape(7U), TensorShape(7U, 7U, 7U, 2U),
+                   PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::FLOOR), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::FLOOR));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
@@ -133,6 +133,18 @@ public:
         add_config(TensorShape(177U, 311U, 22U), Size2D(3U, 3U), PadStrideInfo(2, 1, 1, 1), Size2D(3U, 3U));
     }
 };
+/** Dataset containing small depthwise convolution shapes with dilation and enough channels to fill the vector lanes. */
+class SmallDepthwiseDilatedConvolutionLayerDatasetVectorized final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallDepthwiseDilatedConvolutionLayerDatasetVectorized()
+    {
+        add_config(TensorShape(13U, 13U, 16U), Size2D(3U, 3U), PadStrideInfo(1, 1, 2, 2), Size2D(2U, 2U));
+        add_config(TensorShape(17U, 15U, 9U), Size2D(3U, 3U), PadStrideInfo(2, 2, 2, 2), Size2D(2U, 2U));
+        add_config(TensorShape(17U, 15U, 8U), Size2D(5U, 5U), PadStrideInfo(1, 1, 0, 0), Size2D(2U, 3U));
+        add_config(TensorShape(21U, 19U, 16U, 2U), Size2D(5U, 5U), PadStrideInfo(2, 1, 4, 4), Size2D(2U, 2U));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
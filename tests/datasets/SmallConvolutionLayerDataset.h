@@ -185,6 +185,24 @@ public:
     }
 };
 
+class SmallPaddedConvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallPaddedConvolutionLayerDataset()
+    {
+        // Padding
+        add_config(TensorShape(17U, 15U, 7U), TensorShape(3U, 3U, 7U, 12U), TensorShape(12U), TensorShape(17U, 15U, 12U), PadStrideInfo(1, 1, 1, 1));
+        // Stride 2
+        add_config(TensorShape(23U, 19U, 5U, 3U), TensorShape(3U, 3U, 5U, 16U), TensorShape(16U), TensorShape(12U, 10U, 16U, 3U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(19U, 23U, 4U, 2U), TensorShape(5U, 3U, 4U, 8U), TensorShape(8U), TensorShape(10U, 23U, 8U, 2U), PadStrideInfo(2, 1, 2, 1));
+        // Dilation
+        add_config(TensorShape(21U, 17U, 6U, 2U), TensorShape(3U, 3U, 6U, 10U), TensorShape(10U), TensorShape(21U, 17U, 10U, 2U), PadStrideInfo(1, 1, 2, 2), Size2D(2U, 2U));
+        // Asymmetric padding, stride 2 and dilation
+        add_config(TensorShape(33U, 27U, 7U, 2U), TensorShape(3U, 3U, 7U, 16U), TensorShape(16U), TensorShape(16U, 13U, 16U, 2U), PadStrideInfo(2, 2, 1, 2, 0, 1, DimensionRoundingType::FLOOR),
+                   Size2D(2U, 1U));
+    }
+};
+
 // TODO (COMPMID-1749)
 class SmallConvolutionLayerReducedDataset final : public ConvolutionLayerDataset
 {
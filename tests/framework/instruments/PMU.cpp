@@ -55,6 +55,13 @@ PMU::PMU(uint64_t config)
     open(config);
 }
 
+PMU::PMU(uint32_t type, uint64_t config)
+    : PMU()
+{
+    _perf_config.type = type;
+    open(config);
+}
+
 PMU::~PMU()
 {
     close();
@@ -76,6 +83,7 @@ void PMU::open(const perf_event_attr &perf_config)
     const int result = ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
     if(result == -1)
     {
+        close();
         ARM_COMPUTE_ERROR("Failed to enable PMU counter: %d", errno);
     }
 }
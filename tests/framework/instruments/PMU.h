@@ -55,6 +55,13 @@ public:
      */
     explicit PMU(uint64_t config);
 
+    /** Create PMU with specified counter of the specified type.
+     *
+     * @param[in] type   Counter type (e.g. PERF_TYPE_HARDWARE or PERF_TYPE_HW_CACHE).
+     * @param[in] config Counter identifier.
+     */
+    PMU(uint32_t type, uint64_t config);
+
     /** Default destructor. */
     ~PMU();
 
@@ -38,6 +38,10 @@ void PMUCounter::start()
 {
     _pmu_cycles.reset();
     _pmu_instructions.reset();
+    if(_pmu_dtlb_misses != nullptr)
+    {
+        _pmu_dtlb_misses->reset();
+    }
 }
 
 void PMUCounter::stop()
@@ -59,15 +63,34 @@ void PMUCounter::stop()
     {
         _instructions = 0;
     }
+
+    if(_pmu_dtlb_misses != nullptr)
+    {
+        try
+        {
+            _dtlb_misses = _pmu_dtlb_misses->get_value<long long>();
+        }
+        catch(const std::runtime_error &)
+        {
+            _dtlb_misses = 0;
+        }
+    }
 }
 
 Instrument::MeasurementsMap PMUCounter::measurements() const
 {
-    return MeasurementsMap
+    MeasurementsMap measurements
     {
         { "CPU cycles", Measurement(_cycles / _scale_factor, _unit + "cycles") },
         { "CPU instructions", Measurement(_instructions / _scale_factor, _unit + "instructions") },
     };
+
+    if(_pmu_dtlb_misses != nullptr)
+    {
+        measurements.emplace("CPU dTLB misses", Measurement(_dtlb_misses / _scale_factor, _unit + "misses"));
+    }
+
+    return measurements;
 }
 } // namespace framework
 } // namespace test
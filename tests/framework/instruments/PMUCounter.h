@@ -27,13 +27,18 @@
 #include "Instrument.h"
 #include "PMU.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
-/** Implementation of an instrument to count CPU cycles. */
+/** Implementation of an instrument to count CPU cycles, instructions and data TLB misses.
+ *
+ * @note Data TLB misses are only reported if the CPU exposes the event.
+ */
 class PMUCounter : public Instrument
 {
 public:
@@ -60,6 +65,16 @@ public:
             default:
                 ARM_COMPUTE_ERROR("Invalid scale");
         }
+
+        // Not all the cores (or virtual machines) expose the data TLB event
+        try
+        {
+            _pmu_dtlb_misses = support::cpp14::make_unique<PMU>(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        }
+        catch(const std::runtime_error &)
+        {
+            _pmu_dtlb_misses = nullptr;
+        }
     };
 
     std::string     id() const override;
@@ -68,11 +83,13 @@ public:
     MeasurementsMap measurements() const override;
 
 private:
-    PMU       _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
-    PMU       _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
-    long long _cycles{ 0 };
-    long long _instructions{ 0 };
-    int       _scale_factor{};
+    PMU                  _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
+    PMU                  _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
+    std::unique_ptr<PMU> _pmu_dtlb_misses{ nullptr };
+    long long            _cycles{ 0 };
+    long long            _instructions{ 0 };
+    long long            _dtlb_misses{ 0 };
+    int                  _scale_factor{};
 };
 } // namespace framework
 } // namespace test
@@ -67,6 +67,18 @@ public:
         return _real_scheduler.num_threads();
     }
 
+    void set_wait_policy(WaitPolicy policy, unsigned int spin_count) override
+    {
+        IScheduler::set_wait_policy(policy, spin_count);
+        _real_scheduler.set_wait_policy(policy, spin_count);
+    }
+
+    void set_affinity(const std::vector<unsigned int> &cpu_ids) override
+    {
+        IScheduler::set_affinity(cpu_ids);
+        _real_scheduler.set_affinity(cpu_ids);
+    }
+
     void set_prefix(const std::string &prefix)
     {
         _prefix = prefix;
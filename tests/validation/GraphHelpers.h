@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TEST_VALIDATION_GRAPH_HELPERS_H__
+#define __ARM_COMPUTE_TEST_VALIDATION_GRAPH_HELPERS_H__
+
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Graph accessor filling a F32 tensor with uniformly distributed values in [-1, 1] */
+class UniformAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] seed_offset Seed offset of the values
+     */
+    UniformAccessor(std::random_device::result_type seed_offset)
+        : _seed_offset(seed_offset)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        library->fill(Accessor(tensor), std::uniform_real_distribution<>(-1.f, 1.f), _seed_offset);
+        return true;
+    }
+
+private:
+    std::random_device::result_type _seed_offset;
+};
+
+/** Graph accessor copying a F32 output tensor into a vector and stopping the execution after a number of runs */
+class CopyAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values   Vector to copy the values of the tensor into
+     * @param[in]  num_runs (Optional) Number of runs to execute the graph for
+     */
+    CopyAccessor(std::vector<float> &values, unsigned int num_runs = 1)
+        : _values(values), _num_runs(num_runs), _runs(0)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        Accessor  accessor(tensor);
+        const int num_elements = accessor.num_elements();
+        _values.resize(num_elements);
+        for(int i = 0; i < num_elements; ++i)
+        {
+            _values[i] = *reinterpret_cast<const float *>(accessor(index2coord(accessor.shape(), i)));
+        }
+        return ++_runs < _num_runs;
+    }
+
+private:
+    std::vector<float> &_values;
+    unsigned int        _num_runs;
+    unsigned int        _runs;
+};
+
+/** Shape of the input of the network added by @ref add_small_network */
+inline TensorShape small_network_input_shape()
+{
+    return TensorShape(8U, 8U, 3U, 1U);
+}
+
+/** Adds a small F32 network to a stream: convolution, activation, fully connected and softmax layers
+ *
+ * The weights and biases are filled with @ref UniformAccessor, the values are the same for every network added.
+ *
+ * @param[in, out] stream Stream to add the network to
+ * @param[in]      input  Accessor of the input, can be nullptr
+ * @param[in]      output Accessor of the output, can be nullptr
+ */
+inline void add_small_network(graph::frontend::Stream &stream, graph::ITensorAccessorUPtr input, graph::ITensorAccessorUPtr output)
+{
+    using namespace graph::frontend;
+
+    stream << InputLayer(graph::TensorDescriptor(small_network_input_shape(), DataType::F32), std::move(input)).set_name("input")
+           << ConvolutionLayer(3U, 3U, 4U,
+                               support::cpp14::make_unique<UniformAccessor>(1),
+                               support::cpp14::make_unique<UniformAccessor>(2),
+                               PadStrideInfo(1, 1, 1, 1))
+           .set_name("conv")
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu")
+           << FullyConnectedLayer(10U,
+                                  support::cpp14::make_unique<UniformAccessor>(3),
+                                  support::cpp14::make_unique<UniformAccessor>(4))
+           .set_name("fc")
+           << SoftmaxLayer().set_name("softmax")
+           << OutputLayer(std::move(output)).set_name("output");
+}
+
+/** Adds a small F32 network with a GoogLeNet-style inception block to a stream
+ *
+ * Four branches (1x1 convolution, 1x1 then 3x3 convolutions, 1x1 then 5x5 convolutions, pooling then 1x1 convolution)
+ * are concatenated along the channels and followed by fully connected and softmax layers.
+ * The weights and biases are filled with @ref UniformAccessor, the values are the same for every network added.
+ *
+ * @param[in, out] stream Stream to add the network to
+ * @param[in]      input  Accessor of the input, can be nullptr
+ * @param[in]      output Accessor of the output, can be nullptr
+ */
+inline void add_inception_network(graph::frontend::Stream &stream, graph::ITensorAccessorUPtr input, graph::ITensorAccessorUPtr output)
+{
+    using namespace graph::frontend;
+
+    std::random_device::result_type seed = 1;
+    auto convolution = [&](unsigned int kernel_size, unsigned int num_outputs, const std::string &name)
+    {
+        const unsigned int pad = kernel_size / 2;
+        ConvolutionLayer   conv(kernel_size, kernel_size, num_outputs,
+                                support::cpp14::make_unique<UniformAccessor>(seed),
+                                support::cpp14::make_unique<UniformAccessor>(seed + 1),
+                                PadStrideInfo(1, 1, pad, pad));
+        seed += 2;
+        conv.set_name(name);
+        return conv;
+    };
+    const ActivationLayerInfo relu(ActivationLayerInfo::ActivationFunction::RELU);
+
+    stream << InputLayer(graph::TensorDescriptor(small_network_input_shape(), DataType::F32), std::move(input)).set_name("input")
+           << convolution(3U, 8U, "stem") << ActivationLayer(relu).set_name("stem/relu");
+
+    SubStream i_a(stream);
+    i_a << convolution(1U, 4U, "a/1x1") << ActivationLayer(relu).set_name("a/relu");
+
+    SubStream i_b(stream);
+    i_b << convolution(1U, 4U, "b/1x1") << ActivationLayer(relu).set_name("b/relu_1x1")
+        << convolution(3U, 6U, "b/3x3") << ActivationLayer(relu).set_name("b/relu_3x3");
+
+    SubStream i_c(stream);
+    i_c << convolution(1U, 2U, "c/1x1") << ActivationLayer(relu).set_name("c/relu_1x1")
+        << convolution(5U, 3U, "c/5x5") << ActivationLayer(relu).set_name("c/relu_5x5");
+
+    SubStream i_d(stream);
+    i_d << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1))).set_name("d/pool")
+        << convolution(1U, 3U, "d/1x1") << ActivationLayer(relu).set_name("d/relu");
+
+    stream << ConcatLayer(std::move(i_a), std::move(i_b), std::move(i_c), std::move(i_d)).set_name("concat")
+           << FullyConnectedLayer(10U,
+                                  support::cpp14::make_unique<UniformAccessor>(seed),
+                                  support::cpp14::make_unique<UniformAccessor>(seed + 1))
+           .set_name("fc")
+           << SoftmaxLayer().set_name("softmax")
+           << OutputLayer(std::move(output)).set_name("output");
+}
+
+/** Checks that the values computed by a graph match the expected ones
+ *
+ * @param[in] values          Values to check
+ * @param[in] expected_values Expected values
+ * @param[in] tolerance       (Optional) Absolute tolerance
+ */
+inline void validate_values(const std::vector<float> &values, const std::vector<float> &expected_values, float tolerance = 1e-5f)
+{
+    ARM_COMPUTE_EXPECT(!expected_values.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(values.size() == expected_values.size());
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(values[i] - expected_values[i]) <= tolerance, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Returns the tensor of the first input layer of a finalized stream
+ *
+ * @param[in] stream Finalized stream
+ *
+ * @return The input tensor
+ */
+inline graph::Tensor *stream_input(graph::frontend::Stream &stream)
+{
+    graph::Graph &g = stream.graph();
+    return g.node(g.nodes(graph::NodeType::Input).front())->output(0);
+}
+
+/** Returns the tensor of the first output layer of a finalized stream
+ *
+ * @param[in] stream Finalized stream
+ *
+ * @return The output tensor
+ */
+inline graph::Tensor *stream_output(graph::frontend::Stream &stream)
+{
+    graph::Graph &g = stream.graph();
+    return g.node(g.nodes(graph::NodeType::Output).front())->input(0);
+}
+
+/** Allocates a tensor with the same layout, padding included, as a tensor of a finalized graph
+ *
+ * @param[out] tensor       Tensor to allocate
+ * @param[in]  graph_tensor Tensor of the graph
+ */
+inline void allocate_like(Tensor &tensor, graph::Tensor &graph_tensor)
+{
+    tensor.allocator()->init(TensorInfo(*graph_tensor.handle()->tensor().info()), 64);
+    tensor.allocator()->allocate();
+}
+
+/** Creates an external buffer pointing to the memory of an allocated tensor
+ *
+ * @param[in] tensor Allocated tensor
+ *
+ * @return An external buffer with the size and strides of the tensor
+ */
+inline graph::ExternalBuffer external_buffer(Tensor &tensor)
+{
+    graph::ExternalBuffer buffer;
+    buffer.ptr     = tensor.buffer();
+    buffer.size    = tensor.info()->total_size();
+    buffer.strides = tensor.info()->strides_in_bytes();
+    return buffer;
+}
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_TEST_VALIDATION_GRAPH_HELPERS_H__ */
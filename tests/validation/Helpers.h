@@ -177,6 +177,21 @@ void fill_lookuptable(T &&table)
     }
 }
 
+/** Round the values of a simple tensor to the nearest BFLOAT16 values.
+ *
+ * @note Used to give a float reference the same inputs as a BFLOAT16 target.
+ *
+ * @param[in,out] tensor Tensor to round.
+ */
+template <typename T>
+void round_to_bfloat16(SimpleTensor<T> &tensor)
+{
+    for(int i = 0; i < tensor.num_elements(); ++i)
+    {
+        tensor[i] = static_cast<T>(static_cast<float>(bfloat16(static_cast<float>(tensor[i]))));
+    }
+}
+
 /** Convert quantized simple tensor into float using tensor quantization information.
  *
  * @param[in] src Quantized tensor.
@@ -185,6 +200,14 @@ void fill_lookuptable(T &&table)
  */
 SimpleTensor<float> convert_from_asymmetric(const SimpleTensor<uint8_t> &src);
 
+/** Convert signed quantized simple tensor into float using tensor quantization information.
+ *
+ * @param[in] src Signed quantized tensor.
+ *
+ * @return Float tensor.
+ */
+SimpleTensor<float> convert_from_asymmetric(const SimpleTensor<int8_t> &src);
+
 /** Convert float simple tensor into quantized using specified quantization information.
  *
  * @param[in] src               Float tensor.
@@ -194,6 +217,15 @@ SimpleTensor<float> convert_from_asymmetric(const SimpleTensor<uint8_t> &src);
  */
 SimpleTensor<uint8_t> convert_to_asymmetric(const SimpleTensor<float> &src, const QuantizationInfo &quantization_info);
 
+/** Convert float simple tensor into signed quantized using specified quantization information.
+ *
+ * @param[in] src               Float tensor.
+ * @param[in] quantization_info Quantification information.
+ *
+ * @return Signed quantized tensor.
+ */
+SimpleTensor<int8_t> convert_to_asymmetric_signed(const SimpleTensor<float> &src, const QuantizationInfo &quantization_info);
+
 /** Matrix multiply between 2 float simple tensors
  *
  * @param[in]  a   Input tensor A
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEFusedPointwiseLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/PaddingCalculator.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedPointwiseLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.001f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.0001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+const auto act_infos = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC),
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedPointwiseLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),    // Broadcast operand
+                                                       TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),    // Mismatching data types
+                                                       TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),    // Invalid mean/var shape
+                                                       TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),     // Unsupported data type
+                                                     }),
+               framework::dataset::make("OperandInfo", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F16),
+                                                         TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),
+                                                       })),
+               framework::dataset::make("MeanVarInfo", { TensorInfo(TensorShape(2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(2U), 1, DataType::U8),
+                                                       })),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),
+                                                      })),
+               framework::dataset::make("Expected", { true, false, false, false, false })),
+               input_info, operand_info, mean_var_info, output_info, expected)
+{
+    const std::vector<PointwiseOperation> operations
+    {
+        PointwiseOperation(PointwiseOperation::Type::ADD, 0),
+        PointwiseOperation(PointwiseOperation::Type::BATCH_NORMALIZATION, 1),
+        PointwiseOperation(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+    };
+    const std::vector<const ITensorInfo *> operands{ &operand_info, &mean_var_info, &mean_var_info, nullptr, nullptr };
+
+    const bool is_valid = bool(NEFusedPointwiseLayer::validate(&input_info.clone()->set_is_resizable(false), operands, &output_info.clone()->set_is_resizable(false), operations));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(datasets::Small4DShapes(), framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+               shape, data_layout)
+{
+    TensorShape src_dst_shape = shape;
+    if(data_layout == DataLayout::NHWC)
+    {
+        permute(src_dst_shape, PermutationVector(2U, 0U, 1U));
+    }
+
+    // Create tensors
+    Tensor src     = create_tensor<Tensor>(src_dst_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+    Tensor operand = create_tensor<Tensor>(src_dst_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+    Tensor dst     = create_tensor<Tensor>(src_dst_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+    Tensor mean    = create_tensor<Tensor>(TensorShape(shape[2]), DataType::F32, 1);
+    Tensor var     = create_tensor<Tensor>(TensorShape(shape[2]), DataType::F32, 1);
+
+    // Create and configure function
+    NEFusedPointwiseLayer fused;
+    fused.configure(&src, { &operand, &mean, &var, nullptr, nullptr }, &dst,
+    {
+        PointwiseOperation(PointwiseOperation::Type::BATCH_NORMALIZATION, 1),
+        PointwiseOperation(PointwiseOperation::Type::ADD, 0),
+        PointwiseOperation(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+    });
+
+    // Validate valid region
+    const ValidRegion valid_region = shape_to_valid_region(src_dst_shape);
+    validate(dst.info()->valid_region(), valid_region);
+
+    // Validate padding: the left-over elements are computed in-kernel
+    validate(src.info()->padding(), PaddingSize());
+    validate(operand.info()->padding(), PaddingSize());
+    validate(dst.info()->padding(), PaddingSize());
+}
+
+template <typename T>
+using NEFusedPointwiseLayerFixture = FusedPointwiseLayerValidationFixture<Tensor, Accessor, NEFusedPointwiseLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedPointwiseLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::Small4DShapes(), act_infos),
+                                                                                                                                  framework::dataset::make("InPlace", { false, true })),
+                                                                                                                          framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                  framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedPointwiseLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -24,7 +24,11 @@
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -40,6 +44,11 @@
 #include "tests/validation/fixtures/GEMMFixture.h"
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
 
 namespace arm_compute
 {
@@ -67,6 +76,48 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 const auto data_interleave = framework::dataset::make("M", 8, 12) * framework::dataset::make("N", 8, 12);
 const auto data_transpose  = framework::dataset::make("M", 8, 14) * framework::dataset::make("N", 7, 14);
 
+/** Batched GEMMs: B broadcast to all the heads, one B per head and one B per head broadcast along the batches */
+const auto data_batched = zip(zip(zip(framework::dataset::make("A", { TensorShape(21U, 13U, 4U), TensorShape(16U, 33U, 3U, 2U), TensorShape(32U, 17U, 5U), TensorShape(9U, 7U, 6U, 2U) }),
+                                      framework::dataset::make("B", { TensorShape(11U, 21U), TensorShape(24U, 16U), TensorShape(19U, 32U, 5U), TensorShape(13U, 9U, 6U) })),
+                                  framework::dataset::make("Out", { TensorShape(11U, 13U, 4U), TensorShape(24U, 33U, 3U, 2U), TensorShape(19U, 17U, 5U), TensorShape(13U, 7U, 6U, 2U) })),
+                              framework::dataset::make("Alpha", { 1.f, 0.5f, 1.f, 2.f }));
+
+/** Runs a F32 GEMM through NEGEMM and validates it against the reference
+ *
+ * @param[in] m Number of rows of the output
+ * @param[in] n Number of columns of the output
+ * @param[in] k Number of columns of A
+ */
+void run_and_validate_gemm(unsigned int m, unsigned int n, unsigned int k)
+{
+    const TensorShape shape_a(k, m);
+    const TensorShape shape_b(n, k);
+    const TensorShape shape_dst(n, m);
+
+    Tensor a   = create_tensor<Tensor>(shape_a, DataType::F32);
+    Tensor b   = create_tensor<Tensor>(shape_b, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape_dst, DataType::F32);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    gemm.run();
+
+    SimpleTensor<float> ref_a{ shape_a, DataType::F32 };
+    SimpleTensor<float> ref_b{ shape_b, DataType::F32 };
+    SimpleTensor<float> ref_c{ shape_dst, DataType::F32 };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+
+    validate(Accessor(dst), reference::gemm<float>(ref_a, ref_b, ref_c, 1.f, 0.f), tolerance_f);
+}
 } // namespace
 
 TEST_SUITE(NEON)
@@ -107,6 +158,11 @@ using NEGEMMFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T>;
 template <typename T>
 using NEGEMMFixtureDisabledC = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T, true>;
 
+using NEGEMMBF16Fixture = GEMMBF16ValidationFixture<Tensor, Accessor, NEGEMM>;
+
+template <typename T>
+using NEGEMMBatchedFixture = GEMMBatchedValidationFixture<Tensor, Accessor, NEGEMMBatched, T>;
+
 TEST_SUITE(Float)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 TEST_SUITE(FP16)
@@ -155,10 +211,110 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMFixtureDisabledC<float>, framework::Datas
     validate(Accessor(_target), _reference, tolerance_f);
 }
 TEST_SUITE_END()
+TEST_SUITE_END()
 
+#ifdef __aarch64__
+TEST_SUITE(BFLOAT16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMBF16Fixture, framework::DatasetMode::PRECOMMIT, datasets::SmallGEMMDataset())
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
 TEST_SUITE_END()
+#endif /* __aarch64__ */
 TEST_SUITE_END()
 
+TEST_SUITE(Batched)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMBatchedFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(data_batched,
+                                                                                                                framework::dataset::make("ReshapeWeights", { true, false })),
+                                                                                                        framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMBatchedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(data_batched,
+                                                                                                                 framework::dataset::make("ReshapeWeights", { true, false })),
+                                                                                                         framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Batched
+
+TEST_SUITE(Tuner)
+TEST_CASE(SaveLoad, framework::DatasetMode::ALL)
+{
+    const std::string filename = "gemm_tuner_round_trip.csv";
+
+    const std::unordered_map<std::string, std::string> table
+    {
+        { "F32_GENERIC_M23_N41_K37_B1_MU1_T4_PT1_A1", "sgemm_12x8" },
+        { "F32_A53_M1_N1000_K2048_B1_MU1_T1_PT1_A1", "sgemv_trans" },
+        { "QASYMM8_A55r1_M196_N64_K576_B1_MU1_T2_PT1_A1_C3x3", "gemm_u8_12x8" },
+    };
+
+    NEGEMMTuner tuner;
+    tuner.import_kernel_table(table);
+    tuner.save_to_file(filename);
+
+    NEGEMMTuner loaded_tuner;
+    loaded_tuner.load_from_file(filename);
+    ARM_COMPUTE_EXPECT(loaded_tuner.kernel_table() == table, framework::LogLevel::ERRORS);
+
+    // Saving the loaded table writes the same content
+    loaded_tuner.save_to_file(filename);
+    NEGEMMTuner reloaded_tuner;
+    reloaded_tuner.load_from_file(filename);
+    ARM_COMPUTE_EXPECT(reloaded_tuner.kernel_table() == table, framework::LogLevel::ERRORS);
+
+    std::string kernel_name;
+    ARM_COMPUTE_EXPECT(reloaded_tuner.find_kernel("F32_A53_M1_N1000_K2048_B1_MU1_T1_PT1_A1", kernel_name), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel_name == "sgemv_trans", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!reloaded_tuner.find_kernel("F32_A53_M2_N1000_K2048_B1_MU1_T1_PT1_A1", kernel_name), framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(ForcedKernels, framework::DatasetMode::ALL)
+{
+    const unsigned int m = 23;
+    const unsigned int n = 41;
+    const unsigned int k = 37;
+
+    // Tuning the configuration records one kernel in the table
+    NEGEMMTuner tuner;
+    tuner.set_num_iterations(1);
+    NEGEMMAssemblyDispatch::set_tuner(&tuner);
+    run_and_validate_gemm(m, n, k);
+
+    const std::unordered_map<std::string, std::string> table = tuner.kernel_table();
+    ARM_COMPUTE_EXPECT(table.size() == 1, framework::LogLevel::ERRORS);
+
+    // Force each kernel compatible with the configuration through the table
+    tuner.set_tune_new_kernels(false);
+    const auto kernels = arm_gemm::get_compatible_kernels<float, float>(NEScheduler::get().cpu_info(), m, n, k, 1, 1, false, false, 1.f, 0.f,
+                                                                        NEScheduler::get().num_threads(), true);
+    for(const auto &gemm_entry : table)
+    {
+        for(const auto &kernel : kernels)
+        {
+            ARM_COMPUTE_TEST_INFO("Kernel : " << kernel.name);
+            tuner.add_kernel_to_table(gemm_entry.first, kernel.name);
+            run_and_validate_gemm(m, n, k);
+        }
+    }
+
+    NEGEMMAssemblyDispatch::set_tuner(nullptr);
+}
+TEST_SUITE_END() // Tuner
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
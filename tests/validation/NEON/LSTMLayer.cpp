@@ -41,6 +41,7 @@ namespace
 {
 RelativeTolerance<float> tolerance_f32(0.00001f);
 RelativeTolerance<half>  tolerance_f16(half(0.1));
+AbsoluteTolerance<float> tolerance_dynamic_quantization(0.05f); /**< The fully connected layers round their inputs and weights to 8 bit */
 } // namespace
 
 TEST_SUITE(NEON)
@@ -162,6 +163,21 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMLayerFixture<float>, framework::DatasetMo
     validate(Accessor(_target), _reference, tolerance_f32);
     validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32);
 }
+
+template <typename T>
+using NELSTMLayerDynamicQuantizationFixture = LSTMLayerValidationDynamicQuantizationFixture<Tensor, Accessor, NELSTMLayer, LSTMParams<ITensor>, T>;
+
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMLayerDynamicQuantizationFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(datasets::SmallLSTMLayerDataset(),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                    framework::dataset::make("ProjectionOpt", { true, false })),
+                                                                                                                    framework::dataset::make("PeepholeOpt", { true, false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_dynamic_quantization);
+    validate(Accessor(_target_scratch), _reference_scratch, tolerance_dynamic_quantization);
+}
+TEST_SUITE_END() // DynamicQuantization
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
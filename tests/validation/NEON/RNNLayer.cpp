@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@ namespace
 {
 RelativeTolerance<float> tolerance_f32(0.001f);
 RelativeTolerance<half>  tolerance_f16(half(0.1));
+AbsoluteTolerance<float> tolerance_dynamic_quantization(0.05f); /**< The fully connected layers round their inputs and weights to 8 bit */
 } // namespace
 
 TEST_SUITE(NEON)
@@ -129,6 +130,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NERNNLayerFixture<float>, framework::DatasetMod
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+
+template <typename T>
+using NERNNLayerDynamicQuantizationFixture = RNNLayerValidationDynamicQuantizationFixture<Tensor, Accessor, NERNNLayer, T>;
+
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERNNLayerDynamicQuantizationFixture<float>, framework::DatasetMode::ALL, combine(datasets::SmallRNNLayerDataset(), framework::dataset::make("DataType",
+                                                                                                                   DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_dynamic_quantization);
+}
+TEST_SUITE_END() // DynamicQuantization
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
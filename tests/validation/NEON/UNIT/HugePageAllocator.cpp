@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "support/ToolchainSupport.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Checks that a buffer is aligned and can be written and read back in full
+ *
+ * @param[in] ptr       Buffer to check
+ * @param[in] size      Size of the buffer in bytes
+ * @param[in] alignment Required alignment of the buffer
+ */
+void validate_buffer(void *ptr, size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(ptr, alignment), framework::LogLevel::ERRORS);
+
+    auto *bytes = static_cast<uint8_t *>(ptr);
+    std::memset(bytes, 0x5A, size);
+    ARM_COMPUTE_EXPECT(bytes[0] == 0x5A && bytes[size / 2] == 0x5A && bytes[size - 1] == 0x5A, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(HugePageAllocator)
+
+TEST_CASE(AllocateFree, framework::DatasetMode::ALL)
+{
+    HugePageAllocator allocator;
+
+    // Below the threshold the memory comes from the heap
+    const size_t small_size = 4096 + 3;
+    void        *small_ptr  = allocator.allocate(small_size, 64);
+    validate_buffer(small_ptr, small_size, 64);
+
+    // Above the threshold the memory is mapped and starts on a huge page boundary
+    const size_t large_size = 3 * HugePageAllocator::huge_page_size + 5;
+    void        *large_ptr  = allocator.allocate(large_size, 128);
+    validate_buffer(large_ptr, large_size, 128);
+#ifndef BARE_METAL
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(large_ptr, HugePageAllocator::huge_page_size), framework::LogLevel::ERRORS);
+#endif /* BARE_METAL */
+
+    ARM_COMPUTE_EXPECT(allocator.allocate(0, 64) == nullptr, framework::LogLevel::ERRORS);
+
+    allocator.free(small_ptr);
+    allocator.free(large_ptr);
+    allocator.free(nullptr);
+}
+
+TEST_CASE(HugePagesUnavailable, framework::DatasetMode::ALL)
+{
+    // Transparent huge pages are only a hint and binding to a NUMA node that doesn't exist fails:
+    // the allocations must be usable in both cases
+    HugePageAllocator allocator(HugePageAllocator::huge_page_size, 1023);
+
+    const size_t large_size = 2 * HugePageAllocator::huge_page_size;
+    void        *large_ptr  = allocator.allocate(large_size, 64);
+    validate_buffer(large_ptr, large_size, 64);
+    allocator.free(large_ptr);
+
+    // An alignment larger than a huge page is honoured
+    const size_t alignment   = 2 * HugePageAllocator::huge_page_size;
+    void        *aligned_ptr = allocator.allocate(large_size, alignment);
+    validate_buffer(aligned_ptr, large_size, alignment);
+    allocator.free(aligned_ptr);
+}
+
+TEST_CASE(Regions, framework::DatasetMode::ALL)
+{
+    HugePageAllocator allocator(1024);
+
+    std::unique_ptr<IMemoryRegion> region = allocator.make_region(4096, 64);
+    ARM_COMPUTE_ASSERT(region != nullptr);
+    validate_buffer(region->buffer(), region->size(), 64);
+
+    // Sub-regions point into the region and are bounds checked
+    std::unique_ptr<IMemoryRegion> subregion = region->extract_subregion(1024, 1024);
+    ARM_COMPUTE_ASSERT(subregion != nullptr);
+    ARM_COMPUTE_EXPECT(subregion->buffer() == static_cast<uint8_t *>(region->buffer()) + 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(region->extract_subregion(4000, 1024) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TensorAllocation, framework::DatasetMode::ALL)
+{
+    HugePageAllocator allocator(1024);
+
+    Tensor tensor;
+    tensor.allocator()->init(TensorInfo(TensorShape(64U, 64U), 1, DataType::F32), 256);
+    tensor.allocator()->set_allocator(&allocator);
+    tensor.allocator()->allocate();
+    validate_buffer(tensor.buffer(), tensor.info()->total_size(), 256);
+    tensor.allocator()->free();
+    ARM_COMPUTE_EXPECT(tensor.buffer() == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(DestroyWithLiveAllocations, framework::DatasetMode::ALL)
+{
+    // The allocator releases the memory which was not freed instead of terminating the process
+    auto allocator = support::cpp14::make_unique<HugePageAllocator>(1024);
+    validate_buffer(allocator->allocate(512, 64), 512, 64);
+    validate_buffer(allocator->allocate(HugePageAllocator::huge_page_size, 64), HugePageAllocator::huge_page_size, 64);
+    allocator.reset();
+}
+
+TEST_SUITE_END() // HugePageAllocator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
@@ -90,6 +91,60 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(IntervalMemoryManagerOverlappingLifetimes, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<IntervalLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+    MemoryGroup group(mm);
+
+    // Create tensors of different sizes whose lifetimes form a chain: t0 -> t1 -> t2 -> t3
+    std::vector<Tensor> tensors(4);
+    const std::vector<unsigned int> sizes{ 64U, 256U, 32U, 128U };
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        tensors[i].allocator()->init(TensorInfo(TensorShape(sizes[i]), 1, DataType::F32));
+    }
+
+    group.manage(&tensors[0]);
+    group.manage(&tensors[1]);
+    tensors[0].allocator()->allocate();
+    group.manage(&tensors[2]);
+    tensors[1].allocator()->allocate();
+    group.manage(&tensors[3]);
+    tensors[2].allocator()->allocate();
+    tensors[3].allocator()->allocate();
+
+    // Finalize memory manager
+    mm->populate(allocator, 1 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->lifetime_manager()->are_all_finalized(), framework::LogLevel::ERRORS);
+
+    // At most two consecutive tensors are alive at the same time
+    size_t max_live_size = 0;
+    for(size_t i = 0; i + 1 < tensors.size(); ++i)
+    {
+        max_live_size = std::max(max_live_size, tensors[i].info()->total_size() + tensors[i + 1].info()->total_size());
+    }
+    ARM_COMPUTE_EXPECT(lifetime_mgr->planned_size() >= max_live_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->planned_size() < lifetime_mgr->naive_size(), framework::LogLevel::ERRORS);
+
+    // Tensors alive at the same time don't share memory
+    group.acquire();
+    for(size_t i = 0; i + 1 < tensors.size(); ++i)
+    {
+        const uint8_t *a = tensors[i].buffer();
+        const uint8_t *b = tensors[i + 1].buffer();
+        ARM_COMPUTE_EXPECT(a != nullptr && b != nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT((a + tensors[i].info()->total_size() <= b) || (b + tensors[i + 1].info()->total_size() <= a), framework::LogLevel::ERRORS);
+    }
+    group.release();
+
+    // Clear manager
+    mm->clear();
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPUUtils.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/SimpleTensor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(Scheduler)
+
+TEST_CASE(WaitPolicy, framework::DatasetMode::ALL)
+{
+    if(!Scheduler::is_available(Scheduler::Type::CPP))
+    {
+        ARM_COMPUTE_TEST_INFO("The C++11 threads scheduler is not available");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+
+    const Scheduler::Type default_type = Scheduler::get_type();
+    Scheduler::set(Scheduler::Type::CPP);
+    IScheduler &scheduler = Scheduler::get();
+
+    const IScheduler::WaitPolicy default_policy     = scheduler.wait_policy();
+    const unsigned int           default_spin_count = scheduler.spin_count();
+    const unsigned int           default_threads    = scheduler.num_threads();
+    scheduler.set_num_threads(4);
+
+    const TensorShape         shape(33U, 27U, 5U);
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::RELU);
+
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape, DataType::F32);
+
+    NEActivationLayerKernel kernel;
+    kernel.configure(&src, &dst, act_info);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(ref_src, 0);
+    const SimpleTensor<float> reference = reference::activation_layer(ref_src, act_info);
+
+    // A spin count shorter than the idle periods lets the workers block, a very long one keeps them spinning
+    const std::vector<std::pair<IScheduler::WaitPolicy, unsigned int>> policies
+    {
+        { IScheduler::WaitPolicy::BLOCK, 0U },
+        { IScheduler::WaitPolicy::SPIN_THEN_BLOCK, 1U },
+        { IScheduler::WaitPolicy::SPIN_THEN_BLOCK, 1000U },
+        { IScheduler::WaitPolicy::SPIN_THEN_BLOCK, 100000000U },
+    };
+    const std::vector<unsigned int> idle_periods_ms{ 0U, 1U, 20U, 0U };
+
+    for(const auto &policy : policies)
+    {
+        scheduler.set_wait_policy(policy.first, policy.second);
+        ARM_COMPUTE_EXPECT(scheduler.wait_policy() == policy.first, framework::LogLevel::ERRORS);
+
+        for(const auto idle_period_ms : idle_periods_ms)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(idle_period_ms));
+
+            library->fill_tensor_value(Accessor(dst), -1.f);
+            scheduler.schedule(&kernel, IScheduler::Hints(Window::DimY));
+
+            validate(Accessor(dst), reference);
+        }
+    }
+
+    scheduler.set_wait_policy(default_policy, default_spin_count);
+    scheduler.set_num_threads(default_threads);
+    Scheduler::set(default_type);
+}
+
+TEST_CASE(Affinity, framework::DatasetMode::ALL)
+{
+    const ThreadAffinity original = get_thread_affinity();
+    if(!Scheduler::is_available(Scheduler::Type::CPP) || original.tid < 0)
+    {
+        ARM_COMPUTE_TEST_INFO("The C++11 threads scheduler or thread affinities are not available");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+    ARM_COMPUTE_EXPECT(!original.cpu_ids.empty(), framework::LogLevel::ERRORS);
+
+    const Scheduler::Type default_type = Scheduler::get_type();
+    Scheduler::set(Scheduler::Type::CPP);
+    IScheduler &scheduler = Scheduler::get();
+
+    const std::vector<unsigned int> default_affinity = scheduler.affinity();
+    const unsigned int              default_threads  = scheduler.num_threads();
+    scheduler.set_affinity({});
+    scheduler.set_num_threads(4);
+
+    // Returns the CPU ids each thread of the scheduler, the caller included, is allowed to run on
+    auto get_affinities = [&]()
+    {
+        std::mutex                             mutex;
+        std::vector<std::vector<unsigned int>> affinities;
+        std::vector<IScheduler::Workload>      workloads(scheduler.num_threads(), [&](const ThreadInfo &)
+        {
+            // Keep the thread busy so that every thread of the pool picks a workload
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            const ThreadAffinity affinity = get_thread_affinity();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            affinities.push_back(affinity.cpu_ids);
+        });
+        scheduler.run_tagged_workloads(workloads, nullptr);
+        affinities.push_back(get_thread_affinity().cpu_ids);
+        return affinities;
+    };
+
+    // Pin all the threads to the first CPU the process can run on
+    const std::vector<unsigned int> pinned{ original.cpu_ids[0] };
+    scheduler.set_affinity(pinned);
+    ARM_COMPUTE_EXPECT(scheduler.affinity() == pinned, framework::LogLevel::ERRORS);
+    for(const auto &cpu_ids : get_affinities())
+    {
+        ARM_COMPUTE_EXPECT(cpu_ids == pinned, framework::LogLevel::ERRORS);
+    }
+
+    // Unpinned threads get the CPUs the process was allowed to run on back, not every CPU of the system
+    scheduler.set_affinity({});
+    ARM_COMPUTE_EXPECT(scheduler.affinity().empty(), framework::LogLevel::ERRORS);
+    for(const auto &cpu_ids : get_affinities())
+    {
+        ARM_COMPUTE_EXPECT(cpu_ids == original.cpu_ids, framework::LogLevel::ERRORS);
+    }
+
+    // Changing the number of threads while pinned doesn't leak the pinned affinity to the new threads
+    scheduler.set_affinity(pinned);
+    scheduler.set_num_threads(3);
+    scheduler.set_affinity({});
+    for(const auto &cpu_ids : get_affinities())
+    {
+        ARM_COMPUTE_EXPECT(cpu_ids == original.cpu_ids, framework::LogLevel::ERRORS);
+    }
+
+    scheduler.set_num_threads(default_threads);
+    scheduler.set_affinity(default_affinity);
+    Scheduler::set(default_type);
+}
+
+TEST_SUITE_END() // Scheduler
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
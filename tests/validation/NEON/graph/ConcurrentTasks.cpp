@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Runs the inception network once and returns its output
+ *
+ * @param[in] id     Id of the stream
+ * @param[in] config Configuration of the graph
+ *
+ * @return The values of the output tensor
+ */
+std::vector<float> run_inception_network(unsigned int id, const graph::GraphConfig &config)
+{
+    std::vector<float>      values;
+    graph::frontend::Stream stream(id, "inception");
+    add_inception_network(stream, support::cpp14::make_unique<UniformAccessor>(0), support::cpp14::make_unique<CopyAccessor>(values));
+    stream.finalize(graph::Target::NEON, config);
+    stream.run();
+    return values;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ConcurrentTasks)
+
+TEST_CASE(BranchingNetwork, framework::DatasetMode::ALL)
+{
+    const std::vector<float> expected_values = run_inception_network(0, graph::GraphConfig());
+
+    // The branches of the inception block run concurrently
+    graph::GraphConfig config;
+    config.max_concurrent_tasks = 2;
+    validate_values(run_inception_network(1, config), expected_values);
+
+    // Without the transition memory manager
+    config.use_transition_memory_manager = false;
+    validate_values(run_inception_network(2, config), expected_values);
+}
+
+TEST_SUITE_END() // ConcurrentTasks
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
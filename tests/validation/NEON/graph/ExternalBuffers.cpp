@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Finalizes a stream with the small network and no input or output accessor */
+void finalize_small_network(graph::frontend::Stream &stream, const graph::GraphConfig &config = graph::GraphConfig())
+{
+    add_small_network(stream, nullptr, nullptr);
+    stream.finalize(graph::Target::NEON, config);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ExternalBuffers)
+
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    Tensor input{};
+    Tensor output{};
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    finalize_small_network(stream);
+
+    // Bind buffers laid out as the input and output tensors
+    allocate_like(input, *stream_input(stream));
+    allocate_like(output, *stream_output(stream));
+    UniformAccessor(0).access_tensor(input);
+
+    const std::vector<graph::ExternalBuffer> inputs{ external_buffer(input) };
+    const std::vector<graph::ExternalBuffer> outputs{ external_buffer(output) };
+    ARM_COMPUTE_EXPECT(bool(stream.validate_external_buffers(inputs, outputs)), framework::LogLevel::ERRORS);
+    stream.run(inputs, outputs);
+
+    // Compute the same network through the accessors
+    std::vector<float>      expected_values;
+    graph::frontend::Stream reference(1, "accessors");
+    add_small_network(reference, support::cpp14::make_unique<UniformAccessor>(0), support::cpp14::make_unique<CopyAccessor>(expected_values));
+    reference.finalize(graph::Target::NEON, graph::GraphConfig());
+    reference.run();
+
+    std::vector<float> values;
+    CopyAccessor(values).access_tensor(output);
+    ARM_COMPUTE_ASSERT(values.size() == expected_values.size());
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(values[i] - expected_values[i]) <= 1e-5f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(RunAccessorsAfterBuffers, framework::DatasetMode::ALL)
+{
+    Tensor             input{};
+    Tensor             output{};
+    std::vector<float> values;
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    add_small_network(stream, support::cpp14::make_unique<UniformAccessor>(0), support::cpp14::make_unique<CopyAccessor>(values));
+    stream.finalize(graph::Target::NEON, graph::GraphConfig());
+
+    // Run on buffers holding the values written by the input accessor
+    allocate_like(input, *stream_input(stream));
+    allocate_like(output, *stream_output(stream));
+    UniformAccessor(0).access_tensor(input);
+    stream.run({ external_buffer(input) }, { external_buffer(output) });
+
+    std::vector<float> buffer_values;
+    CopyAccessor(buffer_values).access_tensor(output);
+
+    // The buffers are released once the execution is over: a following run through the accessors must not access them
+    std::fill_n(input.buffer(), input.info()->total_size(), 0);
+    std::fill_n(output.buffer(), output.info()->total_size(), 0);
+    stream.run();
+    validate_values(values, buffer_values);
+
+    std::vector<float> output_values;
+    CopyAccessor(output_values).access_tensor(output);
+    for(const float value : output_values)
+    {
+        ARM_COMPUTE_EXPECT(value == 0.f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(RejectMisaligned, framework::DatasetMode::ALL)
+{
+    Tensor input{};
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    finalize_small_network(stream);
+    allocate_like(input, *stream_input(stream));
+
+    graph::ExternalBuffer buffer = external_buffer(input);
+    buffer.ptr                   = input.buffer() + 1;
+    ARM_COMPUTE_EXPECT(!bool(stream.validate_external_buffers({ buffer }, {})), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectUndersized, framework::DatasetMode::ALL)
+{
+    Tensor output{};
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    finalize_small_network(stream);
+    allocate_like(output, *stream_output(stream));
+
+    graph::ExternalBuffer buffer = external_buffer(output);
+    buffer.size -= output.info()->element_size();
+    ARM_COMPUTE_EXPECT(!bool(stream.validate_external_buffers({}, { buffer })), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectStridesMismatch, framework::DatasetMode::ALL)
+{
+    Tensor input{};
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    finalize_small_network(stream);
+    allocate_like(input, *stream_input(stream));
+
+    graph::ExternalBuffer buffer = external_buffer(input);
+    buffer.strides.set(1, buffer.strides[1] + input.info()->element_size());
+    ARM_COMPUTE_EXPECT(!bool(stream.validate_external_buffers({ buffer }, {})), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectDenseBufferOnPaddedTensor, framework::DatasetMode::ALL)
+{
+    Tensor input{};
+
+    // NCHW 3x3 pooling reads its input through a border
+    graph::frontend::Stream stream(0, "padded_input");
+    stream << graph::frontend::InputLayer(graph::TensorDescriptor(small_network_input_shape(), DataType::F32), nullptr)
+           << graph::frontend::PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1)))
+           << graph::frontend::OutputLayer(nullptr);
+    stream.finalize(graph::Target::NEON, graph::GraphConfig());
+
+    const ITensorInfo *info = stream_input(stream)->handle()->tensor().info();
+    ARM_COMPUTE_ASSERT(!info->padding().empty());
+
+    // A dense buffer is rejected even when it is large enough
+    allocate_like(input, *stream_input(stream));
+    graph::ExternalBuffer dense_buffer = external_buffer(input);
+    dense_buffer.strides               = Strides();
+    ARM_COMPUTE_EXPECT(!bool(stream.validate_external_buffers({ dense_buffer }, {})), framework::LogLevel::ERRORS);
+
+    // A buffer following the strides of the padded tensor is accepted
+    ARM_COMPUTE_EXPECT(bool(stream.validate_external_buffers({ external_buffer(input) }, {})), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectMultipleStreams, framework::DatasetMode::ALL)
+{
+    Tensor input{};
+
+    graph::GraphConfig config;
+    config.num_streams = 2;
+
+    graph::frontend::Stream stream(0, "external_buffers");
+    finalize_small_network(stream, config);
+    allocate_like(input, *stream_input(stream));
+
+    ARM_COMPUTE_EXPECT(!bool(stream.validate_external_buffers({ external_buffer(input) }, {})), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ExternalBuffers
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
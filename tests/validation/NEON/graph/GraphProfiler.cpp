@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(Profiler)
+
+TEST_CASE(RecordTasksAndKernels, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_runs = 3;
+
+    // Create and finalize the graph
+    std::vector<float>      output_values;
+    graph::frontend::Stream stream(0, "profiled_network");
+    add_small_network(stream, support::cpp14::make_unique<UniformAccessor>(0), support::cpp14::make_unique<CopyAccessor>(output_values, num_runs));
+    stream.finalize(graph::Target::NEON, graph::GraphConfig());
+
+    // Profile the executions
+    auto profiler = std::make_shared<graph::GraphProfiler>();
+    stream.set_profiler(profiler);
+    stream.run();
+
+    // Every task was recorded once per run
+    const std::vector<graph::TaskProfile> &tasks = profiler->tasks();
+    ARM_COMPUTE_EXPECT(!tasks.empty(), framework::LogLevel::ERRORS);
+    for(const auto &task : tasks)
+    {
+        ARM_COMPUTE_EXPECT(task.num_runs == num_runs, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(task.total_time_us >= 0, framework::LogLevel::ERRORS);
+    }
+
+    const auto conv = std::find_if(tasks.begin(), tasks.end(), [](const graph::TaskProfile & task)
+    {
+        return task.type == graph::NodeType::ConvolutionLayer;
+    });
+    ARM_COMPUTE_ASSERT(conv != tasks.end());
+    ARM_COMPUTE_EXPECT(conv->flops > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(conv->bytes > 0, framework::LogLevel::ERRORS);
+
+#ifndef NO_MULTI_THREADING
+    // The kernels of the convolution were intercepted in every run
+    ARM_COMPUTE_EXPECT(!conv->kernels.empty(), framework::LogLevel::ERRORS);
+    for(const auto &kernel : conv->kernels)
+    {
+        ARM_COMPUTE_EXPECT(!kernel.name.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(kernel.num_runs >= num_runs, framework::LogLevel::ERRORS);
+    }
+#endif /* NO_MULTI_THREADING */
+
+    // The scheduler of the thread is restored after each task
+    ARM_COMPUTE_EXPECT(Scheduler::get_thread_scheduler() == nullptr, framework::LogLevel::ERRORS);
+
+    // The output was computed
+    ARM_COMPUTE_EXPECT(output_values.size() == 10, framework::LogLevel::ERRORS);
+
+    std::stringstream trace;
+    profiler->export_chrome_trace(trace);
+    ARM_COMPUTE_EXPECT(!trace.str().empty(), framework::LogLevel::ERRORS);
+
+    // Reset clears the recorded runs
+    profiler->reset();
+    for(const auto &task : profiler->tasks())
+    {
+        ARM_COMPUTE_EXPECT(task.num_runs == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(task.kernels.empty(), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // Profiler
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphSerializer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Offsets of the header fields of a serialized graph: magic, version, number of CPUs and model of each CPU */
+constexpr size_t version_offset   = 8;
+constexpr size_t num_cpus_offset  = 12;
+constexpr size_t cpu_model_offset = 16;
+
+/** Executes the small network once and serializes it
+ *
+ * @param[in] filename File to serialize the network to
+ * @param[in] method   (Optional) Convolution method hint of the network
+ *
+ * @return The output of the network
+ */
+std::vector<float> serialize_small_network(const std::string &filename, graph::ConvolutionMethod method = graph::ConvolutionMethod::Default)
+{
+    std::vector<float> values;
+    graph::GraphConfig config;
+    config.serialized_graph_file = filename;
+
+    graph::frontend::Stream stream(0, "serialized_network");
+    stream << method;
+    add_small_network(stream, support::cpp14::make_unique<UniformAccessor>(0), support::cpp14::make_unique<CopyAccessor>(values));
+    stream.finalize(graph::Target::NEON, config);
+    stream.run();
+
+    return values;
+}
+
+/** Runs a restored small network on the input of the serialized one and compares the outputs
+ *
+ * @param[in, out] stream          Stream the small network was restored into
+ * @param[in]      expected_values Output of the serialized network
+ */
+void validate_restored_network(graph::frontend::Stream &stream, const std::vector<float> &expected_values)
+{
+    Tensor input{};
+    Tensor output{};
+    allocate_like(input, *stream_input(stream));
+    allocate_like(output, *stream_output(stream));
+    UniformAccessor(0).access_tensor(input);
+    stream.run({ external_buffer(input) }, { external_buffer(output) });
+
+    std::vector<float> values;
+    CopyAccessor(values).access_tensor(output);
+    ARM_COMPUTE_ASSERT(values.size() == expected_values.size());
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(values[i] - expected_values[i]) <= 1e-5f, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Reads the contents of a file */
+std::vector<char> read_file(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+}
+
+/** Writes the first @p size bytes of @p data to a file */
+void write_file(const std::string &filename, const std::vector<char> &data, size_t size)
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fs.write(data.data(), size);
+}
+
+/** Reads a 32-bit value at an offset of a file contents */
+uint32_t read_u32(const std::vector<char> &data, size_t offset)
+{
+    uint32_t value = 0;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+/** Overwrites a 32-bit value at an offset of a file contents */
+void write_u32(std::vector<char> &data, size_t offset, uint32_t value)
+{
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(Serializer)
+
+TEST_CASE(RoundTrip, framework::DatasetMode::ALL)
+{
+    const std::string        filename        = "graph_serializer_round_trip.bin";
+    const std::vector<float> expected_values = serialize_small_network(filename);
+
+    graph::frontend::Stream stream(1, "restored_network");
+    stream.restore(graph::Target::NEON, graph::GraphConfig(), filename);
+
+    // The weights of the fully connected layer were stored transposed
+    graph::Graph &g = stream.graph();
+    ARM_COMPUTE_ASSERT(!g.nodes(graph::NodeType::FullyConnectedLayer).empty());
+    const auto *fc = dynamic_cast<graph::FullyConnectedLayerNode *>(g.node(g.nodes(graph::NodeType::FullyConnectedLayer).front()));
+    ARM_COMPUTE_ASSERT(fc != nullptr);
+    ARM_COMPUTE_EXPECT(fc->info().are_weights_reshaped, framework::LogLevel::ERRORS);
+
+    validate_restored_network(stream, expected_values);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(RoundTripGEMMConvolution, framework::DatasetMode::ALL)
+{
+    const std::string        filename        = "graph_serializer_round_trip_gemm.bin";
+    const std::vector<float> expected_values = serialize_small_network(filename, graph::ConvolutionMethod::GEMM);
+
+    graph::frontend::Stream stream(1, "restored_network");
+    stream.restore(graph::Target::NEON, graph::GraphConfig(), filename);
+
+    // The weights of the GEMM convolution layer were stored reshaped
+    graph::Graph &g = stream.graph();
+    ARM_COMPUTE_ASSERT(!g.nodes(graph::NodeType::ConvolutionLayer).empty());
+    const auto *conv = dynamic_cast<graph::ConvolutionLayerNode *>(g.node(g.nodes(graph::NodeType::ConvolutionLayer).front()));
+    ARM_COMPUTE_ASSERT(conv != nullptr);
+    const WeightsInfo weights_info = conv->weights_info();
+    ARM_COMPUTE_EXPECT(weights_info.are_reshaped(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(weights_info.kernel_size().first == 3U && weights_info.kernel_size().second == 3U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(weights_info.num_kernels() == 4U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(conv->input(1)->desc().shape == TensorShape(4U, 27U), framework::LogLevel::ERRORS);
+
+    validate_restored_network(stream, expected_values);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(RejectTruncatedFile, framework::DatasetMode::ALL)
+{
+    const std::string filename = "graph_serializer_truncated.bin";
+    serialize_small_network(filename);
+
+    const std::vector<char> data = read_file(filename);
+    ARM_COMPUTE_ASSERT(!data.empty());
+    write_file(filename, data, data.size() / 2);
+
+    graph::Graph g(0, "truncated");
+    ARM_COMPUTE_EXPECT(!bool(graph::deserialize_graph(g, filename)), framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(RejectWrongVersion, framework::DatasetMode::ALL)
+{
+    const std::string filename = "graph_serializer_version.bin";
+    serialize_small_network(filename);
+
+    std::vector<char> data = read_file(filename);
+    ARM_COMPUTE_ASSERT(read_u32(data, version_offset) == graph::serialized_graph_version);
+    write_u32(data, version_offset, graph::serialized_graph_version + 1);
+    write_file(filename, data, data.size());
+
+    graph::Graph g(0, "wrong_version");
+    ARM_COMPUTE_EXPECT(!bool(graph::deserialize_graph(g, filename)), framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(RejectWrongCPUModel, framework::DatasetMode::ALL)
+{
+    const std::string filename = "graph_serializer_cpu_model.bin";
+    serialize_small_network(filename);
+
+    std::vector<char> data = read_file(filename);
+    ARM_COMPUTE_ASSERT(read_u32(data, num_cpus_offset) > 0);
+    write_u32(data, cpu_model_offset, read_u32(data, cpu_model_offset) + 1);
+    write_file(filename, data, data.size());
+
+    graph::Graph g(0, "wrong_cpu_model");
+    ARM_COMPUTE_EXPECT(!bool(graph::deserialize_graph(g, filename)), framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+}
+
+TEST_SUITE_END() // Serializer
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
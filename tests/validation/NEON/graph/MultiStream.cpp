@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "support/ToolchainSupport.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int num_inferences = 8;
+
+/** Graph accessor filling the input of each inference with different values and stopping the execution after a number of inferences */
+class SequenceInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_runs == num_inferences)
+        {
+            return false;
+        }
+        library->fill(Accessor(tensor), std::uniform_real_distribution<>(-1.f, 1.f), _runs++);
+        return true;
+    }
+
+private:
+    std::random_device::result_type _runs{ 0 };
+};
+
+/** Graph accessor appending the output of each inference to a list */
+class SequenceOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] outputs List to append the values of the outputs to
+     */
+    SequenceOutputAccessor(std::vector<std::vector<float>> &outputs)
+        : _outputs(outputs)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        _outputs.emplace_back();
+        CopyAccessor(_outputs.back()).access_tensor(tensor);
+        return true;
+    }
+
+private:
+    std::vector<std::vector<float>> &_outputs;
+};
+
+/** Runs the inception network on a sequence of inputs
+ *
+ * @param[in] id     Id of the stream
+ * @param[in] config Configuration of the graph
+ *
+ * @return The outputs of the inferences, in the order they were returned
+ */
+std::vector<std::vector<float>> run_inferences(unsigned int id, const graph::GraphConfig &config)
+{
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(id, "multi_stream");
+    add_inception_network(stream, support::cpp14::make_unique<SequenceInputAccessor>(), support::cpp14::make_unique<SequenceOutputAccessor>(outputs));
+    stream.finalize(graph::Target::NEON, config);
+    stream.run();
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(MultiStream)
+
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const std::vector<std::vector<float>> expected_outputs = run_inferences(0, graph::GraphConfig());
+    ARM_COMPUTE_ASSERT(expected_outputs.size() == num_inferences);
+
+    // The outputs are returned in the order the inputs were read
+    graph::GraphConfig config;
+    config.num_streams = 2;
+
+    const std::vector<std::vector<float>> outputs = run_inferences(1, config);
+    ARM_COMPUTE_ASSERT(outputs.size() == num_inferences);
+    for(unsigned int i = 0; i < num_inferences; ++i)
+    {
+        validate_values(outputs[i], expected_outputs[i]);
+    }
+}
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+TEST_CASE(RejectConcurrentTasks, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    config.num_streams          = 2;
+    config.max_concurrent_tasks = 2;
+
+    graph::frontend::Stream stream(0, "multi_stream");
+    add_inception_network(stream, nullptr, nullptr);
+
+    bool rejected = false;
+    try
+    {
+        stream.finalize(graph::Target::NEON, config);
+    }
+    catch(const std::runtime_error &)
+    {
+        rejected = true;
+    }
+    ARM_COMPUTE_EXPECT(rejected, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectWithoutTransitionMemoryManager, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    config.num_streams                   = 2;
+    config.use_transition_memory_manager = false;
+
+    graph::frontend::Stream stream(0, "multi_stream");
+    add_inception_network(stream, nullptr, nullptr);
+
+    bool rejected = false;
+    try
+    {
+        stream.finalize(graph::Target::NEON, config);
+    }
+    catch(const std::runtime_error &)
+    {
+        rejected = true;
+    }
+    ARM_COMPUTE_EXPECT(rejected, framework::LogLevel::ERRORS);
+}
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+TEST_SUITE_END() // MultiStream
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
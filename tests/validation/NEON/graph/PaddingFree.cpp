@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Finalizes a stream with a small NHWC network whose channel counts are not a multiple of the vector length
+ *
+ * A direct convolution (replaced by a GEMM based one when running padding-free) is followed by a pooling branch
+ * and a 1x1 convolution branch concatenated along the channels.
+ *
+ * @param[in, out] stream Stream to add the network to
+ * @param[out]     values Vector to copy the output values into
+ * @param[in]      config Configuration of the graph
+ */
+void finalize_nhwc_network(graph::frontend::Stream &stream, std::vector<float> &values, const graph::GraphConfig &config)
+{
+    using namespace graph::frontend;
+
+    const ActivationLayerInfo relu(ActivationLayerInfo::ActivationFunction::RELU);
+
+    stream << InputLayer(graph::TensorDescriptor(TensorShape(3U, 9U, 9U, 1U), DataType::F32).set_layout(DataLayout::NHWC),
+                         support::cpp14::make_unique<UniformAccessor>(0))
+           .set_name("input")
+           << graph::ConvolutionMethod::Direct
+           << ConvolutionLayer(3U, 3U, 5U,
+                               support::cpp14::make_unique<UniformAccessor>(1),
+                               support::cpp14::make_unique<UniformAccessor>(2),
+                               PadStrideInfo(1, 1, 1, 1))
+           .set_name("conv")
+           << ActivationLayer(relu).set_name("relu")
+           << graph::ConvolutionMethod::GEMM;
+
+    SubStream i_a(stream);
+    i_a << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1))).set_name("a/pool");
+
+    SubStream i_b(stream);
+    i_b << ConvolutionLayer(1U, 1U, 7U,
+                            support::cpp14::make_unique<UniformAccessor>(3),
+                            support::cpp14::make_unique<UniformAccessor>(4),
+                            PadStrideInfo(1, 1, 0, 0))
+        .set_name("b/1x1")
+        << ActivationLayer(relu).set_name("b/relu");
+
+    stream << ConcatLayer(std::move(i_a), std::move(i_b)).set_name("concat")
+           << OutputLayer(support::cpp14::make_unique<CopyAccessor>(values)).set_name("output");
+
+    stream.finalize(graph::Target::NEON, config);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(PaddingFree)
+
+TEST_CASE(NHWCNetwork, framework::DatasetMode::ALL)
+{
+    std::vector<float>      expected_values;
+    graph::frontend::Stream expected_stream(0, "padded");
+    finalize_nhwc_network(expected_stream, expected_values, graph::GraphConfig());
+    expected_stream.run();
+
+    std::vector<float> values;
+    graph::GraphConfig config;
+    config.use_padding_free_kernels = true;
+    graph::frontend::Stream stream(1, "padding_free");
+    finalize_nhwc_network(stream, values, config);
+
+    // None of the tensors of the graph is padded
+    ARM_COMPUTE_EXPECT(graph::detail::report_padded_tensors(stream.graph()) == 0, framework::LogLevel::ERRORS);
+
+    // The padding-free functions compute the same values
+    stream.run();
+    validate_values(values, expected_values, 1e-4f);
+}
+
+TEST_SUITE_END() // PaddingFree
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
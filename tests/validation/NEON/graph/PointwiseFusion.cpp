@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/GraphHelpers.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+using NetworkBuilder = void (*)(graph::frontend::Stream &, std::vector<float> &);
+
+/** Adds an F32 input of shape (8, 8, 4) filled by @ref UniformAccessor to a stream */
+void add_input(graph::frontend::Stream &stream)
+{
+    stream << graph::frontend::InputLayer(graph::TensorDescriptor(TensorShape(8U, 8U, 4U, 1U), DataType::F32), support::cpp14::make_unique<UniformAccessor>(0)).set_name("input");
+}
+
+/** Adds a 1x1 convolution keeping the shape of its input to a sub-stream */
+void add_conv(graph::frontend::SubStream &stream, unsigned int seed, const std::string &name)
+{
+    stream << graph::frontend::ConvolutionLayer(1U, 1U, 4U,
+                                                support::cpp14::make_unique<UniformAccessor>(seed),
+                                                support::cpp14::make_unique<UniformAccessor>(seed + 1),
+                                                PadStrideInfo(1, 1, 0, 0))
+           .set_name(name);
+}
+
+/** Residual block: identity + conv(input) -> ReLU. The identity is consumed twice so the fused node can't run in-place */
+void add_residual_network(graph::frontend::Stream &stream, std::vector<float> &values)
+{
+    using namespace graph::frontend;
+
+    add_input(stream);
+    SubStream identity(stream);
+    SubStream branch(stream);
+    add_conv(branch, 1, "conv");
+
+    stream << EltwiseLayer(std::move(identity), std::move(branch), EltwiseOperation::Add).set_name("add")
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu")
+           << OutputLayer(support::cpp14::make_unique<CopyAccessor>(values)).set_name("output");
+}
+
+/** Residual block: conv(input) + identity -> ReLU. The result of the convolution has a single consumer so the fused node runs in-place */
+void add_in_place_network(graph::frontend::Stream &stream, std::vector<float> &values)
+{
+    using namespace graph::frontend;
+
+    add_input(stream);
+    SubStream branch(stream);
+    SubStream identity(stream);
+    add_conv(branch, 1, "conv");
+
+    stream << EltwiseLayer(std::move(branch), std::move(identity), EltwiseOperation::Add).set_name("add")
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu")
+           << OutputLayer(support::cpp14::make_unique<CopyAccessor>(values)).set_name("output");
+}
+
+/** conv_a(input) * conv_b(input) + input -> ReLU6 */
+void add_scale_network(graph::frontend::Stream &stream, std::vector<float> &values)
+{
+    using namespace graph::frontend;
+
+    add_input(stream);
+    SubStream identity(stream);
+    SubStream branch_a(stream);
+    SubStream branch_b(stream);
+    add_conv(branch_a, 1, "conv_a");
+    add_conv(branch_b, 3, "conv_b");
+
+    SubStream scale(stream);
+    scale << EltwiseLayer(std::move(branch_a), std::move(branch_b), EltwiseOperation::Mul).set_name("scale");
+
+    stream << EltwiseLayer(std::move(scale), std::move(identity), EltwiseOperation::Add).set_name("add")
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)).set_name("relu6")
+           << OutputLayer(support::cpp14::make_unique<CopyAccessor>(values)).set_name("output");
+}
+
+/** sum = conv(input) + input, sum * ReLU(sum): the sum is consumed twice and can't be fused */
+void add_multi_consumer_network(graph::frontend::Stream &stream, std::vector<float> &values)
+{
+    using namespace graph::frontend;
+
+    add_input(stream);
+    SubStream branch(stream);
+    SubStream identity(stream);
+    add_conv(branch, 1, "conv");
+
+    stream << EltwiseLayer(std::move(branch), std::move(identity), EltwiseOperation::Add).set_name("add");
+
+    SubStream activation(stream);
+    SubStream sum(stream);
+    activation << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu");
+
+    stream << EltwiseLayer(std::move(activation), std::move(sum), EltwiseOperation::Mul).set_name("mul")
+           << OutputLayer(support::cpp14::make_unique<CopyAccessor>(values)).set_name("output");
+}
+
+/** Runs a network finalized with the default passes but the pointwise fusion
+ *
+ * @param[in]  builder Function adding the network to a stream
+ * @param[out] values  Vector to copy the output values into
+ */
+void run_unfused(NetworkBuilder builder, std::vector<float> &values)
+{
+    graph::frontend::Stream stream(0, "unfused");
+    builder(stream, values);
+
+    graph::PassManager pm;
+    pm.append(support::cpp14::make_unique<graph::NodeFusionMutator>());
+    pm.append(support::cpp14::make_unique<graph::GroupedConvolutionMutator>());
+    pm.append(support::cpp14::make_unique<graph::InPlaceOperationMutator>());
+    pm.append(support::cpp14::make_unique<graph::DepthConcatSubTensorMutator>());
+    pm.append(support::cpp14::make_unique<graph::SplitLayerSubTensorMutator>());
+    pm.append(support::cpp14::make_unique<graph::NodeExecutionMethodMutator>());
+
+    graph::GraphContext ctx;
+    graph::GraphManager manager;
+    ctx.set_config(graph::GraphConfig());
+    manager.finalize_graph(stream.graph(), ctx, pm, graph::Target::NEON);
+    manager.execute_graph(stream.graph());
+}
+
+/** Returns the nodes of a given type of a graph */
+std::vector<const graph::INode *> find_nodes(const graph::Graph &g, graph::NodeType type)
+{
+    std::vector<const graph::INode *> nodes;
+    for(const auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == type)
+        {
+            nodes.push_back(node.get());
+        }
+    }
+    return nodes;
+}
+
+/** Finalizes and runs a network with the default passes and checks it computes the same values as the unfused network
+ *
+ * @param[in] stream  Stream to add the network to
+ * @param[in] builder Function adding the network to a stream
+ */
+void validate_fused(graph::frontend::Stream &stream, NetworkBuilder builder)
+{
+    std::vector<float> expected_values;
+    run_unfused(builder, expected_values);
+
+    std::vector<float> values;
+    builder(stream, values);
+    stream.finalize(graph::Target::NEON, graph::GraphConfig());
+    stream.run();
+    validate_values(values, expected_values);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(PointwiseFusion)
+
+TEST_CASE(ResidualAddReLU, framework::DatasetMode::ALL)
+{
+    graph::frontend::Stream stream(1, "residual");
+    validate_fused(stream, add_residual_network);
+
+    // The addition and the activation run as a single fused node, out-of-place as the input is read twice
+    const auto fused_nodes = find_nodes(stream.graph(), graph::NodeType::FusedPointwiseLayer);
+    ARM_COMPUTE_ASSERT(fused_nodes.size() == 1);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::EltwiseLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(fused_nodes[0]->input(0) != fused_nodes[0]->output(0), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(InPlace, framework::DatasetMode::ALL)
+{
+    graph::frontend::Stream stream(1, "in_place");
+    validate_fused(stream, add_in_place_network);
+
+    // The fused node writes its output over the result of the convolution
+    const auto fused_nodes = find_nodes(stream.graph(), graph::NodeType::FusedPointwiseLayer);
+    ARM_COMPUTE_ASSERT(fused_nodes.size() == 1);
+    ARM_COMPUTE_EXPECT(fused_nodes[0]->input(0) == fused_nodes[0]->output(0), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ScaleAddReLU6, framework::DatasetMode::ALL)
+{
+    graph::frontend::Stream stream(1, "scale");
+    validate_fused(stream, add_scale_network);
+
+    // The scale, the addition and the activation run as a single fused node
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::FusedPointwiseLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::EltwiseLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(MultiConsumerIntermediate, framework::DatasetMode::ALL)
+{
+    graph::frontend::Stream stream(1, "multi_consumer");
+    validate_fused(stream, add_multi_consumer_network);
+
+    // The sum stays a node of its own, only the activation and the multiplication are fused
+    const auto eltwise_nodes = find_nodes(stream.graph(), graph::NodeType::EltwiseLayer);
+    ARM_COMPUTE_ASSERT(eltwise_nodes.size() == 1);
+    ARM_COMPUTE_EXPECT(eltwise_nodes[0]->name() == "add", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::FusedPointwiseLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_nodes(stream.graph(), graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // PointwiseFusion
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
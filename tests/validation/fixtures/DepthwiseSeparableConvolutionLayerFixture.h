@@ -32,6 +32,9 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Fixture.h"
 #include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
 #include "tests/validation/reference/DepthwiseSeparableConvolutionLayer.h"
 
 #include <random>
@@ -148,6 +151,116 @@ protected:
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionFusedValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape in_shape, TensorShape depthwise_weights_shape, TensorShape depthwise_biases_shape, TensorShape depthwise_out_shape, TensorShape pointwise_weights_shape,
+               TensorShape pointwise_biases_shape, TensorShape output_shape,
+               PadStrideInfo pad_stride_depthwise_info, PadStrideInfo pad_stride_pointwise_info,
+               ActivationLayerInfo depthwise_act_info, ActivationLayerInfo pointwise_act_info, DataType data_type, DataLayout data_layout)
+    {
+        _data_type = data_type;
+        _target    = compute_target(in_shape, depthwise_weights_shape, depthwise_biases_shape, pointwise_weights_shape, pointwise_biases_shape, output_shape, pad_stride_depthwise_info,
+                                    pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info, data_layout);
+        _reference = compute_reference(in_shape, depthwise_weights_shape, depthwise_biases_shape, depthwise_out_shape, pointwise_weights_shape, pointwise_biases_shape, output_shape,
+                                       pad_stride_depthwise_info, pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(TensorShape input_shape, TensorShape depthwise_weights_shape, const TensorShape &depthwise_biases_shape,
+                              TensorShape pointwise_weights_shape, const TensorShape &pointwise_biases_shape, TensorShape output_shape,
+                              const PadStrideInfo &pad_stride_depthwise_info, const PadStrideInfo &pad_stride_pointwise_info,
+                              const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, DataLayout data_layout)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(depthwise_weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(pointwise_weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src               = create_tensor<TensorType>(input_shape, _data_type, 1, QuantizationInfo(), data_layout);
+        TensorType depthwise_weights = create_tensor<TensorType>(depthwise_weights_shape, _data_type, 1, QuantizationInfo(), data_layout);
+        TensorType depthwise_biases  = create_tensor<TensorType>(depthwise_biases_shape, _data_type, 1, QuantizationInfo(), data_layout);
+        TensorType pointwise_weights = create_tensor<TensorType>(pointwise_weights_shape, _data_type, 1, QuantizationInfo(), data_layout);
+        TensorType pointwise_biases  = create_tensor<TensorType>(pointwise_biases_shape, _data_type, 1, QuantizationInfo(), data_layout);
+        TensorType dst               = create_tensor<TensorType>(output_shape, _data_type, 1, QuantizationInfo(), data_layout);
+
+        // Create Depthwise Separable Convolution Layer configure function
+        FunctionType depthwise_separable_convolution_layer;
+        depthwise_separable_convolution_layer.configure(&src, &depthwise_weights, &depthwise_biases, &pointwise_weights, &pointwise_biases, &dst, pad_stride_depthwise_info,
+                                                        pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        depthwise_weights.allocator()->allocate();
+        depthwise_biases.allocator()->allocate();
+        pointwise_weights.allocator()->allocate();
+        pointwise_biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!pointwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!pointwise_biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(depthwise_weights), 1);
+        fill(AccessorType(depthwise_biases), 2);
+        fill(AccessorType(pointwise_weights), 3);
+        fill(AccessorType(pointwise_biases), 4);
+
+        // Compute function
+        depthwise_separable_convolution_layer.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &in_shape, const TensorShape &depthwise_weights_shape, const TensorShape &depthwise_biases_shape, const TensorShape &depthwise_out_shape,
+                                      const TensorShape &pointwise_weights_shape, const TensorShape &pointwise_biases_shape, const TensorShape &dst_shape,
+                                      const PadStrideInfo &pad_stride_depthwise_info, const PadStrideInfo &pad_stride_pointwise_info,
+                                      const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+    {
+        SimpleTensor<T> src(in_shape, _data_type);
+        SimpleTensor<T> depthwise_weights(depthwise_weights_shape, _data_type);
+        SimpleTensor<T> depthwise_biases(depthwise_biases_shape, _data_type);
+        SimpleTensor<T> pointwise_weights(pointwise_weights_shape, _data_type);
+        SimpleTensor<T> pointwise_biases(pointwise_biases_shape, _data_type);
+
+        fill(src, 0);
+        fill(depthwise_weights, 1);
+        fill(depthwise_biases, 2);
+        fill(pointwise_weights, 3);
+        fill(pointwise_biases, 4);
+
+        SimpleTensor<T> depthwise_out = reference::depthwise_convolution(src, depthwise_weights, depthwise_biases, depthwise_out_shape, pad_stride_depthwise_info, 1);
+        if(depthwise_act_info.enabled())
+        {
+            depthwise_out = reference::activation_layer<T>(depthwise_out, depthwise_act_info);
+        }
+        SimpleTensor<T> dst = reference::convolution_layer(depthwise_out, pointwise_weights, pointwise_biases, dst_shape, pad_stride_pointwise_info);
+        return (pointwise_act_info.enabled()) ? reference::activation_layer<T>(dst, pointwise_act_info) : dst;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,8 @@
 #include "tests/validation/reference/FullyConnectedLayer.h"
 #include "tests/validation/reference/Utils.h"
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 
 namespace arm_compute
@@ -60,7 +62,9 @@ public:
         ARM_COMPUTE_UNUSED(bias_shape);
 
         _data_type         = data_type;
-        _bias_data_type    = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+        _is_bf16           = data_type == DataType::BFLOAT16;
+        _bias_data_type    = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : (_is_bf16 ? DataType::F32 : data_type);
+        _output_data_type  = _is_bf16 ? DataType::F32 : data_type;
         _quantization_info = quantization_info;
 
         _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, transpose_weights, reshape_weights);
@@ -81,7 +85,7 @@ protected:
             std::uniform_int_distribution<int32_t> distribution(-50, 50);
             library->fill(tensor, distribution, i);
         }
-        else if(is_data_type_float(_data_type))
+        else if(is_data_type_float(_data_type) || _is_bf16)
         {
             std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
             library->fill(tensor, distribution, i);
@@ -92,6 +96,29 @@ protected:
         }
     }
 
+    /** Replace each row of @p tensor by its symmetric 8 bit quantized approximation, as done by dynamic quantization */
+    void fake_quantize_rows(SimpleTensor<T> &tensor, int row_size)
+    {
+        for(int row = 0; row < tensor.num_elements() / row_size; ++row)
+        {
+            T *data = tensor.data() + row * row_size;
+
+            float max = 0.f;
+            for(int i = 0; i < row_size; ++i)
+            {
+                max = std::max(max, std::abs(static_cast<float>(data[i])));
+            }
+
+            const float scale     = (max > 0.f) ? max / 127.f : 1.f;
+            const float inv_scale = 1.f / scale;
+            for(int i = 0; i < row_size; ++i)
+            {
+                const float x = static_cast<float>(data[i]) * inv_scale;
+                data[i]       = static_cast<T>(static_cast<int>(x + ((x < 0.f) ? -0.5f : 0.5f)) * scale);
+            }
+        }
+    }
+
     TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, bool transpose_weights,
                               bool reshape_weights)
     {
@@ -118,12 +145,13 @@ protected:
         TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1, _quantization_info);
         TensorType weights = create_tensor<TensorType>(reshaped_weights_shape, _data_type, 1, _quantization_info);
         TensorType bias    = create_tensor<TensorType>(bias_shape, _bias_data_type, 1, _quantization_info);
-        TensorType dst     = create_tensor<TensorType>(output_shape, _data_type, 1, _quantization_info);
+        TensorType dst     = create_tensor<TensorType>(output_shape, _output_data_type, 1, _quantization_info);
 
         // Create Fully Connected layer info
         FullyConnectedLayerInfo fc_info;
         fc_info.transpose_weights    = transpose_weights;
         fc_info.are_weights_reshaped = !reshape_weights;
+        fc_info.dynamic_quantization = _dynamic_quantization;
 
         // Create and configure function.
         FunctionType fc;
@@ -184,9 +212,9 @@ protected:
     SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, bool transpose_weights,
                                       bool reshape_weights)
     {
-        // Create reference
-        SimpleTensor<T>     src{ input_shape, _data_type, 1, _quantization_info };
-        SimpleTensor<T>     weights{ weights_shape, _data_type, 1, _quantization_info };
+        // Create reference: a BFLOAT16 fully connected layer is computed in F32 on inputs rounded to BFLOAT16
+        SimpleTensor<T>     src{ input_shape, _output_data_type, 1, _quantization_info };
+        SimpleTensor<T>     weights{ weights_shape, _output_data_type, 1, _quantization_info };
         SimpleTensor<TBias> bias{ bias_shape, _bias_data_type, 1, _quantization_info };
 
         // Fill reference
@@ -194,6 +222,19 @@ protected:
         fill(weights, 1);
         fill(bias, 2);
 
+        if(_is_bf16)
+        {
+            round_to_bfloat16(src);
+            round_to_bfloat16(weights);
+        }
+
+        // The input is quantized per row and the weights per output channel
+        if(_dynamic_quantization)
+        {
+            fake_quantize_rows(src, weights_shape[0]);
+            fake_quantize_rows(weights, weights_shape[0]);
+        }
+
         return reference::fully_connected_layer<T>(src, weights, bias, output_shape);
     }
 
@@ -201,7 +242,10 @@ protected:
     SimpleTensor<T>  _reference{};
     DataType         _data_type{};
     DataType         _bias_data_type{};
+    DataType         _output_data_type{};
     QuantizationInfo _quantization_info{};
+    bool             _is_bf16{ false };
+    bool             _dynamic_quantization{ false };
 };
 
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
@@ -217,6 +261,20 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedLayerValidationDynamicQuantizationFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, DataType data_type)
+    {
+        this->_dynamic_quantization = true;
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, weights_shape, bias_shape, output_shape, true /* transpose_weights */,
+                                                                                                      true /* reshape_weights */, data_type,
+                                                                                                      QuantizationInfo());
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FullyConnectedLayerValidationQuantizedFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
 {
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_FUSED_POINTWISE_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_FUSED_POINTWISE_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/BatchNormalizationLayer.h"
+#include "tests/validation/reference/PixelWiseMultiplication.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Runs batch normalization -> add -> activation -> reverse subtraction -> multiplication -> activation as a single fused chain */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedPointwiseLayerValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, ActivationLayerInfo act_info, bool in_place, DataType dt, DataLayout data_layout)
+    {
+        _target    = compute_target(shape, act_info, in_place, dt, data_layout);
+        _reference = compute_reference(shape, act_info, dt);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&src, U &&add_operand, U &&sub_operand, U &&mean, U &&var, U &&beta, U &&gamma)
+    {
+        std::uniform_real_distribution<> distribution(-1.f, 1.f);
+        std::uniform_real_distribution<> distribution_var(0.f, 1.f);
+        library->fill(src, distribution, 0);
+        library->fill(add_operand, distribution, 1);
+        library->fill(sub_operand, distribution, 2);
+        library->fill(mean, distribution, 3);
+        library->fill(var, distribution_var, 4);
+        library->fill(beta, distribution, 5);
+        library->fill(gamma, distribution, 6);
+    }
+
+    TensorType compute_target(TensorShape shape, ActivationLayerInfo act_info, bool in_place, DataType dt, DataLayout data_layout)
+    {
+        const TensorShape params_shape(shape[2]);
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src         = create_tensor<TensorType>(shape, dt, 1, QuantizationInfo(), data_layout);
+        TensorType dst         = create_tensor<TensorType>(shape, dt, 1, QuantizationInfo(), data_layout);
+        TensorType add_operand = create_tensor<TensorType>(shape, dt, 1, QuantizationInfo(), data_layout);
+        TensorType sub_operand = create_tensor<TensorType>(shape, dt, 1, QuantizationInfo(), data_layout);
+        TensorType mean        = create_tensor<TensorType>(params_shape, dt, 1);
+        TensorType var         = create_tensor<TensorType>(params_shape, dt, 1);
+        TensorType beta        = create_tensor<TensorType>(params_shape, dt, 1);
+        TensorType gamma       = create_tensor<TensorType>(params_shape, dt, 1);
+
+        const std::vector<const ITensor *> operands{ &add_operand, &sub_operand, &mean, &var, &beta, &gamma };
+        const std::vector<PointwiseOperation> operations
+        {
+            PointwiseOperation(PointwiseOperation::Type::BATCH_NORMALIZATION, 2, _epsilon),
+            PointwiseOperation(PointwiseOperation::Type::ADD, 0),
+            PointwiseOperation(act_info),
+            PointwiseOperation(PointwiseOperation::Type::REVERSE_SUB, 1),
+            PointwiseOperation(PointwiseOperation::Type::MUL, 0),
+            PointwiseOperation(act_info)
+        };
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&src, operands, in_place ? &src : &dst, operations);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        add_operand.allocator()->allocate();
+        sub_operand.allocator()->allocate();
+        mean.allocator()->allocate();
+        var.allocator()->allocate();
+        beta.allocator()->allocate();
+        gamma.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), AccessorType(add_operand), AccessorType(sub_operand), AccessorType(mean), AccessorType(var), AccessorType(beta), AccessorType(gamma));
+
+        // Compute function
+        fused.run();
+
+        if(in_place)
+        {
+            return src;
+        }
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, ActivationLayerInfo act_info, DataType dt)
+    {
+        const TensorShape params_shape(shape[2]);
+
+        // Create reference
+        SimpleTensor<T> src{ shape, dt, 1 };
+        SimpleTensor<T> add_operand{ shape, dt, 1 };
+        SimpleTensor<T> sub_operand{ shape, dt, 1 };
+        SimpleTensor<T> mean{ params_shape, dt, 1 };
+        SimpleTensor<T> var{ params_shape, dt, 1 };
+        SimpleTensor<T> beta{ params_shape, dt, 1 };
+        SimpleTensor<T> gamma{ params_shape, dt, 1 };
+
+        // Fill reference
+        fill(src, add_operand, sub_operand, mean, var, beta, gamma);
+
+        SimpleTensor<T> dst = reference::batch_normalization_layer(src, mean, var, beta, gamma, _epsilon, ActivationLayerInfo());
+        dst                 = reference::arithmetic_operation(reference::ArithmeticOperation::ADD, dst, add_operand, dt, ConvertPolicy::SATURATE);
+        dst                 = reference::activation_layer(dst, act_info);
+        dst                 = reference::arithmetic_operation(reference::ArithmeticOperation::SUB, sub_operand, dst, dt, ConvertPolicy::SATURATE);
+        dst                 = reference::pixel_wise_multiplication(dst, add_operand, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
+        return reference::activation_layer(dst, act_info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    const float     _epsilon{ 0.001f };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_FUSED_POINTWISE_LAYER_FIXTURE */
@@ -151,6 +151,159 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+/** GEMM of BFLOAT16 matrices accumulating into a F32 output, without matrix C */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class GEMMBF16ValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta)
+    {
+        ARM_COMPUTE_UNUSED(shape_c, beta);
+        _target    = compute_target(shape_a, shape_b, output_shape, alpha);
+        _reference = compute_reference(shape_a, shape_b, output_shape, alpha);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.f, 1.f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, DataType::BFLOAT16, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, DataType::BFLOAT16, 1);
+        TensorType dst = create_tensor<TensorType>(output_shape, DataType::F32, 1);
+
+        // Create and configure function
+        FunctionType gemm;
+        gemm.configure(&a, &b, nullptr, &dst, alpha, 0.f, GEMMInfo());
+
+        ARM_COMPUTE_EXPECT(a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha)
+    {
+        // Create reference
+        SimpleTensor<float> a{ shape_a, DataType::F32, 1 };
+        SimpleTensor<float> b{ shape_b, DataType::F32, 1 };
+        SimpleTensor<float> c{ output_shape, DataType::F32, 1 };
+
+        // Fill reference with the same values as the target, rounded to BFLOAT16
+        fill(a, 0);
+        fill(b, 1);
+        for(int i = 0; i < a.num_elements(); ++i)
+        {
+            a[i] = static_cast<float>(bfloat16(a[i]));
+        }
+        for(int i = 0; i < b.num_elements(); ++i)
+        {
+            b[i] = static_cast<float>(bfloat16(b[i]));
+        }
+
+        return reference::gemm<float>(a, b, c, alpha, 0.f);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMBatchedValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape output_shape, float alpha, bool reshape_b_only_on_first_run, DataType data_type)
+    {
+        _target    = compute_target(shape_a, shape_b, output_shape, alpha, reshape_b_only_on_first_run, data_type);
+        _reference = compute_reference(shape_a, shape_b, output_shape, alpha, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.f, 1.f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha, bool reshape_b_only_on_first_run, DataType data_type)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, data_type, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, data_type, 1);
+        TensorType dst = create_tensor<TensorType>(output_shape, data_type, 1);
+
+        // Create and configure function
+        FunctionType gemm;
+        gemm.configure(&a, &b, &dst, alpha, GEMMInfo(false, false, reshape_b_only_on_first_run));
+
+        ARM_COMPUTE_EXPECT(a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> a{ shape_a, data_type, 1 };
+        SimpleTensor<T> b{ shape_b, data_type, 1 };
+        SimpleTensor<T> c{ output_shape, data_type, 1 };
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+
+        // The reference doesn't slide matrix B along the dimensions it doesn't have
+        return reference::gemm<T>(a, b, c, alpha, 0.f);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename T, typename ReshapeLHSFunctionType, typename ReshapeRHSFunctionType, typename GEMMFunctionType>
 class GEMMMatrixMultiplyReshapedValidationFixture : public framework::Fixture
 {
@@ -131,6 +131,8 @@ protected:
             lstm_params.set_projection_params(&projection_w, &projection_bias);
         }
 
+        lstm_params.set_dynamic_quantization(_dynamic_quantization);
+
         // Create and configure function
         FunctionType lstm;
         lstm.configure(&input, &input_to_forget_w, &input_to_cell_w, &input_to_output_w, &recurrent_to_forget_w,
@@ -424,6 +426,22 @@ protected:
     TensorType      _target_scratch{};
     SimpleTensor<T> _reference{};
     SimpleTensor<T> _reference_scratch{};
+    bool            _dynamic_quantization{ false };
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename FunctionParams, typename T>
+class LSTMLayerValidationDynamicQuantizationFixture : public LSTMLayerValidationFixture<TensorType, AccessorType, FunctionType, FunctionParams, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape input_weights_shape, TensorShape recurrent_weights_shape, TensorShape cell_bias_shape, TensorShape output_cell_shape, TensorShape output_shape,
+               TensorShape scratch_shape, ActivationLayerInfo info, float cell_threshold, float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt)
+    {
+        this->_dynamic_quantization = true;
+        LSTMLayerValidationFixture<TensorType, AccessorType, FunctionType, FunctionParams, T>::setup(input_shape, input_weights_shape, recurrent_weights_shape, cell_bias_shape, output_cell_shape,
+                                                                                                     output_shape, scratch_shape, info, cell_threshold, projection_threshold, data_type,
+                                                                                                     projection_opt, peephole_opt);
+    }
 };
 } // namespace validation
 } // namespace test
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 ARM Limited.
+ * Copyright (c) 2018-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -139,6 +139,60 @@ protected:
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RNNLayerValidationDynamicQuantizationFixture : public RNNLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape recurrent_weights_shape, TensorShape bias_shape, TensorShape output_shape, ActivationLayerInfo info,
+               DataType data_type)
+    {
+        this->_target    = compute_target(input_shape, weights_shape, recurrent_weights_shape, bias_shape, output_shape, info, data_type);
+        this->_reference = this->compute_reference(input_shape, weights_shape, recurrent_weights_shape, bias_shape, output_shape, info, data_type);
+    }
+
+protected:
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                              ActivationLayerInfo info, DataType data_type)
+    {
+        // Create tensors
+        TensorType input             = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights           = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType recurrent_weights = create_tensor<TensorType>(recurrent_weights_shape, data_type);
+        TensorType bias              = create_tensor<TensorType>(bias_shape, data_type);
+        TensorType hidden_state      = create_tensor<TensorType>(output_shape, data_type);
+        TensorType output            = create_tensor<TensorType>(output_shape, data_type);
+
+        // Both fully connected layers quantize their inputs and weights at run time
+        FullyConnectedLayerInfo fc_info;
+        fc_info.dynamic_quantization = true;
+
+        // Create and configure function
+        FunctionType rnn;
+        rnn.configure(&input, &weights, &recurrent_weights, &bias, &hidden_state, &output, info, fc_info);
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        weights.allocator()->allocate();
+        recurrent_weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        hidden_state.allocator()->allocate();
+        output.allocator()->allocate();
+
+        // Fill tensors
+        this->fill(AccessorType(input), 0);
+        this->fill(AccessorType(weights), 0);
+        this->fill(AccessorType(recurrent_weights), 0);
+        this->fill(AccessorType(bias), 0);
+        this->fill(AccessorType(hidden_state), 0);
+
+        // Compute function
+        rnn.run();
+
+        return output;
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
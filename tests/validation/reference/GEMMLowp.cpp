@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,8 +38,8 @@ namespace reference
 {
 namespace
 {
-template <typename T>
-void quantize_down_int32_to_uint8_scale(const SimpleTensor<T> *in, const SimpleTensor<T> *bias, SimpleTensor<uint8_t> *dst, int32_t result_offset, int32_t result_mult_int, int32_t result_shift,
+template <typename T, typename TOut>
+void quantize_down_int32_to_uint8_scale(const SimpleTensor<T> *in, const SimpleTensor<T> *bias, SimpleTensor<TOut> *dst, int32_t result_offset, int32_t result_mult_int, int32_t result_shift,
                                         int32_t min, int32_t max)
 {
     const int cols_in = in->shape().x();
@@ -63,12 +63,12 @@ void quantize_down_int32_to_uint8_scale(const SimpleTensor<T> *in, const SimpleT
             result = std::max(min, std::min(max, result));
         }
 
-        (*dst)[i] = static_cast<uint8_t>(std::max(0, std::min(255, result)));
+        (*dst)[i] = static_cast<TOut>(std::max<int32_t>(std::numeric_limits<TOut>::lowest(), std::min<int32_t>(std::numeric_limits<TOut>::max(), result)));
     }
 }
 
-template <typename T>
-void quantize_down_int32_to_uint8_scale_by_fixedpoint(const SimpleTensor<T> *in, const SimpleTensor<T> *bias, SimpleTensor<uint8_t> *dst, int32_t result_fixedpoint_multiplier, int32_t result_shift,
+template <typename T, typename TOut>
+void quantize_down_int32_to_uint8_scale_by_fixedpoint(const SimpleTensor<T> *in, const SimpleTensor<T> *bias, SimpleTensor<TOut> *dst, int32_t result_fixedpoint_multiplier, int32_t result_shift,
                                                       int32_t result_offset_after_shift, int32_t min, int32_t max)
 {
     const int cols_in = in->shape().x();
@@ -92,7 +92,7 @@ void quantize_down_int32_to_uint8_scale_by_fixedpoint(const SimpleTensor<T> *in,
             result = std::max(min, std::min(max, result));
         }
 
-        (*dst)[i] = static_cast<uint8_t>(std::max(0, std::min(255, result)));
+        (*dst)[i] = static_cast<TOut>(std::max<int32_t>(std::numeric_limits<TOut>::lowest(), std::min<int32_t>(std::numeric_limits<TOut>::max(), result)));
     }
 }
 } // namespace
@@ -162,7 +162,7 @@ SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale(const SimpleTe
 {
     SimpleTensor<uint8_t> dst(in.shape(), DataType::QASYMM8);
 
-    quantize_down_int32_to_uint8_scale<T>(&in, nullptr, &dst, result_offset, result_mult_int, result_shift, min, max);
+    quantize_down_int32_to_uint8_scale<T, uint8_t>(&in, nullptr, &dst, result_offset, result_mult_int, result_shift, min, max);
 
     return dst;
 }
@@ -173,7 +173,7 @@ SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale(const SimpleTe
 {
     SimpleTensor<uint8_t> dst(in.shape(), DataType::QASYMM8);
 
-    quantize_down_int32_to_uint8_scale<T>(&in, &bias, &dst, result_offset, result_mult_int, result_shift, min, max);
+    quantize_down_int32_to_uint8_scale<T, uint8_t>(&in, &bias, &dst, result_offset, result_mult_int, result_shift, min, max);
 
     return dst;
 }
@@ -185,7 +185,7 @@ SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint(
 {
     SimpleTensor<uint8_t> dst(in.shape(), DataType::QASYMM8);
 
-    quantize_down_int32_to_uint8_scale_by_fixedpoint<T>(&in, nullptr, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
+    quantize_down_int32_to_uint8_scale_by_fixedpoint<T, uint8_t>(&in, nullptr, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
 
     return dst;
 }
@@ -196,11 +196,65 @@ SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint(
 {
     SimpleTensor<uint8_t> dst(in.shape(), DataType::QASYMM8);
 
-    quantize_down_int32_to_uint8_scale_by_fixedpoint<T>(&in, &bias, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
+    quantize_down_int32_to_uint8_scale_by_fixedpoint<T, uint8_t>(&in, &bias, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
+
+    return dst;
+}
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> gemmlowp_quantize_down_scale(const SimpleTensor<T> &in, int32_t result_offset, int32_t result_mult_int, int32_t result_shift, int32_t min, int32_t max)
+{
+    SimpleTensor<TOut> dst(in.shape(), std::is_same<TOut, int8_t>::value ? DataType::QASYMM8_SIGNED : DataType::QASYMM8);
+
+    quantize_down_int32_to_uint8_scale<T, TOut>(&in, nullptr, &dst, result_offset, result_mult_int, result_shift, min, max);
+
+    return dst;
+}
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> gemmlowp_quantize_down_scale(const SimpleTensor<T> &in, const SimpleTensor<T> &bias, int32_t result_offset, int32_t result_mult_int, int32_t result_shift, int32_t min, int32_t max)
+{
+    SimpleTensor<TOut> dst(in.shape(), std::is_same<TOut, int8_t>::value ? DataType::QASYMM8_SIGNED : DataType::QASYMM8);
+
+    quantize_down_int32_to_uint8_scale<T, TOut>(&in, &bias, &dst, result_offset, result_mult_int, result_shift, min, max);
+
+    return dst;
+}
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> gemmlowp_quantize_down_scale_by_fixedpoint(const SimpleTensor<T> &in, int32_t result_fixedpoint_multiplier, int32_t result_shift, int32_t result_offset_after_shift,
+                                                              int32_t min, int32_t max)
+{
+    SimpleTensor<TOut> dst(in.shape(), std::is_same<TOut, int8_t>::value ? DataType::QASYMM8_SIGNED : DataType::QASYMM8);
+
+    quantize_down_int32_to_uint8_scale_by_fixedpoint<T, TOut>(&in, nullptr, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
+
+    return dst;
+}
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> gemmlowp_quantize_down_scale_by_fixedpoint(const SimpleTensor<T> &in, const SimpleTensor<T> &bias, int32_t result_fixedpoint_multiplier, int32_t result_shift,
+                                                              int32_t result_offset_after_shift, int32_t min, int32_t max)
+{
+    SimpleTensor<TOut> dst(in.shape(), std::is_same<TOut, int8_t>::value ? DataType::QASYMM8_SIGNED : DataType::QASYMM8);
+
+    quantize_down_int32_to_uint8_scale_by_fixedpoint<T, TOut>(&in, &bias, &dst, result_fixedpoint_multiplier, result_shift, result_offset_after_shift, min, max);
 
     return dst;
 }
 
+template SimpleTensor<uint8_t> gemmlowp_quantize_down_scale<int32_t, uint8_t>(const SimpleTensor<int32_t> &in, const SimpleTensor<int32_t> &bias, int32_t result_offset, int32_t result_mult_int,
+                                                                              int32_t result_shift, int32_t min, int32_t max);
+template SimpleTensor<int8_t> gemmlowp_quantize_down_scale<int32_t, int8_t>(const SimpleTensor<int32_t> &in, const SimpleTensor<int32_t> &bias, int32_t result_offset, int32_t result_mult_int,
+                                                                            int32_t result_shift, int32_t min, int32_t max);
+template SimpleTensor<uint8_t> gemmlowp_quantize_down_scale_by_fixedpoint<int32_t, uint8_t>(const SimpleTensor<int32_t> &in, const SimpleTensor<int32_t> &bias, int32_t result_fixedpoint_multiplier,
+                                                                                            int32_t result_shift, int32_t result_offset_after_shift, int32_t min, int32_t max);
+template SimpleTensor<int8_t> gemmlowp_quantize_down_scale_by_fixedpoint<int32_t, int8_t>(const SimpleTensor<int32_t> &in, const SimpleTensor<int32_t> &bias, int32_t result_fixedpoint_multiplier,
+                                                                                          int32_t result_shift, int32_t result_offset_after_shift, int32_t min, int32_t max);
+template SimpleTensor<int8_t> gemmlowp_quantize_down_scale<int32_t, int8_t>(const SimpleTensor<int32_t> &in, int32_t result_offset, int32_t result_mult_int, int32_t result_shift, int32_t min,
+                                                                            int32_t max);
+template SimpleTensor<int8_t> gemmlowp_quantize_down_scale_by_fixedpoint<int32_t, int8_t>(const SimpleTensor<int32_t> &in, int32_t result_fixedpoint_multiplier, int32_t result_shift,
+                                                                                          int32_t result_offset_after_shift, int32_t min, int32_t max);
 template SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint(const SimpleTensor<int32_t> &a, int32_t result_fixedpoint_multiplier, int32_t result_shift,
                                                                                          int32_t result_offset_after_shift, int32_t min, int32_t max);
 template SimpleTensor<uint8_t> gemmlowp_quantize_down_int32_to_uint8_scale_by_fixedpoint(const SimpleTensor<int32_t> &a, const SimpleTensor<int32_t> &b, int32_t result_fixedpoint_multiplier,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,24 @@ namespace validation
 {
 namespace reference
 {
+namespace
+{
+template <typename T>
+SimpleTensor<T> convert_to_quantized(const SimpleTensor<float> &src, const QuantizationInfo &quantization_info);
+
+template <>
+SimpleTensor<uint8_t> convert_to_quantized<uint8_t>(const SimpleTensor<float> &src, const QuantizationInfo &quantization_info)
+{
+    return convert_to_asymmetric(src, quantization_info);
+}
+
+template <>
+SimpleTensor<int8_t> convert_to_quantized<int8_t>(const SimpleTensor<float> &src, const QuantizationInfo &quantization_info)
+{
+    return convert_to_asymmetric_signed(src, quantization_info);
+}
+} // namespace
+
 template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type>
 SimpleTensor<T> softmax_layer(const SimpleTensor<T> &src, float beta, size_t axis)
 {
@@ -82,21 +100,21 @@ SimpleTensor<T> softmax_layer(const SimpleTensor<T> &src, float beta, size_t axi
     return dst;
 }
 
-template <typename T, typename std::enable_if<std::is_same<T, uint8_t>::value, int>::type>
+template <typename T, typename std::enable_if<std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value, int>::type>
 SimpleTensor<T> softmax_layer(const SimpleTensor<T> &src, float beta, size_t axis)
 {
-    // Note: Output quantization info should always have scale = 1/256 and offset = 0
-    const QuantizationInfo output_quantization_info = QuantizationInfo(1.f / 256, 0);
+    // Note: Output quantization info should always have scale = 1/256 and offset = 0 (-128 for signed)
+    const QuantizationInfo output_quantization_info = QuantizationInfo(1.f / 256, std::is_same<T, int8_t>::value ? -128 : 0);
 
     SimpleTensor<float> src_tmp = convert_from_asymmetric(src);
     SimpleTensor<float> dst_tmp = softmax_layer<float>(src_tmp, beta, axis);
-    SimpleTensor<T>     dst     = convert_to_asymmetric(dst_tmp, output_quantization_info);
-    return dst;
+    return convert_to_quantized<T>(dst_tmp, output_quantization_info);
 }
 
 template SimpleTensor<float> softmax_layer(const SimpleTensor<float> &src, float beta, size_t axis);
 template SimpleTensor<half> softmax_layer(const SimpleTensor<half> &src, float beta, size_t axis);
 template SimpleTensor<uint8_t> softmax_layer(const SimpleTensor<uint8_t> &src, float beta, size_t axis);
+template SimpleTensor<int8_t> softmax_layer(const SimpleTensor<int8_t> &src, float beta, size_t axis);
 } // namespace reference
 } // namespace validation
 } // namespace test
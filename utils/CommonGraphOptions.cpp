@@ -79,6 +79,8 @@ namespace utils
     std::string true_str  = std::string("true");
 
     os << "Threads : " << common_params.threads << std::endl;
+    os << "Parallel branches : " << common_params.parallel_branches << std::endl;
+    os << "Streams : " << common_params.streams << std::endl;
     os << "Target : " << common_params.target << std::endl;
     os << "Data type : " << common_params.data_type << std::endl;
     os << "Data layout : " << common_params.data_layout << std::endl;
@@ -86,6 +88,8 @@ namespace utils
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
+    os << "Padding-free kernels? : " << (common_params.padding_free ? true_str : false_str) << std::endl;
+    os << "External buffers? : " << (common_params.external_buffers ? true_str : false_str) << std::endl;
     if(!common_params.data_path.empty())
     {
         os << "Data path : " << common_params.data_path << std::endl;
@@ -98,6 +102,14 @@ namespace utils
     {
         os << "Labels file : " << common_params.labels << std::endl;
     }
+    if(!common_params.serialize_graph.empty())
+    {
+        os << "Serialized graph file : " << common_params.serialize_graph << std::endl;
+    }
+    if(!common_params.restore_graph.empty())
+    {
+        os << "Restored graph file : " << common_params.restore_graph << std::endl;
+    }
     if(!common_params.validation_file.empty())
     {
         os << "Validation range : " << common_params.validation_range_start << "-" << common_params.validation_range_end << std::endl;
@@ -114,12 +126,18 @@ namespace utils
 CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       threads(parser.add_option<SimpleOption<int>>("threads", 1)),
+      parallel_branches(parser.add_option<SimpleOption<int>>("parallel-branches", 1)),
+      streams(parser.add_option<SimpleOption<int>>("streams", 1)),
       target(),
       data_type(),
       data_layout(),
       enable_tuner(parser.add_option<ToggleOption>("enable-tuner")),
       tuner_mode(),
       fast_math_hint(parser.add_option<ToggleOption>("fast-math")),
+      padding_free(parser.add_option<ToggleOption>("padding-free")),
+      external_buffers(parser.add_option<ToggleOption>("external-buffers")),
+      serialize_graph(parser.add_option<SimpleOption<std::string>>("serialize-graph")),
+      restore_graph(parser.add_option<SimpleOption<std::string>>("restore-graph")),
       data_path(parser.add_option<SimpleOption<std::string>>("data")),
       image(parser.add_option<SimpleOption<std::string>>("image")),
       labels(parser.add_option<SimpleOption<std::string>>("labels")),
@@ -162,12 +180,18 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
 
     help->set_help("Show this help message");
     threads->set_help("Number of threads to use");
+    parallel_branches->set_help("Number of independent graph branches to execute concurrently, each one on its own share of the threads");
+    streams->set_help("Number of inferences to execute concurrently, each one on its own share of the threads. Can't be combined with parallel-branches");
     target->set_help("Target to execute on");
     data_type->set_help("Data type to use");
     data_layout->set_help("Data layout to use");
-    enable_tuner->set_help("Enable OpenCL dynamic tuner");
+    enable_tuner->set_help("Enable OpenCL dynamic tuner and NEON GEMM kernel tuner");
     tuner_mode->set_help("Configures the time taken by the tuner to tune. Slow tuner produces the most performant LWS configuration");
     fast_math_hint->set_help("Enable fast math");
+    padding_free->set_help("Use the functions whose tensors need no padding and no border filling (NEON only)");
+    external_buffers->set_help("Bind aligned buffers allocated by the example to the input and output of the graph instead of copying through the accessors (NEON only)");
+    serialize_graph->set_help("File to serialize the finalized graph to");
+    restore_graph->set_help("File to restore a serialized graph from instead of building it, it must have been serialized on the same CPUs");
     data_path->set_help("Path where graph parameters reside");
     image->set_help("Input image for the graph");
     labels->set_help("File containing the output labels");
@@ -191,9 +215,15 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     {
         common_params.data_layout = options.data_layout->value();
     }
+    common_params.parallel_branches      = options.parallel_branches->value();
+    common_params.streams                = options.streams->value();
     common_params.enable_tuner           = options.enable_tuner->is_set() ? options.enable_tuner->value() : false;
     common_params.tuner_mode             = options.tuner_mode->value();
     common_params.fast_math_hint         = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
+    common_params.padding_free           = options.padding_free->is_set() ? options.padding_free->value() : false;
+    common_params.external_buffers       = options.external_buffers->is_set() ? options.external_buffers->value() : false;
+    common_params.serialize_graph        = options.serialize_graph->value();
+    common_params.restore_graph          = options.restore_graph->value();
     common_params.data_path              = options.data_path->value();
     common_params.image                  = options.image->value();
     common_params.labels                 = options.labels->value();
@@ -40,11 +40,17 @@ namespace utils
  *
  * --help             : Print the example's help message.
  * --threads          : The number of threads to be used by the example during execution.
+ * --parallel-branches: The number of independent branches of the graph to execute concurrently (NEON only).
+ * --streams          : The number of inferences to execute concurrently (NEON only).
  * --target           : Execution target to be used by the examples. Supported target options: NEON, CL, GC.
  * --type             : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
  * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
  * --fast-math        : Toggle option to enable the fast math option.
+ * --padding-free     : Toggle option to select the functions whose tensors need no padding (NEON only).
+ * --external-buffers : Toggle option to bind buffers allocated by the example to the input and output of the graph (NEON only).
+ * --serialize-graph  : File to serialize the finalized graph to.
+ * --restore-graph    : File to restore a serialized graph from instead of building it.
  * --data             : Path that contains the trainable parameter files of graph layers.
  * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
  * --labels           : File that contains the labels that classify upon.
@@ -90,12 +96,18 @@ struct CommonGraphParams
 {
     bool                             help{ false };
     int                              threads{ 0 };
+    int                              parallel_branches{ 1 };
+    int                              streams{ 1 };
     arm_compute::graph::Target       target{ arm_compute::graph::Target::NEON };
     arm_compute::DataType            data_type{ DataType::F32 };
     arm_compute::DataLayout          data_layout{ DataLayout::NHWC };
     bool                             enable_tuner{ false };
     arm_compute::CLTunerMode         tuner_mode{ CLTunerMode::NORMAL };
     arm_compute::graph::FastMathHint fast_math_hint{ arm_compute::graph::FastMathHint::Disabled };
+    bool                             padding_free{ false };
+    bool                             external_buffers{ false };
+    std::string                      serialize_graph{};
+    std::string                      restore_graph{};
     std::string                      data_path{};
     std::string                      image{};
     std::string                      labels{};
@@ -143,21 +155,27 @@ public:
     /** Default destructor */
     ~CommonGraphOptions() = default;
 
-    ToggleOption                           *help;             /**< Show help option */
-    SimpleOption<int>                      *threads;          /**< Number of threads option */
-    EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
-    EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
-    EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
-    ToggleOption                           *enable_tuner;     /**< Enable tuner */
-    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;       /**< Tuner mode */
-    ToggleOption                           *fast_math_hint;   /**< Fast math hint */
-    SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
-    SimpleOption<std::string>              *image;            /**< Image */
-    SimpleOption<std::string>              *labels;           /**< Labels */
-    SimpleOption<std::string>              *validation_file;  /**< Validation file */
-    SimpleOption<std::string>              *validation_path;  /**< Validation data path */
-    SimpleOption<std::string>              *validation_range; /**< Validation range */
-    SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
+    ToggleOption                           *help;              /**< Show help option */
+    SimpleOption<int>                      *threads;           /**< Number of threads option */
+    SimpleOption<int>                      *parallel_branches; /**< Number of branches executed concurrently */
+    SimpleOption<int>                      *streams;           /**< Number of inferences executed concurrently */
+    EnumOption<arm_compute::graph::Target> *target;            /**< Graph execution target */
+    EnumOption<arm_compute::DataType>      *data_type;         /**< Graph data type */
+    EnumOption<arm_compute::DataLayout>    *data_layout;       /**< Graph data layout */
+    ToggleOption                           *enable_tuner;      /**< Enable tuner */
+    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;        /**< Tuner mode */
+    ToggleOption                           *fast_math_hint;    /**< Fast math hint */
+    ToggleOption                           *padding_free;      /**< Use padding-free kernels */
+    ToggleOption                           *external_buffers;  /**< Bind external input and output buffers */
+    SimpleOption<std::string>              *serialize_graph;   /**< File to serialize the graph to */
+    SimpleOption<std::string>              *restore_graph;     /**< File to restore the graph from */
+    SimpleOption<std::string>              *data_path;         /**< Trainable parameters path */
+    SimpleOption<std::string>              *image;             /**< Image */
+    SimpleOption<std::string>              *labels;            /**< Labels */
+    SimpleOption<std::string>              *validation_file;   /**< Validation file */
+    SimpleOption<std::string>              *validation_path;   /**< Validation data path */
+    SimpleOption<std::string>              *validation_range;  /**< Validation range */
+    SimpleOption<std::string>              *tuner_file;        /**< File to load/store the tuner's values from */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -143,7 +143,8 @@ bool DummyAccessor::access_tensor(ITensor &tensor)
 NumPyAccessor::NumPyAccessor(std::string npy_path, TensorShape shape, DataType data_type, std::ostream &output_stream)
     : _npy_tensor(), _filename(std::move(npy_path)), _output_stream(output_stream)
 {
-    NumPyBinLoader loader(_filename);
+    // The tensor outlives the loader so it can't import the mapped file
+    NumPyBinLoader loader(_filename, DataLayout::NCHW, false);
 
     TensorInfo info(shape, 1, data_type);
     _npy_tensor.allocator()->init(info);
@@ -354,6 +355,9 @@ bool ValidationOutputAccessor::access_tensor(arm_compute::ITensor &tensor)
             case DataType::QASYMM8:
                 tensor_results = access_predictions_tensor<uint8_t>(tensor);
                 break;
+            case DataType::QASYMM8_SIGNED:
+                tensor_results = access_predictions_tensor<int8_t>(tensor);
+                break;
             case DataType::F32:
                 tensor_results = access_predictions_tensor<float>(tensor);
                 break;
@@ -555,7 +559,7 @@ void TopNPredictionsAccessor::access_predictions_tensor(ITensor &tensor)
 
 bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
     ARM_COMPUTE_ERROR_ON(_labels.size() != tensor.info()->dimension(0));
 
     switch(tensor.info()->data_type())
@@ -563,6 +567,9 @@ bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
         case DataType::QASYMM8:
             access_predictions_tensor<uint8_t>(tensor);
             break;
+        case DataType::QASYMM8_SIGNED:
+            access_predictions_tensor<int8_t>(tensor);
+            break;
         case DataType::F32:
             access_predictions_tensor<float>(tensor);
             break;
@@ -617,6 +624,7 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
             break;
         }
         case DataType::S8:
+        case DataType::QASYMM8_SIGNED:
         {
             std::uniform_int_distribution<int8_t> distribution_s8(_lower.get<int8_t>(), _upper.get<int8_t>());
             fill<int8_t>(tensor, distribution_s8);
@@ -682,8 +690,8 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
-NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout, bool use_mmap)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _use_mmap(use_mmap), _mapping()
 {
 }
 
@@ -693,7 +701,17 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
-        loader.fill_tensor(tensor);
+
+        // Only CPU tensors can use the mapped file as backing memory
+        auto cpu_tensor = dynamic_cast<Tensor *>(&tensor);
+        if(_use_mmap && cpu_tensor != nullptr)
+        {
+            _mapping = loader.import_tensor(*cpu_tensor);
+        }
+        if(_mapping == nullptr)
+        {
+            loader.fill_tensor(tensor);
+        }
     }
 
     _already_loaded = !_already_loaded;
@@ -35,12 +35,18 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
 
 namespace arm_compute
 {
+namespace utils
+{
+class MappedFile;
+} // namespace utils
+
 namespace graph_utils
 {
 /** Preprocessor interface **/
@@ -376,8 +382,10 @@ public:
      *
      * @param[in] filename    Binary file name
      * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] use_mmap    (Optional) Map the file in memory and import it in the tensor without copying it when the
+     *                        layout, shape and padding of the tensor allow it. The mapping lives as long as the loader. Defaults to true
      */
-    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW, bool use_mmap = true);
     /** Allows instances to move constructed */
     NumPyBinLoader(NumPyBinLoader &&) = default;
 
@@ -385,9 +393,11 @@ public:
     bool access_tensor(ITensor &tensor) override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    bool                               _already_loaded;
+    const std::string                  _filename;
+    const DataLayout                   _file_layout;
+    const bool                         _use_mmap;
+    std::shared_ptr<utils::MappedFile> _mapping;
 };
 
 /** Generates appropriate random accessor
@@ -35,6 +35,7 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include <ostream>
 #include <sstream>
@@ -325,6 +326,11 @@ inline ::std::ostream &operator<<(::std::ostream &os, const QuantizationInfo &qu
 {
     os << "Scale:" << quantization_info.scale << "~"
        << "Offset:" << quantization_info.offset;
+    if(quantization_info.is_per_channel())
+    {
+        os << "~"
+           << "ChannelScales:" << quantization_info.channel_scales.size();
+    }
     return os;
 }
 
@@ -622,6 +628,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const DataType &data_type)
         case DataType::QASYMM8:
             os << "QASYMM8";
             break;
+        case DataType::QASYMM8_SIGNED:
+            os << "QASYMM8_SIGNED";
+            break;
+        case DataType::QSYMM8_PER_CHANNEL:
+            os << "QSYMM8_PER_CHANNEL";
+            break;
         case DataType::S8:
             os << "S8";
             break;
@@ -643,6 +655,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const DataType &data_type)
         case DataType::S64:
             os << "S64";
             break;
+        case DataType::BFLOAT16:
+            os << "BFLOAT16";
+            break;
         case DataType::F16:
             os << "F16";
             break;
@@ -2271,6 +2286,89 @@ inline ::std::ostream &operator<<(::std::ostream &os, const CLTunerMode &val)
     return os;
 }
 
+/** Formatted output of the IScheduler::StrategyHint type.
+ *
+ * @param[out] os       Output stream.
+ * @param[in]  strategy IScheduler::StrategyHint to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const IScheduler::StrategyHint &strategy)
+{
+    switch(strategy)
+    {
+        case IScheduler::StrategyHint::STATIC:
+            os << "STATIC";
+            break;
+        case IScheduler::StrategyHint::DYNAMIC:
+            os << "DYNAMIC";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the IScheduler::StrategyHint type.
+ *
+ * @param[in] strategy IScheduler::StrategyHint to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const IScheduler::StrategyHint &strategy)
+{
+    std::stringstream str;
+    str << strategy;
+    return str.str();
+}
+
+/** Formatted output of the Scheduler::Type type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  type Scheduler::Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const Scheduler::Type &type)
+{
+    switch(type)
+    {
+        case Scheduler::Type::ST:
+            os << "ST";
+            break;
+        case Scheduler::Type::CPP:
+            os << "CPP";
+            break;
+        case Scheduler::Type::CPP_WORK_STEALING:
+            os << "CPP_WORK_STEALING";
+            break;
+        case Scheduler::Type::OMP:
+            os << "OMP";
+            break;
+        case Scheduler::Type::CUSTOM:
+            os << "CUSTOM";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the Scheduler::Type type.
+ *
+ * @param[in] type Scheduler::Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const Scheduler::Type &type)
+{
+    std::stringstream str;
+    str << type;
+    return str.str();
+}
+
 } // namespace arm_compute
 
 #endif /* __ARM_COMPUTE_TYPE_PRINTER_H__ */
@@ -23,11 +23,23 @@
  */
 #include "Utils.h"
 
+#include "utils/command_line/CommandLineParser.h"
+#include "utils/command_line/ToggleOption.h"
+
 #include <cctype>
 #include <cerrno>
+#include <chrono>
 #include <iomanip>
 #include <string>
 
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-default"
 #define STB_IMAGE_IMPLEMENTATION
@@ -78,13 +90,31 @@ int run_example(int argc, char **argv, std::unique_ptr<Example> example)
     std::cout << "\n"
               << argv[0] << "\n\n";
 
+    // Setup statistics are only reported when requested: the example's own options are ignored here
+    CommandLineParser parser;
+    auto             *setup_stats = parser.add_option<ToggleOption>("setup-stats");
+    parser.parse(argc, argv);
+
     try
     {
-        bool status = example->do_setup(argc, argv);
+        const auto setup_start = std::chrono::steady_clock::now();
+        bool       status      = example->do_setup(argc, argv);
         if(!status)
         {
             return 1;
         }
+        if(setup_stats->is_set() && setup_stats->value())
+        {
+            const auto setup_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - setup_start);
+            std::cout << "Setup time: " << setup_time.count() << " ms\n";
+#ifndef BARE_METAL
+            struct rusage usage;
+            if(getrusage(RUSAGE_SELF, &usage) == 0)
+            {
+                std::cout << "Peak resident memory: " << usage.ru_maxrss << " kB\n";
+            }
+#endif /* BARE_METAL */
+        }
         example->do_run();
         example->do_teardown();
 
@@ -234,6 +264,44 @@ std::tuple<std::vector<unsigned long>, bool, std::string> parse_npy_header(std::
     return std::make_tuple(shape, fortran_order, typestr);
 }
 
+MappedFile::MappedFile(const std::string &filename)
+    : _data(nullptr), _size(0)
+{
+#ifndef BARE_METAL
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return;
+    }
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+    {
+        // Private mapping so that functions writing to their (const) inputs don't modify the file
+        void *ptr = mmap(nullptr, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if(ptr != MAP_FAILED)
+        {
+            _data = static_cast<uint8_t *>(ptr);
+            _size = file_stat.st_size;
+        }
+    }
+    // The mapping stays valid once the file is closed
+    close(fd);
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(filename);
+#endif /* BARE_METAL */
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef BARE_METAL
+    if(_data != nullptr)
+    {
+        munmap(_data, _size);
+    }
+#endif /* BARE_METAL */
+}
+
 /** This function returns the amount of memory free reading from /proc/meminfo
  *
  * @return The free memory in kB
@@ -46,6 +46,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 #include <tuple>
@@ -91,6 +92,8 @@ public:
 };
 
 /** Run an example and handle the potential exceptions it throws
+ *
+ * Passing --setup-stats prints the time spent in @ref Example::do_setup and the peak resident memory once it returns.
  *
  * @param[in] argc    Number of command line arguments
  * @param[in] argv    Command line arguments
@@ -314,13 +317,52 @@ public:
     }
 };
 
+/** Private read-only mapping of a whole file in memory
+ *
+ * @note The mapped pages are copy-on-write: writing to them doesn't modify the file.
+ */
+class MappedFile
+{
+public:
+    /** Map a file in memory
+     *
+     * @param[in] filename File to map
+     */
+    MappedFile(const std::string &filename);
+    /** Prevent instances of this class from being copied (As this class owns the mapping) */
+    MappedFile(const MappedFile &) = delete;
+    /** Prevent instances of this class from being copied (As this class owns the mapping) */
+    MappedFile &operator=(const MappedFile &) = delete;
+    /** Unmap the file */
+    ~MappedFile();
+    /** Return true if the file was successfully mapped */
+    bool is_mapped() const
+    {
+        return _data != nullptr;
+    }
+    /** Start of the mapped file */
+    uint8_t *data() const
+    {
+        return _data;
+    }
+    /** Size of the mapped file in bytes */
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    uint8_t *_data;
+    size_t   _size;
+};
+
 /** Numpy data loader */
 class NPYLoader
 {
 public:
     /** Default constructor */
     NPYLoader()
-        : _fs(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
+        : _fs(), _filename(), _data_offset(0), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
     {
     }
 
@@ -338,8 +380,10 @@ public:
             ARM_COMPUTE_EXIT_ON_MSG(!_fs.good(), "Failed to load binary data from %s", npy_filename.c_str());
             _fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
             _file_layout = file_layout;
+            _filename    = npy_filename;
 
             std::tie(_shape, _fortran_order, _typestring) = parse_npy_header(_fs);
+            _data_offset                                  = _fs.tellg();
         }
         catch(const std::ifstream::failure &e)
         {
@@ -403,35 +447,14 @@ public:
             map(tensor, true);
 
             // Check if the file is large enough to fill the tensor
-            const size_t current_position = _fs.tellg();
-            _fs.seekg(0, std::ios_base::end);
-            const size_t end_position = _fs.tellg();
-            _fs.seekg(current_position, std::ios_base::beg);
-
-            ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) < tensor.info()->tensor_shape().total_size() * tensor.info()->element_size(),
-                                     "Not enough data in file");
-            ARM_COMPUTE_UNUSED(end_position);
+            ARM_COMPUTE_ERROR_ON_MSG(data_size() < tensor.info()->tensor_shape().total_size() * tensor.info()->element_size(), "Not enough data in file");
 
             // Check if the typestring matches the given one
             std::string expect_typestr = get_typestring(tensor.info()->data_type());
             ARM_COMPUTE_ERROR_ON_MSG(_typestring != expect_typestr, "Typestrings mismatch");
 
             bool are_layouts_different = (_file_layout != tensor.info()->data_layout());
-            // Correct dimensions (Needs to match TensorShape dimension corrections)
-            if(_shape.size() != tensor.info()->tensor_shape().num_dimensions())
-            {
-                for(int i = static_cast<int>(_shape.size()) - 1; i > 0; --i)
-                {
-                    if(_shape[i] == 1)
-                    {
-                        _shape.pop_back();
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-            }
+            correct_dimensions(*tensor.info());
 
             TensorShape                    permuted_shape = tensor.info()->tensor_shape();
             arm_compute::PermutationVector perm;
@@ -458,11 +481,33 @@ public:
                 case arm_compute::DataType::F16:
                 {
                     // Read data
+                    const bool is_permuted = are_layouts_different && tensor.info()->num_dimensions() > 2;
                     if(!are_layouts_different && !_fortran_order && tensor.info()->padding().empty())
                     {
                         // If tensor has no padding read directly from stream.
                         _fs.read(reinterpret_cast<char *>(tensor.buffer()), tensor.info()->total_size());
                     }
+                    else if(!is_permuted && !_fortran_order)
+                    {
+                        // If tensor has padding read it row by row.
+                        read_rows(tensor);
+                    }
+                    else if(!_fortran_order && tensor.info()->num_dimensions() <= 4)
+                    {
+                        // If the layouts are different read the tensor one 3D slice at a time and transpose it by tiles.
+                        switch(tensor.info()->element_size())
+                        {
+                            case 1:
+                                read_permuted<T, uint8_t>(tensor);
+                                break;
+                            case 2:
+                                read_permuted<T, uint16_t>(tensor);
+                                break;
+                            default:
+                                read_permuted<T, uint32_t>(tensor);
+                                break;
+                        }
+                    }
                     else
                     {
                         // If tensor has padding or is in fortran order accessing tensor elements through execution window.
@@ -516,8 +561,154 @@ public:
         }
     }
 
+    /** Import the content of the currently open NPY file as backing memory of a tensor without copying it
+     *
+     * The file is mapped in memory and the tensor's memory is replaced by the mapped data, which is only possible if
+     * the file is in C order, has the layout, data type and shape of the tensor and if the tensor has no padding.
+     *
+     * @note The mapping must be kept alive as long as the tensor is used.
+     *
+     * @param[in,out] tensor Tensor to import the data into (Must not be part of a memory group).
+     *
+     * @return The mapping of the file if the data was imported, nullptr otherwise (The tensor is left unchanged).
+     */
+    std::shared_ptr<MappedFile> import_tensor(arm_compute::Tensor &tensor)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+
+        const ITensorInfo &info = *tensor.info();
+        correct_dimensions(info);
+
+        const size_t element_size = info.element_size();
+        if(_fortran_order || _file_layout != info.data_layout() || !info.padding().empty() || _typestring != get_typestring(info.data_type())
+           || _shape.size() != info.num_dimensions() || data_size() < info.total_size() || (_data_offset % element_size) != 0)
+        {
+            return nullptr;
+        }
+        for(size_t i = 0; i < _shape.size(); ++i)
+        {
+            if(_shape[i] != info.dimension(i))
+            {
+                return nullptr;
+            }
+        }
+
+        auto mapping = std::make_shared<MappedFile>(_filename);
+        if(!mapping->is_mapped() || !bool(tensor.allocator()->import_memory(mapping->data() + _data_offset)))
+        {
+            return nullptr;
+        }
+        return mapping;
+    }
+
 private:
+    /** Size in bytes of the data following the header of the currently open NPY file */
+    size_t data_size()
+    {
+        const size_t current_position = _fs.tellg();
+        _fs.seekg(0, std::ios_base::end);
+        const size_t end_position = _fs.tellg();
+        _fs.seekg(current_position, std::ios_base::beg);
+        return end_position - _data_offset;
+    }
+
+    /** Drop the trailing dimensions of size 1 of the file (Needs to match TensorShape dimension corrections) */
+    void correct_dimensions(const ITensorInfo &info)
+    {
+        if(_shape.size() != info.tensor_shape().num_dimensions())
+        {
+            for(int i = static_cast<int>(_shape.size()) - 1; i > 0; --i)
+            {
+                if(_shape[i] == 1)
+                {
+                    _shape.pop_back();
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    /** Read a tensor which has the layout of the file, one row at a time */
+    template <typename T>
+    void read_rows(T &tensor)
+    {
+        const size_t row_size = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            _fs.read(reinterpret_cast<char *>(tensor.ptr_to_element(id)), row_size);
+        });
+    }
+
+    /** Read a tensor whose layout differs from the file's
+     *
+     * Each 3D slice is read at once and transposed by tiles: a NCHW slice is a matrix of C rows and W x H columns,
+     * a NHWC slice a matrix of W x H rows and C columns.
+     */
+    template <typename T, typename U>
+    void read_permuted(T &tensor)
+    {
+        const ITensorInfo &info    = *tensor.info();
+        const DataLayout   layout  = info.data_layout();
+        const size_t       idx_w   = get_data_layout_dimension_index(layout, DataLayoutDimension::WIDTH);
+        const size_t       idx_h   = get_data_layout_dimension_index(layout, DataLayoutDimension::HEIGHT);
+        const size_t       idx_c   = get_data_layout_dimension_index(layout, DataLayoutDimension::CHANNEL);
+        const Strides     &strides = info.strides_in_bytes();
+
+        const size_t width        = info.dimension(idx_w);
+        const size_t plane_size   = width * info.dimension(idx_h);
+        const size_t channels     = info.dimension(idx_c);
+        const size_t slice_size   = plane_size * channels;
+        const size_t num_slices   = info.tensor_shape().total_size() / slice_size;
+        const bool   is_nchw_file = (_file_layout == DataLayout::NCHW);
+        const size_t rows         = is_nchw_file ? channels : plane_size;
+        const size_t cols         = is_nchw_file ? plane_size : channels;
+
+        // Offsets in the tensor of the elements of each spatial position
+        std::vector<size_t> plane_offsets(plane_size);
+        for(size_t i = 0; i < plane_size; ++i)
+        {
+            plane_offsets[i] = (i % width) * strides[idx_w] + (i / width) * strides[idx_h];
+        }
+
+        constexpr size_t tile = 16;
+        std::vector<U>   slice(slice_size);
+        for(size_t s = 0; s < num_slices; ++s)
+        {
+            _fs.read(reinterpret_cast<char *>(slice.data()), slice_size * sizeof(U));
+            uint8_t *dst = tensor.buffer() + info.offset_first_element_in_bytes() + s * strides[3];
+
+            for(size_t r0 = 0; r0 < rows; r0 += tile)
+            {
+                const size_t r_end = std::min(r0 + tile, rows);
+                for(size_t c0 = 0; c0 < cols; c0 += tile)
+                {
+                    const size_t c_end = std::min(c0 + tile, cols);
+                    for(size_t r = r0; r < r_end; ++r)
+                    {
+                        const U *src = slice.data() + r * cols;
+                        for(size_t c = c0; c < c_end; ++c)
+                        {
+                            const size_t channel  = is_nchw_file ? r : c;
+                            const size_t position = is_nchw_file ? c : r;
+                            *reinterpret_cast<U *>(dst + channel * strides[idx_c] + plane_offsets[position]) = src[c];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     std::ifstream              _fs;
+    std::string                _filename;
+    size_t                     _data_offset;
     std::vector<unsigned long> _shape;
     bool                       _fortran_order;
     std::string                _typestring;